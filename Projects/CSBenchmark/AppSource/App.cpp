@@ -0,0 +1,58 @@
+//
+//  App.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <App.h>
+
+#include <BenchmarkState.h>
+
+#include <ChilliSource/Core/State.h>
+
+CSCore::Application* CreateApplication()
+{
+    return new CSBenchmark::App();
+}
+
+namespace CSBenchmark
+{
+    void App::CreateSystems()
+    {
+    }
+
+    void App::OnInit()
+    {
+    }
+
+    void App::PushInitialState()
+    {
+        GetStateManager()->Push(CSCore::StateSPtr(new BenchmarkState()));
+    }
+
+    void App::OnDestroy()
+    {
+    }
+}
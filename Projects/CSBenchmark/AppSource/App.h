@@ -1,11 +1,11 @@
 //
-//  Particle.h
-//  Chilli Source
-//  Created by Ian Copland on 07/10/2014.
+//  App.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
 //
 //  The MIT License (MIT)
 //
-//  Copyright (c) 2014 Tag Games Limited
+//  Copyright (c) 2026 Tag Games Limited
 //
 //  Permission is hereby granted, free of charge, to any person obtaining a copy
 //  of this software and associated documentation files (the "Software"), to deal
@@ -26,38 +26,28 @@
 //  THE SOFTWARE.
 //
 
-#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLE_H_
-#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLE_H_
+#ifndef _CSBENCHMARK_APP_H_
+#define _CSBENCHMARK_APP_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base.h>
 
-#include <ChilliSource/Core/Math/Vector3.h>
-#include <ChilliSource/Core/Math/Vector2.h>
-#include <ChilliSource/Core/Math/Quaternion.h>
-#include <ChilliSource/Core/Base/Colour.h>
-
-namespace ChilliSource
+namespace CSBenchmark
 {
-	namespace Rendering
-	{
-		//-----------------------------------------------------------------------
-		/// A struct containing the properties for a single particle.
-		///
-		/// @author Ian Copland
-		//-----------------------------------------------------------------------
-		struct Particle final
-		{
-			bool m_isActive = false;
-			f32 m_lifetime = 0.0f;
-			f32 m_energy = 0.0f;
-			Core::Vector3 m_position;
-            Core::Vector2 m_scale = Core::Vector2::k_one;
-			f32 m_rotation = 0.0f;
-			Core::Colour m_colour = Core::Colour::k_white;
-			Core::Vector3 m_velocity;
-			f32 m_angularVelocity = 0.0f;
-		};
-	}
+    //------------------------------------------------------------------------------
+    /// An application which runs the engine benchmarks and then quits. See
+    /// BenchmarkState for details.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class App final : public CSCore::Application
+    {
+    public:
+        void CreateSystems() override;
+        void OnInit() override;
+        void PushInitialState() override;
+        void OnDestroy() override;
+    };
 }
 
-#endif
\ No newline at end of file
+#endif
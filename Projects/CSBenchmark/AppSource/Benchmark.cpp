@@ -0,0 +1,116 @@
+//
+//  Benchmark.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Benchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CSBenchmark
+{
+    namespace
+    {
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @param The sorted frame times.
+        /// @param The percentile in the range 0 - 100.
+        ///
+        /// @return The nearest rank percentile of the frame times.
+        //------------------------------------------------------------------------------
+        f64 GetPercentile(const std::vector<f64>& in_sortedFrameTimes, f64 in_percentile)
+        {
+            CS_ASSERT(in_sortedFrameTimes.empty() == false, "Cannot get the percentile of no frame times.");
+            
+            f64 rank = std::ceil(in_percentile / 100.0 * f64(in_sortedFrameTimes.size()));
+            std::size_t index = std::size_t(std::max(rank, 1.0)) - 1;
+            return in_sortedFrameTimes[std::min(index, in_sortedFrameTimes.size() - 1)];
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string Benchmark::GetFrameSummary() const
+    {
+        return "";
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string Benchmark::GetRenderFrameSummary()
+    {
+        CSRendering::RenderSystem* renderSystem = CSCore::Application::Get()->GetRenderSystem();
+        if (renderSystem->IsA(CSBackend::Null::RenderSystem::InterfaceID) == false)
+        {
+            return "";
+        }
+        
+        const CSBackend::Null::RenderSystem::FrameStats& stats = static_cast<CSBackend::Null::RenderSystem*>(renderSystem)->GetFrameStats();
+        
+        std::string summary;
+        summary += "passes " + CSCore::ToString(stats.m_numPasses);
+        summary += ", draws " + CSCore::ToString(stats.m_numDrawCalls);
+        summary += ", elements " + CSCore::ToString(stats.m_numElementsDrawn);
+        summary += ", material applies " + CSCore::ToString(stats.m_numMaterialApplies);
+        summary += ", material changes " + CSCore::ToString(stats.m_numMaterialChanges);
+        summary += ", shader changes " + CSCore::ToString(stats.m_numShaderChanges);
+        summary += ", texture binds " + CSCore::ToString(stats.m_numTextureBinds);
+        summary += ", light changes " + CSCore::ToString(stats.m_numLightChanges);
+        summary += ", state changes " + CSCore::ToString(stats.m_numStateChanges);
+        return summary;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    FrameTimeStats CalculateFrameTimeStats(std::vector<f64>& inout_frameTimes)
+    {
+        FrameTimeStats stats;
+        if (inout_frameTimes.empty() == true)
+        {
+            return stats;
+        }
+        
+        std::sort(inout_frameTimes.begin(), inout_frameTimes.end());
+        
+        f64 total = 0.0;
+        for (f64 frameTime : inout_frameTimes)
+        {
+            total += frameTime;
+        }
+        
+        stats.m_mean = total / f64(inout_frameTimes.size());
+        stats.m_p50 = GetPercentile(inout_frameTimes, 50.0);
+        stats.m_p95 = GetPercentile(inout_frameTimes, 95.0);
+        stats.m_p99 = GetPercentile(inout_frameTimes, 99.0);
+        stats.m_max = inout_frameTimes.back();
+        return stats;
+    }
+}
@@ -0,0 +1,138 @@
+//
+//  Benchmark.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_BENCHMARK_H_
+#define _CSBENCHMARK_BENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// A single benchmark scenario. The scenario is set up, a number of frames
+    /// are timed and then it is torn down. Every frame should perform the same
+    /// work so that the frame times can be compared.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class Benchmark
+    {
+    public:
+        CS_DECLARE_NOCOPY(Benchmark);
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        Benchmark() = default;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The name the results of the benchmark are reported under.
+        //------------------------------------------------------------------------------
+        virtual std::string GetName() const = 0;
+        //------------------------------------------------------------------------------
+        /// Creates everything the benchmark needs. This is not timed.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark is run in.
+        //------------------------------------------------------------------------------
+        virtual void SetUp(CSCore::State* in_state) = 0;
+        //------------------------------------------------------------------------------
+        /// Performs a single frame of work. This is timed.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        virtual void RunFrame() = 0;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return A description of the work done in the last frame, for example
+        /// the number of draw calls. This is added to the report and is empty by
+        /// default.
+        //------------------------------------------------------------------------------
+        virtual std::string GetFrameSummary() const;
+        //------------------------------------------------------------------------------
+        /// Destroys everything created in SetUp(). This is not timed.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark was run in.
+        //------------------------------------------------------------------------------
+        virtual void TearDown(CSCore::State* in_state) = 0;
+        //------------------------------------------------------------------------------
+        /// Destructor
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        virtual ~Benchmark() {}
+        
+    protected:
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return A description of the render work done in the last frame. This is
+        /// only available when running on the null render backend, which counts
+        /// the work it is given instead of drawing it. Otherwise this is empty.
+        //------------------------------------------------------------------------------
+        static std::string GetRenderFrameSummary();
+    };
+    
+    typedef std::unique_ptr<Benchmark> BenchmarkUPtr;
+    //------------------------------------------------------------------------------
+    /// The frame times of a benchmark run, in milliseconds. Percentiles use the
+    /// nearest rank.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    struct FrameTimeStats
+    {
+        f64 m_mean = 0.0;
+        f64 m_p50 = 0.0;
+        f64 m_p95 = 0.0;
+        f64 m_p99 = 0.0;
+        f64 m_max = 0.0;
+    };
+    //------------------------------------------------------------------------------
+    /// Calculates the stats for the given frame times.
+    ///
+    /// @author Jordan Brown
+    ///
+    /// @param The frame times in milliseconds. These will be sorted.
+    ///
+    /// @return The frame time stats.
+    //------------------------------------------------------------------------------
+    FrameTimeStats CalculateFrameTimeStats(std::vector<f64>& inout_frameTimes);
+}
+
+#endif
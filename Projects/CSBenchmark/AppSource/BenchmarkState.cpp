@@ -0,0 +1,189 @@
+//
+//  BenchmarkState.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <BenchmarkState.h>
+
+#include <CanvasBenchmark.h>
+#include <DelegateBenchmark.h>
+#include <ParticleBenchmark.h>
+#include <SceneBenchmark.h>
+#include <ShaderUniformBenchmark.h>
+#include <SpriteBatchBenchmark.h>
+#include <ThreadPoolBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Core/Time.h>
+
+namespace CSBenchmark
+{
+    namespace
+    {
+        const u32 k_numWarmUpFrames = 20;
+        const u32 k_numTimedFrames = 200;
+        const std::string k_resultsFilePath = "BenchmarkResults.txt";
+        
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @param A time in milliseconds.
+        ///
+        /// @return The time formatted for the report.
+        //------------------------------------------------------------------------------
+        std::string FormatTime(f64 in_timeMS)
+        {
+            return CSCore::ToString(in_timeMS, 3, 0, ' ', std::ios::fixed) + "ms";
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void BenchmarkState::AddBenchmark(BenchmarkUPtr in_benchmark)
+    {
+        CS_ASSERT(m_nextBenchmark == 0, "Benchmarks cannot be added once they have started running.");
+        m_benchmarks.push_back(std::move(in_benchmark));
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void BenchmarkState::OnInit()
+    {
+        AddBenchmark(BenchmarkUPtr(new SceneBenchmark(1000, 0.0f)));
+        
+        //Large scenes for culling, filtering and sorting. The transparent objects are sorted back to front
+        //rather than by material.
+        AddBenchmark(BenchmarkUPtr(new SceneBenchmark(10000, 0.0f)));
+        AddBenchmark(BenchmarkUPtr(new SceneBenchmark(50000, 0.0f)));
+        AddBenchmark(BenchmarkUPtr(new SceneBenchmark(100000, 0.0f)));
+        AddBenchmark(BenchmarkUPtr(new SceneBenchmark(10000, 0.25f)));
+        AddBenchmark(BenchmarkUPtr(new SceneBenchmark(50000, 0.25f)));
+        AddBenchmark(BenchmarkUPtr(new SceneBenchmark(100000, 0.25f)));
+        //Sprite batching, by sprite data and by material handle, with and without material sorting.
+        AddBenchmark(BenchmarkUPtr(new SpriteBatchBenchmark(20000, 1, SpriteBatchBenchmark::SubmitMode::k_spriteData, false)));
+        AddBenchmark(BenchmarkUPtr(new SpriteBatchBenchmark(20000, 1, SpriteBatchBenchmark::SubmitMode::k_materialHandle, false)));
+        AddBenchmark(BenchmarkUPtr(new SpriteBatchBenchmark(20000, 4, SpriteBatchBenchmark::SubmitMode::k_spriteData, false)));
+        AddBenchmark(BenchmarkUPtr(new SpriteBatchBenchmark(20000, 4, SpriteBatchBenchmark::SubmitMode::k_materialHandle, false)));
+        AddBenchmark(BenchmarkUPtr(new SpriteBatchBenchmark(20000, 4, SpriteBatchBenchmark::SubmitMode::k_materialHandle, true)));
+        
+        AddBenchmark(BenchmarkUPtr(new CanvasBenchmark(500, 200, 0)));
+        AddBenchmark(BenchmarkUPtr(new CanvasBenchmark(500, 200, 50)));
+        
+        //Delegates bound to a member function, which std::function has to allocate for.
+        const DelegateBenchmark::Scenario k_delegateScenarios[] = { DelegateBenchmark::Scenario::k_construct, DelegateBenchmark::Scenario::k_invoke,
+            DelegateBenchmark::Scenario::k_notify, DelegateBenchmark::Scenario::k_connect };
+        for (DelegateBenchmark::Scenario scenario : k_delegateScenarios)
+        {
+            AddBenchmark(BenchmarkUPtr(new DelegateBenchmark(DelegateBenchmark::DelegateType::k_stdFunction, scenario)));
+            AddBenchmark(BenchmarkUPtr(new DelegateBenchmark(DelegateBenchmark::DelegateType::k_inlineDelegate, scenario)));
+        }
+        
+        //Particle simulation with the pool close to full.
+        AddBenchmark(BenchmarkUPtr(new ParticleBenchmark(1000)));
+        AddBenchmark(BenchmarkUPtr(new ParticleBenchmark(10000)));
+        AddBenchmark(BenchmarkUPtr(new ParticleBenchmark(100000)));
+        
+        //The work stealing pool against the single queue pool it replaced.
+        const ThreadPoolBenchmark::Scenario k_threadPoolScenarios[] = { ThreadPoolBenchmark::Scenario::k_schedule, ThreadPoolBenchmark::Scenario::k_parallelFor };
+        for (ThreadPoolBenchmark::Scenario scenario : k_threadPoolScenarios)
+        {
+            AddBenchmark(BenchmarkUPtr(new ThreadPoolBenchmark(ThreadPoolBenchmark::PoolType::k_singleQueue, scenario)));
+            AddBenchmark(BenchmarkUPtr(new ThreadPoolBenchmark(ThreadPoolBenchmark::PoolType::k_workStealing, scenario)));
+        }
+        
+        if (ShaderUniformBenchmark::IsSupported() == true)
+        {
+            AddBenchmark(BenchmarkUPtr(new ShaderUniformBenchmark(ShaderUniformBenchmark::UniformMode::k_byName)));
+            AddBenchmark(BenchmarkUPtr(new ShaderUniformBenchmark(ShaderUniformBenchmark::UniformMode::k_builtInSlot)));
+        }
+        
+        m_report = "Benchmark results (" + CSCore::ToString(k_numTimedFrames) + " frames after " + CSCore::ToString(k_numWarmUpFrames) + " warm up frames)\n";
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void BenchmarkState::OnUpdate(f32 in_deltaTime)
+    {
+        if (m_finished == true)
+        {
+            return;
+        }
+        
+        if (m_nextBenchmark < m_benchmarks.size())
+        {
+            //Results are logged as warnings so that they are still logged in release builds.
+            std::string result = RunBenchmark(m_benchmarks[m_nextBenchmark].get());
+            CS_LOG_WARNING(result);
+            m_report += result + "\n";
+            ++m_nextBenchmark;
+            return;
+        }
+        
+        if (CSCore::Application::Get()->GetFileSystem()->WriteFile(CSCore::StorageLocation::k_saveData, k_resultsFilePath, m_report) == false)
+        {
+            CS_LOG_ERROR("Failed to write the benchmark results to " + k_resultsFilePath);
+        }
+        
+        m_finished = true;
+        CSCore::Application::Get()->Quit();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string BenchmarkState::RunBenchmark(Benchmark* in_benchmark)
+    {
+        in_benchmark->SetUp(this);
+        
+        for (u32 i = 0; i < k_numWarmUpFrames; ++i)
+        {
+            in_benchmark->RunFrame();
+        }
+        
+        std::vector<f64> frameTimes;
+        frameTimes.reserve(k_numTimedFrames);
+        
+        CSCore::PerformanceTimer timer;
+        for (u32 i = 0; i < k_numTimedFrames; ++i)
+        {
+            timer.Start();
+            in_benchmark->RunFrame();
+            timer.Stop();
+            frameTimes.push_back(timer.GetTimeTakenMS());
+        }
+        
+        std::string frameSummary = in_benchmark->GetFrameSummary();
+        in_benchmark->TearDown(this);
+        
+        FrameTimeStats stats = CalculateFrameTimeStats(frameTimes);
+        
+        std::string result = in_benchmark->GetName() + ": mean " + FormatTime(stats.m_mean) + ", p50 " + FormatTime(stats.m_p50) + ", p95 " + FormatTime(stats.m_p95)
+            + ", p99 " + FormatTime(stats.m_p99) + ", max " + FormatTime(stats.m_max);
+        if (frameSummary.empty() == false)
+        {
+            result += " (" + frameSummary + ")";
+        }
+        return result;
+    }
+}
@@ -0,0 +1,101 @@
+//
+//  BenchmarkState.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_BENCHMARKSTATE_H_
+#define _CSBENCHMARK_BENCHMARKSTATE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/State.h>
+
+#include <Benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// Runs each of the benchmarks in turn, one per update. Each benchmark is
+    /// warmed up and then a fixed number of frames are timed back to back. The
+    /// frame time percentiles are logged and written to BenchmarkResults.txt in
+    /// save data, after which the application quits.
+    ///
+    /// The results are most useful on the null render backend, where the frame
+    /// time is the CPU cost of the engine alone and the work submitted each
+    /// frame is reported alongside it.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class BenchmarkState final : public CSCore::State
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// Adds a benchmark to be run. This must be called before the state is
+        /// updated.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The benchmark.
+        //------------------------------------------------------------------------------
+        void AddBenchmark(BenchmarkUPtr in_benchmark);
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// Adds the benchmarks.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void OnInit() override;
+        //------------------------------------------------------------------------------
+        /// Runs the next benchmark, or writes the report and quits if they have
+        /// all been run.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The time since the last update.
+        //------------------------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override;
+        //------------------------------------------------------------------------------
+        /// Runs the given benchmark.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The benchmark.
+        ///
+        /// @return The line reporting the results.
+        //------------------------------------------------------------------------------
+        std::string RunBenchmark(Benchmark* in_benchmark);
+        
+        std::vector<BenchmarkUPtr> m_benchmarks;
+        u32 m_nextBenchmark = 0;
+        std::string m_report;
+        bool m_finished = false;
+    };
+}
+
+#endif
@@ -0,0 +1,139 @@
+//
+//  CanvasBenchmark.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CanvasBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/State.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Rendering/Base.h>
+#include <ChilliSource/Rendering/Texture.h>
+#include <ChilliSource/UI/Base.h>
+#include <ChilliSource/UI/Drawable.h>
+#include <ChilliSource/UI/Text.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    CanvasBenchmark::CanvasBenchmark(u32 in_numImages, u32 in_numLabels, u32 in_numChangingLabels)
+        : m_numImages(in_numImages), m_numLabels(in_numLabels), m_numChangingLabels(in_numChangingLabels)
+    {
+        CS_ASSERT(m_numChangingLabels <= m_numLabels, "There cannot be more changing labels than labels.");
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string CanvasBenchmark::GetName() const
+    {
+        return "Canvas " + CSCore::ToString(m_numImages) + " images, " + CSCore::ToString(m_numLabels) + " labels, " + CSCore::ToString(m_numChangingLabels) + " changing";
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void CanvasBenchmark::SetUp(CSCore::State* in_state)
+    {
+        m_scene = in_state->GetScene();
+        m_canvas = in_state->GetUICanvas();
+        m_frameIndex = 0;
+        
+        CSUI::WidgetFactory* widgetFactory = CSCore::Application::Get()->GetWidgetFactory();
+        CSRendering::TextureCSPtr texture = CSCore::Application::Get()->GetResourcePool()->LoadResource<CSRendering::Texture>(CSCore::StorageLocation::k_chilliSource, "Textures/Blank.csimage");
+        
+        //Lay the widgets out in a grid covering the canvas, images first.
+        const u32 numWidgets = m_numImages + m_numLabels;
+        const u32 gridSize = std::max(u32(std::ceil(std::sqrt(f32(numWidgets)))), 1u);
+        const CSCore::Vector2 cellSize(1.0f / f32(gridSize), 1.0f / f32(gridSize));
+        
+        for (u32 i = 0; i < numWidgets; ++i)
+        {
+            CSUI::WidgetSPtr widget;
+            if (i < m_numImages)
+            {
+                widget = widgetFactory->CreateImage();
+                
+                CSCore::Colour colour(f32(i % 3) * 0.5f, f32(i % 5) * 0.25f, f32(i % 7) / 6.0f, 1.0f);
+                widget->GetComponent<CSUI::DrawableComponent>()->ApplyDrawableDef(CSUI::DrawableDefCSPtr(new CSUI::StandardDrawableDef(texture, CSRendering::UVs(0.0f, 0.0f, 1.0f, 1.0f), colour)));
+            }
+            else
+            {
+                widget = widgetFactory->CreateLabel();
+                
+                u32 labelIndex = i - m_numImages;
+                CSUI::TextComponent* textComponent = widget->GetComponent<CSUI::TextComponent>();
+                textComponent->SetText("Label " + CSCore::ToString(labelIndex));
+                if (labelIndex < m_numChangingLabels)
+                {
+                    m_changingLabels.push_back(textComponent);
+                }
+            }
+            
+            CSCore::Vector2 cell(f32(i % gridSize), f32(i / gridSize));
+            widget->SetRelativeSize(cellSize);
+            widget->SetRelativePosition((cell + CSCore::Vector2(0.5f, 0.5f)) * cellSize - CSCore::Vector2(0.5f, 0.5f));
+            
+            m_canvas->AddWidget(widget);
+            m_widgets.push_back(widget);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void CanvasBenchmark::RunFrame()
+    {
+        ++m_frameIndex;
+        for (u32 i = 0; i < m_changingLabels.size(); ++i)
+        {
+            m_changingLabels[i]->SetText(CSCore::ToString(m_frameIndex * 31 + i));
+        }
+        
+        CSCore::Application::Get()->GetRenderer()->RenderToScreen(m_scene, m_canvas);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string CanvasBenchmark::GetFrameSummary() const
+    {
+        return GetRenderFrameSummary();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void CanvasBenchmark::TearDown(CSCore::State* in_state)
+    {
+        for (const CSUI::WidgetSPtr& widget : m_widgets)
+        {
+            m_canvas->RemoveWidget(widget.get());
+        }
+        
+        m_widgets.clear();
+        m_changingLabels.clear();
+        m_scene = nullptr;
+        m_canvas = nullptr;
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  CanvasBenchmark.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_CANVASBENCHMARK_H_
+#define _CSBENCHMARK_CANVASBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <Benchmark.h>
+
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// Renders a canvas of images and labels with nothing in the scene. Some of
+    /// the labels change their text every frame, while the rest keep the same
+    /// text.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class CanvasBenchmark final : public Benchmark
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The number of image widgets.
+        /// @param The number of label widgets.
+        /// @param The number of the labels which change their text every frame.
+        //------------------------------------------------------------------------------
+        CanvasBenchmark(u32 in_numImages, u32 in_numLabels, u32 in_numChangingLabels);
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The name the results of the benchmark are reported under.
+        //------------------------------------------------------------------------------
+        std::string GetName() const override;
+        //------------------------------------------------------------------------------
+        /// Creates the widgets and adds them to the canvas.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark is run in.
+        //------------------------------------------------------------------------------
+        void SetUp(CSCore::State* in_state) override;
+        //------------------------------------------------------------------------------
+        /// Changes the text of the changing labels and renders the canvas.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrame() override;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The render work done in the last frame.
+        //------------------------------------------------------------------------------
+        std::string GetFrameSummary() const override;
+        //------------------------------------------------------------------------------
+        /// Removes the widgets from the canvas.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark was run in.
+        //------------------------------------------------------------------------------
+        void TearDown(CSCore::State* in_state) override;
+        
+    private:
+        u32 m_numImages;
+        u32 m_numLabels;
+        u32 m_numChangingLabels;
+        u32 m_frameIndex = 0;
+        
+        CSCore::Scene* m_scene = nullptr;
+        CSUI::Canvas* m_canvas = nullptr;
+        std::vector<CSUI::WidgetSPtr> m_widgets;
+        std::vector<CSUI::TextComponent*> m_changingLabels;
+    };
+}
+
+#endif
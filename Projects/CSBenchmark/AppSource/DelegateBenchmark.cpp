@@ -0,0 +1,198 @@
+//
+//  DelegateBenchmark.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <DelegateBenchmark.h>
+
+#include <ChilliSource/Core/Delegate.h>
+#include <ChilliSource/Core/String.h>
+
+namespace CSBenchmark
+{
+    namespace
+    {
+        const u32 k_numDelegates = 10000;
+        const u32 k_numInvokeRounds = 10;
+        const u32 k_numConnections = 1000;
+        const u32 k_numNotifies = 100;
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    DelegateBenchmark::DelegateBenchmark(DelegateType in_delegateType, Scenario in_scenario)
+        : m_delegateType(in_delegateType), m_scenario(in_scenario)
+    {
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string DelegateBenchmark::GetName() const
+    {
+        std::string name = (m_delegateType == DelegateType::k_inlineDelegate) ? "InlineDelegate" : "std::function";
+        switch (m_scenario)
+        {
+            case Scenario::k_construct:
+                return name + " construct";
+            case Scenario::k_invoke:
+                return name + " invoke";
+            case Scenario::k_notify:
+                return name + " event notify";
+            case Scenario::k_connect:
+                return name + " event connect and disconnect";
+        }
+        
+        return name;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void DelegateBenchmark::SetUp(CSCore::State* in_state)
+    {
+        if (m_delegateType == DelegateType::k_inlineDelegate)
+        {
+            SetUp(m_inlineDelegates, m_inlineEvent);
+        }
+        else
+        {
+            SetUp(m_functionDelegates, m_functionEvent);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void DelegateBenchmark::RunFrame()
+    {
+        if (m_delegateType == DelegateType::k_inlineDelegate)
+        {
+            RunFrame(m_inlineDelegates, m_inlineEvent);
+        }
+        else
+        {
+            RunFrame(m_functionDelegates, m_functionEvent);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string DelegateBenchmark::GetFrameSummary() const
+    {
+        switch (m_scenario)
+        {
+            case Scenario::k_construct:
+                return CSCore::ToString(k_numDelegates) + " delegates constructed and destroyed";
+            case Scenario::k_invoke:
+                return CSCore::ToString(k_numDelegates * k_numInvokeRounds) + " calls";
+            case Scenario::k_notify:
+                return CSCore::ToString(k_numNotifies) + " notifies of " + CSCore::ToString(k_numConnections) + " connections";
+            case Scenario::k_connect:
+                return CSCore::ToString(k_numConnections) + " connections opened and closed";
+        }
+        
+        return "";
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void DelegateBenchmark::TearDown(CSCore::State* in_state)
+    {
+        m_connections.clear();
+        m_functionEvent.CloseAllConnections();
+        m_inlineEvent.CloseAllConnections();
+        m_functionDelegates.clear();
+        m_inlineDelegates.clear();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void DelegateBenchmark::BindDelegate(FunctionDelegate& out_delegate)
+    {
+        out_delegate = CSCore::MakeDelegate(this, &DelegateBenchmark::OnValue);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void DelegateBenchmark::BindDelegate(InlineDelegate& out_delegate)
+    {
+        out_delegate = InlineDelegate(this, &DelegateBenchmark::OnValue);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TDelegateType> void DelegateBenchmark::SetUp(std::vector<TDelegateType>& out_delegates, CSCore::Event<TDelegateType>& out_event)
+    {
+        out_delegates.resize(k_numDelegates);
+        for (TDelegateType& delegate : out_delegates)
+        {
+            BindDelegate(delegate);
+        }
+        
+        m_connections.reserve(k_numConnections);
+        if (m_scenario == Scenario::k_notify)
+        {
+            for (u32 i = 0; i < k_numConnections; ++i)
+            {
+                m_connections.push_back(out_event.OpenConnection(out_delegates[i]));
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TDelegateType> void DelegateBenchmark::RunFrame(std::vector<TDelegateType>& inout_delegates, CSCore::Event<TDelegateType>& inout_event)
+    {
+        switch (m_scenario)
+        {
+            case Scenario::k_construct:
+                inout_delegates.clear();
+                for (u32 i = 0; i < k_numDelegates; ++i)
+                {
+                    inout_delegates.emplace_back();
+                    BindDelegate(inout_delegates.back());
+                }
+                break;
+            case Scenario::k_invoke:
+                for (u32 round = 0; round < k_numInvokeRounds; ++round)
+                {
+                    for (u32 i = 0; i < inout_delegates.size(); ++i)
+                    {
+                        inout_delegates[i](i);
+                    }
+                }
+                break;
+            case Scenario::k_notify:
+                for (u32 i = 0; i < k_numNotifies; ++i)
+                {
+                    inout_event.NotifyConnections(i);
+                }
+                break;
+            case Scenario::k_connect:
+                for (u32 i = 0; i < k_numConnections; ++i)
+                {
+                    m_connections.push_back(inout_event.OpenConnection(inout_delegates[i]));
+                }
+                m_connections.clear();
+                break;
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void DelegateBenchmark::OnValue(u32 in_value)
+    {
+        m_total += in_value;
+    }
+}
@@ -0,0 +1,178 @@
+//
+//  DelegateBenchmark.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_DELEGATEBENCHMARK_H_
+#define _CSBENCHMARK_DELEGATEBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
+#include <ChilliSource/Core/Event/Event.h>
+#include <ChilliSource/Core/Event/EventConnection.h>
+
+#include <Benchmark.h>
+
+#include <functional>
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// Compares InlineDelegate with std::function, bound to a member function,
+    /// when constructing delegates, invoking them, notifying an event with many
+    /// connections, and opening and closing event connections.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class DelegateBenchmark final : public Benchmark
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// The delegate types which can be benchmarked.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        enum class DelegateType
+        {
+            k_stdFunction,
+            k_inlineDelegate
+        };
+        //------------------------------------------------------------------------------
+        /// The work done each frame.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        enum class Scenario
+        {
+            k_construct,
+            k_invoke,
+            k_notify,
+            k_connect
+        };
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The delegate type.
+        /// @param The work done each frame.
+        //------------------------------------------------------------------------------
+        DelegateBenchmark(DelegateType in_delegateType, Scenario in_scenario);
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The name the results of the benchmark are reported under.
+        //------------------------------------------------------------------------------
+        std::string GetName() const override;
+        //------------------------------------------------------------------------------
+        /// Creates the delegates and connections which are not created each frame.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark is run in.
+        //------------------------------------------------------------------------------
+        void SetUp(CSCore::State* in_state) override;
+        //------------------------------------------------------------------------------
+        /// Performs the work for the scenario.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrame() override;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The amount of work done each frame.
+        //------------------------------------------------------------------------------
+        std::string GetFrameSummary() const override;
+        //------------------------------------------------------------------------------
+        /// Destroys the delegates and closes the connections.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark was run in.
+        //------------------------------------------------------------------------------
+        void TearDown(CSCore::State* in_state) override;
+        
+    private:
+        typedef std::function<void(u32)> FunctionDelegate;
+        typedef CSCore::InlineDelegate<void(u32)> InlineDelegate;
+        //------------------------------------------------------------------------------
+        /// Binds the given delegate to OnValue().
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param [Out] The delegate.
+        //------------------------------------------------------------------------------
+        void BindDelegate(FunctionDelegate& out_delegate);
+        //------------------------------------------------------------------------------
+        /// Binds the given delegate to OnValue().
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param [Out] The delegate.
+        //------------------------------------------------------------------------------
+        void BindDelegate(InlineDelegate& out_delegate);
+        //------------------------------------------------------------------------------
+        /// Creates the delegates and connections which are not created each frame.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param [Out] The delegates.
+        /// @param [Out] The event.
+        //------------------------------------------------------------------------------
+        template <typename TDelegateType> void SetUp(std::vector<TDelegateType>& out_delegates, CSCore::Event<TDelegateType>& out_event);
+        //------------------------------------------------------------------------------
+        /// Performs the work for the scenario.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param [In/Out] The delegates.
+        /// @param [In/Out] The event.
+        //------------------------------------------------------------------------------
+        template <typename TDelegateType> void RunFrame(std::vector<TDelegateType>& inout_delegates, CSCore::Event<TDelegateType>& inout_event);
+        //------------------------------------------------------------------------------
+        /// The function all of the delegates are bound to.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param A value to accumulate.
+        //------------------------------------------------------------------------------
+        void OnValue(u32 in_value);
+        
+        DelegateType m_delegateType;
+        Scenario m_scenario;
+        u64 m_total = 0;
+        
+        std::vector<FunctionDelegate> m_functionDelegates;
+        std::vector<InlineDelegate> m_inlineDelegates;
+        CSCore::Event<FunctionDelegate> m_functionEvent;
+        CSCore::Event<InlineDelegate> m_inlineEvent;
+        std::vector<CSCore::EventConnectionUPtr> m_connections;
+    };
+}
+
+#endif
@@ -0,0 +1,190 @@
+//
+//  ParticleBenchmark.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ParticleBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Rendering/Particle.h>
+
+namespace CSBenchmark
+{
+    namespace
+    {
+        const f32 k_frameTime = 1.0f / 60.0f;
+        const f32 k_effectDuration = 5.0f;
+        const f32 k_minLifetime = 1.5f;
+        const f32 k_maxLifetime = 2.5f;
+        
+        //Particles are emitted a little faster than they expire, so the pool stays close to full.
+        const f32 k_emissionRateScale = 1.1f;
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    ParticleBenchmark::ParticleBenchmark(u32 in_numParticles)
+        : m_numParticles(in_numParticles)
+    {
+        CS_ASSERT(m_numParticles > 0, "A particle benchmark needs at least one particle.");
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string ParticleBenchmark::GetName() const
+    {
+        return "Particles " + CSCore::ToString(m_numParticles) + " per effect";
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ParticleBenchmark::SetUp(CSCore::State* in_state)
+    {
+        //Resources are kept by the pool after tear down, so the effect is only created once.
+        if (m_particleEffect == nullptr)
+        {
+            m_particleEffect = CreateParticleEffect();
+        }
+        
+        m_particlePool = std::unique_ptr<CSRendering::ParticlePool>(new CSRendering::ParticlePool(m_numParticles));
+        m_concurrentParticleData = std::unique_ptr<CSRendering::ConcurrentParticleData>(new CSRendering::ConcurrentParticleData(m_numParticles));
+        m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(m_particlePool.get());
+        for (const auto& affectorDef : m_particleEffect->GetAffectorDefs())
+        {
+            m_affectors.push_back(affectorDef->CreateInstance(m_particlePool.get()));
+        }
+        
+        m_playbackTime = 0.0f;
+        m_firstFrame = true;
+        
+        const u32 numFillFrames = u32(k_maxLifetime / k_frameTime) + 1;
+        for (u32 i = 0; i < numFillFrames; ++i)
+        {
+            RunFrame();
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ParticleBenchmark::RunFrame()
+    {
+        m_playbackTime += k_frameTime;
+        while (m_playbackTime >= m_particleEffect->GetDuration())
+        {
+            m_playbackTime -= m_particleEffect->GetDuration();
+        }
+        
+        m_concurrentParticleData->AcquireLatestData();
+        m_concurrentParticleData->StartUpdate();
+        
+        f32* energies = m_particlePool->GetEnergies();
+        u32 particleIndex = 0;
+        while (particleIndex < m_particlePool->GetNumActiveParticles())
+        {
+            energies[particleIndex] -= k_frameTime;
+            if (energies[particleIndex] > 0.0f)
+            {
+                ++particleIndex;
+            }
+            else
+            {
+                u32 movedFromIndex = m_particlePool->DeactivateParticle(particleIndex);
+                if (movedFromIndex != particleIndex)
+                {
+                    for (auto& affector : m_affectors)
+                    {
+                        affector->MoveParticle(movedFromIndex, particleIndex);
+                    }
+                }
+            }
+        }
+        
+        m_particlePool->IntegrateParticles(k_frameTime);
+        
+        const f32 effectProgress = m_playbackTime / m_particleEffect->GetDuration();
+        for (auto& affector : m_affectors)
+        {
+            affector->AffectParticles(k_frameTime, effectProgress);
+        }
+        
+        std::vector<u32> newIndices = m_emitter->TryEmit(m_playbackTime, CSCore::Vector3::k_zero, CSCore::Vector3::k_one, CSCore::Quaternion::k_identity, m_firstFrame == false);
+        for (u32 newIndex : newIndices)
+        {
+            for (auto& affector : m_affectors)
+            {
+                affector->ActivateParticle(newIndex, effectProgress);
+            }
+        }
+        m_firstFrame = false;
+        
+        m_concurrentParticleData->CommitParticleData(m_particlePool.get(), newIndices, CSCore::AABB(), CSCore::Sphere());
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string ParticleBenchmark::GetFrameSummary() const
+    {
+        return CSCore::ToString(m_particlePool->GetNumActiveParticles()) + " active particles";
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ParticleBenchmark::TearDown(CSCore::State* in_state)
+    {
+        m_affectors.clear();
+        m_emitter.reset();
+        m_concurrentParticleData.reset();
+        m_particlePool.reset();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    CSRendering::ParticleEffectCSPtr ParticleBenchmark::CreateParticleEffect() const
+    {
+        CSRendering::ParticleEffectSPtr particleEffect = CSCore::Application::Get()->GetResourcePool()->CreateResource<CSRendering::ParticleEffect>(GetName());
+        particleEffect->SetDuration(k_effectDuration);
+        particleEffect->SetMaxParticles(m_numParticles);
+        particleEffect->SetLifetimeProperty(CSRendering::ParticlePropertyUPtr<f32>(new CSRendering::RandomConstantParticleProperty<f32>(k_minLifetime, k_maxLifetime)));
+        particleEffect->SetInitialSpeedProperty(CSRendering::ParticlePropertyUPtr<f32>(new CSRendering::RandomConstantParticleProperty<f32>(1.0f, 3.0f)));
+        particleEffect->SetInitialAngularVelocityProperty(CSRendering::ParticlePropertyUPtr<f32>(new CSRendering::RandomConstantParticleProperty<f32>(-1.0f, 1.0f)));
+        
+        const f32 emissionRate = k_emissionRateScale * f32(m_numParticles) * 2.0f / (k_minLifetime + k_maxLifetime);
+        particleEffect->SetEmitterDef(CSRendering::ParticleEmitterDefUPtr(new CSRendering::PointParticleEmitterDef(CSRendering::ParticleEmitterDef::EmissionMode::k_stream,
+            CSRendering::ParticlePropertyUPtr<f32>(new CSRendering::ConstantParticleProperty<f32>(emissionRate)), CSRendering::ParticlePropertyUPtr<u32>(new CSRendering::ConstantParticleProperty<u32>(1)),
+            CSRendering::ParticlePropertyUPtr<f32>(new CSRendering::ConstantParticleProperty<f32>(1.0f)))));
+        
+        std::vector<CSRendering::ParticleAffectorDefUPtr> affectorDefs;
+        affectorDefs.push_back(CSRendering::ParticleAffectorDefUPtr(new CSRendering::AccelerationParticleAffectorDef(
+            CSRendering::ParticlePropertyUPtr<CSCore::Vector3>(new CSRendering::ConstantParticleProperty<CSCore::Vector3>(CSCore::Vector3(0.0f, -9.8f, 0.0f))))));
+        affectorDefs.push_back(CSRendering::ParticleAffectorDefUPtr(new CSRendering::AngularAccelerationParticleAffectorDef(
+            CSRendering::ParticlePropertyUPtr<f32>(new CSRendering::ConstantParticleProperty<f32>(0.5f)))));
+        affectorDefs.push_back(CSRendering::ParticleAffectorDefUPtr(new CSRendering::ColourOverLifetimeParticleAffectorDef(
+            CSRendering::ParticlePropertyUPtr<CSCore::Colour>(new CSRendering::ConstantParticleProperty<CSCore::Colour>(CSCore::Colour(1.0f, 1.0f, 1.0f, 0.0f))))));
+        affectorDefs.push_back(CSRendering::ParticleAffectorDefUPtr(new CSRendering::ScaleOverLifetimeParticleAffectorDef(
+            CSRendering::ParticlePropertyUPtr<CSCore::Vector2>(new CSRendering::ConstantParticleProperty<CSCore::Vector2>(CSCore::Vector2(0.25f, 0.25f))))));
+        particleEffect->SetAffectorDefs(std::move(affectorDefs));
+        
+        particleEffect->SetLoadState(CSCore::Resource::LoadState::k_loaded);
+        return particleEffect;
+    }
+}
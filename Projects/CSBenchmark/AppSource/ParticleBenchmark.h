@@ -0,0 +1,120 @@
+//
+//  ParticleBenchmark.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_PARTICLEBENCHMARK_H_
+#define _CSBENCHMARK_PARTICLEBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <Benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// Simulates a single streaming particle effect with acceleration, angular
+    /// acceleration, colour and scale affectors, with the pool kept close to
+    /// full. Each frame performs the same steps as a particle effect component's
+    /// background update: expiring particles, integrating, applying affectors,
+    /// emitting and committing the particles for rendering. These are run on the
+    /// calling thread so that the frame time covers the whole update.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class ParticleBenchmark final : public Benchmark
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The maximum number of particles in the effect.
+        //------------------------------------------------------------------------------
+        ParticleBenchmark(u32 in_numParticles);
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The name the results of the benchmark are reported under.
+        //------------------------------------------------------------------------------
+        std::string GetName() const override;
+        //------------------------------------------------------------------------------
+        /// Creates the particle effect and its instances, then simulates until the
+        /// pool has filled.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark is run in.
+        //------------------------------------------------------------------------------
+        void SetUp(CSCore::State* in_state) override;
+        //------------------------------------------------------------------------------
+        /// Updates the particles by one frame.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrame() override;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The number of active particles after the last frame.
+        //------------------------------------------------------------------------------
+        std::string GetFrameSummary() const override;
+        //------------------------------------------------------------------------------
+        /// Destroys the particle pool and the emitter and affector instances.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark was run in.
+        //------------------------------------------------------------------------------
+        void TearDown(CSCore::State* in_state) override;
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// Creates the particle effect resource.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @return The new particle effect.
+        //------------------------------------------------------------------------------
+        CSRendering::ParticleEffectCSPtr CreateParticleEffect() const;
+        
+        u32 m_numParticles;
+        f32 m_playbackTime = 0.0f;
+        bool m_firstFrame = true;
+        
+        CSRendering::ParticleEffectCSPtr m_particleEffect;
+        std::unique_ptr<CSRendering::ParticlePool> m_particlePool;
+        std::unique_ptr<CSRendering::ConcurrentParticleData> m_concurrentParticleData;
+        CSRendering::ParticleEmitterUPtr m_emitter;
+        std::vector<CSRendering::ParticleAffectorUPtr> m_affectors;
+    };
+}
+
+#endif
@@ -0,0 +1,259 @@
+//
+//  SceneBenchmark.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <SceneBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Entity.h>
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/Scene.h>
+#include <ChilliSource/Core/State.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Rendering/Base.h>
+#include <ChilliSource/Rendering/Camera.h>
+#include <ChilliSource/Rendering/Lighting.h>
+#include <ChilliSource/Rendering/Material.h>
+#include <ChilliSource/Rendering/Model.h>
+#include <ChilliSource/Rendering/Texture.h>
+
+#include <cmath>
+
+namespace CSBenchmark
+{
+    namespace
+    {
+        const u32 k_numMaterials = 8;
+        const f32 k_objectSpacing = 3.0f;
+        const f32 k_cameraRotationPerFrame = 0.02f;
+        
+        //------------------------------------------------------------------------------
+        /// The layout of a mesh vertex, matching VertexLayout::kMesh.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        struct MeshVertex
+        {
+            CSCore::Vector4 m_position;
+            CSCore::Vector3 m_normal;
+            CSCore::Vector2 m_uv;
+        };
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    SceneBenchmark::SceneBenchmark(u32 in_numObjects, f32 in_transparentFraction)
+        : m_numObjects(in_numObjects), m_transparentFraction(in_transparentFraction)
+    {
+        CS_ASSERT(m_numObjects > 0, "A scene benchmark needs at least one object.");
+        CS_ASSERT(m_transparentFraction >= 0.0f && m_transparentFraction <= 1.0f, "The transparent fraction must be in the range 0 - 1.");
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string SceneBenchmark::GetName() const
+    {
+        std::string name = "Scene " + CSCore::ToString(m_numObjects) + " objects";
+        if (m_transparentFraction > 0.0f)
+        {
+            name += ", " + CSCore::ToString(u32(m_transparentFraction * 100.0f + 0.5f)) + "% transparent";
+        }
+        return name;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SceneBenchmark::SetUp(CSCore::State* in_state)
+    {
+        m_scene = in_state->GetScene();
+        m_canvas = in_state->GetUICanvas();
+        
+        CSCore::ResourcePool* resourcePool = CSCore::Application::Get()->GetResourcePool();
+        CSRendering::MaterialFactory* materialFactory = CSCore::Application::Get()->GetSystem<CSRendering::MaterialFactory>();
+        CSRendering::RenderComponentFactory* renderComponentFactory = CSCore::Application::Get()->GetSystem<CSRendering::RenderComponentFactory>();
+        
+        //Resources are kept by the pool after tear down, so they are named after the benchmark to keep them unique.
+        if (m_mesh == nullptr)
+        {
+            m_mesh = CreateBoxMesh();
+            
+            CSRendering::TextureCSPtr texture = resourcePool->LoadResource<CSRendering::Texture>(CSCore::StorageLocation::k_chilliSource, "Textures/Blank.csimage");
+            for (u32 i = 0; i < k_numMaterials; ++i)
+            {
+                CSRendering::MaterialSPtr opaqueMaterial = materialFactory->CreateStatic(GetName() + " Opaque " + CSCore::ToString(i), texture);
+                m_materials.push_back(opaqueMaterial);
+            }
+            for (u32 i = 0; i < k_numMaterials; ++i)
+            {
+                CSRendering::MaterialSPtr transparentMaterial = materialFactory->CreateStatic(GetName() + " Transparent " + CSCore::ToString(i), texture);
+                transparentMaterial->SetTransparencyEnabled(true);
+                m_materials.push_back(transparentMaterial);
+            }
+        }
+        
+        //Lay the objects out in a cube around the camera. Transparent objects are spread evenly through it.
+        const u32 gridSize = u32(std::ceil(std::pow(f64(m_numObjects), 1.0 / 3.0)));
+        const f32 gridOffset = f32(gridSize - 1) * k_objectSpacing * 0.5f;
+        const u32 numTransparent = u32(f32(m_numObjects) * m_transparentFraction);
+        
+        u32 transparentAccumulator = 0;
+        for (u32 i = 0; i < m_numObjects; ++i)
+        {
+            transparentAccumulator += numTransparent;
+            bool transparent = (transparentAccumulator >= m_numObjects);
+            if (transparent == true)
+            {
+                transparentAccumulator -= m_numObjects;
+            }
+            
+            u32 materialIndex = (i % k_numMaterials) + (transparent ? k_numMaterials : 0);
+            
+            CSCore::EntitySPtr entity = CSCore::Entity::Create();
+            entity->AddComponent(renderComponentFactory->CreateStaticMeshComponent(m_mesh, m_materials[materialIndex]));
+            
+            CSCore::Vector3 position(f32(i % gridSize), f32((i / gridSize) % gridSize), f32(i / (gridSize * gridSize)));
+            entity->GetTransform().SetPosition(position * k_objectSpacing - CSCore::Vector3(gridOffset, gridOffset, gridOffset));
+            m_scene->Add(entity);
+        }
+        
+        CSCore::EntitySPtr ambientLightEntity = CSCore::Entity::Create();
+        ambientLightEntity->AddComponent(renderComponentFactory->CreateAmbientLightComponent());
+        m_scene->Add(ambientLightEntity);
+        
+        CSCore::EntitySPtr directionalLightEntity = CSCore::Entity::Create();
+        directionalLightEntity->AddComponent(renderComponentFactory->CreateDirectionalLightComponent());
+        directionalLightEntity->GetTransform().SetLookAt(CSCore::Vector3::k_zero, CSCore::Vector3(1.0f, -2.0f, 1.0f), CSCore::Vector3::k_unitPositiveY);
+        m_scene->Add(directionalLightEntity);
+        
+        m_cameraEntity = CSCore::Entity::Create();
+        m_cameraEntity->AddComponent(renderComponentFactory->CreatePerspectiveCameraComponent(CSCore::MathUtils::k_pi / 3.0f, 1.0f, gridOffset * 2.0f + 10.0f));
+        m_scene->Add(m_cameraEntity);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SceneBenchmark::RunFrame()
+    {
+        m_cameraEntity->GetTransform().RotateYBy(k_cameraRotationPerFrame);
+        CSCore::Application::Get()->GetRenderer()->RenderToScreen(m_scene, m_canvas);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string SceneBenchmark::GetFrameSummary() const
+    {
+        return GetRenderFrameSummary();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SceneBenchmark::TearDown(CSCore::State* in_state)
+    {
+        in_state->GetScene()->RemoveAllEntities();
+        
+        m_cameraEntity.reset();
+        m_scene = nullptr;
+        m_canvas = nullptr;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    CSRendering::MeshCSPtr SceneBenchmark::CreateBoxMesh() const
+    {
+        const u32 k_numFaces = 6;
+        const CSCore::Vector3 k_faceNormals[k_numFaces] =
+        {
+            CSCore::Vector3::k_unitPositiveX, CSCore::Vector3::k_unitNegativeX,
+            CSCore::Vector3::k_unitPositiveY, CSCore::Vector3::k_unitNegativeY,
+            CSCore::Vector3::k_unitPositiveZ, CSCore::Vector3::k_unitNegativeZ
+        };
+        const CSCore::Vector3 k_faceTangents[k_numFaces] =
+        {
+            CSCore::Vector3::k_unitPositiveZ, CSCore::Vector3::k_unitNegativeZ,
+            CSCore::Vector3::k_unitPositiveX, CSCore::Vector3::k_unitNegativeX,
+            CSCore::Vector3::k_unitNegativeX, CSCore::Vector3::k_unitPositiveX
+        };
+        const CSCore::Vector2 k_cornerUVs[4] = { CSCore::Vector2(0.0f, 0.0f), CSCore::Vector2(1.0f, 0.0f), CSCore::Vector2(1.0f, 1.0f), CSCore::Vector2(0.0f, 1.0f) };
+        
+        const u32 numVertices = k_numFaces * 4;
+        const u32 numIndices = k_numFaces * 6;
+        MeshVertex* vertices = new MeshVertex[numVertices];
+        u16* indices = new u16[numIndices];
+        
+        for (u32 face = 0; face < k_numFaces; ++face)
+        {
+            const CSCore::Vector3& normal = k_faceNormals[face];
+            const CSCore::Vector3& tangent = k_faceTangents[face];
+            CSCore::Vector3 bitangent = CSCore::Vector3::CrossProduct(normal, tangent);
+            
+            for (u32 corner = 0; corner < 4; ++corner)
+            {
+                const CSCore::Vector2& uv = k_cornerUVs[corner];
+                CSCore::Vector3 position = (normal + tangent * (uv.x * 2.0f - 1.0f) + bitangent * (uv.y * 2.0f - 1.0f)) * 0.5f;
+                
+                MeshVertex& vertex = vertices[face * 4 + corner];
+                vertex.m_position = CSCore::Vector4(position, 1.0f);
+                vertex.m_normal = normal;
+                vertex.m_uv = uv;
+            }
+            
+            const u16 firstVertex = u16(face * 4);
+            const u16 faceIndices[6] = { 0, 1, 2, 0, 2, 3 };
+            for (u32 index = 0; index < 6; ++index)
+            {
+                indices[face * 6 + index] = firstVertex + faceIndices[index];
+            }
+        }
+        
+        CSRendering::SubMeshDescriptor subMeshDesc;
+        subMeshDesc.mstrName = "Box";
+        subMeshDesc.mudwNumVertices = numVertices;
+        subMeshDesc.mudwNumIndices = numIndices;
+        subMeshDesc.mvMinBounds = CSCore::Vector3(-0.5f, -0.5f, -0.5f);
+        subMeshDesc.mvMaxBounds = CSCore::Vector3(0.5f, 0.5f, 0.5f);
+        subMeshDesc.mpVertexData = reinterpret_cast<u8*>(vertices);
+        subMeshDesc.mpIndexData = reinterpret_cast<u8*>(indices);
+        subMeshDesc.ePrimitiveType = CSRendering::PrimitiveType::k_tri;
+        
+        CSRendering::MeshDescriptor meshDesc;
+        meshDesc.mFeatures.mbHasTexture = true;
+        meshDesc.mFeatures.mbHasMaterial = false;
+        meshDesc.mFeatures.mbHasAnimationData = false;
+        meshDesc.mVertexDeclaration = CSRendering::VertexLayout::kMesh;
+        meshDesc.mudwIndexSize = sizeof(u16);
+        meshDesc.mvMinBounds = subMeshDesc.mvMinBounds;
+        meshDesc.mvMaxBounds = subMeshDesc.mvMaxBounds;
+        meshDesc.mMeshes.push_back(subMeshDesc);
+        
+        CSRendering::MeshSPtr mesh = CSCore::Application::Get()->GetResourcePool()->CreateResource<CSRendering::Mesh>(GetName() + " Box");
+        if (mesh->Build(meshDesc) == false)
+        {
+            CS_LOG_FATAL("Failed to build the box mesh.");
+        }
+        mesh->SetLoadState(CSCore::Resource::LoadState::k_loaded);
+        
+        delete[] vertices;
+        delete[] indices;
+        
+        return mesh;
+    }
+}
@@ -0,0 +1,117 @@
+//
+//  SceneBenchmark.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_SCENEBENCHMARK_H_
+#define _CSBENCHMARK_SCENEBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <Benchmark.h>
+
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// Renders a grid of static meshes, which share a small number of materials,
+    /// with an ambient and a directional light. The camera sits in the middle
+    /// of the grid and turns a little each frame, so culling, sorting and
+    /// recording all have to be redone every frame.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class SceneBenchmark final : public Benchmark
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The number of meshes in the scene.
+        /// @param The fraction of the meshes, in the range 0 - 1, which are
+        /// transparent and so are sorted back to front.
+        //------------------------------------------------------------------------------
+        SceneBenchmark(u32 in_numObjects, f32 in_transparentFraction);
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The name the results of the benchmark are reported under.
+        //------------------------------------------------------------------------------
+        std::string GetName() const override;
+        //------------------------------------------------------------------------------
+        /// Creates the mesh, materials and entities.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark is run in.
+        //------------------------------------------------------------------------------
+        void SetUp(CSCore::State* in_state) override;
+        //------------------------------------------------------------------------------
+        /// Turns the camera and renders the scene.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrame() override;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The render work done in the last frame.
+        //------------------------------------------------------------------------------
+        std::string GetFrameSummary() const override;
+        //------------------------------------------------------------------------------
+        /// Removes all entities from the scene.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark was run in.
+        //------------------------------------------------------------------------------
+        void TearDown(CSCore::State* in_state) override;
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// Creates a unit cube mesh.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @return The new mesh.
+        //------------------------------------------------------------------------------
+        CSRendering::MeshCSPtr CreateBoxMesh() const;
+        
+        u32 m_numObjects;
+        f32 m_transparentFraction;
+        
+        CSCore::Scene* m_scene = nullptr;
+        CSUI::Canvas* m_canvas = nullptr;
+        CSCore::EntitySPtr m_cameraEntity;
+        CSRendering::MeshCSPtr m_mesh;
+        std::vector<CSRendering::MaterialCSPtr> m_materials;
+    };
+}
+
+#endif
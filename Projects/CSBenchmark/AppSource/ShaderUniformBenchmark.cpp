@@ -0,0 +1,254 @@
+//
+//  ShaderUniformBenchmark.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ShaderUniformBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Rendering/Base.h>
+#include <ChilliSource/Rendering/Shader.h>
+
+#ifdef CS_TARGETPLATFORM_WINDOWS
+#include <CSBackend/Rendering/OpenGL/Base/RenderSystem.h>
+#include <CSBackend/Rendering/OpenGL/Shader/Shader.h>
+#endif
+
+namespace CSBenchmark
+{
+#ifdef CS_TARGETPLATFORM_WINDOWS
+    namespace
+    {
+        const u32 k_numDraws = 10000;
+        const u32 k_drawsPerMaterial = 10;
+        
+        //Every uniform the shader declares has to be used, otherwise the GLSL compiler may remove it.
+        const std::string k_vertexShader =
+            "attribute vec4 a_position;\n"
+            "attribute vec3 a_normal;\n"
+            "uniform mat4 u_wvpMat;\n"
+            "uniform mat4 u_worldMat;\n"
+            "uniform mat4 u_normalMat;\n"
+            "uniform mat4 u_lightMat;\n"
+            "uniform vec3 u_cameraPos;\n"
+            "uniform vec3 u_lightPos;\n"
+            "varying vec4 v_colour;\n"
+            "void main()\n"
+            "{\n"
+            "    vec4 worldPos = u_worldMat * a_position;\n"
+            "    vec3 normal = (u_normalMat * vec4(a_normal, 0.0)).xyz;\n"
+            "    v_colour = vec4(normal * dot(u_cameraPos - worldPos.xyz, u_lightPos), 1.0) + u_lightMat * worldPos;\n"
+            "    gl_Position = u_wvpMat * a_position;\n"
+            "}\n";
+        const std::string k_fragmentShader =
+            "uniform vec4 u_lightCol;\n"
+            "uniform vec3 u_lightDir;\n"
+            "varying vec4 v_colour;\n"
+            "void main()\n"
+            "{\n"
+            "    gl_FragColor = v_colour * u_lightCol + vec4(u_lightDir, 0.0);\n"
+            "}\n";
+        
+        u32 g_numUploads = 0;
+        
+        PFNGLUNIFORM1IPROC g_uniform1i = nullptr;
+        PFNGLUNIFORM1FPROC g_uniform1f = nullptr;
+        PFNGLUNIFORM3FVPROC g_uniform3fv = nullptr;
+        PFNGLUNIFORM4FVPROC g_uniform4fv = nullptr;
+        PFNGLUNIFORMMATRIX4FVPROC g_uniformMatrix4fv = nullptr;
+        
+        void GLAPIENTRY CountUniform1i(GLint, GLint)
+        {
+            ++g_numUploads;
+        }
+        void GLAPIENTRY CountUniform1f(GLint, GLfloat)
+        {
+            ++g_numUploads;
+        }
+        void GLAPIENTRY CountUniform3fv(GLint, GLsizei, const GLfloat*)
+        {
+            ++g_numUploads;
+        }
+        void GLAPIENTRY CountUniform4fv(GLint, GLsizei, const GLfloat*)
+        {
+            ++g_numUploads;
+        }
+        void GLAPIENTRY CountUniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat*)
+        {
+            ++g_numUploads;
+        }
+    }
+#endif
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool ShaderUniformBenchmark::IsSupported()
+    {
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        return CSCore::Application::Get()->GetRenderSystem()->IsA(CSBackend::OpenGL::RenderSystem::InterfaceID);
+#else
+        return false;
+#endif
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    ShaderUniformBenchmark::ShaderUniformBenchmark(UniformMode in_uniformMode)
+        : m_uniformMode(in_uniformMode)
+    {
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string ShaderUniformBenchmark::GetName() const
+    {
+        return (m_uniformMode == UniformMode::k_builtInSlot) ? "Shader uniforms by built-in slot" : "Shader uniforms by name";
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ShaderUniformBenchmark::SetUp(CSCore::State* in_state)
+    {
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        //The shader is only used by this benchmark, so its cached uniform values don't need to match what GL
+        //was actually given while the stubs are installed.
+        if (m_shader == nullptr)
+        {
+            m_shader = CSCore::Application::Get()->GetResourcePool()->CreateResource<CSRendering::Shader>(GetName());
+            static_cast<CSBackend::OpenGL::Shader*>(m_shader.get())->Build(k_vertexShader, k_fragmentShader);
+            m_shader->SetLoadState(CSCore::Resource::LoadState::k_loaded);
+        }
+        
+        CSCore::Matrix4 viewProj = CSCore::Matrix4::CreateLookAt(CSCore::Vector3(0.0f, 10.0f, -10.0f), CSCore::Vector3::k_zero, CSCore::Vector3::k_unitPositiveY)
+            * CSCore::Matrix4::CreatePerspectiveProjectionLH(CSCore::MathUtils::k_pi / 3.0f, 1.0f, 1.0f, 100.0f);
+        
+        m_worldMatrices.resize(k_numDraws);
+        m_wvpMatrices.resize(k_numDraws);
+        m_normalMatrices.resize(k_numDraws);
+        for (u32 i = 0; i < k_numDraws; ++i)
+        {
+            m_worldMatrices[i] = CSCore::Matrix4::CreateTranslation(f32(i % 100), 0.0f, f32(i / 100));
+            m_wvpMatrices[i] = m_worldMatrices[i] * viewProj;
+            m_normalMatrices[i] = CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(m_worldMatrices[i]));
+        }
+        
+        g_uniform1i = glUniform1i;
+        g_uniform1f = glUniform1f;
+        g_uniform3fv = glUniform3fv;
+        g_uniform4fv = glUniform4fv;
+        g_uniformMatrix4fv = glUniformMatrix4fv;
+        
+        glUniform1i = &CountUniform1i;
+        glUniform1f = &CountUniform1f;
+        glUniform3fv = &CountUniform3fv;
+        glUniform4fv = &CountUniform4fv;
+        glUniformMatrix4fv = &CountUniformMatrix4fv;
+#endif
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ShaderUniformBenchmark::RunFrame()
+    {
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        typedef CSBackend::OpenGL::Shader::BuiltInUniform BuiltInUniform;
+        const CSBackend::OpenGL::Shader::UniformNotFoundPolicy k_failSilent = CSBackend::OpenGL::Shader::UniformNotFoundPolicy::k_failSilent;
+        
+        CSBackend::OpenGL::Shader* shader = static_cast<CSBackend::OpenGL::Shader*>(m_shader.get());
+        
+        const CSCore::Vector3 cameraPos(0.0f, 10.0f, -10.0f);
+        const CSCore::Vector3 lightDir(0.0f, -1.0f, 0.0f);
+        const CSCore::Vector3 lightPos(0.0f, 20.0f, 0.0f);
+        const CSCore::Colour lightCol(1.0f, 0.9f, 0.8f, 1.0f);
+        const CSCore::Matrix4 lightMat = CSCore::Matrix4::k_identity;
+        
+        //Mirrors the uniforms the OpenGL render system sets: the light and camera position when a material is
+        //applied, and the matrices for every draw.
+        g_numUploads = 0;
+        for (u32 i = 0; i < k_numDraws; ++i)
+        {
+            if (m_uniformMode == UniformMode::k_builtInSlot)
+            {
+                if (i % k_drawsPerMaterial == 0)
+                {
+                    shader->SetUniform(BuiltInUniform::k_lightDir, lightDir, k_failSilent);
+                    shader->SetUniform(BuiltInUniform::k_lightPos, lightPos, k_failSilent);
+                    shader->SetUniform(BuiltInUniform::k_lightCol, lightCol, k_failSilent);
+                    shader->SetUniform(BuiltInUniform::k_lightMat, lightMat, k_failSilent);
+                    shader->SetUniform(BuiltInUniform::k_cameraPos, cameraPos, k_failSilent);
+                }
+                
+                shader->SetUniform(BuiltInUniform::k_wvpMat, m_wvpMatrices[i], k_failSilent);
+                shader->SetUniform(BuiltInUniform::k_worldMat, m_worldMatrices[i], k_failSilent);
+                if (shader->HasUniform(BuiltInUniform::k_normalMat))
+                {
+                    shader->SetUniform(BuiltInUniform::k_normalMat, m_normalMatrices[i]);
+                }
+            }
+            else
+            {
+                if (i % k_drawsPerMaterial == 0)
+                {
+                    shader->SetUniform("u_lightDir", lightDir, k_failSilent);
+                    shader->SetUniform("u_lightPos", lightPos, k_failSilent);
+                    shader->SetUniform("u_lightCol", lightCol, k_failSilent);
+                    shader->SetUniform("u_lightMat", lightMat, k_failSilent);
+                    shader->SetUniform("u_cameraPos", cameraPos, k_failSilent);
+                }
+                
+                shader->SetUniform("u_wvpMat", m_wvpMatrices[i], k_failSilent);
+                shader->SetUniform("u_worldMat", m_worldMatrices[i], k_failSilent);
+                if (shader->HasUniform("u_normalMat"))
+                {
+                    shader->SetUniform("u_normalMat", m_normalMatrices[i]);
+                }
+            }
+        }
+        m_numUploads = g_numUploads;
+#endif
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string ShaderUniformBenchmark::GetFrameSummary() const
+    {
+        return "uniform uploads " + CSCore::ToString(m_numUploads);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ShaderUniformBenchmark::TearDown(CSCore::State* in_state)
+    {
+#ifdef CS_TARGETPLATFORM_WINDOWS
+        glUniform1i = g_uniform1i;
+        glUniform1f = g_uniform1f;
+        glUniform3fv = g_uniform3fv;
+        glUniform4fv = g_uniform4fv;
+        glUniformMatrix4fv = g_uniformMatrix4fv;
+#endif
+        
+        m_worldMatrices.clear();
+        m_wvpMatrices.clear();
+        m_normalMatrices.clear();
+    }
+}
@@ -0,0 +1,127 @@
+//
+//  ShaderUniformBenchmark.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_SHADERUNIFORMBENCHMARK_H_
+#define _CSBENCHMARK_SHADERUNIFORMBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <Benchmark.h>
+
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// Measures the CPU cost of setting the uniforms the OpenGL render system sets
+    /// for each draw, either by name or through the built-in uniform slots. The
+    /// GL uniform upload functions are replaced with stubs which count the
+    /// uploads, so only the cost of the shader's uniform layer is timed, and the
+    /// number of uploads which were not skipped is reported.
+    ///
+    /// The stubs replace GLEW's function pointers, so this is only supported on
+    /// Windows with the OpenGL backend.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class ShaderUniformBenchmark final : public Benchmark
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// The ways in which the uniforms can be set.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        enum class UniformMode
+        {
+            k_byName,
+            k_builtInSlot
+        };
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return Whether or not the benchmark can be run with the current platform
+        /// and render backend.
+        //------------------------------------------------------------------------------
+        static bool IsSupported();
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The way in which the uniforms are set.
+        //------------------------------------------------------------------------------
+        ShaderUniformBenchmark(UniformMode in_uniformMode);
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The name the results of the benchmark are reported under.
+        //------------------------------------------------------------------------------
+        std::string GetName() const override;
+        //------------------------------------------------------------------------------
+        /// Builds the shader, creates the per draw matrices and installs the GL
+        /// stubs.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark is run in.
+        //------------------------------------------------------------------------------
+        void SetUp(CSCore::State* in_state) override;
+        //------------------------------------------------------------------------------
+        /// Sets the uniforms for each draw.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrame() override;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The number of uniform uploads in the last frame.
+        //------------------------------------------------------------------------------
+        std::string GetFrameSummary() const override;
+        //------------------------------------------------------------------------------
+        /// Restores the GL functions.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark was run in.
+        //------------------------------------------------------------------------------
+        void TearDown(CSCore::State* in_state) override;
+        
+    private:
+        UniformMode m_uniformMode;
+        u32 m_numUploads = 0;
+        
+        CSRendering::ShaderSPtr m_shader;
+        std::vector<CSCore::Matrix4> m_worldMatrices;
+        std::vector<CSCore::Matrix4> m_wvpMatrices;
+        std::vector<CSCore::Matrix4> m_normalMatrices;
+    };
+}
+
+#endif
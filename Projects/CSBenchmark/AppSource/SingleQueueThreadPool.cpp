@@ -0,0 +1,82 @@
+//
+//  SingleQueueThreadPool.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <SingleQueueThreadPool.h>
+
+#include <ChilliSource/Core/Delegate/MakeDelegate.h>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    SingleQueueThreadPool::SingleQueueThreadPool(u32 in_numThreads)
+        : m_isFinished(false)
+    {
+        for (u32 i = 0; i < in_numThreads; ++i)
+        {
+            m_threadGroup.push_back(std::thread(CSCore::MakeDelegate(this, &SingleQueueThreadPool::DoTaskOrWait)));
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SingleQueueThreadPool::Schedule(const GenericTaskType& in_task)
+    {
+        m_tasks.push(in_task);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 SingleQueueThreadPool::GetNumThreads() const
+    {
+        return static_cast<u32>(m_threadGroup.size());
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SingleQueueThreadPool::DoTaskOrWait()
+    {
+        while (m_isFinished == false)
+        {
+            GenericTaskType task;
+            if (m_tasks.pop_or_wait(task) == true)
+            {
+                task();
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    SingleQueueThreadPool::~SingleQueueThreadPool()
+    {
+        m_isFinished = true;
+        m_tasks.abort();
+        
+        for (u32 i = 0; i < m_threadGroup.size(); ++i)
+        {
+            m_threadGroup[i].join();
+        }
+    }
+}
@@ -0,0 +1,100 @@
+//
+//  SingleQueueThreadPool.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_SINGLEQUEUETHREADPOOL_H_
+#define _CSBENCHMARK_SINGLEQUEUETHREADPOOL_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/concurrent_blocking_queue.h>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// A copy of the engine's thread pool from before it was replaced with the
+    /// work stealing pool. All workers share a single queue of std::function
+    /// tasks, and there is no way to wait on a group of tasks. This is only kept
+    /// so that the two pools can be compared.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class SingleQueueThreadPool final
+    {
+    public:
+        CS_DECLARE_NOCOPY(SingleQueueThreadPool);
+        
+        typedef std::function<void()> GenericTaskType;
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param Num threads in pool
+        //------------------------------------------------------------------------------
+        SingleQueueThreadPool(u32 in_numThreads);
+        //------------------------------------------------------------------------------
+        /// Add a task to the queue to be serviced when a thread becomes available
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param Task to execute
+        //------------------------------------------------------------------------------
+        void Schedule(const GenericTaskType& in_task);
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return Num threads in the pool
+        //------------------------------------------------------------------------------
+        u32 GetNumThreads() const;
+        //------------------------------------------------------------------------------
+        /// Destructor
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        ~SingleQueueThreadPool();
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// Continues to perform tasks until there are none left to perform at which
+        /// point this will sleep until there are new tasks.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void DoTaskOrWait();
+        
+        std::vector<std::thread> m_threadGroup;
+        CSCore::concurrent_blocking_queue<GenericTaskType> m_tasks;
+        std::atomic<bool> m_isFinished;
+    };
+}
+
+#endif
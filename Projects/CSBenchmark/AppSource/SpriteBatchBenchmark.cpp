@@ -0,0 +1,169 @@
+//
+//  SpriteBatchBenchmark.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <SpriteBatchBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/Resource.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Rendering/Base.h>
+#include <ChilliSource/Rendering/Material.h>
+#include <ChilliSource/Rendering/Sprite.h>
+#include <ChilliSource/Rendering/Texture.h>
+
+namespace CSBenchmark
+{
+    namespace
+    {
+        const f32 k_spriteSize = 8.0f;
+        const u32 k_spritesPerRow = 128;
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    SpriteBatchBenchmark::SpriteBatchBenchmark(u32 in_numSprites, u32 in_numMaterials, SubmitMode in_submitMode, bool in_materialSortingEnabled)
+        : m_numSprites(in_numSprites), m_numMaterials(in_numMaterials), m_submitMode(in_submitMode), m_materialSortingEnabled(in_materialSortingEnabled)
+    {
+        CS_ASSERT(m_numMaterials > 0, "A sprite batch benchmark needs at least one material.");
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string SpriteBatchBenchmark::GetName() const
+    {
+        std::string name = "Sprites " + CSCore::ToString(m_numSprites) + ", " + CSCore::ToString(m_numMaterials) + " materials";
+        name += (m_submitMode == SubmitMode::k_materialHandle) ? ", by handle" : ", by sprite data";
+        name += (m_materialSortingEnabled == true) ? ", sorted" : ", unsorted";
+        return name;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SpriteBatchBenchmark::SetUp(CSCore::State* in_state)
+    {
+        m_renderSystem = CSCore::Application::Get()->GetRenderSystem();
+        m_batch = CSRendering::DynamicSpriteBatchUPtr(new CSRendering::DynamicSpriteBatch(m_renderSystem));
+        m_batch->SetMaterialSortingEnabled(m_materialSortingEnabled);
+        
+        //Resources are kept by the pool after tear down, so they are named after the benchmark to keep them unique.
+        if (m_materials.empty() == true)
+        {
+            CSCore::ResourcePool* resourcePool = CSCore::Application::Get()->GetResourcePool();
+            CSRendering::MaterialFactory* materialFactory = CSCore::Application::Get()->GetSystem<CSRendering::MaterialFactory>();
+            
+            CSRendering::TextureCSPtr texture = resourcePool->LoadResource<CSRendering::Texture>(CSCore::StorageLocation::k_chilliSource, "Textures/Blank.csimage");
+            for (u32 i = 0; i < m_numMaterials; ++i)
+            {
+                m_materials.push_back(materialFactory->CreateSprite(GetName() + " " + CSCore::ToString(i), texture));
+            }
+        }
+        
+        m_sprites.resize(m_numSprites);
+        for (u32 i = 0; i < m_numSprites; ++i)
+        {
+            CSRendering::SpriteBatch::SpriteData& sprite = m_sprites[i];
+            sprite.pMaterial = m_materials[i % m_numMaterials];
+            
+            CSCore::Vector2 bottomLeft(f32(i % k_spritesPerRow) * k_spriteSize, f32(i / k_spritesPerRow) * k_spriteSize);
+            CSCore::ByteColour colour = CSCore::ColourUtils::ColourToByteColour(CSCore::Colour::k_white);
+            
+            sprite.sVerts[(u32)CSRendering::SpriteBatch::Verts::k_topLeft].vPos = CSCore::Vector4(bottomLeft.x, bottomLeft.y + k_spriteSize, 0.0f, 1.0f);
+            sprite.sVerts[(u32)CSRendering::SpriteBatch::Verts::k_topLeft].vTex = CSCore::Vector2(0.0f, 0.0f);
+            sprite.sVerts[(u32)CSRendering::SpriteBatch::Verts::k_bottomLeft].vPos = CSCore::Vector4(bottomLeft.x, bottomLeft.y, 0.0f, 1.0f);
+            sprite.sVerts[(u32)CSRendering::SpriteBatch::Verts::k_bottomLeft].vTex = CSCore::Vector2(0.0f, 1.0f);
+            sprite.sVerts[(u32)CSRendering::SpriteBatch::Verts::k_topRight].vPos = CSCore::Vector4(bottomLeft.x + k_spriteSize, bottomLeft.y + k_spriteSize, 0.0f, 1.0f);
+            sprite.sVerts[(u32)CSRendering::SpriteBatch::Verts::k_topRight].vTex = CSCore::Vector2(1.0f, 0.0f);
+            sprite.sVerts[(u32)CSRendering::SpriteBatch::Verts::k_bottomRight].vPos = CSCore::Vector4(bottomLeft.x + k_spriteSize, bottomLeft.y, 0.0f, 1.0f);
+            sprite.sVerts[(u32)CSRendering::SpriteBatch::Verts::k_bottomRight].vTex = CSCore::Vector2(1.0f, 1.0f);
+            
+            for (u32 vertex = 0; vertex < (u32)CSRendering::SpriteBatch::Verts::k_total; ++vertex)
+            {
+                sprite.sVerts[vertex].Col = colour;
+            }
+        }
+        
+        m_materialHandles.reserve(m_numMaterials);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SpriteBatchBenchmark::RunFrame()
+    {
+        m_renderSystem->BeginFrame(nullptr);
+        
+        if (m_submitMode == SubmitMode::k_materialHandle)
+        {
+            //Handles are only valid until the batch is flushed, so they are looked up once per frame.
+            m_materialHandles.clear();
+            for (const CSRendering::MaterialCSPtr& material : m_materials)
+            {
+                m_materialHandles.push_back(m_batch->GetMaterialHandle(material));
+            }
+            
+            for (u32 i = 0; i < m_numSprites; ++i)
+            {
+                m_batch->Render(m_materialHandles[i % m_numMaterials], m_sprites[i].sVerts);
+            }
+        }
+        else
+        {
+            for (const CSRendering::SpriteBatch::SpriteData& sprite : m_sprites)
+            {
+                m_batch->Render(sprite);
+            }
+        }
+        
+        m_batch->ForceRender();
+        
+        m_renderSystem->EndFrame(nullptr);
+        m_renderSystem->EndSpriteBatchStatsFrame();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string SpriteBatchBenchmark::GetFrameSummary() const
+    {
+        const CSRendering::RenderSystem::SpriteBatchStats& stats = m_renderSystem->GetSpriteBatchStats();
+        
+        std::string summary = "flushes " + CSCore::ToString(stats.m_numFlushes) + ", batched sprites " + CSCore::ToString(stats.m_numSprites) + ", draw commands " + CSCore::ToString(stats.m_numDrawCommands);
+        
+        std::string renderSummary = GetRenderFrameSummary();
+        if (renderSummary.empty() == false)
+        {
+            summary += ", " + renderSummary;
+        }
+        return summary;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SpriteBatchBenchmark::TearDown(CSCore::State* in_state)
+    {
+        m_batch.reset();
+        m_sprites.clear();
+        m_sprites.shrink_to_fit();
+        m_materialHandles.clear();
+        m_renderSystem = nullptr;
+    }
+}
@@ -0,0 +1,124 @@
+//
+//  SpriteBatchBenchmark.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_SPRITEBATCHBENCHMARK_H_
+#define _CSBENCHMARK_SPRITEBATCHBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
+#include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
+
+#include <Benchmark.h>
+
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// Submits sprites straight to a dynamic sprite batch, bypassing the scene and
+    /// canvas, so that only the cost of batching is measured. Consecutive sprites
+    /// cycle through the materials, which is the worst case for batching unless
+    /// material sorting is enabled.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class SpriteBatchBenchmark final : public Benchmark
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// The ways in which sprites can be submitted to the batch.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        enum class SubmitMode
+        {
+            k_spriteData,
+            k_materialHandle
+        };
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The number of sprites submitted each frame.
+        /// @param The number of materials the sprites cycle through.
+        /// @param Whether sprites are submitted as sprite data, which holds a
+        /// material pointer, or by material handle.
+        /// @param Whether or not material sorting is enabled on the batch.
+        //------------------------------------------------------------------------------
+        SpriteBatchBenchmark(u32 in_numSprites, u32 in_numMaterials, SubmitMode in_submitMode, bool in_materialSortingEnabled);
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The name the results of the benchmark are reported under.
+        //------------------------------------------------------------------------------
+        std::string GetName() const override;
+        //------------------------------------------------------------------------------
+        /// Creates the batch, materials and sprite vertices.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark is run in.
+        //------------------------------------------------------------------------------
+        void SetUp(CSCore::State* in_state) override;
+        //------------------------------------------------------------------------------
+        /// Submits all of the sprites and flushes the batch.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrame() override;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The batching and render work done in the last frame.
+        //------------------------------------------------------------------------------
+        std::string GetFrameSummary() const override;
+        //------------------------------------------------------------------------------
+        /// Destroys the batch and sprites.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark was run in.
+        //------------------------------------------------------------------------------
+        void TearDown(CSCore::State* in_state) override;
+        
+    private:
+        u32 m_numSprites;
+        u32 m_numMaterials;
+        SubmitMode m_submitMode;
+        bool m_materialSortingEnabled;
+        
+        CSRendering::RenderSystem* m_renderSystem = nullptr;
+        CSRendering::DynamicSpriteBatchUPtr m_batch;
+        std::vector<CSRendering::MaterialCSPtr> m_materials;
+        std::vector<CSRendering::DynamicSpriteBatch::MaterialHandle> m_materialHandles;
+        std::vector<CSRendering::SpriteBatch::SpriteData> m_sprites;
+    };
+}
+
+#endif
@@ -0,0 +1,209 @@
+//
+//  ThreadPoolBenchmark.cpp
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ThreadPoolBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace CSBenchmark
+{
+    namespace
+    {
+        const u32 k_numTasks = 10000;
+        const u32 k_numParallelForItems = 100000;
+        const u32 k_minBatchSize = 256;
+        const u32 k_batchesPerThread = 4;
+        const u32 k_workPerItem = 16;
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    ThreadPoolBenchmark::ThreadPoolBenchmark(PoolType in_poolType, Scenario in_scenario)
+        : m_poolType(in_poolType), m_scenario(in_scenario), m_numPendingTasks(0)
+    {
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string ThreadPoolBenchmark::GetName() const
+    {
+        std::string name = (m_poolType == PoolType::k_workStealing) ? "Work stealing pool" : "Single queue pool";
+        switch (m_scenario)
+        {
+            case Scenario::k_schedule:
+                return name + " schedule and wait";
+            case Scenario::k_parallelFor:
+                return name + " parallel for";
+        }
+        
+        return name;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ThreadPoolBenchmark::SetUp(CSCore::State* in_state)
+    {
+        //The task scheduler creates its pool with two threads per core, so the single queue pool matches it.
+        m_numThreads = CSCore::Application::Get()->GetSystem<CSCore::Device>()->GetNumberOfCPUCores() * 2;
+        if (m_poolType == PoolType::k_singleQueue)
+        {
+            m_singleQueuePool = std::unique_ptr<SingleQueueThreadPool>(new SingleQueueThreadPool(m_numThreads));
+        }
+        
+        u32 numItems = (m_scenario == Scenario::k_schedule) ? k_numTasks : k_numParallelForItems;
+        m_items.resize(numItems);
+        for (u32 i = 0; i < numItems; ++i)
+        {
+            m_items[i] = f32(i);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ThreadPoolBenchmark::RunFrame()
+    {
+        if (m_poolType == PoolType::k_workStealing)
+        {
+            RunFrameWorkStealing();
+        }
+        else
+        {
+            RunFrameSingleQueue();
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    std::string ThreadPoolBenchmark::GetFrameSummary() const
+    {
+        switch (m_scenario)
+        {
+            case Scenario::k_schedule:
+                return CSCore::ToString(k_numTasks) + " tasks on " + CSCore::ToString(m_numThreads) + " threads";
+            case Scenario::k_parallelFor:
+                return CSCore::ToString(k_numParallelForItems) + " items on " + CSCore::ToString(m_numThreads) + " threads";
+        }
+        
+        return "";
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ThreadPoolBenchmark::TearDown(CSCore::State* in_state)
+    {
+        m_singleQueuePool.reset();
+        m_items.clear();
+        m_items.shrink_to_fit();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ThreadPoolBenchmark::RunFrameSingleQueue()
+    {
+        switch (m_scenario)
+        {
+            case Scenario::k_schedule:
+                m_numPendingTasks = k_numTasks;
+                for (u32 i = 0; i < k_numTasks; ++i)
+                {
+                    m_singleQueuePool->Schedule([this, i]()
+                    {
+                        ProcessItems(i, i + 1);
+                        --m_numPendingTasks;
+                    });
+                }
+                break;
+            case Scenario::k_parallelFor:
+            {
+                //Split the items into the same batches as TaskScheduler::ParallelFor() would.
+                u32 batchSize = std::max(k_minBatchSize, k_numParallelForItems / ((m_numThreads + 1) * k_batchesPerThread));
+                u32 numBatches = (k_numParallelForItems + batchSize - 1) / batchSize;
+                
+                m_numPendingTasks = numBatches;
+                for (u32 i = 0; i < numBatches; ++i)
+                {
+                    u32 begin = i * batchSize;
+                    u32 end = std::min(begin + batchSize, k_numParallelForItems);
+                    m_singleQueuePool->Schedule([this, begin, end]()
+                    {
+                        ProcessItems(begin, end);
+                        --m_numPendingTasks;
+                    });
+                }
+                break;
+            }
+        }
+        
+        while (m_numPendingTasks > 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ThreadPoolBenchmark::RunFrameWorkStealing()
+    {
+        CSCore::TaskScheduler* taskScheduler = CSCore::Application::Get()->GetTaskScheduler();
+        switch (m_scenario)
+        {
+            case Scenario::k_schedule:
+            {
+                CSCore::TaskCounter counter;
+                for (u32 i = 0; i < k_numTasks; ++i)
+                {
+                    taskScheduler->ScheduleTask([this, i]()
+                    {
+                        ProcessItems(i, i + 1);
+                    }, counter);
+                }
+                taskScheduler->WaitForTasks(counter);
+                break;
+            }
+            case Scenario::k_parallelFor:
+                taskScheduler->ParallelFor(k_numParallelForItems, k_minBatchSize, [this](u32 in_begin, u32 in_end)
+                {
+                    ProcessItems(in_begin, in_end);
+                });
+                break;
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ThreadPoolBenchmark::ProcessItems(u32 in_begin, u32 in_end)
+    {
+        for (u32 i = in_begin; i < in_end; ++i)
+        {
+            f32 value = m_items[i];
+            for (u32 j = 0; j < k_workPerItem; ++j)
+            {
+                value = std::sqrt(value * value + 1.0f);
+            }
+            m_items[i] = value;
+        }
+    }
+}
@@ -0,0 +1,154 @@
+//
+//  ThreadPoolBenchmark.h
+//  CSBenchmark
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARK_THREADPOOLBENCHMARK_H_
+#define _CSBENCHMARK_THREADPOOLBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <Benchmark.h>
+#include <SingleQueueThreadPool.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace CSBenchmark
+{
+    //------------------------------------------------------------------------------
+    /// Compares the engine's work stealing thread pool with a copy of the single
+    /// queue std::function pool it replaced, when scheduling many small tasks and
+    /// waiting for them, and when splitting a loop over many items into batches.
+    /// Both pools have the same number of threads.
+    ///
+    /// @author Jordan Brown
+    //------------------------------------------------------------------------------
+    class ThreadPoolBenchmark final : public Benchmark
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// The thread pools which can be benchmarked.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        enum class PoolType
+        {
+            k_singleQueue,
+            k_workStealing
+        };
+        //------------------------------------------------------------------------------
+        /// The work done each frame.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        enum class Scenario
+        {
+            k_schedule,
+            k_parallelFor
+        };
+        //------------------------------------------------------------------------------
+        /// Constructor
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The thread pool.
+        /// @param The work done each frame.
+        //------------------------------------------------------------------------------
+        ThreadPoolBenchmark(PoolType in_poolType, Scenario in_scenario);
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The name the results of the benchmark are reported under.
+        //------------------------------------------------------------------------------
+        std::string GetName() const override;
+        //------------------------------------------------------------------------------
+        /// Creates the single queue pool, if used, and the items to process.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark is run in.
+        //------------------------------------------------------------------------------
+        void SetUp(CSCore::State* in_state) override;
+        //------------------------------------------------------------------------------
+        /// Processes every item on the pool and waits for them all to complete.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrame() override;
+        //------------------------------------------------------------------------------
+        /// @author Jordan Brown
+        ///
+        /// @return The amount of work done each frame.
+        //------------------------------------------------------------------------------
+        std::string GetFrameSummary() const override;
+        //------------------------------------------------------------------------------
+        /// Destroys the single queue pool, if used, and the items.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The state the benchmark was run in.
+        //------------------------------------------------------------------------------
+        void TearDown(CSCore::State* in_state) override;
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// Performs the work for the scenario on the single queue pool. The pool has
+        /// no way to wait on tasks, so the tasks count themselves down and the
+        /// calling thread yields until they are all done.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrameSingleQueue();
+        //------------------------------------------------------------------------------
+        /// Performs the work for the scenario on the work stealing pool, through the
+        /// task scheduler.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        void RunFrameWorkStealing();
+        //------------------------------------------------------------------------------
+        /// Processes the items in the given range.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param The first item.
+        /// @param One past the last item.
+        //------------------------------------------------------------------------------
+        void ProcessItems(u32 in_begin, u32 in_end);
+        
+        PoolType m_poolType;
+        Scenario m_scenario;
+        u32 m_numThreads = 0;
+        
+        std::unique_ptr<SingleQueueThreadPool> m_singleQueuePool;
+        std::atomic<u32> m_numPendingTasks;
+        std::vector<f32> m_items;
+    };
+}
+
+#endif
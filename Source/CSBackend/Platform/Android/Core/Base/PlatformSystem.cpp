@@ -32,8 +32,12 @@
 
 #include <CSBackend/Platform/Android/Core/Base/CoreJavaInterface.h>
 #include <CSBackend/Platform/Android/Core/JNI/JavaInterfaceManager.h>
+#ifdef CS_RENDERBACKEND_NULL
+#include <CSBackend/Rendering/Null/Shader/ShaderProvider.h>
+#else
 #include <CSBackend/Rendering/OpenGL/Shader/GLSLShaderProvider.h>
 #include <CSBackend/Rendering/OpenGL/Texture/TextureUnitSystem.h>
+#endif
 #include <ChilliSource/Core/Image/ETC1ImageProvider.h>
 
 namespace CSBackend 
@@ -51,9 +55,14 @@ namespace CSBackend
 		//-------------------------------------------------
 		void PlatformSystem::CreateDefaultSystems(CSCore::Application* in_application)
 		{
+#ifdef CS_RENDERBACKEND_NULL
+			in_application->CreateSystem<CSBackend::Null::ShaderProvider>();
+			in_application->CreateSystem<CSCore::ETC1ImageProvider>();
+#else
 			in_application->CreateSystem<CSBackend::OpenGL::GLSLShaderProvider>();
 			in_application->CreateSystem<CSCore::ETC1ImageProvider>();
 			in_application->CreateSystem<CSBackend::OpenGL::TextureUnitSystem>();
+#endif
 		}
         //-----------------------------------------
         //-----------------------------------------
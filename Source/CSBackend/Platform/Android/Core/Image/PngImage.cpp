@@ -31,10 +31,13 @@
 #include <CSBackend/Platform/Android/Core/Image/PngImage.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileView.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
 
 #include <png/png.h>
 
+#include <cstring>
+
 namespace CSBackend
 {
 	namespace Android
@@ -58,15 +61,15 @@ namespace CSBackend
 				return;
 			}
 
-			CSCore::FileStream* pStream = (CSCore::FileStream*)png_get_io_ptr(inpPng);
+			CSCore::FileView* pFileView = (CSCore::FileView*)png_get_io_ptr(inpPng);
 
-			if (pStream->IsBad() == true || pStream->IsOpen() == false)
+			if (indwLength > pFileView->GetSize() - pFileView->GetReadPosition())
 			{
-				CS_LOG_ERROR("ReadPngData() has failed due to a problem with the filestream.");
+				CS_LOG_ERROR("ReadPngData() has failed because the file is truncated.");
 				png_error(inpPng, "Read Error");
 			}
 
-			pStream->Read((s8*)inpData, indwLength);
+			memcpy(inpData, pFileView->Read(indwLength), indwLength);
 		}
 		//----------------------------------------------------------------------------------
 		/// Constructor
@@ -107,24 +110,20 @@ namespace CSBackend
 		//----------------------------------------------------------------------------------
 		void PngImage::Load(CSCore::StorageLocation ineStorageLocation, const std::string& instrFilename)
 		{
-			//create the file stream
-			CSCore::FileStreamSPtr stream = CSCore::Application::Get()->GetFileSystem()->CreateFileStream(ineStorageLocation, instrFilename, CSCore::FileMode::k_readBinary);
+			//create the file view
+			CSCore::FileViewUPtr fileView = CSCore::Application::Get()->GetFileSystem()->CreateFileView(ineStorageLocation, instrFilename);
 
-			//insure the stream is not broken
-			if (stream == CSCore::FileStreamSPtr() || stream->IsBad() == true || stream->IsOpen() == false)
+			//insure the file could be opened
+			if (fileView == nullptr)
 			{
-				stream->Close();
 				return;
 			}
 
 			//load from lib png
-			if (LoadWithLibPng(stream) == true)
+			if (LoadWithLibPng(fileView.get()) == true)
 			{
 				mbIsLoaded = true;
 			}
-
-			//close the stream
-			stream->Close();
 		}
 		//----------------------------------------------------------------------------------
 		/// Release
@@ -185,15 +184,17 @@ namespace CSBackend
 		//----------------------------------------------------------------------------------
 		/// Load with lib png
 		//----------------------------------------------------------------------------------
-		bool PngImage::LoadWithLibPng(CSCore::FileStreamSPtr inStream)
+		bool PngImage::LoadWithLibPng(CSCore::FileView* inpFileView)
 		{
 			//-------- Intialisation
 			//read the header to insure it is indeed a png
 			s32 dwHeaderSize = 8;
-			u8 * ubyHeader = new u8[dwHeaderSize];
-			inStream->Read((s8*)ubyHeader, dwHeaderSize);
-			bool bIsPng = !png_sig_cmp(ubyHeader, 0, dwHeaderSize);
-			delete[] ubyHeader;
+			if (inpFileView->GetSize() < u64(dwHeaderSize))
+			{
+				CS_LOG_ERROR("PNG header invalid.");
+				return false;
+			}
+			bool bIsPng = !png_sig_cmp(const_cast<u8*>(inpFileView->Read(dwHeaderSize)), 0, dwHeaderSize);
 
 			//if its not a PNG return.
 			if (bIsPng == false)
@@ -228,7 +229,7 @@ namespace CSBackend
 			}
 
 			//Setup the ReadPngData function for use within libPng
-			png_set_read_fn(pPng,(void*)inStream.get(), ReadPngData);
+			png_set_read_fn(pPng,(void*)inpFileView, ReadPngData);
 
 			//tell it that we've ready read 8 bytes of data
 			png_set_sig_bytes(pPng, dwHeaderSize);
@@ -320,8 +321,6 @@ namespace CSBackend
 			//deallocate everything
 			png_destroy_read_struct(&pPng, &pInfo, (png_infopp)nullptr);
 
-			inStream->Close();
-
 			return true;
 		}
 	}
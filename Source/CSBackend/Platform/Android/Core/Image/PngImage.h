@@ -173,9 +173,9 @@ namespace CSBackend
 			///
 			/// Loads the png data using lib png
 			///
-			/// @param the stream lib png should use to read the data.
+			/// @param the file view lib png should read the data from.
 			//----------------------------------------------------------------------------------
-			bool LoadWithLibPng(CSCore::FileStreamSPtr inStream);
+			bool LoadWithLibPng(CSCore::FileView* inpFileView);
 
 			bool mbIsLoaded;
 			s32 mdwHeight;
@@ -30,8 +30,12 @@
 
 #include <CSBackend/Platform/Windows/Core/Base/PlatformSystem.h>
 #include <CSBackend/Platform/Windows/SFML/Base/SFMLWindow.h>
+#ifdef CS_RENDERBACKEND_NULL
+#include <CSBackend/Rendering/Null/Shader/ShaderProvider.h>
+#else
 #include <CSBackend/Rendering/OpenGL/Shader/GLSLShaderProvider.h>
 #include <CSBackend/Rendering/OpenGL/Texture/TextureUnitSystem.h>
+#endif
 #include <ChilliSource/Core/Base/Application.h>
 
 #define WIN32_LEAN_AND_MEAN
@@ -65,8 +69,12 @@ namespace CSBackend
 		//-------------------------------------------------
 		void PlatformSystem::CreateDefaultSystems(CSCore::Application* in_application)
 		{
+#ifdef CS_RENDERBACKEND_NULL
+			in_application->CreateSystem<CSBackend::Null::ShaderProvider>();
+#else
 			in_application->CreateSystem<CSBackend::OpenGL::GLSLShaderProvider>();
 			in_application->CreateSystem<CSBackend::OpenGL::TextureUnitSystem>();
+#endif
 		}
 		//-------------------------------------------------
 		//-------------------------------------------------
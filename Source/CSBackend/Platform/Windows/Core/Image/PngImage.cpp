@@ -32,8 +32,11 @@
 
 #include <png/png.h>
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileView.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
 
+#include <cstring>
+
 //----------------------------------------------------------------------------------
 /// Read Png Data
 ///
@@ -49,11 +52,12 @@ void ReadPngData(png_structp png_ptr, png_bytep data, png_size_t length)
 	if (png_ptr == nullptr)
 		return;
 
-	CSCore::FileStream* pStream = (CSCore::FileStream*)png_get_io_ptr(png_ptr);
-	pStream->Read((s8*)data, length);
+	CSCore::FileView* pFileView = (CSCore::FileView*)png_get_io_ptr(png_ptr);
 
-	if (pStream->IsBad() == true)
+	if (length > pFileView->GetSize() - pFileView->GetReadPosition())
 		png_error(png_ptr, "Read Error");
+
+	memcpy(data, pFileView->Read(length), length);
 }
 
 namespace CSBackend
@@ -102,24 +106,20 @@ namespace CSBackend
 		//----------------------------------------------------------------------------------
 		void PngImage::Load(CSCore::StorageLocation ineLocation, const std::string& instrFilename)
 		{
-			//create the file stream
-			CSCore::FileStreamSPtr stream = CSCore::Application::Get()->GetFileSystem()->CreateFileStream(ineLocation, instrFilename, CSCore::FileMode::k_readBinary);
+			//create the file view
+			CSCore::FileViewUPtr fileView = CSCore::Application::Get()->GetFileSystem()->CreateFileView(ineLocation, instrFilename);
 
-			//insure the stream is not broken
-			if (stream == CSCore::FileStreamSPtr() || stream->IsBad() == true || stream->IsOpen() == false)
+			//insure the file could be opened
+			if (fileView == nullptr)
 			{
-				stream->Close();
 				return;
 			}
 
 			//load from lib png
-			if (LoadWithLibPng(stream) == true)
+			if (LoadWithLibPng(fileView.get()) == true)
 			{
 				mbIsLoaded = true;
 			}
-
-			//close the stream
-			stream->Close();
 		}
 		//----------------------------------------------------------------------------------
 		/// Release
@@ -191,16 +191,13 @@ namespace CSBackend
 		/// Load with lib png
 		///
 		/// Loads the png data using lib png
-		/// @param FileStreamSPtr inStream - the steam lib png should use to read the data.
+		/// @param FileView* inpFileView - the file view lib png should read the data from.
 		//----------------------------------------------------------------------------------
-		bool PngImage::LoadWithLibPng(CSCore::FileStreamSPtr inStream)
+		bool PngImage::LoadWithLibPng(CSCore::FileView* inpFileView)
 		{
 			//insure that it is indeed a png
 			const s32 dwHeaderSize = 8;
-			u8 ubyHeader[dwHeaderSize];
-			inStream->Read((s8*)ubyHeader, dwHeaderSize);
-
-			if (png_sig_cmp(ubyHeader, 0, dwHeaderSize) > 0)
+			if (inpFileView->GetSize() < u64(dwHeaderSize) || png_sig_cmp(const_cast<u8*>(inpFileView->Read(dwHeaderSize)), 0, dwHeaderSize) > 0)
 			{
 				CS_LOG_ERROR("PNG header invalid.");
 				return false;
@@ -232,7 +229,7 @@ namespace CSBackend
 			}
 
 			//Setup the ReadPngData function for use within libPng
-			png_set_read_fn(pPng,(void*)inStream.get(), ReadPngData);
+			png_set_read_fn(pPng,(void*)inpFileView, ReadPngData);
 
 			//tell it that we've ready read 8 bytes of data
 			png_set_sig_bytes(pPng, dwHeaderSize);
@@ -110,9 +110,9 @@ namespace CSBackend
 			/// Load with lib png
 			///
 			/// Loads the png data using lib png
-			/// @param FileStreamSPtr inStream - the stream lib png should use to read the data.
+			/// @param FileView* inpFileView - the file view lib png should read the data from.
 			//----------------------------------------------------------------------------------
-			bool LoadWithLibPng(CSCore::FileStreamSPtr inStream);
+			bool LoadWithLibPng(CSCore::FileView* inpFileView);
 
 			bool mbIsLoaded;
 			s32 mdwHeight;
@@ -32,8 +32,12 @@
 
 #import <CSBackend/Platform/iOS/Core/Base/CSAppDelegate.h>
 #import <CSBackend/Platform/iOS/Core/String/NSStringUtils.h>
+#ifdef CS_RENDERBACKEND_NULL
+#import <CSBackend/Rendering/Null/Shader/ShaderProvider.h>
+#else
 #import <CSBackend/Rendering/OpenGL/Shader/GLSLShaderProvider.h>
 #import <CSBackend/Rendering/OpenGL/Texture/TextureUnitSystem.h>
+#endif
 #import <ChilliSource/Core/Base/Application.h>
 #import <ChilliSource/Core/Image/PVRImageProvider.h>
 
@@ -56,8 +60,12 @@ namespace CSBackend
 		void PlatformSystem::CreateDefaultSystems(CSCore::Application* in_application)
 		{
             in_application->CreateSystem<CSCore::PVRImageProvider>();
+#ifdef CS_RENDERBACKEND_NULL
+            in_application->CreateSystem<Null::ShaderProvider>();
+#else
             in_application->CreateSystem<OpenGL::GLSLShaderProvider>();
             in_application->CreateSystem<OpenGL::TextureUnitSystem>();
+#endif
 		}
         //-------------------------------------------------------
         //-------------------------------------------------------
@@ -0,0 +1,100 @@
+//
+//  MeshBuffer.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Base/MeshBuffer.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        MeshBuffer::MeshBuffer(CSRendering::BufferDescription& in_bufferDesc)
+        : CSRendering::MeshBuffer(in_bufferDesc), m_vertexData(in_bufferDesc.VertexDataCapacity), m_indexData(in_bufferDesc.IndexDataCapacity)
+        {
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void MeshBuffer::Bind()
+        {
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::LockVertex(f32** out_buffer, u32 in_dataOffset, u32 in_dataStride)
+        {
+            if (m_vertexData.empty() == true)
+            {
+                (*out_buffer) = nullptr;
+                return false;
+            }
+
+            if (mBufferDesc.eAccessFlag == CSRendering::BufferAccess::k_writeNoOverwrite)
+            {
+                CS_ASSERT(in_dataOffset < m_vertexData.size(), "Cannot lock a range outside of the vertex buffer.");
+                (*out_buffer) = reinterpret_cast<f32*>(m_vertexData.data() + in_dataOffset);
+            }
+            else
+            {
+                (*out_buffer) = reinterpret_cast<f32*>(m_vertexData.data());
+            }
+
+            return true;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::LockIndex(u16** out_buffer, u32 in_dataOffset, u32 in_dataStride)
+        {
+            if (m_indexData.empty() == true)
+            {
+                (*out_buffer) = nullptr;
+                return false;
+            }
+
+            (*out_buffer) = reinterpret_cast<u16*>(m_indexData.data());
+            return true;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::UnlockVertex()
+        {
+            return (m_vertexData.empty() == false);
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::UnlockVertex(u32 in_numBytesWritten)
+        {
+            return UnlockVertex();
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::UnlockIndex()
+        {
+            return (m_indexData.empty() == false);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+//
+//  MeshBuffer.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_MESHBUFFER_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_MESHBUFFER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Base/MeshBuffer.h>
+
+#include <vector>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// A mesh buffer for the null render backend. The vertex
+        /// and index data is held in main memory so that it can be
+        /// locked and written to as it would be on a real device,
+        /// but it is never uploaded anywhere.
+        ///
+        /// @author Jordan Brown
+        //----------------------------------------------------------
+        class MeshBuffer final : public CSRendering::MeshBuffer
+        {
+        public:
+            //-----------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The buffer description.
+            //-----------------------------------------------------
+            MeshBuffer(CSRendering::BufferDescription& in_bufferDesc);
+            //-----------------------------------------------------
+            /// Does nothing as there is no context to bind to.
+            ///
+            /// @author Jordan Brown
+            //-----------------------------------------------------
+            void Bind() override;
+            //-----------------------------------------------------
+            /// Obtain a pointer to the vertex data. As with the
+            /// OpenGL buffer, k_writeNoOverwrite buffers return a
+            /// pointer to the start of the requested range.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [Out] The pointer to the buffer
+            /// @param The offset to the subset of the buffer
+            /// @param The vertex layout stride, or the size of
+            /// the range to lock.
+            ///
+            /// @return If successful
+            //-----------------------------------------------------
+            bool LockVertex(f32** out_buffer, u32 in_dataOffset, u32 in_dataStride) override;
+            //-----------------------------------------------------
+            /// Obtain a pointer to the index data.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [Out] The pointer to the buffer
+            /// @param The offset to the subset of the buffer
+            /// @param The index stride
+            ///
+            /// @return If successful
+            //-----------------------------------------------------
+            bool LockIndex(u16** out_buffer, u32 in_dataOffset, u32 in_dataStride) override;
+            //-----------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return If successful
+            //-----------------------------------------------------
+            bool UnlockVertex() override;
+            //-----------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The number of bytes written to the locked range.
+            ///
+            /// @return If successful
+            //-----------------------------------------------------
+            bool UnlockVertex(u32 in_numBytesWritten) override;
+            //-----------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return If successful. This will fail if the
+            /// buffer was created without an index capacity.
+            //-----------------------------------------------------
+            bool UnlockIndex() override;
+
+        private:
+            std::vector<u8> m_vertexData;
+            std::vector<u8> m_indexData;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,108 @@
+//
+//  RenderCapabilities.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_RENDERCAPABILITIES_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_RENDERCAPABILITIES_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Base/RenderCapabilities.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //---------------------------------------------------------
+        /// The capabilities reported by the null render backend.
+        /// Every optional feature is reported as supported so that
+        /// the same code paths are exercised as on a capable
+        /// device.
+        ///
+        /// @author Jordan Brown
+        //---------------------------------------------------------
+        class RenderCapabilities final : public CSRendering::RenderCapabilities
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(RenderCapabilities);
+            //-------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The interface to compare
+            ///
+            /// @return Whether the object implements that
+            /// interface
+            //-------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //-------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not shadow mapping is
+            /// supported.
+            //-------------------------------------------------
+            bool IsShadowMappingSupported() const override;
+            //-------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not depth textures are
+            /// supported.
+            //-------------------------------------------------
+            bool IsDepthTextureSupported() const override;
+            //-------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not mapping buffers is
+            /// supported.
+            //-------------------------------------------------
+            bool IsMapBufferSupported() const override;
+            //-------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The maximum texture size.
+            //-------------------------------------------------
+            u32 GetMaxTextureSize() const override;
+            //-------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of texture units.
+            //-------------------------------------------------
+            u32 GetNumTextureUnits() const override;
+
+        private:
+            friend CSRendering::RenderCapabilitiesUPtr CSRendering::RenderCapabilities::Create();
+            //-------------------------------------------------
+            /// Private constructor to force the use of the
+            /// factory method.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------
+            RenderCapabilities() = default;
+        };
+    }
+}
+
+#endif
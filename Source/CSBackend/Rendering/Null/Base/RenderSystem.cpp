@@ -0,0 +1,351 @@
+//
+//  RenderSystem.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+
+#include <CSBackend/Rendering/Null/Base/MeshBuffer.h>
+#include <CSBackend/Rendering/Null/Base/RenderTarget.h>
+#include <ChilliSource/Rendering/Base/RenderCapabilities.h>
+#include <ChilliSource/Rendering/Lighting/LightComponent.h>
+#include <ChilliSource/Rendering/Material/Material.h>
+
+#include <algorithm>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        CS_DEFINE_NAMEDTYPE(RenderSystem);
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        RenderSystem::RenderSystem(CSRendering::RenderCapabilities* in_renderCapabilities)
+        : m_renderCapabilities(in_renderCapabilities)
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool RenderSystem::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return in_interfaceId == RenderSystem::InterfaceID || in_interfaceId == CSRendering::RenderSystem::InterfaceID;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Init()
+        {
+            CS_ASSERT(m_renderCapabilities, "Cannot find required system: Render Capabilities.");
+
+            InvalidateCaches();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Resume()
+        {
+            InvalidateCaches();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Suspend()
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Destroy()
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::BeginFrame(CSRendering::RenderTarget* in_renderTarget)
+        {
+            if (in_renderTarget != nullptr)
+            {
+                in_renderTarget->Bind();
+            }
+
+            EnableColourWriting(true);
+            EnableDepthWriting(true);
+
+            ++m_currentFrameStats.m_numPasses;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EndFrame(CSRendering::RenderTarget* in_renderTarget)
+        {
+            if (in_renderTarget == nullptr)
+            {
+                m_frameStats = m_currentFrameStats;
+                m_currentFrameStats = FrameStats();
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyMaterial(const CSRendering::MaterialCSPtr& in_material, CSRendering::ShaderPass in_shaderPass)
+        {
+            CS_ASSERT(in_material != nullptr, "Cannot apply null material");
+
+            const CSRendering::Shader* shader = in_material->GetShader(in_shaderPass).get();
+            CS_ASSERT(shader != nullptr, "Cannot render with null shader");
+
+            ++m_currentFrameStats.m_numMaterialApplies;
+
+            bool hasMaterialChanged = m_invalidateAllCaches == true || m_currentMaterial != in_material.get() || m_currentMaterial->IsCacheValid() == false || shader != m_currentShader;
+            if (hasMaterialChanged == true)
+            {
+                ++m_currentFrameStats.m_numMaterialChanges;
+                m_currentMaterial = in_material.get();
+
+                EnableAlphaBlending(m_currentMaterial->IsTransparencyEnabled());
+                SetBlendFunction(m_currentMaterial->GetSourceBlendMode(), m_currentMaterial->GetDestBlendMode());
+                EnableFaceCulling(m_currentMaterial->IsFaceCullingEnabled());
+                SetCullFace(m_currentMaterial->GetCullFace());
+                EnableColourWriting(m_currentMaterial->IsColourWriteEnabled());
+                EnableDepthWriting(m_currentMaterial->IsDepthWriteEnabled());
+                EnableDepthTesting(m_currentMaterial->IsDepthTestEnabled());
+
+                if (m_invalidateAllCaches == true || shader != m_currentShader)
+                {
+                    ++m_currentFrameStats.m_numShaderChanges;
+                    m_currentShader = shader;
+                }
+
+                u32 numTextureBinds = std::min(m_currentMaterial->GetNumTextures(), m_renderCapabilities->GetNumTextureUnits());
+                if (m_currentMaterial->GetCubemap() != nullptr)
+                {
+                    ++numTextureBinds;
+                }
+                m_currentFrameStats.m_numTextureBinds += numTextureBinds;
+
+                const_cast<CSRendering::Material*>(m_currentMaterial)->SetCacheValid();
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyJoints(const std::vector<CSCore::Vector4>& in_jointPalette)
+        {
+            CS_ASSERT(m_currentShader != nullptr, "Cannot set joints without binding shader");
+
+            ++m_currentFrameStats.m_numJointUploads;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyCamera(const CSCore::Vector3& in_position, const CSCore::Matrix4& in_view, const CSCore::Matrix4& in_projection, const CSCore::Colour& in_clearColour)
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetLight(CSRendering::LightComponent* in_lightComponent)
+        {
+            bool hasLightChanged = m_invalidateAllCaches == true || in_lightComponent != m_currentLight || (m_currentLight != nullptr && m_currentLight->IsCacheValid() == false);
+            if (hasLightChanged == true)
+            {
+                m_currentLight = in_lightComponent;
+
+                if (m_currentLight != nullptr)
+                {
+                    ++m_currentFrameStats.m_numLightChanges;
+                    m_currentLight->CalculateLightingValues();
+                    m_currentLight->SetCacheValid();
+                }
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableAlphaBlending(bool in_isEnabled)
+        {
+            if (m_isAlphaBlendingLocked == false)
+            {
+                SetFlag(m_isAlphaBlendingEnabled, in_isEnabled);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableDepthTesting(bool in_isEnabled)
+        {
+            SetFlag(m_isDepthTestEnabled, in_isEnabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableFaceCulling(bool in_isEnabled)
+        {
+            SetFlag(m_isCullingEnabled, in_isEnabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableColourWriting(bool in_isEnabled)
+        {
+            SetFlag(m_isColourWriteEnabled, in_isEnabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableDepthWriting(bool in_isEnabled)
+        {
+            if (m_isDepthWriteLocked == false)
+            {
+                SetFlag(m_isDepthWriteEnabled, in_isEnabled);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableScissorTesting(bool in_isEnabled)
+        {
+            SetFlag(m_isScissorTestEnabled, in_isEnabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockDepthWriting()
+        {
+            m_isDepthWriteLocked = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockDepthWriting()
+        {
+            m_isDepthWriteLocked = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockAlphaBlending()
+        {
+            m_isAlphaBlendingLocked = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockAlphaBlending()
+        {
+            m_isAlphaBlendingLocked = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockBlendFunction()
+        {
+            m_isBlendFunctionLocked = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockBlendFunction()
+        {
+            m_isBlendFunctionLocked = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetBlendFunction(CSRendering::BlendMode in_srcFunc, CSRendering::BlendMode in_dstFunc)
+        {
+            if (m_isBlendFunctionLocked == false && (m_invalidateAllCaches == true || in_srcFunc != m_srcBlendFunc || in_dstFunc != m_dstBlendFunc))
+            {
+                m_srcBlendFunc = in_srcFunc;
+                m_dstBlendFunc = in_dstFunc;
+                ++m_currentFrameStats.m_numStateChanges;
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetDepthFunction(CSRendering::DepthTestComparison in_func)
+        {
+            if (m_invalidateAllCaches == true || in_func != m_depthFunc)
+            {
+                m_depthFunc = in_func;
+                ++m_currentFrameStats.m_numStateChanges;
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetCullFace(CSRendering::CullFace in_cullFace)
+        {
+            if (m_invalidateAllCaches == true || in_cullFace != m_cullFace)
+            {
+                m_cullFace = in_cullFace;
+                ++m_currentFrameStats.m_numStateChanges;
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetScissorRegion(const CSCore::Vector2& in_position, const CSCore::Vector2& in_size)
+        {
+            if (m_invalidateAllCaches == true || in_position != m_scissorPosition || in_size != m_scissorSize)
+            {
+                m_scissorPosition = in_position;
+                m_scissorSize = in_size;
+                ++m_currentFrameStats.m_numStateChanges;
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        CSRendering::MeshBuffer* RenderSystem::CreateBuffer(CSRendering::BufferDescription& in_desc)
+        {
+            return new MeshBuffer(in_desc);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::RenderVertexBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numVerts, const CSCore::Matrix4& in_world)
+        {
+            ++m_currentFrameStats.m_numDrawCalls;
+            m_currentFrameStats.m_numElementsDrawn += in_numVerts;
+
+            m_invalidateAllCaches = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::RenderBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numIndices, const CSCore::Matrix4& in_world)
+        {
+            ++m_currentFrameStats.m_numDrawCalls;
+            m_currentFrameStats.m_numElementsDrawn += in_numIndices;
+
+            m_invalidateAllCaches = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        CSRendering::RenderTarget* RenderSystem::CreateRenderTarget(u32 in_width, u32 in_height)
+        {
+            return new RenderTarget(in_width, in_height);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        const RenderSystem::FrameStats& RenderSystem::GetFrameStats() const
+        {
+            return m_frameStats;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetFlag(bool& out_cachedValue, bool in_value)
+        {
+            if (m_invalidateAllCaches == true || out_cachedValue != in_value)
+            {
+                out_cachedValue = in_value;
+                ++m_currentFrameStats.m_numStateChanges;
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::InvalidateCaches()
+        {
+            m_invalidateAllCaches = true;
+            m_currentMaterial = nullptr;
+            m_currentShader = nullptr;
+            m_currentLight = nullptr;
+        }
+    }
+}
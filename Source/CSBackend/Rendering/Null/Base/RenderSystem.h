@@ -0,0 +1,348 @@
+//
+//  RenderSystem.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_RENDERSYSTEM_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_RENDERSYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Rendering/Base/BlendMode.h>
+#include <ChilliSource/Rendering/Base/CullFace.h>
+#include <ChilliSource/Rendering/Base/DepthTestComparison.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// A render system which issues no graphics API calls. It
+        /// tracks render state in the same way as the OpenGL render
+        /// system, and counts the draw calls and state changes that
+        /// would have been made, allowing the CPU cost of rendering
+        /// to be measured on machines without a GPU or display.
+        ///
+        /// The null backend is selected by building with
+        /// CS_RENDERBACKEND_NULL defined.
+        ///
+        /// @author Jordan Brown
+        //----------------------------------------------------------
+        class RenderSystem final : public CSRendering::RenderSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(RenderSystem);
+            //----------------------------------------------------------
+            /// The counters for a single frame. Render passes into
+            /// render targets, such as shadow maps, are included in the
+            /// frame that is presented after them.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            struct FrameStats
+            {
+                u32 m_numPasses = 0;
+                u32 m_numDrawCalls = 0;
+                u32 m_numElementsDrawn = 0;
+                u32 m_numMaterialApplies = 0;
+                u32 m_numMaterialChanges = 0;
+                u32 m_numShaderChanges = 0;
+                u32 m_numTextureBinds = 0;
+                u32 m_numJointUploads = 0;
+                u32 m_numLightChanges = 0;
+                u32 m_numStateChanges = 0;
+            };
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Comparison Type
+            ///
+            /// @return Whether the class matches the comparison type
+            //----------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //----------------------------------------------------------
+            /// Resets the render state cache.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void Init() override;
+            //----------------------------------------------------------
+            /// Resets the render state cache, as a context restore
+            /// would on a real device.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void Resume() override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void Suspend() override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void Destroy() override;
+            //----------------------------------------------------------
+            /// Begins a render pass into the given target, or the
+            /// screen if the target is null.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The render target or null.
+            //----------------------------------------------------------
+            void BeginFrame(CSRendering::RenderTarget* in_renderTarget) override;
+            //----------------------------------------------------------
+            /// Ends the render pass. If rendering to the screen this
+            /// also ends the frame, storing the counters for it and
+            /// resetting them for the next frame.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The render target or null.
+            //----------------------------------------------------------
+            void EndFrame(CSRendering::RenderTarget* in_renderTarget) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The material to apply.
+            /// @param The shader pass to apply it for.
+            //----------------------------------------------------------
+            void ApplyMaterial(const CSRendering::MaterialCSPtr& in_material, CSRendering::ShaderPass in_shaderPass) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The joint palette.
+            //----------------------------------------------------------
+            void ApplyJoints(const std::vector<CSCore::Vector4>& in_jointPalette) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Camera position
+            /// @param Camera view matrix
+            /// @param Camera projection matrix
+            /// @param Clear colour
+            //----------------------------------------------------------
+            void ApplyCamera(const CSCore::Vector3& in_position, const CSCore::Matrix4& in_view, const CSCore::Matrix4& in_projection, const CSCore::Colour& in_clearColour) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The light to use for subsequent draws.
+            //----------------------------------------------------------
+            void SetLight(CSRendering::LightComponent* in_lightComponent) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not alpha blending is enabled.
+            //----------------------------------------------------------
+            void EnableAlphaBlending(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not depth testing is enabled.
+            //----------------------------------------------------------
+            void EnableDepthTesting(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not face culling is enabled.
+            //----------------------------------------------------------
+            void EnableFaceCulling(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not colour writing is enabled.
+            //----------------------------------------------------------
+            void EnableColourWriting(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not depth writing is enabled.
+            //----------------------------------------------------------
+            void EnableDepthWriting(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not scissor testing is enabled.
+            //----------------------------------------------------------
+            void EnableScissorTesting(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void LockDepthWriting() override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void UnlockDepthWriting() override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void LockAlphaBlending() override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void UnlockAlphaBlending() override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void LockBlendFunction() override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void UnlockBlendFunction() override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The source blend mode.
+            /// @param The destination blend mode.
+            //----------------------------------------------------------
+            void SetBlendFunction(CSRendering::BlendMode in_srcFunc, CSRendering::BlendMode in_dstFunc) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The depth test comparison.
+            //----------------------------------------------------------
+            void SetDepthFunction(CSRendering::DepthTestComparison in_func) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The face to cull.
+            //----------------------------------------------------------
+            void SetCullFace(CSRendering::CullFace in_cullFace) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The bottom left of the scissor region.
+            /// @param The size of the scissor region.
+            //----------------------------------------------------------
+            void SetScissorRegion(const CSCore::Vector2& in_position, const CSCore::Vector2& in_size) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The buffer description.
+            ///
+            /// @return A new mesh buffer backed by main memory.
+            //----------------------------------------------------------
+            CSRendering::MeshBuffer* CreateBuffer(CSRendering::BufferDescription& in_desc) override;
+            //----------------------------------------------------------
+            /// Counts a draw of the given vertices.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The buffer to be rendered
+            /// @param Offset into vertex buffer
+            /// @param Number of vertices to render
+            /// @param The world matrix
+            //----------------------------------------------------------
+            void RenderVertexBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numVerts, const CSCore::Matrix4& in_world) override;
+            //----------------------------------------------------------
+            /// Counts a draw of the given indices.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The buffer to be rendered
+            /// @param Offset into index buffer
+            /// @param Number of indices to render
+            /// @param The world matrix
+            //----------------------------------------------------------
+            void RenderBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numIndices, const CSCore::Matrix4& in_world) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Width of the render target
+            /// @param Height of the render target
+            ///
+            /// @return A new render target.
+            //----------------------------------------------------------
+            CSRendering::RenderTarget* CreateRenderTarget(u32 in_width, u32 in_height) override;
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The counters for the last frame presented.
+            //----------------------------------------------------------
+            const FrameStats& GetFrameStats() const;
+
+        private:
+            friend CSRendering::RenderSystemUPtr CSRendering::RenderSystem::Create(CSRendering::RenderCapabilities*);
+            //----------------------------------------------------------
+            /// Private constructor to force use of factory method
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The render capabilities.
+            //----------------------------------------------------------
+            RenderSystem(CSRendering::RenderCapabilities* in_renderCapabilities);
+            //----------------------------------------------------------
+            /// Counts a change of the given cached flag if it differs
+            /// from the new value, or if the cache is invalid.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [Out] The cached flag.
+            /// @param The new value.
+            //----------------------------------------------------------
+            void SetFlag(bool& out_cachedValue, bool in_value);
+            //----------------------------------------------------------
+            /// Resets the cached render state, forcing the next
+            /// setting of each state to be counted as a change.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void InvalidateCaches();
+
+            CSRendering::RenderCapabilities* m_renderCapabilities;
+
+            const CSRendering::Material* m_currentMaterial = nullptr;
+            const CSRendering::Shader* m_currentShader = nullptr;
+            CSRendering::LightComponent* m_currentLight = nullptr;
+            bool m_invalidateAllCaches = true;
+
+            bool m_isAlphaBlendingEnabled = false;
+            bool m_isDepthTestEnabled = false;
+            bool m_isCullingEnabled = false;
+            bool m_isColourWriteEnabled = false;
+            bool m_isDepthWriteEnabled = false;
+            bool m_isScissorTestEnabled = false;
+
+            bool m_isAlphaBlendingLocked = false;
+            bool m_isDepthWriteLocked = false;
+            bool m_isBlendFunctionLocked = false;
+
+            CSRendering::BlendMode m_srcBlendFunc = CSRendering::BlendMode::k_one;
+            CSRendering::BlendMode m_dstBlendFunc = CSRendering::BlendMode::k_zero;
+            CSRendering::DepthTestComparison m_depthFunc = CSRendering::DepthTestComparison::k_less;
+            CSRendering::CullFace m_cullFace = CSRendering::CullFace::k_back;
+            CSCore::Vector2 m_scissorPosition;
+            CSCore::Vector2 m_scissorSize;
+
+            FrameStats m_currentFrameStats;
+            FrameStats m_frameStats;
+        };
+    }
+}
+
+#endif
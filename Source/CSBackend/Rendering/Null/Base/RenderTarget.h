@@ -0,0 +1,104 @@
+//
+//  RenderTarget.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_RENDERTARGET_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_RENDERTARGET_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Base/RenderTarget.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //------------------------------------------------------
+        /// A render target for the null render backend. This
+        /// holds on to its target textures but never renders
+        /// into them.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------
+        class RenderTarget final : public CSRendering::RenderTarget
+        {
+        public:
+            //------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Width of the render target
+            /// @param Height of the render target
+            //------------------------------------------------------
+            RenderTarget(u32 in_width, u32 in_height);
+            //------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The colour texture.
+            /// @param The depth texture.
+            //------------------------------------------------------
+            void SetTargetTextures(const CSRendering::TextureSPtr& in_colourTexture, const CSRendering::TextureSPtr& in_depthTexture) override;
+            //------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The colour texture.
+            //------------------------------------------------------
+            const CSRendering::TextureSPtr& GetColourTexture() const override;
+            //------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The depth texture.
+            //------------------------------------------------------
+            const CSRendering::TextureSPtr& GetDepthTexture() const override;
+            //------------------------------------------------------
+            /// Does nothing as there is no frame buffer to bind.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------
+            void Bind() override;
+            //------------------------------------------------------
+            /// Does nothing as there is no frame buffer to discard.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------
+            void Discard() override;
+            //------------------------------------------------------
+            /// Releases the target textures.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------
+            void Destroy() override;
+
+        private:
+            CSRendering::TextureSPtr m_colourTexture;
+            CSRendering::TextureSPtr m_depthTexture;
+        };
+    }
+}
+
+#endif
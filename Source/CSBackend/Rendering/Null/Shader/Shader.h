@@ -0,0 +1,73 @@
+//
+//  Shader.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_SHADER_SHADER_H_
+#define _CSBACKEND_RENDERING_NULL_SHADER_SHADER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Shader/Shader.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// A shader for the null render backend. This has no
+        /// program and exists only so that materials can reference
+        /// it.
+        ///
+        /// @author Jordan Brown
+        //----------------------------------------------------------
+        class Shader final : public CSRendering::Shader
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(Shader);
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Interface ID type
+            ///
+            /// @return Whether the object is of this type
+            //----------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+
+        private:
+            friend CSRendering::ShaderUPtr CSRendering::Shader::Create();
+            //----------------------------------------------------------
+            /// Private constructor to enforce the use of the factory
+            /// method
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            Shader() = default;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,107 @@
+//
+//  Cubemap.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_TEXTURE_CUBEMAP_H_
+#define _CSBACKEND_RENDERING_NULL_TEXTURE_CUBEMAP_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Texture/Cubemap.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //--------------------------------------------------------------
+        /// A cubemap for the null render backend. The face image data
+        /// is released as soon as it is built.
+        ///
+        /// @author Jordan Brown
+        //--------------------------------------------------------------
+        class Cubemap final : public CSRendering::Cubemap
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(Cubemap);
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Interface ID type
+            ///
+            /// @return Whether the object is of this type
+            //--------------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //--------------------------------------------------------------
+            /// Releases the face image data.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Texture descriptors for each face
+            /// @param Image data for each face
+            /// @param Whether the cubemap should have mip maps generated
+            /// @param Whether or not the cubemap data should be
+            /// restored after a context loss. This is ignored.
+            //--------------------------------------------------------------
+            void Build(const std::array<CSRendering::Texture::Descriptor, 6>& in_descs, std::array<CSRendering::Texture::TextureDataUPtr, 6>&& in_datas, bool in_mipMap, bool in_restoreCubemapDataEnabled) override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Texture unit
+            //--------------------------------------------------------------
+            void Bind(u32 in_texUnit = 0) override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            //--------------------------------------------------------------
+            void Unbind() override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Filter mode
+            //--------------------------------------------------------------
+            void SetFilterMode(CSRendering::Texture::FilterMode in_mode) override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Horizontal wrapping
+            /// @param Vertical wrapping
+            //--------------------------------------------------------------
+            void SetWrapMode(CSRendering::Texture::WrapMode in_sMode, CSRendering::Texture::WrapMode in_tMode) override;
+
+        private:
+            friend CSRendering::CubemapUPtr CSRendering::Cubemap::Create();
+            //--------------------------------------------------------------
+            /// Private constructor to enforce the use of the factory
+            /// method
+            ///
+            /// @author Jordan Brown
+            //--------------------------------------------------------------
+            Cubemap() = default;
+        };
+    }
+}
+
+#endif
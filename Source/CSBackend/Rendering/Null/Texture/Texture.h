@@ -0,0 +1,124 @@
+//
+//  Texture.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_TEXTURE_TEXTURE_H_
+#define _CSBACKEND_RENDERING_NULL_TEXTURE_TEXTURE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //--------------------------------------------------------------
+        /// A texture for the null render backend. This records the
+        /// dimensions of the image it was built from, but the image
+        /// data itself is released immediately.
+        ///
+        /// @author Jordan Brown
+        //--------------------------------------------------------------
+        class Texture final : public CSRendering::Texture
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(Texture);
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Interface ID type
+            ///
+            /// @return Whether the object is of this type
+            //--------------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //--------------------------------------------------------------
+            /// Stores the dimensions of the texture and releases the
+            /// image data.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Texture descriptor
+            /// @param Image data
+            /// @param Whether the texture should have mip maps generated
+            /// @param Whether or not the texture data should be
+            /// restored after a context loss. This is ignored.
+            //--------------------------------------------------------------
+            void Build(const Descriptor& in_desc, TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled) override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Texture unit
+            //--------------------------------------------------------------
+            void Bind(u32 in_texUnit = 0) override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            //--------------------------------------------------------------
+            void Unbind() override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Filter mode
+            //--------------------------------------------------------------
+            void SetFilterMode(FilterMode in_mode) override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Horizontal wrapping
+            /// @param Vertical wrapping
+            //--------------------------------------------------------------
+            void SetWrapMode(WrapMode in_sMode, WrapMode in_tMode) override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The width of the texture in texels
+            //--------------------------------------------------------------
+            u32 GetWidth() const override;
+            //--------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The height of the texture in texels
+            //--------------------------------------------------------------
+            u32 GetHeight() const override;
+
+        private:
+            friend CSRendering::TextureUPtr CSRendering::Texture::Create();
+            //--------------------------------------------------------------
+            /// Private constructor to enforce the use of the factory
+            /// method
+            ///
+            /// @author Jordan Brown
+            //--------------------------------------------------------------
+            Texture() = default;
+
+            u32 m_width = 0;
+            u32 m_height = 0;
+        };
+    }
+}
+
+#endif
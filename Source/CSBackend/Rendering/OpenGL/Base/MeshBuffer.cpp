@@ -48,7 +48,7 @@ namespace CSBackend
 		//-----------------------------------------------------
 		MeshBuffer::MeshBuffer(CSRendering::BufferDescription &inBuffDesc) 
         : CSRendering::MeshBuffer(inBuffDesc), mVertexBuffer(0), mIndexBuffer(0), mBufferUsage(0), mBufferAccess(0),
-          mpVertexData(nullptr), mpIndexData(nullptr), mpVertexDataBackup(nullptr), mpIndexDataBackup(nullptr), mbMapBufferAvailable(false), mbCacheValid(false)
+          mpVertexData(nullptr), mpIndexData(nullptr), mudwLockedVertexOffset(0), mudwLockedVertexSize(0), mpVertexDataBackup(nullptr), mpIndexDataBackup(nullptr), mbMapBufferAvailable(false), mbCacheValid(false)
 		{
             mbMapBufferAvailable = CSCore::Application::Get()->GetSystem<CSRendering::RenderCapabilities>()->IsMapBufferSupported();
             
@@ -134,7 +134,22 @@ namespace CSBackend
 		//-----------------------------------------------------
 		bool MeshBuffer::LockVertex(f32** outppBuffer, u32 inDataOffset, u32 inDataStride)
 		{
-			if(mbMapBufferAvailable)
+			if(mBufferDesc.eAccessFlag == CSRendering::BufferAccess::k_writeNoOverwrite)
+			{
+				//Ranged writes are staged in a copy of the buffer and uploaded with glBufferSubData() on unlock. Mapping
+				//the buffer instead would wait on every pending draw that uses it, not just those using this range.
+				if(!mpVertexData)
+				{
+					mpVertexData = (f32*)new u8[mBufferDesc.VertexDataCapacity];
+				}
+
+				mudwLockedVertexOffset = inDataOffset;
+				mudwLockedVertexSize = (inDataStride > 0) ? inDataStride : mBufferDesc.VertexDataCapacity - inDataOffset;
+				CS_ASSERT(mudwLockedVertexOffset + mudwLockedVertexSize <= mBufferDesc.VertexDataCapacity, "Cannot lock a range outside of the vertex buffer.");
+
+				(*outppBuffer) = (f32*)((u8*)mpVertexData + inDataOffset);
+			}
+			else if(mbMapBufferAvailable)
 			{
 				if (mBufferDesc.eUsageFlag == CSRendering::BufferUsage::k_dynamic)
 				{
@@ -211,7 +226,19 @@ namespace CSBackend
 		//-----------------------------------------------------
 		bool MeshBuffer::UnlockVertex()
 		{
-			if(mbMapBufferAvailable)
+			if(mBufferDesc.eAccessFlag == CSRendering::BufferAccess::k_writeNoOverwrite)
+			{
+				//Writing from the start of the buffer discards its contents, so orphan it rather than waiting on draws using it
+				if(mudwLockedVertexOffset == 0)
+				{
+					glBufferData(GL_ARRAY_BUFFER, mBufferDesc.VertexDataCapacity, nullptr, mBufferUsage);
+				}
+
+				glBufferSubData(GL_ARRAY_BUFFER, mudwLockedVertexOffset, mudwLockedVertexSize, (u8*)mpVertexData + mudwLockedVertexOffset);
+                CS_ASSERT_NOGLERROR("An OpenGL error occurred while unlocking vertex buffer.");
+				return true;
+			}
+			else if(mbMapBufferAvailable)
 			{
 				mpVertexData = nullptr;
                 bool success = false;
@@ -231,6 +258,18 @@ namespace CSBackend
 			}
 		}
 		//-----------------------------------------------------
+		//-----------------------------------------------------
+		bool MeshBuffer::UnlockVertex(u32 in_numBytesWritten)
+		{
+			if(mBufferDesc.eAccessFlag == CSRendering::BufferAccess::k_writeNoOverwrite)
+			{
+				CS_ASSERT(in_numBytesWritten <= mudwLockedVertexSize, "Cannot write more than the locked range of the vertex buffer.");
+				mudwLockedVertexSize = in_numBytesWritten;
+			}
+
+			return UnlockVertex();
+		}
+		//-----------------------------------------------------
 		/// Unlock Index
 		///
 		/// Releases the buffer from mapping
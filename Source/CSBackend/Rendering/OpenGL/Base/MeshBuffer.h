@@ -76,6 +76,18 @@ namespace CSBackend
             //-----------------------------------------------------
 			bool UnlockVertex();
             //-----------------------------------------------------
+            /// Releases the buffer from mapping, keeping only the
+            /// given number of bytes of the locked range for
+            /// k_writeNoOverwrite buffers.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The number of bytes written to the locked range.
+            ///
+            /// @return If successful
+            //-----------------------------------------------------
+			bool UnlockVertex(u32 in_numBytesWritten);
+            //-----------------------------------------------------
             /// Lock Index
             ///
             /// Obtain a handle to the buffer memory in order
@@ -141,6 +153,9 @@ namespace CSBackend
             
             f32* mpVertexData;
             u16* mpIndexData;
+            
+            u32 mudwLockedVertexOffset;
+            u32 mudwLockedVertexSize;
 
             f32* mpVertexDataBackup;
             u16* mpIndexDataBackup;
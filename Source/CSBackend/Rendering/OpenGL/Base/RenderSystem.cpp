@@ -295,25 +295,17 @@ namespace CSBackend
                 const_cast<CSRendering::Material*>(mpCurrentMaterial)->SetCacheValid();
             }
             
-            shader->SetUniform("u_cameraPos", mvCameraPos, Shader::UniformNotFoundPolicy::k_failSilent);
+            shader->SetUniform(Shader::BuiltInUniform::k_cameraPos, mvCameraPos, Shader::UniformNotFoundPolicy::k_failSilent);
 		}
         //----------------------------------------------------------
         /// Apply Joints
         //----------------------------------------------------------
-        void RenderSystem::ApplyJoints(const std::vector<CSCore::Matrix4>& inaJoints)
+        void RenderSystem::ApplyJoints(const std::vector<CSCore::Vector4>& in_jointPalette)
         {
             CS_ASSERT(m_currentShader != nullptr,  "Cannot set joints without binding shader");
             
-            //Remove the final column from the joint matrix data as it is always going to be [0 0 0 1].
-            std::vector<CSCore::Vector4> jointVectors;
-            for (const auto& joint : inaJoints)
-            {
-                jointVectors.push_back(CSCore::Vector4(joint.m[0], joint.m[4], joint.m[8], joint.m[12]));
-                jointVectors.push_back(CSCore::Vector4(joint.m[1], joint.m[5], joint.m[9], joint.m[13]));
-                jointVectors.push_back(CSCore::Vector4(joint.m[2], joint.m[6], joint.m[10], joint.m[14]));
-            }
-            
-            m_currentShader->SetUniform("u_joints", jointVectors);
+            //The palette is already in the 3 row layout the shader expects so can be uploaded as is.
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_joints, in_jointPalette);
         }
         //----------------------------------------------------------
 		/// Apply Render States
@@ -373,7 +365,7 @@ namespace CSBackend
                 //with a list of commands and texture handles
                 Cubemap* cubemap = (Cubemap*)inMaterial->GetCubemap().get();
                 cubemap->Bind(mudwNumBoundTextures);
-                out_shader->SetUniform("u_cubemap", (s32)mudwNumBoundTextures);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_cubemap, (s32)mudwNumBoundTextures);
                 ++mudwNumBoundTextures;
             }
             
@@ -399,25 +391,25 @@ namespace CSBackend
             {
                 mbEmissiveSet = true;
                 mCurrentEmissive = inMaterial->GetEmissive();
-                out_shader->SetUniform("u_emissive", mCurrentEmissive, Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_emissive, mCurrentEmissive, Shader::UniformNotFoundPolicy::k_failSilent);
             }
             if(mbInvalidateAllCaches || mbAmbientSet == false || mCurrentAmbient != inMaterial->GetAmbient())
             {
                 mbAmbientSet = true;
                 mCurrentAmbient = inMaterial->GetAmbient();
-                out_shader->SetUniform("u_ambient", mCurrentAmbient, Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_ambient, mCurrentAmbient, Shader::UniformNotFoundPolicy::k_failSilent);
             }
             if(mbInvalidateAllCaches || mbDiffuseSet == false || mCurrentDiffuse != inMaterial->GetDiffuse())
             {
                 mbDiffuseSet = true;
                 mCurrentDiffuse = inMaterial->GetDiffuse();
-                out_shader->SetUniform("u_diffuse", mCurrentDiffuse, Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_diffuse, mCurrentDiffuse, Shader::UniformNotFoundPolicy::k_failSilent);
             }
             if(mbInvalidateAllCaches || mbSpecularSet == false || mCurrentSpecular != inMaterial->GetSpecular())
             {
                 mbSpecularSet = true;
                 mCurrentSpecular = inMaterial->GetSpecular();
-                out_shader->SetUniform("u_specular", mCurrentSpecular, Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_specular, mCurrentSpecular, Shader::UniformNotFoundPolicy::k_failSilent);
             }
         }
         //----------------------------------------------------------
@@ -435,17 +427,17 @@ namespace CSBackend
             if(inpLightComponent->IsA(CSRendering::DirectionalLightComponent::InterfaceID))
             {
                 CSRendering::DirectionalLightComponent* pLightComponent = (CSRendering::DirectionalLightComponent*)inpLightComponent;
-                out_shader->SetUniform("u_lightDir", pLightComponent->GetDirection(), Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_lightDir, pLightComponent->GetDirection(), Shader::UniformNotFoundPolicy::k_failSilent);
                 
                 if(pLightComponent->GetShadowMapPtr() != nullptr)
                 {
-                    out_shader->SetUniform("u_shadowTolerance", pLightComponent->GetShadowTolerance(), Shader::UniformNotFoundPolicy::k_failSilent);
+                    out_shader->SetUniform(Shader::BuiltInUniform::k_shadowTolerance, pLightComponent->GetShadowTolerance(), Shader::UniformNotFoundPolicy::k_failSilent);
                     
                     //If we have used all the texture units then we cannot bind the shadow map
                     if(mudwNumBoundTextures <= mpRenderCapabilities->GetNumTextureUnits())
                     {
                         pLightComponent->GetShadowMapPtr()->Bind(mudwNumBoundTextures);
-                        out_shader->SetUniform("u_shadowMap", (s32)mudwNumBoundTextures, Shader::UniformNotFoundPolicy::k_failSilent);
+                        out_shader->SetUniform(Shader::BuiltInUniform::k_shadowMap, (s32)mudwNumBoundTextures, Shader::UniformNotFoundPolicy::k_failSilent);
                         ++mudwNumBoundTextures;
                     }
                     else
@@ -457,14 +449,14 @@ namespace CSBackend
             else if(inpLightComponent->IsA(CSRendering::PointLightComponent::InterfaceID))
             {
                 CSRendering::PointLightComponent* pLightComponent = (CSRendering::PointLightComponent*)inpLightComponent;
-                out_shader->SetUniform("u_attenuationConstant", pLightComponent->GetConstantAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
-                out_shader->SetUniform("u_attenuationLinear", pLightComponent->GetLinearAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
-                out_shader->SetUniform("u_attenuationQuadratic", pLightComponent->GetQuadraticAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_attenuationConstant, pLightComponent->GetConstantAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_attenuationLinear, pLightComponent->GetLinearAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_attenuationQuadratic, pLightComponent->GetQuadraticAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
             }
             
-            out_shader->SetUniform("u_lightPos", inpLightComponent->GetWorldPosition(), Shader::UniformNotFoundPolicy::k_failSilent);
-            out_shader->SetUniform("u_lightCol", inpLightComponent->GetColour(), Shader::UniformNotFoundPolicy::k_failSilent);
-            out_shader->SetUniform("u_lightMat", inpLightComponent->GetLightMatrix(), Shader::UniformNotFoundPolicy::k_failSilent);
+            out_shader->SetUniform(Shader::BuiltInUniform::k_lightPos, inpLightComponent->GetWorldPosition(), Shader::UniformNotFoundPolicy::k_failSilent);
+            out_shader->SetUniform(Shader::BuiltInUniform::k_lightCol, inpLightComponent->GetColour(), Shader::UniformNotFoundPolicy::k_failSilent);
+            out_shader->SetUniform(Shader::BuiltInUniform::k_lightMat, inpLightComponent->GetLightMatrix(), Shader::UniformNotFoundPolicy::k_failSilent);
         }
 		//----------------------------------------------------------
 		/// Apply Camera
@@ -540,11 +532,11 @@ namespace CSBackend
 			//Set the new model view matrix based on the camera view matrix and the object matrix
             static CSCore::Matrix4 matWorldViewProj;
 			matWorldViewProj = inmatWorld * mmatViewProj;
-            m_currentShader->SetUniform("u_wvpMat", matWorldViewProj, Shader::UniformNotFoundPolicy::k_failSilent);
-            m_currentShader->SetUniform("u_worldMat", inmatWorld, Shader::UniformNotFoundPolicy::k_failSilent);
-            if(m_currentShader->HasUniform("u_normalMat"))
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_wvpMat, matWorldViewProj, Shader::UniformNotFoundPolicy::k_failSilent);
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_worldMat, inmatWorld, Shader::UniformNotFoundPolicy::k_failSilent);
+            if(m_currentShader->HasUniform(Shader::BuiltInUniform::k_normalMat))
             {
-                m_currentShader->SetUniform("u_normalMat", CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(inmatWorld)));
+                m_currentShader->SetUniform(Shader::BuiltInUniform::k_normalMat, CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(inmatWorld)));
             }
             
 			EnableVertexAttributeForSemantic(inpBuffer);
@@ -562,11 +554,11 @@ namespace CSBackend
 			//Set the new model view matrix based on the camera view matrix and the object matrix
             static CSCore::Matrix4 matWorldViewProj;
 			matWorldViewProj = inmatWorld * mmatViewProj;
-            m_currentShader->SetUniform("u_wvpMat", matWorldViewProj, Shader::UniformNotFoundPolicy::k_failSilent);
-            m_currentShader->SetUniform("u_worldMat", inmatWorld, Shader::UniformNotFoundPolicy::k_failSilent);
-            if(m_currentShader->HasUniform("u_normalMat"))
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_wvpMat, matWorldViewProj, Shader::UniformNotFoundPolicy::k_failSilent);
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_worldMat, inmatWorld, Shader::UniformNotFoundPolicy::k_failSilent);
+            if(m_currentShader->HasUniform(Shader::BuiltInUniform::k_normalMat))
             {
-                m_currentShader->SetUniform("u_normalMat", CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(inmatWorld)));
+                m_currentShader->SetUniform(Shader::BuiltInUniform::k_normalMat, CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(inmatWorld)));
             }
             
 			//Render the buffer contents
@@ -161,11 +161,12 @@ namespace CSBackend
             //----------------------------------------------------------
 			/// Apply Joints
 			///
-			/// Applies the joint matrices to the next render batch.
+			/// Applies the joint palette to the next render batch.
 			///
-			/// @param Dynamic array of joint matrices.
+			/// @param The joint palette. This contains the top 3 rows
+			/// of each skinning matrix.
 			//----------------------------------------------------------
-            void ApplyJoints(const std::vector<CSCore::Matrix4>& inaJoints) override;
+            void ApplyJoints(const std::vector<CSCore::Vector4>& in_jointPalette) override;
 			//----------------------------------------------------------
 			/// Create Render Target
 			///
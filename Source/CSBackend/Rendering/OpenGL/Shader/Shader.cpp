@@ -34,11 +34,38 @@
 #include <ChilliSource/Core/Math/Matrix4.h>
 
 #include <array>
+#include <cstring>
 
 namespace CSBackend
 {
 	namespace OpenGL
 	{
+        namespace
+        {
+            const std::array<const char*, (u32)Shader::BuiltInUniform::k_total> k_builtInUniformNames =
+            {{
+                "u_wvpMat",
+                "u_worldMat",
+                "u_normalMat",
+                "u_cameraPos",
+                "u_joints",
+                "u_cubemap",
+                "u_emissive",
+                "u_ambient",
+                "u_diffuse",
+                "u_specular",
+                "u_lightDir",
+                "u_lightPos",
+                "u_lightCol",
+                "u_lightMat",
+                "u_shadowTolerance",
+                "u_shadowMap",
+                "u_attenuationConstant",
+                "u_attenuationLinear",
+                "u_attenuationQuadratic"
+            }};
+        }
+        
         CS_DEFINE_NAMEDTYPE(Shader);
         
         //----------------------------------------------------------
@@ -64,6 +91,7 @@ namespace CSBackend
             CompileShader(in_fs, GL_FRAGMENT_SHADER);
             CreateProgram(m_vertexShaderId, m_fragmentShaderId);
             PopulateAttributeHandles();
+            PopulateBuiltInUniformHandles();
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
@@ -115,6 +143,7 @@ namespace CSBackend
                 }
             }
             
+            InvalidateBuiltInUniformCache(handle);
             glUniform1i(handle, in_value);
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
@@ -137,6 +166,7 @@ namespace CSBackend
                 }
             }
             
+            InvalidateBuiltInUniformCache(handle);
             glUniform1f(handle, in_value);
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
@@ -159,6 +189,7 @@ namespace CSBackend
                 }
             }
             
+            InvalidateBuiltInUniformCache(handle);
             glUniform2fv(handle, 1, (GLfloat*)(&in_value));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
@@ -181,6 +212,7 @@ namespace CSBackend
                 }
             }
             
+            InvalidateBuiltInUniformCache(handle);
             glUniform3fv(handle, 1, (GLfloat*)(&in_value));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
@@ -203,6 +235,7 @@ namespace CSBackend
                 }
             }
             
+            InvalidateBuiltInUniformCache(handle);
             glUniform4fv(handle, 1, (GLfloat*)(&in_value));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
@@ -225,6 +258,7 @@ namespace CSBackend
                 }
             }
             
+            InvalidateBuiltInUniformCache(handle);
             glUniformMatrix4fv(handle, 1, GL_FALSE, (GLfloat*)(&in_value.m));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
@@ -247,6 +281,7 @@ namespace CSBackend
                 }
             }
             
+            InvalidateBuiltInUniformCache(handle);
             glUniform4fv(handle, 1, (GLfloat*)(&in_value));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
@@ -269,6 +304,7 @@ namespace CSBackend
                 }
             }
             
+            InvalidateBuiltInUniformCache(handle);
             glUniform4fv(handle, in_vec4Values.size(), (GLfloat*)(&in_vec4Values[0]));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
@@ -281,6 +317,101 @@ namespace CSBackend
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, s32 in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            GLint handle = -1;
+            if(ShouldUploadBuiltInUniform(in_uniform, &in_value, sizeof(in_value), in_notFoundPolicy, handle) == false)
+            {
+                return;
+            }
+            
+            glUniform1i(handle, in_value);
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, f32 in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            GLint handle = -1;
+            if(ShouldUploadBuiltInUniform(in_uniform, &in_value, sizeof(in_value), in_notFoundPolicy, handle) == false)
+            {
+                return;
+            }
+            
+            glUniform1f(handle, in_value);
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const CSCore::Vector3& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            GLint handle = -1;
+            if(ShouldUploadBuiltInUniform(in_uniform, &in_value, sizeof(in_value), in_notFoundPolicy, handle) == false)
+            {
+                return;
+            }
+            
+            glUniform3fv(handle, 1, (GLfloat*)(&in_value));
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const CSCore::Matrix4& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            GLint handle = -1;
+            if(ShouldUploadBuiltInUniform(in_uniform, in_value.m, sizeof(in_value.m), in_notFoundPolicy, handle) == false)
+            {
+                return;
+            }
+            
+            glUniformMatrix4fv(handle, 1, GL_FALSE, in_value.m);
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const CSCore::Colour& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            GLint handle = -1;
+            if(ShouldUploadBuiltInUniform(in_uniform, &in_value, sizeof(in_value), in_notFoundPolicy, handle) == false)
+            {
+                return;
+            }
+            
+            glUniform4fv(handle, 1, (GLfloat*)(&in_value));
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const std::vector<CSCore::Vector4>& in_vec4Values, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            if(in_vec4Values.empty() == true)
+            {
+                return;
+            }
+            
+            GLint handle = -1;
+            if(ShouldUploadBuiltInUniform(in_uniform, &in_vec4Values[0], in_vec4Values.size() * sizeof(CSCore::Vector4), in_notFoundPolicy, handle) == false)
+            {
+                return;
+            }
+            
+            glUniform4fv(handle, in_vec4Values.size(), (GLfloat*)(&in_vec4Values[0]));
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool Shader::HasUniform(BuiltInUniform in_uniform) const
+        {
+            return m_builtInUniforms[(u32)in_uniform].m_handle >= 0;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
         void Shader::SetAttribute(const std::string& in_varName, GLint in_size, GLenum in_type, GLboolean in_isNormalized, GLsizei in_stride, const GLvoid* in_offset)
         {
             auto it = m_attribHandles.find(in_varName);
@@ -311,6 +442,69 @@ namespace CSBackend
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while getting uniform handle.");
             
             return handle;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::PopulateBuiltInUniformHandles()
+        {
+            for(u32 i = 0; i < (u32)BuiltInUniform::k_total; ++i)
+            {
+                m_builtInUniforms[i].m_handle = glGetUniformLocation(m_programId, k_builtInUniformNames[i]);
+                m_builtInUniforms[i].m_cachedValueSize = 0;
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while populating built-in uniform handles.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool Shader::ShouldUploadBuiltInUniform(BuiltInUniform in_uniform, const void* in_value, u32 in_valueSize, UniformNotFoundPolicy in_notFoundPolicy, GLint& out_handle)
+        {
+            BuiltInUniformSlot& slot = m_builtInUniforms[(u32)in_uniform];
+            out_handle = slot.m_handle;
+            
+            if(out_handle < 0)
+            {
+                switch (in_notFoundPolicy)
+                {
+                    case UniformNotFoundPolicy::k_failHard:
+                        CS_LOG_FATAL("Cannot find shader uniform: " + std::string(k_builtInUniformNames[(u32)in_uniform]));
+                        return false;
+                    case UniformNotFoundPolicy::k_failSilent:
+                        return false;
+                }
+            }
+            
+            if(in_valueSize > slot.m_cachedValue.size())
+            {
+                slot.m_cachedValueSize = 0;
+                return true;
+            }
+            
+            if(slot.m_cachedValueSize == in_valueSize && std::memcmp(slot.m_cachedValue.data(), in_value, in_valueSize) == 0)
+            {
+                return false;
+            }
+            
+            std::memcpy(slot.m_cachedValue.data(), in_value, in_valueSize);
+            slot.m_cachedValueSize = in_valueSize;
+            return true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::InvalidateBuiltInUniformCache(GLint in_handle)
+        {
+            if(in_handle < 0)
+            {
+                return;
+            }
+            
+            for(auto& slot : m_builtInUniforms)
+            {
+                if(slot.m_handle == in_handle)
+                {
+                    slot.m_cachedValueSize = 0;
+                }
+            }
         }
 		//----------------------------------------------------------
 		//----------------------------------------------------------
@@ -421,6 +615,12 @@ namespace CSBackend
             m_attribHandles.clear();
             m_uniformHandles.clear();
             
+            for(auto& slot : m_builtInUniforms)
+            {
+                slot.m_handle = -1;
+                slot.m_cachedValueSize = 0;
+            }
+            
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while destroying shader.");
         }
 		//----------------------------------------------------------
@@ -34,6 +34,7 @@
 #include <CSBackend/Rendering/OpenGL/Base/GLIncludes.h>
 #include <ChilliSource/Rendering/Shader/Shader.h>
 
+#include <array>
 #include <unordered_map>
 
 namespace CSBackend
@@ -65,6 +66,38 @@ namespace CSBackend
                 k_failSilent
             };
             //----------------------------------------------------------
+            /// The uniforms set by the engine itself. These are
+            /// resolved to locations when the shader is built so that
+            /// setting them requires no string lookup, and the last
+            /// value uploaded to each is cached so redundant uploads
+            /// can be skipped.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            enum class BuiltInUniform
+            {
+                k_wvpMat,
+                k_worldMat,
+                k_normalMat,
+                k_cameraPos,
+                k_joints,
+                k_cubemap,
+                k_emissive,
+                k_ambient,
+                k_diffuse,
+                k_specular,
+                k_lightDir,
+                k_lightPos,
+                k_lightCol,
+                k_lightMat,
+                k_shadowTolerance,
+                k_shadowMap,
+                k_attenuationConstant,
+                k_attenuationLinear,
+                k_attenuationQuadratic,
+                k_total
+            };
+            //----------------------------------------------------------
             /// Compile the given vertex and fragment shaders
             /// into a shader program. Asserts on failure.
             ///
@@ -181,6 +214,85 @@ namespace CSBackend
             //----------------------------------------------------------
             bool HasUniform(const std::string& in_varName);
             //----------------------------------------------------------
+            /// Sets the given built-in uniform to the given value. If
+            /// the value is the same as the last one uploaded the
+            /// upload is skipped.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, s32 in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Sets the given built-in uniform to the given value. If
+            /// the value is the same as the last one uploaded the
+            /// upload is skipped.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, f32 in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Sets the given built-in uniform to the given value. If
+            /// the value is the same as the last one uploaded the
+            /// upload is skipped.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const CSCore::Vector3& in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Sets the given built-in uniform to the given value. If
+            /// the value is the same as the last one uploaded the
+            /// upload is skipped.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const CSCore::Matrix4& in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Sets the given built-in uniform to the given value. If
+            /// the value is the same as the last one uploaded the
+            /// upload is skipped.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const CSCore::Colour& in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Sets the given built-in uniform to the given values.
+            /// Arrays are always uploaded.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Uniform
+            /// @param Values
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const std::vector<CSCore::Vector4>& in_vec4Values, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Uniform
+            ///
+            /// @return Whether shader has the given built-in uniform.
+            //----------------------------------------------------------
+            bool HasUniform(BuiltInUniform in_uniform) const;
+            //----------------------------------------------------------
             /// Attempts to set the attribute shader variable with
             /// the given name. Will fail silently if variable not found.
             ///
@@ -256,6 +368,39 @@ namespace CSBackend
             /// @return Location or -1 if not found
             //----------------------------------------------------------
             GLint GetUniformHandle(const std::string& in_name);
+            //----------------------------------------------------------
+            /// Resolves the locations of the built-in uniforms. This
+            /// should be called once the program has been linked.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            void PopulateBuiltInUniformHandles();
+            //----------------------------------------------------------
+            /// Checks whether the given value needs to be uploaded to
+            /// the built-in uniform, updating the cached value if so.
+            /// Values larger than the cache are always uploaded.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Uniform
+            /// @param The value data.
+            /// @param The size of the value data in bytes.
+            /// @param Failure policy
+            /// @param [Out] The uniform location.
+            ///
+            /// @return Whether the value should be uploaded.
+            //----------------------------------------------------------
+            bool ShouldUploadBuiltInUniform(BuiltInUniform in_uniform, const void* in_value, u32 in_valueSize, UniformNotFoundPolicy in_notFoundPolicy, GLint& out_handle);
+            //----------------------------------------------------------
+            /// Clears the cached value of any built-in uniform at the
+            /// given location. This is used when a uniform is set by
+            /// name so the cache doesn't go stale.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The uniform location.
+            //----------------------------------------------------------
+            void InvalidateBuiltInUniformCache(GLint in_handle);
             
 		private:
 
@@ -265,6 +410,20 @@ namespace CSBackend
             
             //---Uniforms
             std::unordered_map<std::string, GLint> m_uniformHandles;
+            
+            //----------------------------------------------------------
+            /// The resolved location and last uploaded value of a
+            /// built-in uniform.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            struct BuiltInUniformSlot
+            {
+                GLint m_handle = -1;
+                u32 m_cachedValueSize = 0;
+                std::array<u8, sizeof(f32) * 16> m_cachedValue;
+            };
+            std::array<BuiltInUniformSlot, (u32)BuiltInUniform::k_total> m_builtInUniforms;
         
             //---Attributes
             std::unordered_map<std::string, GLint> m_attribHandles;
@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
 
 namespace CSBackend
 {
@@ -345,6 +346,21 @@ namespace CSBackend
                         UploadImageDataPVR4(i, m_formats[i], m_widths[i], m_heights[i], in_datas[i].get(), in_descs[i].m_dataSize);
                         break;
                 };
+                
+                if(m_compressions[i] == CSCore::ImageCompression::k_none)
+                {
+                    m_gpuMemorySize += m_widths[i] * m_heights[i] * CSCore::ImageFormatConverter::GetBytesPerPixel(m_formats[i]);
+                }
+                else
+                {
+                    m_gpuMemorySize += in_descs[i].m_dataSize;
+                }
+            }
+            
+            //The full mip chain adds a third to the size of the base level.
+            if(m_hasMipMaps == true)
+            {
+                m_gpuMemorySize += m_gpuMemorySize / 3;
             }
             
 #ifdef CS_TARGETPLATFORM_ANDROID
@@ -386,6 +402,30 @@ namespace CSBackend
 		{
 			return m_formats[(u32)in_face];
 		}
+        //--------------------------------------------------
+        //--------------------------------------------------
+        u32 Cubemap::GetCPUMemorySize() const
+        {
+            u32 size = 0;
+            
+#ifdef CS_TARGETPLATFORM_ANDROID
+            for(u32 i = 0; i < m_restorationDatas.size(); ++i)
+            {
+                if(m_restorationDatas[i] != nullptr)
+                {
+                    size += m_restorationDataSizes[i];
+                }
+            }
+#endif
+            
+            return size;
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        u32 Cubemap::GetGPUMemorySize() const
+        {
+            return m_gpuMemorySize;
+        }
 		//--------------------------------------------------
 		//--------------------------------------------------
 		void Cubemap::SetFilterMode(CSRendering::Texture::FilterMode in_mode)
@@ -433,6 +473,8 @@ namespace CSBackend
         //--------------------------------------------------
         void Cubemap::Destroy()
         {
+            m_gpuMemorySize = 0;
+            
             m_hasFilterModeChanged = true;
             m_hasWrapModeChanged = true;
             m_hasMipMaps = false;
@@ -141,6 +141,20 @@ namespace CSBackend
             ///			the cubemap face.
             //--------------------------------------------------
             CSCore::ImageFormat GetFormat(Face in_face) const;
+            //--------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The size of the copy of the cubemap data
+            /// kept for restoration after context loss, if any.
+            //--------------------------------------------------
+            u32 GetCPUMemorySize() const override;
+            //--------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The approximate size of all six faces in
+            /// video memory, including mip maps.
+            //--------------------------------------------------
+            u32 GetGPUMemorySize() const override;
             
 #ifdef CS_TARGETPLATFORM_ANDROID
             //--------------------------------------------------
@@ -186,6 +200,7 @@ namespace CSBackend
             TextureUnitSystem* m_texUnitSystem;
             
             GLuint m_cubemapHandle = 0;
+            u32 m_gpuMemorySize = 0;
             
             CSRendering::Texture::FilterMode m_filterMode = CSRendering::Texture::FilterMode::k_bilinear;
             CSRendering::Texture::WrapMode m_sWrapMode = CSRendering::Texture::WrapMode::k_clamp;
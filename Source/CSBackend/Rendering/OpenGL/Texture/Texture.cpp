@@ -343,6 +343,21 @@ namespace CSBackend
             
             m_hasMipMaps = in_mipMap;
             
+            if(m_compression == CSCore::ImageCompression::k_none)
+            {
+                m_gpuMemorySize = m_width * m_height * CSCore::ImageFormatConverter::GetBytesPerPixel(m_format);
+            }
+            else
+            {
+                m_gpuMemorySize = in_desc.m_dataSize;
+            }
+            
+            //The full mip chain adds a third to the size of the base level.
+            if(m_hasMipMaps == true)
+            {
+                m_gpuMemorySize += m_gpuMemorySize / 3;
+            }
+            
 #ifdef CS_TARGETPLATFORM_ANDROID
             if (GetStorageLocation() == CSCore::StorageLocation::k_none && in_restoreTextureDataEnabled == true)
             {
@@ -389,6 +404,22 @@ namespace CSBackend
         u32 Texture::GetHeight() const
         {
             return m_height;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 Texture::GetCPUMemorySize() const
+        {
+#ifdef CS_TARGETPLATFORM_ANDROID
+            return m_restorationDataSize;
+#else
+            return 0;
+#endif
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 Texture::GetGPUMemorySize() const
+        {
+            return m_gpuMemorySize;
         }
 		//--------------------------------------------------
 		//--------------------------------------------------
@@ -500,6 +531,7 @@ namespace CSBackend
         {
             m_width = 0;
             m_height = 0;
+            m_gpuMemorySize = 0;
             
             m_hasFilterModeChanged = true;
             m_hasWrapModeChanged = true;
@@ -143,6 +143,20 @@ namespace CSBackend
             /// @return The height of the texture in texels
             //--------------------------------------------------
             u32 GetHeight() const;
+            //--------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The size of the copy of the texture data
+            /// kept for restoration after context loss, if any.
+            //--------------------------------------------------
+            u32 GetCPUMemorySize() const override;
+            //--------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The approximate size of the texture in
+            /// video memory, including mip maps.
+            //--------------------------------------------------
+            u32 GetGPUMemorySize() const override;
             
 #ifdef CS_TARGETPLATFORM_ANDROID
             //--------------------------------------------------
@@ -199,6 +213,7 @@ namespace CSBackend
             
             u32 m_width = 0;
             u32 m_height = 0;
+            u32 m_gpuMemorySize = 0;
             CSCore::ImageFormat m_format;
             CSCore::ImageCompression m_compression;
             
@@ -47,6 +47,9 @@ namespace ChilliSource
             const std::string k_configFilePath = "App.config";
             const std::string k_defaultDisplayableName = "Chilli Source App";
             const u32 k_defaultPreferredFPS = 30;
+            const f32 k_defaultMainThreadTaskBudget = 5.0f;
+            const u32 k_defaultDynamicSpriteBatchCapacity = 512;
+            const f32 k_defaultResourceUploadBudget = 3.0f;
         }
         
         CS_DEFINE_NAMEDTYPE(AppConfig);
@@ -60,7 +63,7 @@ namespace ChilliSource
         //---------------------------------------------------------
         //---------------------------------------------------------
         AppConfig::AppConfig()
-        : m_preferredFPS(k_defaultPreferredFPS), m_displayableName(k_defaultDisplayableName)
+        : m_preferredFPS(k_defaultPreferredFPS), m_displayableName(k_defaultDisplayableName), m_mainThreadTaskBudget(k_defaultMainThreadTaskBudget), m_dynamicSpriteBatchCapacity(k_defaultDynamicSpriteBatchCapacity), m_resourceUploadBudget(k_defaultResourceUploadBudget)
         {
         }
         //---------------------------------------------------------
@@ -89,6 +92,30 @@ namespace ChilliSource
 		}
         //---------------------------------------------------------
         //---------------------------------------------------------
+        f32 AppConfig::GetMainThreadTaskBudget() const
+        {
+            return m_mainThreadTaskBudget;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        u32 AppConfig::GetDynamicSpriteBatchCapacity() const
+        {
+            return m_dynamicSpriteBatchCapacity;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        f32 AppConfig::GetResourceUploadBudget() const
+        {
+            return m_resourceUploadBudget;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        const std::unordered_map<std::string, u64>& AppConfig::GetResourceMemoryBudgets() const
+        {
+            return m_resourceMemoryBudgets;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
         void AppConfig::Load()
         {
             Json::Value root;
@@ -97,6 +124,20 @@ namespace ChilliSource
                 m_displayableName = root.get("DisplayableName", k_defaultDisplayableName).asString();
                 m_preferredFPS = root.get("PreferredFPS", k_defaultPreferredFPS).asUInt();
 				m_isVSyncEnabled = root.get("VSync", false).asBool();
+                m_mainThreadTaskBudget = root.get("MainThreadTaskBudget", k_defaultMainThreadTaskBudget).asFloat();
+                m_dynamicSpriteBatchCapacity = root.get("DynamicSpriteBatchCapacity", k_defaultDynamicSpriteBatchCapacity).asUInt();
+                m_resourceUploadBudget = root.get("ResourceUploadBudget", k_defaultResourceUploadBudget).asFloat();
+                
+                const Json::Value& memoryBudgets = root["ResourceMemoryBudgets"];
+                
+                if(memoryBudgets.isNull() == false)
+                {
+                    for(auto it = memoryBudgets.begin(); it != memoryBudgets.end(); ++it)
+                    {
+                        CS_ASSERT((*it).asDouble() >= 0.0, "Resource memory budget cannot be negative.");
+                        m_resourceMemoryBudgets[it.memberName()] = (u64)((*it).asDouble() * 1024.0 * 1024.0);
+                    }
+                }
                 
                 const Json::Value& fileTags = root["FileTags"];
                 
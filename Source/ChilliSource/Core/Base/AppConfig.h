@@ -32,6 +32,8 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 
+#include <unordered_map>
+
 namespace ChilliSource
 {
     namespace Core
@@ -79,6 +81,40 @@ namespace ChilliSource
 			/// @return Whether VSync is enabled or not
 			//---------------------------------------------------------
 			bool IsVSyncEnabled() const;
+            //---------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The maximum time in milliseconds that can be
+            /// spent executing main thread tasks each frame, or zero
+            /// if there is no limit.
+            //--------------------------------------------------------
+            f32 GetMainThreadTaskBudget() const;
+            //---------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The maximum number of sprites a dynamic sprite
+            /// batch will hold before it is flushed.
+            //--------------------------------------------------------
+            u32 GetDynamicSpriteBatchCapacity() const;
+            //---------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The maximum time in milliseconds that can be
+            /// spent uploading asynchronously loaded resources each
+            /// frame, or zero if there is no limit.
+            //--------------------------------------------------------
+            f32 GetResourceUploadBudget() const;
+            //---------------------------------------------------------
+            /// The memory budgets are read from the ResourceMemoryBudgets
+            /// object, which maps resource type names to a budget in
+            /// megabytes, i.e. "ResourceMemoryBudgets": { "Texture": 64 }
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The memory budget in bytes for each resource
+            /// type that has one, keyed by type name.
+            //--------------------------------------------------------
+            const std::unordered_map<std::string, u64>& GetResourceMemoryBudgets() const;
             
         private:
             friend class Application;
@@ -109,6 +145,10 @@ namespace ChilliSource
             u32 m_preferredFPS;
 
 			bool m_isVSyncEnabled = false;
+            f32 m_mainThreadTaskBudget;
+            u32 m_dynamicSpriteBatchCapacity;
+            f32 m_resourceUploadBudget;
+            std::unordered_map<std::string, u64> m_resourceMemoryBudgets;
         };
     }
 }
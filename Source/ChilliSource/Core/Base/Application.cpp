@@ -348,6 +348,9 @@ namespace ChilliSource
             m_renderSystem->Destroy();
 			m_resourcePool->Destroy();
 
+            //the log writer uses the file system so needs to finish before the systems are destroyed.
+            Logging::Get()->StopLogToFile();
+
             m_systems.clear();
 
             Logging::Destroy();
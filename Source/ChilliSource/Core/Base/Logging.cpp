@@ -34,6 +34,10 @@
 
 #include <iostream>
 
+#ifdef CS_ENABLE_LOGTOFILE
+#include <chrono>
+#endif
+
 #ifdef CS_TARGETPLATFORM_ANDROID
 #include <android/log.h>
 #include <cstdlib>
@@ -70,8 +74,39 @@ namespace ChilliSource
         namespace
         {
 #ifdef CS_ENABLE_LOGTOFILE
-            const u32 k_maxLogBufferSize = 2048;
+            const u32 k_recordBufferCapacity = 4096;
+            const std::chrono::milliseconds k_writerInterval(100);
             const std::string k_logFileName = "ChilliSourceLog.txt";
+#ifdef CS_ENABLE_STRUCTUREDLOGTOFILE
+            const std::string k_structuredLogFileName = "ChilliSourceLog.bin";
+            const u32 k_structuredLogVersion = 1;
+#endif
+
+            //-----------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The file system if it currently exists.
+            //-----------------------------------------------
+            FileSystem* GetFileSystem()
+            {
+                Application* application = Application::Get();
+                return (application != nullptr) ? application->GetFileSystem() : nullptr;
+            }
+#ifdef CS_ENABLE_STRUCTUREDLOGTOFILE
+            //-----------------------------------------------
+            /// Appends the raw bytes of the given value to the
+            /// output buffer.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The value.
+            /// @param [Out] The buffer.
+            //-----------------------------------------------
+            template <typename TType> void AppendBytes(TType in_value, std::string& out_buffer)
+            {
+                out_buffer.append(reinterpret_cast<const char*>(&in_value), sizeof(TType));
+            }
+#endif
 #endif
         }
         
@@ -98,9 +133,12 @@ namespace ChilliSource
         //----------------------------------------------
         Logging::Logging()
 #ifdef CS_ENABLE_LOGTOFILE
-            : m_isFirstLog(true)
+            : m_records(k_recordBufferCapacity), m_isWriterThreadIdSet(false), m_isWriterRunning(true), m_isWriteRequested(false), m_numRecordsPushed(0)
 #endif
         {
+#ifdef CS_ENABLE_LOGTOFILE
+            m_writerThread = std::thread(&Logging::WriterLoop, this);
+#endif
         }
         //----------------------------------------------
         //----------------------------------------------
@@ -134,6 +172,7 @@ namespace ChilliSource
             LogMessage(LogLevel::k_error, "FATAL: " + in_message);
             LogMessage(LogLevel::k_error, "Chilli Source is exiting...");
 #endif
+            Flush();
 
 #ifdef CS_TARGETPLATFORM_ANDROID
             exit(1);
@@ -141,17 +180,61 @@ namespace ChilliSource
 #ifdef CS_ENABLE_DEBUG
             assert(false);
 #endif
+#endif
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Logging::Flush()
+        {
+#ifdef CS_ENABLE_LOGTOFILE
+            if (IsWriterThread() == true || m_isWriterRunning == false)
+            {
+                return;
+            }
+
+            u64 numRecordsToWrite = m_numRecordsPushed.load();
+
+            std::unique_lock<std::mutex> lock(m_writerMutex);
+            m_isWriteRequested = true;
+            m_writerCondition.notify_one();
+            m_flushCondition.wait(lock, [this, numRecordsToWrite]()
+            {
+                return m_numRecordsWritten >= numRecordsToWrite || m_isWriterRunning == false;
+            });
 #endif
         }
         //-----------------------------------------------------
         //-----------------------------------------------------
         void Logging::Destroy()
         {
+            if (s_logging != nullptr)
+            {
+                s_logging->StopLogToFile();
+            }
+
             CS_SAFEDELETE(s_logging);
         }
         //-----------------------------------------------------
         //-----------------------------------------------------
-        void Logging::LogMessage(LogLevel in_logLevel, const std::string& in_message)
+        void Logging::StopLogToFile()
+        {
+#ifdef CS_ENABLE_LOGTOFILE
+            if (m_writerThread.joinable() == true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_writerMutex);
+                    m_isWriterRunning = false;
+                }
+                m_writerCondition.notify_one();
+                m_flushCondition.notify_all();
+
+                m_writerThread.join();
+            }
+#endif
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Logging::LogMessage(LogLevel in_logLevel, std::string in_message)
         {
 #ifdef CS_TARGETPLATFORM_ANDROID
             switch (in_logLevel)
@@ -176,46 +259,149 @@ namespace ChilliSource
 #endif
             
 #ifdef CS_ENABLE_LOGTOFILE
-            LogToFile(in_message);
+            LogToFile(in_logLevel, std::move(in_message));
 #endif
         }
         
 #ifdef CS_ENABLE_LOGTOFILE
         //-----------------------------------------------
         //-----------------------------------------------
-        void Logging::CreateLogFile()
+        void Logging::LogToFile(LogLevel in_logLevel, std::string in_message)
         {
-            FileStreamUPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(StorageLocation::k_cache, k_logFileName, Core::FileMode::k_write);
-            stream->Write("Chilli Source Log");
-            stream->Close();
+            if (m_isWriterRunning == false)
+            {
+                return;
+            }
+
+            LogRecord record;
+            record.m_logLevel = in_logLevel;
+            record.m_timestamp = (u64)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            record.m_threadId = (u64)std::hash<std::thread::id>()(std::this_thread::get_id());
+            record.m_message = std::move(in_message);
+
+            while (m_records.try_push(record) == false)
+            {
+                //The writer can't make room for itself, and nothing will once it has stopped, so the message is dropped.
+                if (IsWriterThread() == true || m_isWriterRunning == false)
+                {
+                    return;
+                }
+
+                m_isWriteRequested = true;
+                m_writerCondition.notify_one();
+                std::this_thread::yield();
+            }
+
+            ++m_numRecordsPushed;
+
+            //Wake the writer early rather than waiting for the interval if the buffer is filling up.
+            if (m_records.size() >= m_records.capacity() / 2 && m_isWriteRequested.exchange(true) == false)
+            {
+                m_writerCondition.notify_one();
+            }
         }
         //-----------------------------------------------
         //-----------------------------------------------
-        void Logging::LogToFile(const std::string& in_message)
+        bool Logging::IsWriterThread() const
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_logBuffer += "\n" + in_message;
-            
-            FileSystem* fileSystem = Application::Get()->GetFileSystem();
-            if(fileSystem != nullptr && m_logBuffer.length() > k_maxLogBufferSize)
+            //If the id hasn't been published yet the writer hasn't started, so it can't be the calling thread.
+            return (m_isWriterThreadIdSet.load(std::memory_order_acquire) == true && std::this_thread::get_id() == m_writerThreadId);
+        }
+        //-----------------------------------------------
+        //-----------------------------------------------
+        void Logging::WriterLoop()
+        {
+            m_writerThreadId = std::this_thread::get_id();
+            m_isWriterThreadIdSet.store(true, std::memory_order_release);
+
+            bool isRunning = true;
+            while (isRunning == true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_writerMutex);
+                    m_writerCondition.wait_for(lock, k_writerInterval, [this]()
+                    {
+                        return m_isWriteRequested == true || m_isWriterRunning == false;
+                    });
+                    m_isWriteRequested = false;
+                    isRunning = m_isWriterRunning;
+                }
+
+                u64 numRecordsPopped = PopRecords();
+                WritePendingBatch();
+
+                {
+                    std::unique_lock<std::mutex> lock(m_writerMutex);
+                    m_numRecordsWritten += numRecordsPopped;
+                }
+                m_flushCondition.notify_all();
+            }
+        }
+        //-----------------------------------------------
+        //-----------------------------------------------
+        u64 Logging::PopRecords()
+        {
+            u64 numRecordsPopped = 0;
+
+            LogRecord record;
+            while (m_records.try_pop(record) == true)
+            {
+                m_pendingText += "\n";
+                m_pendingText += record.m_message;
+
+#ifdef CS_ENABLE_STRUCTUREDLOGTOFILE
+                AppendBytes(record.m_timestamp, m_pendingRecords);
+                AppendBytes(record.m_threadId, m_pendingRecords);
+                AppendBytes((u32)record.m_logLevel, m_pendingRecords);
+                AppendBytes((u32)record.m_message.size(), m_pendingRecords);
+                m_pendingRecords += record.m_message;
+#endif
+                ++numRecordsPopped;
+            }
+
+            return numRecordsPopped;
+        }
+        //-----------------------------------------------
+        //-----------------------------------------------
+        void Logging::WritePendingBatch()
+        {
+            FileSystem* fileSystem = GetFileSystem();
+            if (fileSystem == nullptr || (m_pendingText.empty() == true && m_isFirstLog == false))
+            {
+                return;
+            }
+
+            FileMode textFileMode = (m_isFirstLog == true) ? FileMode::k_write : FileMode::k_writeAppend;
+            FileStreamUPtr stream = fileSystem->CreateFileStream(StorageLocation::k_cache, k_logFileName, textFileMode);
+            if (stream != nullptr)
             {
                 if (m_isFirstLog == true)
                 {
-                    FileStreamUPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(StorageLocation::k_cache, k_logFileName, Core::FileMode::k_write);
-                    stream->Write("Chilli Source Log");
-                    stream->Write(m_logBuffer);
-                    stream->Close();
-                    m_logBuffer.clear();
-                    m_isFirstLog = false;
+                    m_pendingText.insert(0, "Chilli Source Log");
                 }
-                else
+                stream->Write(m_pendingText);
+                stream->Close();
+            }
+            m_pendingText.clear();
+
+#ifdef CS_ENABLE_STRUCTUREDLOGTOFILE
+            FileMode recordFileMode = (m_isFirstLog == true) ? FileMode::k_writeBinary : FileMode::k_writeBinaryAppend;
+            FileStreamUPtr recordStream = fileSystem->CreateFileStream(StorageLocation::k_cache, k_structuredLogFileName, recordFileMode);
+            if (recordStream != nullptr)
+            {
+                if (m_isFirstLog == true)
                 {
-                    FileStreamUPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(StorageLocation::k_cache, k_logFileName, Core::FileMode::k_writeAppend);
-                    stream->Write(m_logBuffer);
-                    stream->Close();
-                    m_logBuffer.clear();
+                    std::string header("CSLG");
+                    AppendBytes(k_structuredLogVersion, header);
+                    m_pendingRecords.insert(0, header);
                 }
+                recordStream->Write(m_pendingRecords.data(), (s32)m_pendingRecords.size());
+                recordStream->Close();
             }
+            m_pendingRecords.clear();
+#endif
+
+            m_isFirstLog = false;
         }
 #endif
     }
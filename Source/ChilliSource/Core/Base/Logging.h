@@ -34,7 +34,12 @@
 #include <string>
 
 #ifdef CS_ENABLE_LOGTOFILE
+#include <ChilliSource/Core/Container/concurrent_ring_buffer.h>
+
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
 #endif
 
 namespace ChilliSource
@@ -47,6 +52,15 @@ namespace ChilliSource
         /// implements the singleton pattern but does not inherit
         /// from singleton. This is because singleton uses Logging.
         ///
+        /// If CS_ENABLE_LOGTOFILE is declared, messages are also
+        /// written to a log file in the cache directory. Logging
+        /// threads only push the message into a lock-free ring
+        /// buffer; a background writer thread drains it and writes
+        /// each batch to file in a single write. Declaring
+        /// CS_ENABLE_STRUCTUREDLOGTOFILE additionally writes each
+        /// message as a binary record containing the timestamp,
+        /// thread and log level.
+        ///
         /// @author S Downie
         //------------------------------------------------------------
         class Logging final
@@ -110,6 +124,17 @@ namespace ChilliSource
             /// @param The message to log.
             //-----------------------------------------------------
             void LogFatal(const std::string& in_message);
+            //-----------------------------------------------------
+            /// Blocks until all messages logged before this call
+            /// have been written to the log file. Messages logged
+            /// before the file system exists are kept until it
+            /// does, rather than blocking the flush. This does nothing
+            /// if logging to file is not enabled or if called from
+            /// the log writer thread.
+            ///
+            /// @author Jordan Brown
+            //-----------------------------------------------------
+            void Flush();
         private:
             friend class Application;
             
@@ -145,6 +170,15 @@ namespace ChilliSource
             //-----------------------------------------------------
             Logging();
             //-----------------------------------------------------
+            /// Writes any outstanding messages to file and stops
+            /// the log writer thread. Messages logged after this
+            /// are only output to the platform log. This must be
+            /// called while the file system still exists.
+            ///
+            /// @author Jordan Brown
+            //-----------------------------------------------------
+            void StopLogToFile();
+            //-----------------------------------------------------
             /// Logs the given message to file. How this is logged
             /// is dependant on platform.
             ///
@@ -153,26 +187,85 @@ namespace ChilliSource
             /// @param The logging level.
             /// @param The message to log.
             //-----------------------------------------------------
-            void LogMessage(LogLevel in_logLevel, const std::string& in_message);
+            void LogMessage(LogLevel in_logLevel, std::string in_message);
 #ifdef CS_ENABLE_LOGTOFILE
             //-----------------------------------------------------
-            /// Creates a new Log file.
+            /// A single message waiting to be written to file.
             ///
-            /// @author Ian Copland
+            /// @author Jordan Brown
             //-----------------------------------------------------
-            void CreateLogFile();
+            struct LogRecord
+            {
+                LogLevel m_logLevel = LogLevel::k_verbose;
+                u64 m_timestamp = 0;
+                u64 m_threadId = 0;
+                std::string m_message;
+            };
             //-----------------------------------------------------
-            /// Adds the message to to the log file.
+            /// Pushes the message onto the ring buffer for the
+            /// log writer thread. If the buffer is full this
+            /// waits for the writer to make room, unless this is
+            /// the writer itself or it has stopped, in which case
+            /// the message is dropped.
             ///
             /// @author Ian Copland
             ///
+            /// @param The logging level.
             /// @param The message to log.
             //-----------------------------------------------------
-            void LogToFile(const std::string& in_message);
-            
-            bool m_isFirstLog;
-            std::string m_logBuffer;
-            std::mutex m_mutex;
+            void LogToFile(LogLevel in_logLevel, std::string in_message);
+            //-----------------------------------------------------
+            /// The log writer thread's main loop.
+            ///
+            /// @author Jordan Brown
+            //-----------------------------------------------------
+            void WriterLoop();
+            //-----------------------------------------------------
+            /// The writer thread publishes its id when it starts,
+            /// so this can be safely called from any thread, even
+            /// while the writer is starting up.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return Whether the calling thread is the log
+            /// writer thread.
+            //-----------------------------------------------------
+            bool IsWriterThread() const;
+            //-----------------------------------------------------
+            /// Pops all records from the ring buffer and appends
+            /// them to the pending batch.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The number of records popped.
+            //-----------------------------------------------------
+            u64 PopRecords();
+            //-----------------------------------------------------
+            /// Writes the pending batch to the log file, creating
+            /// the file on the first write. The batch is kept if
+            /// the file system doesn't exist yet.
+            ///
+            /// @author Ian Copland
+            //-----------------------------------------------------
+            void WritePendingBatch();
+
+            concurrent_ring_buffer<LogRecord> m_records;
+            std::thread m_writerThread;
+            std::thread::id m_writerThreadId;
+            std::atomic<bool> m_isWriterThreadIdSet;
+            std::mutex m_writerMutex;
+            std::condition_variable m_writerCondition;
+            std::condition_variable m_flushCondition;
+            std::atomic<bool> m_isWriterRunning;
+            std::atomic<bool> m_isWriteRequested;
+            std::atomic<u64> m_numRecordsPushed;
+            u64 m_numRecordsWritten = 0;
+
+            bool m_isFirstLog = true;
+            std::string m_pendingText;
+#ifdef CS_ENABLE_STRUCTUREDLOGTOFILE
+            std::string m_pendingRecords;
+#endif
 #endif
             static Logging* s_logging;
         };
@@ -37,9 +37,24 @@
 //------------------------------------------------------------
 /// Logging macros
 //------------------------------------------------------------
+/// Messages below the current logging level are compiled out,
+/// so the message expression is never evaluated.
+//------------------------------------------------------------
+#if defined CS_LOGLEVEL_VERBOSE
 #define CS_LOG_VERBOSE(in_message)      (CSCore::Logging::Get()->LogVerbose(in_message))
+#else
+#define CS_LOG_VERBOSE(in_message)      ((void)sizeof(in_message))
+#endif
+#if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING
 #define CS_LOG_WARNING(in_message)      (CSCore::Logging::Get()->LogWarning(in_message))
+#else
+#define CS_LOG_WARNING(in_message)      ((void)sizeof(in_message))
+#endif
+#if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING || defined CS_LOGLEVEL_ERROR
 #define CS_LOG_ERROR(in_message)        (CSCore::Logging::Get()->LogError(in_message))
+#else
+#define CS_LOG_ERROR(in_message)        ((void)sizeof(in_message))
+#endif
 #define CS_LOG_FATAL(in_message)        (CSCore::Logging::Get()->LogFatal(in_message))
 //------------------------------------------------------------
 /// Assertion macros
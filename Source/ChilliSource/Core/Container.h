@@ -33,6 +33,8 @@
 #include <ChilliSource/Core/Container/HashedArray.h>
 #include <ChilliSource/Core/Container/concurrent_vector.h>
 #include <ChilliSource/Core/Container/concurrent_blocking_queue.h>
+#include <ChilliSource/Core/Container/concurrent_mpsc_queue.h>
+#include <ChilliSource/Core/Container/concurrent_ring_buffer.h>
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
 #include <ChilliSource/Core/Container/ParamDictionarySerialiser.h>
@@ -41,7 +43,9 @@
 #include <ChilliSource/Core/Container/Property/IProperty.h>
 #include <ChilliSource/Core/Container/Property/IPropertyType.h>
 #include <ChilliSource/Core/Container/Property/Property.h>
+#include <ChilliSource/Core/Container/Property/PropertyHandle.h>
 #include <ChilliSource/Core/Container/Property/PropertyMap.h>
+#include <ChilliSource/Core/Container/Property/PropertyName.h>
 #include <ChilliSource/Core/Container/Property/PropertyType.h>
 #include <ChilliSource/Core/Container/Property/ReferenceProperty.h>
 #include <ChilliSource/Core/Container/Property/ValueProperty.h>
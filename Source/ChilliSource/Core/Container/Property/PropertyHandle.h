@@ -0,0 +1,132 @@
+//
+//  PropertyHandle.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_PROPERTY_PROPERTYHANDLE_H_
+#define _CHILLISOURCE_CORE_CONTAINER_PROPERTY_PROPERTYHANDLE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/Property/Property.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------------------------------
+        /// A typed handle to a single property, resolved once from a property map,
+        /// widget or UI component. Setting or getting through the handle goes directly
+        /// to the property without any name lookup or type check, which makes it the
+        /// preferred way to update the same property every frame.
+        ///
+        /// The handle does not own the property. It is invalidated when the object it
+        /// was resolved from is destroyed, copied to or assigned to.
+        ///
+        /// @author Jordan Brown
+        //---------------------------------------------------------------------------------
+        template <typename TType> class PropertyHandle final
+        {
+        public:
+            //----------------------------------------------------------------------------------------
+            /// Constructor. Creates an invalid handle.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------------------
+            PropertyHandle() = default;
+            //----------------------------------------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The property.
+            /// @param [Optional] A flag which is set whenever a value is set through the handle.
+            /// This is used by property maps to track whether a property has a value.
+            //----------------------------------------------------------------------------------------
+            PropertyHandle(Property<TType>* in_property, bool* in_initialisedFlag = nullptr);
+            //----------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not the handle refers to a property.
+            //----------------------------------------------------------------------------------------
+            bool IsValid() const;
+            //----------------------------------------------------------------------------------------
+            /// Sets the value of the property. The handle must be valid.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The value.
+            //----------------------------------------------------------------------------------------
+            void Set(const TType& in_value) const;
+            //----------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The value of the property. The handle must be valid.
+            //----------------------------------------------------------------------------------------
+            TType Get() const;
+            
+        private:
+            Property<TType>* m_property = nullptr;
+            bool* m_initialised = nullptr;
+        };
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        template <typename TType> PropertyHandle<TType>::PropertyHandle(Property<TType>* in_property, bool* in_initialisedFlag)
+            : m_property(in_property), m_initialised(in_initialisedFlag)
+        {
+            CS_ASSERT(m_property != nullptr, "Cannot create a property handle to a null property.");
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        template <typename TType> bool PropertyHandle<TType>::IsValid() const
+        {
+            return (m_property != nullptr);
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        template <typename TType> void PropertyHandle<TType>::Set(const TType& in_value) const
+        {
+            CS_ASSERT(IsValid() == true, "Cannot set the value of an invalid property handle.");
+            
+            m_property->Set(in_value);
+            
+            if (m_initialised != nullptr)
+            {
+                *m_initialised = true;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        template <typename TType> TType PropertyHandle<TType>::Get() const
+        {
+            CS_ASSERT(IsValid() == true, "Cannot get the value of an invalid property handle.");
+            CS_ASSERT(m_initialised == nullptr || *m_initialised == true, "Cannot get the value of an uninitialised property.");
+            
+            return m_property->Get();
+        }
+    }
+}
+
+#endif
@@ -31,9 +31,10 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
-#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/Core/Container/Property/Property.h>
+#include <ChilliSource/Core/Container/Property/PropertyHandle.h>
+#include <ChilliSource/Core/Container/Property/PropertyName.h>
 
 #include <cassert>
 #include <unordered_map>
@@ -52,6 +53,11 @@ namespace ChilliSource
         /// a property after SetProperty() has been called for it. HasValue() can be used
         /// to check if a value has been set.
         ///
+        /// Properties are keyed on the id of their interned name, so names which are
+        /// used repeatedly should be stored as PropertyNames rather than strings. A
+        /// PropertyHandle can be used to access the same property repeatedly without
+        /// any lookup.
+        ///
         /// @author S Downie
         //---------------------------------------------------------------------------------
         class PropertyMap final
@@ -130,7 +136,7 @@ namespace ChilliSource
             ///
             /// @return Whether the property key exists
             //----------------------------------------------------------------------------------------
-            bool HasKey(const std::string& in_name) const;
+            bool HasKey(const PropertyName& in_name) const;
             //----------------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -139,7 +145,7 @@ namespace ChilliSource
             /// @return Whether or not property with the given key has a value. This will error if the
             /// property doesn't exist.
             //----------------------------------------------------------------------------------------
-            bool HasValue(const std::string& in_name) const;
+            bool HasValue(const PropertyName& in_name) const;
             //----------------------------------------------------------------------------------------
             /// Set the value of the property with the given name. If no property exists with the
             /// name then it will assert.
@@ -149,7 +155,7 @@ namespace ChilliSource
             /// @param Name
             /// @param Value
             //----------------------------------------------------------------------------------------
-            template<typename TType> void SetProperty(const std::string& in_name, TType&& in_value);
+            template<typename TType> void SetProperty(const PropertyName& in_name, TType&& in_value);
             //----------------------------------------------------------------------------------------
             /// Specialisation to store property value for const char* as a std::string
             ///
@@ -158,7 +164,7 @@ namespace ChilliSource
             /// @param Property name
             /// @param Property value
             //----------------------------------------------------------------------------------------
-            void SetProperty(const std::string& in_name, const char* in_value);
+            void SetProperty(const PropertyName& in_name, const char* in_value);
             //----------------------------------------------------------------------------------------
             /// Sets the property with the given name to the result of parsing the given string.
             /// Not all property types can be parsed depending on whether or not the type specifies
@@ -170,7 +176,7 @@ namespace ChilliSource
             /// @param The name of the property.
             /// @param The value to set in string form.
             //----------------------------------------------------------------------------------------
-            void ParseProperty(const std::string& in_name, const std::string& in_value);
+            void ParseProperty(const PropertyName& in_name, const std::string& in_value);
             //----------------------------------------------------------------------------------------
             /// Get the value of the property with the given name. If no property exists with the name
             /// or the property doesn't yet have a value, with the name then it will assert.
@@ -181,7 +187,7 @@ namespace ChilliSource
             ///
             /// @return Value
             //----------------------------------------------------------------------------------------
-            template<typename TType> TType GetProperty(const std::string& in_name) const;
+            template<typename TType> TType GetProperty(const PropertyName& in_name) const;
             //----------------------------------------------------------------------------------------
             /// Get the value of the property with the given name. If the property has not been set
             /// the default will be returned instead. If the property doesn't exist it will assert.
@@ -192,7 +198,7 @@ namespace ChilliSource
             ///
             /// @return Value (or default)
             //----------------------------------------------------------------------------------------
-            template<typename TType> TType GetPropertyOrDefault(const std::string& in_name, TType&& in_default) const;
+            template<typename TType> TType GetPropertyOrDefault(const PropertyName& in_name, TType&& in_default) const;
             //----------------------------------------------------------------------------------------
             /// Specialisation to return property value for const char* which is stored as a std::string
             ///
@@ -203,7 +209,7 @@ namespace ChilliSource
             ///
             /// @return Property value or default if name not found
             //----------------------------------------------------------------------------------------
-			std::string GetPropertyOrDefault(const std::string& in_name, const char* in_default) const;
+			std::string GetPropertyOrDefault(const PropertyName& in_name, const char* in_default) const;
             //----------------------------------------------------------------------------------------
             /// @author S Downie
             ///
@@ -211,7 +217,7 @@ namespace ChilliSource
             ///
             /// @return The type of the property with the given name
             //----------------------------------------------------------------------------------------
-            const IPropertyType* GetType(const std::string& in_name) const;
+            const IPropertyType* GetType(const PropertyName& in_name) const;
             //----------------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -220,7 +226,7 @@ namespace ChilliSource
             /// @return The underlying property object for the given key. If there is no property
             /// with the given name, or the property has no value this will assert.
             //----------------------------------------------------------------------------------------
-            IProperty* GetPropertyObject(const std::string& in_name);
+            IProperty* GetPropertyObject(const PropertyName& in_name);
             //----------------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -229,7 +235,21 @@ namespace ChilliSource
             /// @return A constant version of the underlying property object for the given key. If
             /// there is no property with the given name, or the property has no value this will assert.
             //----------------------------------------------------------------------------------------
-            const IProperty* GetPropertyObject(const std::string& in_name) const;
+            const IProperty* GetPropertyObject(const PropertyName& in_name) const;
+            //----------------------------------------------------------------------------------------
+            /// Resolves a typed handle to the property with the given name, which can then be used
+            /// to set and get its value without further lookups. Setting a value through the
+            /// handle marks the property as having a value. The handle is invalidated if this
+            /// property map is destroyed or assigned to. If there is no property with the given
+            /// name, or it is of a different type, this will assert.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The property name.
+            ///
+            /// @return The property handle.
+            //----------------------------------------------------------------------------------------
+            template<typename TType> PropertyHandle<TType> GetPropertyHandle(const PropertyName& in_name);
             
         private:
             //----------------------------------------------------------------------------------------
@@ -273,53 +293,44 @@ namespace ChilliSource
             };
     
             std::vector<std::string> m_propertyKeys;
-            std::unordered_map<std::string, PropertyContainer> m_properties;
+            std::unordered_map<u32, PropertyContainer> m_properties;
         };
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> void PropertyMap::SetProperty(const std::string& in_name, TType&& in_value)
+        template<typename TType> void PropertyMap::SetProperty(const PropertyName& in_name, TType&& in_value)
         {
             typedef typename std::decay<TType>::type TValueType;
             
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name);
+            auto entry = m_properties.find(in_name.GetId());
+            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name.GetName());
 
-            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name);
+            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name.GetName());
             property->Set(std::forward<TType>(in_value));
             entry->second.m_initialised = true;
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> TType PropertyMap::GetProperty(const std::string& in_name) const
+        template<typename TType> TType PropertyMap::GetProperty(const PropertyName& in_name) const
         {
             typedef typename std::decay<TType>::type TValueType;
             
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
-            
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name);
+            auto entry = m_properties.find(in_name.GetId());
+            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name.GetName());
             CS_ASSERT(entry->second.m_initialised == true, "Cannot get the value for an uninitialised property.");
             
-            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name);
+            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name.GetName());
             return property->Get();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> TType PropertyMap::GetPropertyOrDefault(const std::string& in_name, TType&& in_default) const
+        template<typename TType> TType PropertyMap::GetPropertyOrDefault(const PropertyName& in_name, TType&& in_default) const
         {
             typedef typename std::decay<TType>::type TValueType;
             
-            std::string lowerCaseName = in_name;
-            Core::StringUtils::ToLowerCase(lowerCaseName);
+            auto entry = m_properties.find(in_name.GetId());
+            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name.GetName());
             
-            auto entry = m_properties.find(lowerCaseName);
-            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name);
-            
-            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name);
+            Property<TValueType>* property = CS_SMARTCAST(Property<TValueType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name.GetName());
             if (entry->second.m_initialised == true)
             {
                 return property->Get();
@@ -327,6 +338,16 @@ namespace ChilliSource
             
             return in_default;
         }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        template<typename TType> PropertyHandle<TType> PropertyMap::GetPropertyHandle(const PropertyName& in_name)
+        {
+            auto entry = m_properties.find(in_name.GetId());
+            CS_ASSERT(entry != m_properties.end(), "No property in property map with name: " + in_name.GetName());
+            
+            Property<TType>* property = CS_SMARTCAST(Property<TType>*, entry->second.m_property.get(), "Wrong type for property with name: " + in_name.GetName());
+            return PropertyHandle<TType>(property, &entry->second.m_initialised);
+        }
     }
 }
 
@@ -0,0 +1,191 @@
+//
+//  PropertyName.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Container/Property/PropertyName.h>
+
+#include <ChilliSource/Core/String/StringUtils.h>
+
+#include <cctype>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_fnvOffsetBasis = 2166136261u;
+            const u32 k_fnvPrime = 16777619u;
+            //----------------------------------------------------------------------------------------
+            /// The interned names, keyed on id. The map is node based, so pointers to the names
+            /// remain valid as it grows.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------------------
+            struct InternTable
+            {
+                std::mutex m_mutex;
+                std::unordered_map<u32, std::string> m_names;
+            };
+            //----------------------------------------------------------------------------------------
+            /// Property names are often declared as statics, so the table is created on first use
+            /// to guarantee it exists before any name is constructed.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The intern table.
+            //----------------------------------------------------------------------------------------
+            InternTable& GetInternTable()
+            {
+                static InternTable s_internTable;
+                return s_internTable;
+            }
+            //----------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The character.
+            ///
+            /// @return The character in lower case. This matches StringUtils::ToLowerCase().
+            //----------------------------------------------------------------------------------------
+            char FoldCase(char in_character)
+            {
+                return static_cast<char>(tolower(static_cast<unsigned char>(in_character)));
+            }
+            //----------------------------------------------------------------------------------------
+            /// Calculates the FNV-1a hash of the given string, ignoring case.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The string.
+            /// @param The length of the string.
+            ///
+            /// @return The hash.
+            //----------------------------------------------------------------------------------------
+            u32 HashCaseInsensitive(const char* in_string, std::size_t in_length)
+            {
+                u32 hash = k_fnvOffsetBasis;
+                for (std::size_t i = 0; i < in_length; ++i)
+                {
+                    hash ^= static_cast<u8>(FoldCase(in_string[i]));
+                    hash *= k_fnvPrime;
+                }
+                
+                return hash;
+            }
+            //----------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The lower case interned name.
+            /// @param The string to compare with.
+            /// @param The length of the string.
+            ///
+            /// @return Whether or not the string is equal to the interned name, ignoring case.
+            //----------------------------------------------------------------------------------------
+            bool IsInternedName(const std::string& in_internedName, const char* in_string, std::size_t in_length)
+            {
+                if (in_internedName.size() != in_length)
+                {
+                    return false;
+                }
+                
+                for (std::size_t i = 0; i < in_length; ++i)
+                {
+                    if (in_internedName[i] != FoldCase(in_string[i]))
+                    {
+                        return false;
+                    }
+                }
+                
+                return true;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        PropertyName::PropertyName(const char* in_name)
+        {
+            CS_ASSERT(in_name != nullptr, "Cannot create a property name from a null string.");
+            
+            Intern(in_name, strlen(in_name));
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        PropertyName::PropertyName(const std::string& in_name)
+        {
+            Intern(in_name.data(), in_name.size());
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        u32 PropertyName::GetId() const
+        {
+            return m_id;
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        const std::string& PropertyName::GetName() const
+        {
+            return *m_name;
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        bool PropertyName::operator==(const PropertyName& in_other) const
+        {
+            return m_id == in_other.m_id;
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        bool PropertyName::operator!=(const PropertyName& in_other) const
+        {
+            return m_id != in_other.m_id;
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void PropertyName::Intern(const char* in_name, std::size_t in_length)
+        {
+            m_id = HashCaseInsensitive(in_name, in_length);
+            
+            InternTable& internTable = GetInternTable();
+            std::unique_lock<std::mutex> lock(internTable.m_mutex);
+            
+            auto entry = internTable.m_names.find(m_id);
+            if (entry == internTable.m_names.end())
+            {
+                std::string lowerCaseName(in_name, in_length);
+                StringUtils::ToLowerCase(lowerCaseName);
+                entry = internTable.m_names.emplace(m_id, std::move(lowerCaseName)).first;
+            }
+            else if (IsInternedName(entry->second, in_name, in_length) == false)
+            {
+                CS_LOG_FATAL("Property name '" + std::string(in_name, in_length) + "' has the same id as '" + entry->second + "'. One of them must be renamed.");
+            }
+            
+            m_name = &entry->second;
+        }
+    }
+}
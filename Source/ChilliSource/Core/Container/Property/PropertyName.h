@@ -0,0 +1,125 @@
+//
+//  PropertyName.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_PROPERTY_PROPERTYNAME_H_
+#define _CHILLISOURCE_CORE_CONTAINER_PROPERTY_PROPERTYNAME_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <string>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------------------------------
+        /// An interned, case insensitive property name. The name is case folded and
+        /// hashed once on construction, after which it can be copied and compared as
+        /// cheaply as an integer, and used to look up properties without any string
+        /// work. Property maps, widgets and UI components are keyed on the id.
+        ///
+        /// Every distinct name is interned in a global table, which guarantees that
+        /// two names share an id only if they are equal ignoring case. Constructing a
+        /// name still hashes the string and probes the table, so names which are used
+        /// repeatedly should be constructed once and stored, typically as a static
+        /// constant. For repeated access to a single property on a single object a
+        /// PropertyHandle avoids the lookup entirely.
+        ///
+        /// This is thread safe.
+        ///
+        /// @author Jordan Brown
+        //---------------------------------------------------------------------------------
+        class PropertyName final
+        {
+        public:
+            //----------------------------------------------------------------------------------------
+            /// Constructor. Implicit so that strings can be passed wherever a property name is
+            /// expected.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The name. This is case insensitive.
+            //----------------------------------------------------------------------------------------
+            PropertyName(const char* in_name);
+            //----------------------------------------------------------------------------------------
+            /// Constructor. Implicit so that strings can be passed wherever a property name is
+            /// expected.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The name. This is case insensitive.
+            //----------------------------------------------------------------------------------------
+            PropertyName(const std::string& in_name);
+            //----------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The unique id of the name.
+            //----------------------------------------------------------------------------------------
+            u32 GetId() const;
+            //----------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The interned, lower case name.
+            //----------------------------------------------------------------------------------------
+            const std::string& GetName() const;
+            //----------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The name to compare with.
+            ///
+            /// @return Whether or not the names are equal, ignoring case.
+            //----------------------------------------------------------------------------------------
+            bool operator==(const PropertyName& in_other) const;
+            //----------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The name to compare with.
+            ///
+            /// @return Whether or not the names differ, ignoring case.
+            //----------------------------------------------------------------------------------------
+            bool operator!=(const PropertyName& in_other) const;
+            
+        private:
+            //----------------------------------------------------------------------------------------
+            /// Hashes the given name and looks it up in the intern table, adding it if this is
+            /// the first time it has been seen.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The name.
+            /// @param The length of the name.
+            //----------------------------------------------------------------------------------------
+            void Intern(const char* in_name, std::size_t in_length);
+            
+            u32 m_id = 0;
+            const std::string* m_name = nullptr;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,189 @@
+//
+//  concurrent_mpsc_queue.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_CONCURRENTMPSCQUEUE_H_
+#define _CHILLISOURCE_CORE_CONTAINER_CONCURRENTMPSCQUEUE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+		//------------------------------------------------------------------
+		/// A lock-free first-in first-out queue which can be pushed to from
+        /// any number of threads but popped from only a single consumer
+        /// thread. Pushing never blocks: each push swaps itself in as the
+        /// new head of a linked list of nodes, and the consumer follows the
+        /// links from the tail.
+        ///
+        /// An object which is mid-push may briefly be invisible to the
+        /// consumer, in which case try_pop() reports the queue as empty
+        /// and the object will be available on the next attempt.
+		/// 
+		/// @author Jordan Brown
+		//------------------------------------------------------------------
+        template <typename TType> class concurrent_mpsc_queue final
+        {
+        public:
+            CS_DECLARE_NOCOPY(concurrent_mpsc_queue);
+            //---------------------------------------------------------
+            /// Default constructor.
+            ///
+            /// @author Jordan Brown
+            //---------------------------------------------------------
+            concurrent_mpsc_queue();
+			//---------------------------------------------------------
+			/// This is approximate if other threads are pushing.
+			///
+			/// @author Jordan Brown
+			///
+			/// @return Size of queue
+			//---------------------------------------------------------
+			u32 size() const;
+            //---------------------------------------------------------
+            /// Thread safe method that will push an object onto the
+            /// back of the queue.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Object of type TType
+            //---------------------------------------------------------
+			void push(TType in_object);
+			//---------------------------------------------------------
+			/// Pops the front of the queue if there is one. This must
+			/// only be called from the consumer thread.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param [Out] The popped object. This will only be set
+			/// if an object was successfully retreived from the queue.
+			///
+			/// @return Whether or not a value was successfully 
+			/// retreived.
+			//---------------------------------------------------------
+			bool try_pop(TType& out_poppedObject);
+            //---------------------------------------------------------
+            /// Clears the queue of all objects. This must only be
+            /// called from the consumer thread.
+            ///
+            /// @author Jordan Brown
+            //---------------------------------------------------------
+            void clear();
+			//---------------------------------------------------------
+			/// Destructor. No other thread may be accessing the queue.
+			///
+			/// @author Jordan Brown
+			//---------------------------------------------------------
+			~concurrent_mpsc_queue();
+        private:
+            //---------------------------------------------------------
+            /// A single link in the queue.
+            ///
+            /// @author Jordan Brown
+            //---------------------------------------------------------
+            struct Node
+            {
+                TType m_object;
+                std::atomic<Node*> m_next;
+            };
+
+            std::atomic<Node*> m_head;
+            Node* m_tail;
+            std::atomic<u32> m_size;
+        };
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        template <typename TType> concurrent_mpsc_queue<TType>::concurrent_mpsc_queue()
+            : m_size(0)
+        {
+            //The tail always points at a node whose object has already been consumed, starting with an empty one.
+            Node* stub = new Node();
+            stub->m_next = nullptr;
+            m_head = stub;
+            m_tail = stub;
+        }
+		//-----------------------------------------------------------
+		//-----------------------------------------------------------
+		template <typename TType> u32 concurrent_mpsc_queue<TType>::size() const
+		{
+			return m_size;
+		}
+		//---------------------------------------------------------
+		//---------------------------------------------------------
+		template <typename TType> void concurrent_mpsc_queue<TType>::push(TType in_object)
+		{
+            Node* node = new Node();
+            node->m_object = std::move(in_object);
+            node->m_next.store(nullptr, std::memory_order_relaxed);
+
+            ++m_size;
+
+            Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+            previous->m_next.store(node, std::memory_order_release);
+		}
+		//---------------------------------------------------------
+		//---------------------------------------------------------
+		template <typename TType> bool concurrent_mpsc_queue<TType>::try_pop(TType& out_poppedObject)
+		{
+            Node* next = m_tail->m_next.load(std::memory_order_acquire);
+            if (next == nullptr)
+            {
+                return false;
+            }
+
+            out_poppedObject = std::move(next->m_object);
+            delete m_tail;
+            m_tail = next;
+
+            --m_size;
+            return true;
+		}
+		//---------------------------------------------------------
+		//---------------------------------------------------------
+		template <typename TType> void concurrent_mpsc_queue<TType>::clear()
+		{
+            TType object;
+			while (try_pop(object) == true)
+			{
+                object = TType();
+			}
+		}
+		//-----------------------------------------------------------
+		//-----------------------------------------------------------
+		template <typename TType> concurrent_mpsc_queue<TType>::~concurrent_mpsc_queue()
+		{
+            clear();
+            delete m_tail;
+		}
+    }
+}
+
+#endif
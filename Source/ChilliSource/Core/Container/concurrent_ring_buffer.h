@@ -0,0 +1,217 @@
+//
+//  concurrent_ring_buffer.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_CONCURRENTRINGBUFFER_H_
+#define _CHILLISOURCE_CORE_CONTAINER_CONCURRENTRINGBUFFER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <memory>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+		//------------------------------------------------------------------
+		/// A lock-free, fixed capacity first-in first-out queue which can be
+        /// pushed to and popped from by any number of threads. The storage
+        /// is allocated up front, so pushing and popping never allocate.
+        ///
+        /// Each slot carries a sequence number which tells a thread
+        /// whether the slot is free to be written or ready to be read for
+        /// its position in the buffer; threads claim positions by
+        /// advancing the shared enqueue and dequeue positions.
+		/// 
+		/// @author Jordan Brown
+		//------------------------------------------------------------------
+        template <typename TType> class concurrent_ring_buffer final
+        {
+        public:
+            CS_DECLARE_NOCOPY(concurrent_ring_buffer);
+            //---------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The capacity of the buffer. This must be a power
+            /// of two.
+            //---------------------------------------------------------
+            concurrent_ring_buffer(u32 in_capacity);
+            //---------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The maximum number of objects the buffer can
+            /// hold.
+            //---------------------------------------------------------
+            u32 capacity() const;
+			//---------------------------------------------------------
+			/// This is approximate if other threads are pushing or
+            /// popping.
+			///
+			/// @author Jordan Brown
+			///
+			/// @return Size of buffer
+			//---------------------------------------------------------
+			u32 size() const;
+            //---------------------------------------------------------
+            /// Thread safe method that will push an object onto the
+            /// back of the buffer if there is room.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [In/Out] The object to push. This is only moved
+            /// from if it was successfully pushed.
+            ///
+            /// @return Whether or not there was room for the object.
+            //---------------------------------------------------------
+			bool try_push(TType& inout_object);
+			//---------------------------------------------------------
+			/// Thread safe method that pops the front of the buffer if
+            /// there is one.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param [Out] The popped object. This will only be set
+			/// if an object was successfully retreived from the buffer.
+			///
+			/// @return Whether or not a value was successfully 
+			/// retreived.
+			//---------------------------------------------------------
+			bool try_pop(TType& out_poppedObject);
+        private:
+            //---------------------------------------------------------
+            /// A single slot in the buffer.
+            ///
+            /// @author Jordan Brown
+            //---------------------------------------------------------
+            struct Slot
+            {
+                std::atomic<u64> m_sequence;
+                TType m_object;
+            };
+
+            std::unique_ptr<Slot[]> m_slots;
+            u64 m_mask;
+            std::atomic<u64> m_enqueuePosition;
+            std::atomic<u64> m_dequeuePosition;
+        };
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        template <typename TType> concurrent_ring_buffer<TType>::concurrent_ring_buffer(u32 in_capacity)
+            : m_slots(new Slot[in_capacity]), m_mask(in_capacity - 1), m_enqueuePosition(0), m_dequeuePosition(0)
+        {
+            CS_ASSERT(in_capacity >= 2 && (in_capacity & (in_capacity - 1)) == 0, "The capacity of a concurrent ring buffer must be a power of two.");
+
+            //A slot is free to be written at position N when its sequence is N, and ready to be read when it is N + 1.
+            for (u32 i = 0; i < in_capacity; ++i)
+            {
+                m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        template <typename TType> u32 concurrent_ring_buffer<TType>::capacity() const
+        {
+            return (u32)(m_mask + 1);
+        }
+		//-----------------------------------------------------------
+		//-----------------------------------------------------------
+		template <typename TType> u32 concurrent_ring_buffer<TType>::size() const
+		{
+            u64 enqueuePosition = m_enqueuePosition.load(std::memory_order_relaxed);
+            u64 dequeuePosition = m_dequeuePosition.load(std::memory_order_relaxed);
+			return (enqueuePosition > dequeuePosition) ? (u32)(enqueuePosition - dequeuePosition) : 0;
+		}
+		//---------------------------------------------------------
+		//---------------------------------------------------------
+		template <typename TType> bool concurrent_ring_buffer<TType>::try_push(TType& inout_object)
+		{
+            u64 position = m_enqueuePosition.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Slot& slot = m_slots[position & m_mask];
+                u64 sequence = slot.m_sequence.load(std::memory_order_acquire);
+                s64 difference = (s64)sequence - (s64)position;
+
+                if (difference == 0)
+                {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+                    {
+                        slot.m_object = std::move(inout_object);
+                        slot.m_sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    //The slot still holds an object from the previous lap, so the buffer is full.
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+		}
+		//---------------------------------------------------------
+		//---------------------------------------------------------
+		template <typename TType> bool concurrent_ring_buffer<TType>::try_pop(TType& out_poppedObject)
+		{
+            u64 position = m_dequeuePosition.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Slot& slot = m_slots[position & m_mask];
+                u64 sequence = slot.m_sequence.load(std::memory_order_acquire);
+                s64 difference = (s64)sequence - (s64)(position + 1);
+
+                if (difference == 0)
+                {
+                    if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+                    {
+                        out_poppedObject = std::move(slot.m_object);
+                        slot.m_sequence.store(position + m_mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    //The slot hasn't been written for this lap yet, so the buffer is empty.
+                    return false;
+                }
+                else
+                {
+                    position = m_dequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+		}
+    }
+}
+
+#endif
@@ -44,26 +44,51 @@ namespace ChilliSource
             //------------------------------------------------
             //------------------------------------------------
             std::string GenerateHexHashCode(const s8* in_data, u32 in_size)
+            {
+                Hasher hasher;
+                hasher.Update(in_data, in_size);
+                return hasher.GenerateHexHashCode();
+            }
+            //------------------------------------------------
+            //------------------------------------------------
+            Hasher::Hasher()
+            : m_hash(new CSHA1())
+            {
+                m_hash->Reset();
+            }
+            //------------------------------------------------
+            //------------------------------------------------
+            void Hasher::Update(const s8* in_data, u32 in_size)
+            {
+                m_hash->Update(reinterpret_cast<const u8*>(in_data), in_size);
+            }
+            //------------------------------------------------
+            //------------------------------------------------
+            std::string Hasher::GenerateHexHashCode()
             {
                 const u32 k_sha1Length = 80;
                 
-                CSHA1 hash;
-                hash.Reset();
-                hash.Update(reinterpret_cast<const u8*>(in_data), in_size);
-                hash.Final();
+                m_hash->Final();
                 
 #ifdef CS_TARGETPLATFORM_WINDOWS
                 TCHAR cHash[k_sha1Length];
                 memset(cHash, 0, k_sha1Length);
-                hash.ReportHash(cHash, CSHA1::REPORT_HEX_SHORT);
+                m_hash->ReportHash(cHash, CSHA1::REPORT_HEX_SHORT);
+                m_hash->Reset();
 				return CSBackend::Windows::WindowsStringUtils::UTF16ToUTF8(std::wstring(cHash));
 #else
 				s8 cHash[k_sha1Length];
 				memset(cHash, 0, k_sha1Length);
-				hash.ReportHash(cHash, CSHA1::REPORT_HEX_SHORT);
+				m_hash->ReportHash(cHash, CSHA1::REPORT_HEX_SHORT);
+                m_hash->Reset();
 				return std::string(cHash);
 #endif
             }
+            //------------------------------------------------
+            //------------------------------------------------
+            Hasher::~Hasher()
+            {
+            }
         }
     }
 }
@@ -31,6 +31,10 @@
 
 #include <ChilliSource/ChilliSource.h>
 
+#include <memory>
+
+class CSHA1;
+
 namespace ChilliSource
 {
     namespace Core
@@ -55,6 +59,51 @@ namespace ChilliSource
             /// @return The output hex string.
             //------------------------------------------------
             std::string GenerateHexHashCode(const s8* in_data, u32 in_size);
+            //------------------------------------------------
+            /// Hashes data using SHA1 as it is passed in,
+            /// allowing large streams of data to be hashed
+            /// without holding all of it in memory.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------
+            class Hasher final
+            {
+            public:
+                CS_DECLARE_NOCOPY(Hasher);
+                //------------------------------------------------
+                /// Constructor
+                ///
+                /// @author Jordan Brown
+                //------------------------------------------------
+                Hasher();
+                //------------------------------------------------
+                /// Adds the data to the hash.
+                ///
+                /// @author Jordan Brown
+                ///
+                /// @param The input data.
+                /// @param The input data size.
+                //------------------------------------------------
+                void Update(const s8* in_data, u32 in_size);
+                //------------------------------------------------
+                /// Finishes the hash. The hasher is reset so it
+                /// can be used again.
+                ///
+                /// @author Jordan Brown
+                ///
+                /// @return The output hex string.
+                //------------------------------------------------
+                std::string GenerateHexHashCode();
+                //------------------------------------------------
+                /// Destructor
+                ///
+                /// @author Jordan Brown
+                //------------------------------------------------
+                ~Hasher();
+                
+            private:
+                std::unique_ptr<CSHA1> m_hash;
+            };
         }
     }
 }
@@ -0,0 +1,409 @@
+//
+//  InlineDelegate.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_DELEGATE_INLINEDELEGATE_H_
+#define _CHILLISOURCE_CORE_DELEGATE_INLINEDELEGATE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ChilliSource
+{
+	namespace Core
+	{
+        //------------------------------------------------------------------
+        /// A callable wrapper similar to std::function, which stores small
+        /// callables - lambdas with a few captures, or an instance paired
+        /// with a member function pointer - in an inline buffer rather than
+        /// on the heap. Larger callables fall back to a heap allocation.
+        ///
+        /// This is intended as the delegate type for events which are
+        /// connected to and notified frequently.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes> class InlineDelegate<TReturnType(TArgTypes...)> final
+        {
+        public:
+            //------------------------------------------------------------------
+            /// The size of the inline buffer. This fits an instance pointer
+            /// and a member function pointer on all supported platforms.
+            //------------------------------------------------------------------
+            static const u32 k_bufferSize = 4 * sizeof(void*);
+            //------------------------------------------------------------------
+            /// Constructs an empty delegate.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------
+            InlineDelegate() = default;
+            //------------------------------------------------------------------
+            /// Constructs an empty delegate.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------
+            InlineDelegate(std::nullptr_t)
+            {
+            }
+            //------------------------------------------------------------------
+            /// Constructs a delegate from any callable object with a
+            /// compatible signature, including lambdas and std::function.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The callable object.
+            //------------------------------------------------------------------
+            template <typename TCallable, typename = typename std::enable_if<std::is_same<typename std::decay<TCallable>::type, InlineDelegate>::value == false>::type>
+            InlineDelegate(TCallable&& in_callable)
+            {
+                Assign(std::forward<TCallable>(in_callable));
+            }
+            //------------------------------------------------------------------
+            /// Constructs a delegate to a member function of the given
+            /// instance. This never allocates.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Instance whose function to call
+            /// @param Member function ptr
+            //------------------------------------------------------------------
+            template <typename TSender, typename TDelegate> InlineDelegate(TSender* in_sender, TReturnType (TDelegate::*in_func)(TArgTypes...))
+            {
+                Assign(MemberFunction<TSender, TReturnType (TDelegate::*)(TArgTypes...)>(in_sender, in_func));
+            }
+            //------------------------------------------------------------------
+            /// Constructs a delegate to a const member function of the given
+            /// instance. This never allocates.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Instance whose function to call
+            /// @param Const member function ptr
+            //------------------------------------------------------------------
+            template <typename TSender, typename TDelegate> InlineDelegate(const TSender* in_sender, TReturnType (TDelegate::*in_func)(TArgTypes...) const)
+            {
+                Assign(MemberFunction<const TSender, TReturnType (TDelegate::*)(TArgTypes...) const>(in_sender, in_func));
+            }
+            //------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The delegate to copy.
+            //------------------------------------------------------------------
+            InlineDelegate(const InlineDelegate& in_toCopy)
+            {
+                if (in_toCopy.m_manager != nullptr)
+                {
+                    in_toCopy.m_manager(Operation::k_copy, &m_storage, const_cast<void*>(static_cast<const void*>(&in_toCopy.m_storage)));
+                    m_invoker = in_toCopy.m_invoker;
+                    m_manager = in_toCopy.m_manager;
+                }
+            }
+            //------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The delegate to move. This will be empty afterwards.
+            //------------------------------------------------------------------
+            InlineDelegate(InlineDelegate&& in_toMove)
+            {
+                MoveFrom(in_toMove);
+            }
+            //------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The delegate to copy.
+            ///
+            /// @return A reference to this after the copy.
+            //------------------------------------------------------------------
+            InlineDelegate& operator=(const InlineDelegate& in_toCopy)
+            {
+                if (this != &in_toCopy)
+                {
+                    InlineDelegate copy(in_toCopy);
+                    Reset();
+                    MoveFrom(copy);
+                }
+                return *this;
+            }
+            //------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The delegate to move. This will be empty afterwards.
+            ///
+            /// @return A reference to this after the move.
+            //------------------------------------------------------------------
+            InlineDelegate& operator=(InlineDelegate&& in_toMove)
+            {
+                if (this != &in_toMove)
+                {
+                    Reset();
+                    MoveFrom(in_toMove);
+                }
+                return *this;
+            }
+            //------------------------------------------------------------------
+            /// Calls the wrapped callable. The delegate must not be empty.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The arguments to pass to the callable.
+            ///
+            /// @return The return value of the callable.
+            //------------------------------------------------------------------
+            TReturnType operator()(TArgTypes... in_args) const
+            {
+                CS_ASSERT(m_invoker != nullptr, "Cannot call an empty delegate.");
+                return m_invoker(const_cast<void*>(static_cast<const void*>(&m_storage)), std::forward<TArgTypes>(in_args)...);
+            }
+            //------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not the delegate wraps a callable.
+            //------------------------------------------------------------------
+            explicit operator bool() const
+            {
+                return m_invoker != nullptr;
+            }
+            //------------------------------------------------------------------
+            /// @author Jordan Brown
+            //------------------------------------------------------------------
+            ~InlineDelegate()
+            {
+                Reset();
+            }
+            
+        private:
+            
+            enum class Operation
+            {
+                k_copy,
+                k_move,
+                k_destroy
+            };
+            
+            typedef TReturnType (*Invoker)(void*, TArgTypes&&...);
+            typedef void (*Manager)(Operation, void*, void*);
+            typedef typename std::aligned_storage<k_bufferSize>::type Storage;
+            
+            //------------------------------------------------------------------
+            /// A callable binding an instance to one of its member functions.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------
+            template <typename TSender, typename TMemberFunction> struct MemberFunction final
+            {
+                MemberFunction(TSender* in_sender, TMemberFunction in_func)
+                : m_sender(in_sender), m_func(in_func)
+                {
+                }
+                
+                TReturnType operator()(TArgTypes&&... in_args) const
+                {
+                    return (m_sender->*m_func)(std::forward<TArgTypes>(in_args)...);
+                }
+                
+                TSender* m_sender;
+                TMemberFunction m_func;
+            };
+            //------------------------------------------------------------------
+            /// Provides the invoke and lifetime operations for callables small
+            /// enough to be stored in the inline buffer.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------
+            template <typename TCallable> struct InlineStorage final
+            {
+                static TCallable* Get(void* in_storage)
+                {
+                    return static_cast<TCallable*>(in_storage);
+                }
+                
+                template <typename TArg> static void Create(void* in_storage, TArg&& in_callable)
+                {
+                    new (in_storage) TCallable(std::forward<TArg>(in_callable));
+                }
+                
+                static TReturnType Invoke(void* in_storage, TArgTypes&&... in_args)
+                {
+                    return (*Get(in_storage))(std::forward<TArgTypes>(in_args)...);
+                }
+                
+                static void Manage(Operation in_operation, void* in_destination, void* in_source)
+                {
+                    switch (in_operation)
+                    {
+                        case Operation::k_copy:
+                            new (in_destination) TCallable(*Get(in_source));
+                            break;
+                        case Operation::k_move:
+                            new (in_destination) TCallable(std::move(*Get(in_source)));
+                            Get(in_source)->~TCallable();
+                            break;
+                        case Operation::k_destroy:
+                            Get(in_destination)->~TCallable();
+                            break;
+                    }
+                }
+            };
+            //------------------------------------------------------------------
+            /// Provides the invoke and lifetime operations for callables which
+            /// are too large for the inline buffer, and so are stored on the
+            /// heap with a pointer in the buffer.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------
+            template <typename TCallable> struct HeapStorage final
+            {
+                static TCallable* Get(void* in_storage)
+                {
+                    return *static_cast<TCallable**>(in_storage);
+                }
+                
+                template <typename TArg> static void Create(void* in_storage, TArg&& in_callable)
+                {
+                    new (in_storage) TCallable*(new TCallable(std::forward<TArg>(in_callable)));
+                }
+                
+                static TReturnType Invoke(void* in_storage, TArgTypes&&... in_args)
+                {
+                    return (*Get(in_storage))(std::forward<TArgTypes>(in_args)...);
+                }
+                
+                static void Manage(Operation in_operation, void* in_destination, void* in_source)
+                {
+                    switch (in_operation)
+                    {
+                        case Operation::k_copy:
+                            new (in_destination) TCallable*(new TCallable(*Get(in_source)));
+                            break;
+                        case Operation::k_move:
+                            new (in_destination) TCallable*(Get(in_source));
+                            break;
+                        case Operation::k_destroy:
+                            delete Get(in_destination);
+                            break;
+                    }
+                }
+            };
+            //------------------------------------------------------------------
+            /// Stores the given callable, inline if it fits.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The callable object.
+            //------------------------------------------------------------------
+            template <typename TCallable> void Assign(TCallable&& in_callable)
+            {
+                typedef typename std::decay<TCallable>::type CallableType;
+                
+                const bool fitsInline = (sizeof(CallableType) <= sizeof(Storage) && std::alignment_of<Storage>::value % std::alignment_of<CallableType>::value == 0);
+                typedef typename std::conditional<fitsInline, InlineStorage<CallableType>, HeapStorage<CallableType>>::type StorageType;
+                
+                StorageType::Create(&m_storage, std::forward<TCallable>(in_callable));
+                m_invoker = &StorageType::Invoke;
+                m_manager = &StorageType::Manage;
+            }
+            //------------------------------------------------------------------
+            /// Takes the callable from the given delegate, leaving it empty.
+            /// This must be empty when called.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The delegate to move from.
+            //------------------------------------------------------------------
+            void MoveFrom(InlineDelegate& in_toMove)
+            {
+                if (in_toMove.m_manager != nullptr)
+                {
+                    in_toMove.m_manager(Operation::k_move, &m_storage, &in_toMove.m_storage);
+                    m_invoker = in_toMove.m_invoker;
+                    m_manager = in_toMove.m_manager;
+                    in_toMove.m_invoker = nullptr;
+                    in_toMove.m_manager = nullptr;
+                }
+            }
+            //------------------------------------------------------------------
+            /// Destroys the wrapped callable, if there is one.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------
+            void Reset()
+            {
+                if (m_manager != nullptr)
+                {
+                    m_manager(Operation::k_destroy, &m_storage, nullptr);
+                    m_invoker = nullptr;
+                    m_manager = nullptr;
+                }
+            }
+            
+            Storage m_storage;
+            Invoker m_invoker = nullptr;
+            Manager m_manager = nullptr;
+        };
+        //------------------------------------------------------------------
+        /// Constructs an inline delegate to a member function with a
+        /// signature that matches the given return and parameter types.
+        /// Unlike MakeDelegate() this never allocates.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param Instance whose function to call
+        /// @param Member function ptr
+        ///
+        /// @return Delegate
+        //------------------------------------------------------------------
+        template <typename TDelegate, typename TSender, typename TReturnType, typename... TArgTypes>
+        InlineDelegate<TReturnType(TArgTypes...)> MakeInlineDelegate(TSender* in_sender, TReturnType (TDelegate::*in_func)(TArgTypes...))
+        {
+            return InlineDelegate<TReturnType(TArgTypes...)>(in_sender, in_func);
+        }
+        //------------------------------------------------------------------
+        /// Constructs an inline delegate to a const member function with a
+        /// signature that matches the given return and parameter types.
+        /// Unlike MakeDelegate() this never allocates.
+        ///
+        /// @author Jordan Brown
+        ///
+        /// @param Instance whose function to call
+        /// @param Const member function ptr
+        ///
+        /// @return Delegate
+        //------------------------------------------------------------------
+        template <typename TDelegate, typename TSender, typename TReturnType, typename... TArgTypes>
+        InlineDelegate<TReturnType(TArgTypes...)> MakeInlineDelegate(const TSender* in_sender, TReturnType (TDelegate::*in_func)(TArgTypes...) const)
+        {
+            return InlineDelegate<TReturnType(TArgTypes...)>(in_sender, in_func);
+        }
+	}
+}
+
+#endif
@@ -32,6 +32,8 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/QueryableInterface.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -170,6 +172,7 @@ namespace ChilliSource
         private:
             
             friend class Entity;
+            friend class Scene;
             //----------------------------------------------------
 			/// @author S Downie
             ///
@@ -180,6 +183,7 @@ namespace ChilliSource
 		private:
             
 			Entity * m_entity;
+            std::vector<std::pair<InterfaceIDType, u32>> m_sceneRegistryIndices;
 		};
 	}
 }
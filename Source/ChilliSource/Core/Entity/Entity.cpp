@@ -210,6 +210,7 @@ namespace ChilliSource
             
             if(GetScene() != nullptr)
             {
+                m_scene->RegisterComponent(in_component.get());
                 in_component->OnAddedToScene();
                 if (m_appActive == true)
                 {
@@ -243,6 +244,7 @@ namespace ChilliSource
                             in_component->OnSuspend();
                         }
                         in_component->OnRemovedFromScene();
+                        m_scene->UnregisterComponent(in_component);
                     }
                     
                     in_component->OnRemovedFromEntity();
@@ -273,6 +275,7 @@ namespace ChilliSource
                         component->OnSuspend();
                     }
                     component->OnRemovedFromScene();
+                    m_scene->UnregisterComponent(component);
                 }
                 
                 component->OnRemovedFromEntity();
@@ -388,6 +391,7 @@ namespace ChilliSource
 		{
             for (u32 i = 0; i < m_components.size(); ++i)
             {
+                m_scene->RegisterComponent(m_components[i].get());
                 m_components[i]->OnAddedToScene();
             }
             
@@ -432,6 +436,7 @@ namespace ChilliSource
             for (s32 i = m_components.size() - 1; i >= 0; --i)
             {
                 m_components[i]->OnRemovedFromScene();
+                m_scene->UnregisterComponent(m_components[i].get());
             }
 		}
         //----------------------------------------------------
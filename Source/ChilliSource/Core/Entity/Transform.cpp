@@ -28,6 +28,8 @@
 
 #include <ChilliSource/Core/Entity/Transform.h>
 
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
+
 #include <algorithm>
 
 namespace ChilliSource
@@ -39,9 +41,18 @@ namespace ChilliSource
         ///
         /// Default
 		//----------------------------------------------------------------
-        Transform::Transform() : mbIsTransformCacheValid(false), mbIsParentTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr)
+        Transform::Transform() : mbIsTransformCacheValid(false), mbIsParentTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr), m_hierarchy(nullptr), m_hierarchyIndex(0)
         {
         
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Transform::~Transform()
+        {
+            if(m_hierarchy != nullptr)
+            {
+                m_hierarchy->Remove(this);
+            }
         }
         //----------------------------------------------------------
 		/// Set Look At
@@ -441,6 +452,13 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const Matrix4& Transform::GetWorldTransform() const
         {
+            //Transforms in a hierarchy store have their world transforms
+            //calculated in batches by the store
+            if(m_hierarchy != nullptr)
+            {
+                return m_hierarchy->GetWorldTransform(this);
+            }
+            
             //If we have a parent transform we must apply it to
             //our local transform to get the relative transformation
             if(mpParentTransform)
@@ -477,6 +495,21 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void Transform::SetWorldTransform(const Matrix4& inmatTransform)
         {
+            //The store derives world transforms from local ones, so the
+            //world transform is converted into our parent's space
+            if(m_hierarchy != nullptr)
+            {
+                if(mpParentTransform)
+                {
+                    SetLocalTransform(inmatTransform * Matrix4::Inverse(mpParentTransform->GetWorldTransform()));
+                }
+                else
+                {
+                    SetLocalTransform(inmatTransform);
+                }
+                return;
+            }
+            
             inmatTransform.Decompose(mvWorldPosition, mvWorldScale, mqWorldOrientation);
             
             mmatWorldTransform = inmatTransform;
@@ -510,6 +543,11 @@ namespace ChilliSource
         //----------------------------------------------------------------
         bool Transform::IsTransformValid() const
         {
+            if(m_hierarchy != nullptr)
+            {
+                return mbIsTransformCacheValid && m_hierarchy->IsWorldTransformValid(this);
+            }
+            
             return mbIsTransformCacheValid && mbIsParentTransformCacheValid;
         }
         //----------------------------------------------------------------
@@ -546,6 +584,11 @@ namespace ChilliSource
 		{
 			inpTransform->SetParentTransform(this);
 			mChildTransforms.push_back(inpTransform);
+            
+            if(m_hierarchy != nullptr)
+            {
+                m_hierarchy->OnChildAdded(inpTransform);
+            }
 		}
 		//----------------------------------------------------------------
 		/// Remove Child Transform
@@ -562,6 +605,11 @@ namespace ChilliSource
 			
 			if(it != mChildTransforms.end())
 			{
+                if(m_hierarchy != nullptr)
+                {
+                    m_hierarchy->Remove(inpTransform);
+                }
+                
 				inpTransform->SetParentTransform(nullptr);
 				mChildTransforms.erase(it);
 				return true;
@@ -579,6 +627,11 @@ namespace ChilliSource
 		{
 			for(std::vector<Transform*>::iterator it = mChildTransforms.begin(); it != mChildTransforms.end(); ++it)
 			{
+                if(m_hierarchy != nullptr)
+                {
+                    m_hierarchy->Remove(*it);
+                }
+                
 				(*it)->SetParentTransform(nullptr);
 			}
 			
@@ -606,6 +659,14 @@ namespace ChilliSource
         {
             mbIsTransformCacheValid = false;
             
+            //The store propagates changes to children and notifies
+            //listeners once per frame when it next updates
+            if(m_hierarchy != nullptr)
+            {
+                m_hierarchy->OnTransformChanged(this);
+                return;
+            }
+            
             for(std::vector<Transform*>::iterator it = mChildTransforms.begin(); it != mChildTransforms.end(); ++it)
             {
                 (*it)->OnParentTransformChanged();
@@ -629,6 +690,11 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void Transform::Reset()
         {
+            if(m_hierarchy != nullptr)
+            {
+                m_hierarchy->Remove(this);
+            }
+            
             mbIsTransformCacheValid = false;
             mbIsParentTransformCacheValid = false;
             mvPosition = Vector3::k_zero;
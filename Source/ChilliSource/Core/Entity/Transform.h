@@ -44,9 +44,16 @@ namespace ChilliSource
         class Transform
         {
         public:
-            typedef std::function<void()> TransformChangedDelegate;
+            typedef InlineDelegate<void()> TransformChangedDelegate;
             
             Transform();
+            //----------------------------------------------------------------
+            /// Destructor. Removes the transform, and its children, from
+            /// the transform hierarchy it belongs to, if any.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------
+            ~Transform();
             //----------------------------------------------------------
             /// Set Look At
             ///
@@ -343,6 +350,7 @@ namespace ChilliSource
             void Reset();
             
         private:
+            friend class TransformHierarchy;
             
             //----------------------------------------------------------------
             /// On Transform Changed 
@@ -380,6 +388,9 @@ namespace ChilliSource
             
             mutable bool mbIsTransformCacheValid;
             mutable bool mbIsParentTransformCacheValid;
+            
+            TransformHierarchy* m_hierarchy;
+            u32 m_hierarchyIndex;
         };
     }
 }
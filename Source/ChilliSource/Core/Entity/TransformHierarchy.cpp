@@ -0,0 +1,413 @@
+//
+//  TransformHierarchy.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/Transform.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_minParallelLevelSize = 256;
+            const u32 k_minParallelBatchSize = 64;
+        }
+        
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::Add(Transform* in_root)
+        {
+            CS_ASSERT(in_root != nullptr, "Cannot add a null transform to a transform hierarchy.");
+            CS_ASSERT(in_root->GetParentTransform() == nullptr, "Only root transforms can be added to a transform hierarchy.");
+            
+            if (in_root->m_hierarchy == this)
+            {
+                return;
+            }
+            
+            if (in_root->m_hierarchy != nullptr)
+            {
+                in_root->m_hierarchy->Remove(in_root);
+            }
+            
+            m_roots.push_back(in_root);
+            SetMembership(in_root, this);
+            m_structureDirty = true;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::Remove(Transform* in_transform)
+        {
+            CS_ASSERT(in_transform != nullptr, "Cannot remove a null transform from a transform hierarchy.");
+            
+            if (in_transform->m_hierarchy != this)
+            {
+                return;
+            }
+            
+            std::vector<Transform*>::iterator it = std::find(m_roots.begin(), m_roots.end(), in_transform);
+            if (it != m_roots.end())
+            {
+                m_roots.erase(it);
+            }
+            
+            SetMembership(in_transform, nullptr);
+            PurgeChangedTransforms();
+            m_structureDirty = true;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::RemoveAll()
+        {
+            while (m_roots.empty() == false)
+            {
+                Remove(m_roots.back());
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::Update()
+        {
+            if (m_structureDirty == true)
+            {
+                RebuildOrder();
+            }
+            
+            if (m_dirtyList.empty() == false)
+            {
+                const u32 firstDirty = *std::min_element(m_dirtyList.begin(), m_dirtyList.end());
+                for (u32 index : m_dirtyList)
+                {
+                    m_localMatrices[index] = m_transforms[index]->GetLocalTransform();
+                }
+                
+                //each level only depends on the level above, so the nodes within a level can be updated in any order.
+                auto updateRange = [this](u32 in_begin, u32 in_end)
+                {
+                    for (u32 i = in_begin; i < in_end; ++i)
+                    {
+                        s32 parentIndex = m_parentIndices[i];
+                        bool isDirty = (m_localDirtyFlags[i] != 0 || (parentIndex >= 0 && m_worldDirtyFlags[parentIndex] != 0));
+                        m_worldDirtyFlags[i] = isDirty ? 1 : 0;
+                        
+                        if (isDirty == true)
+                        {
+                            m_worldMatrices[i] = (parentIndex >= 0) ? m_localMatrices[i] * m_worldMatrices[parentIndex] : m_localMatrices[i];
+                        }
+                    }
+                };
+                
+                TaskScheduler* taskScheduler = (Application::Get() != nullptr) ? Application::Get()->GetTaskScheduler() : nullptr;
+                const bool canUpdateInParallel = (taskScheduler != nullptr && taskScheduler->IsMainThread() == true);
+                
+                u32 level = static_cast<u32>(std::upper_bound(m_levelOffsets.begin(), m_levelOffsets.end(), firstDirty) - m_levelOffsets.begin()) - 1;
+                for (; level + 1 < m_levelOffsets.size(); ++level)
+                {
+                    const u32 begin = std::max(m_levelOffsets[level], firstDirty);
+                    const u32 end = m_levelOffsets[level + 1];
+                    
+                    if (canUpdateInParallel == true && end - begin >= k_minParallelLevelSize)
+                    {
+                        taskScheduler->ParallelFor(end - begin, k_minParallelBatchSize, [begin, &updateRange](u32 in_begin, u32 in_end)
+                        {
+                            updateRange(begin + in_begin, begin + in_end);
+                        });
+                    }
+                    else
+                    {
+                        updateRange(begin, end);
+                    }
+                }
+                
+                for (u32 i = firstDirty; i < m_transforms.size(); ++i)
+                {
+                    if (m_worldDirtyFlags[i] != 0)
+                    {
+                        m_changedTransforms.push_back(m_transforms[i]);
+                        m_worldDirtyFlags[i] = 0;
+                    }
+                    m_localDirtyFlags[i] = 0;
+                }
+                
+                m_dirtyList.clear();
+            }
+            
+            //notifications may change or read transforms, which can re-enter the update. Any transforms that
+            //change as a result are appended to the list and notified by the outermost update.
+            if (m_notifying == true || m_changedTransforms.empty() == true)
+            {
+                return;
+            }
+            
+            m_notifying = true;
+            
+            for (u32 i = 0; i < m_changedTransforms.size(); ++i)
+            {
+                if (m_changedTransforms[i] != nullptr)
+                {
+                    m_changedTransforms[i]->mTransformChangedEvent.NotifyConnections();
+                }
+            }
+            
+            m_changedTransforms.erase(std::remove(m_changedTransforms.begin(), m_changedTransforms.end(), nullptr), m_changedTransforms.end());
+            m_transformsChangedEvent.NotifyConnections(m_changedTransforms);
+            
+            m_changedTransforms.clear();
+            m_notifying = false;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        u32 TransformHierarchy::GetNumTransforms() const
+        {
+            if (m_structureDirty == true)
+            {
+                u32 numTransforms = 0;
+                std::vector<const Transform*> stack(m_roots.begin(), m_roots.end());
+                while (stack.empty() == false)
+                {
+                    const Transform* transform = stack.back();
+                    stack.pop_back();
+                    ++numTransforms;
+                    stack.insert(stack.end(), transform->mChildTransforms.begin(), transform->mChildTransforms.end());
+                }
+                return numTransforms;
+            }
+            
+            return static_cast<u32>(m_transforms.size());
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        IConnectableEvent<TransformHierarchy::TransformsChangedDelegate>& TransformHierarchy::GetTransformsChangedEvent()
+        {
+            return m_transformsChangedEvent;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::OnTransformChanged(Transform* in_transform)
+        {
+            //transforms added since the last rebuild don't have an index yet, but will be dirty once they do.
+            u32 index = in_transform->m_hierarchyIndex;
+            if (index != k_invalidIndex && m_localDirtyFlags[index] == 0)
+            {
+                m_localDirtyFlags[index] = 1;
+                m_dirtyList.push_back(index);
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::OnChildAdded(Transform* in_child)
+        {
+            if (in_child->m_hierarchy == this)
+            {
+                std::vector<Transform*>::iterator it = std::find(m_roots.begin(), m_roots.end(), in_child);
+                if (it != m_roots.end())
+                {
+                    m_roots.erase(it);
+                }
+            }
+            else if (in_child->m_hierarchy != nullptr)
+            {
+                in_child->m_hierarchy->Remove(in_child);
+            }
+            
+            SetMembership(in_child, this);
+            m_structureDirty = true;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        const Matrix4& TransformHierarchy::GetWorldTransform(const Transform* in_transform)
+        {
+            if (IsWorldTransformValid(in_transform) == false)
+            {
+                //updating changes the store and notifies listeners, so it can't safely happen on other threads. The
+                //store is flushed before any parallel work in the frame, so this should only be hit on the main thread.
+                CS_ASSERT(Application::Get() == nullptr || Application::Get()->GetTaskScheduler() == nullptr || Application::Get()->GetTaskScheduler()->IsMainThread() == true,
+                          "Cannot read the world transform of a transform with pending changes from a background thread.");
+                Update();
+            }
+            
+            return m_worldMatrices[in_transform->m_hierarchyIndex];
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        bool TransformHierarchy::IsWorldTransformValid(const Transform* in_transform) const
+        {
+            if (m_structureDirty == true)
+            {
+                return false;
+            }
+            
+            if (m_dirtyList.empty() == true)
+            {
+                return true;
+            }
+            
+            //the world transform is out of date if it, or any of its ancestors, has changed.
+            s32 index = static_cast<s32>(in_transform->m_hierarchyIndex);
+            while (index >= 0)
+            {
+                if (m_localDirtyFlags[index] != 0)
+                {
+                    return false;
+                }
+                index = m_parentIndices[index];
+            }
+            
+            return true;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::SetMembership(Transform* in_transform, TransformHierarchy* in_hierarchy)
+        {
+            in_transform->m_hierarchy = in_hierarchy;
+            in_transform->m_hierarchyIndex = k_invalidIndex;
+            
+            //transforms leaving the store go back to lazy evaluation, so their cached matrices can't be trusted.
+            if (in_hierarchy == nullptr)
+            {
+                in_transform->mbIsTransformCacheValid = false;
+                in_transform->mbIsParentTransformCacheValid = false;
+            }
+            
+            for (Transform* child : in_transform->mChildTransforms)
+            {
+                SetMembership(child, in_hierarchy);
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::RebuildOrder()
+        {
+            m_scratchTransforms.clear();
+            m_parentIndices.clear();
+            m_levelOffsets.clear();
+            
+            for (Transform* root : m_roots)
+            {
+                m_scratchTransforms.push_back(root);
+                m_parentIndices.push_back(-1);
+            }
+            
+            //breadth first, so that each level is contiguous and follows the level above it.
+            m_levelOffsets.push_back(0);
+            u32 levelStart = 0;
+            while (levelStart < m_scratchTransforms.size())
+            {
+                const u32 levelEnd = static_cast<u32>(m_scratchTransforms.size());
+                m_levelOffsets.push_back(levelEnd);
+                
+                for (u32 i = levelStart; i < levelEnd; ++i)
+                {
+                    for (Transform* child : m_scratchTransforms[i]->mChildTransforms)
+                    {
+                        if (child->m_hierarchy != this)
+                        {
+                            continue;
+                        }
+                        
+                        m_scratchTransforms.push_back(child);
+                        m_parentIndices.push_back(static_cast<s32>(i));
+                    }
+                }
+                
+                levelStart = levelEnd;
+            }
+            
+            const u32 numTransforms = static_cast<u32>(m_scratchTransforms.size());
+            m_scratchLocalMatrices.resize(numTransforms);
+            m_scratchWorldMatrices.resize(numTransforms);
+            m_scratchDirtyFlags.resize(numTransforms);
+            
+            for (u32 i = 0; i < numTransforms; ++i)
+            {
+                Transform* transform = m_scratchTransforms[i];
+                u32 previousIndex = transform->m_hierarchyIndex;
+                if (previousIndex != k_invalidIndex)
+                {
+                    m_scratchLocalMatrices[i] = m_localMatrices[previousIndex];
+                    m_scratchWorldMatrices[i] = m_worldMatrices[previousIndex];
+                    m_scratchDirtyFlags[i] = m_localDirtyFlags[previousIndex];
+                }
+                else
+                {
+                    m_scratchDirtyFlags[i] = 1;
+                }
+                
+                transform->m_hierarchyIndex = i;
+            }
+            
+            m_transforms.swap(m_scratchTransforms);
+            m_localMatrices.swap(m_scratchLocalMatrices);
+            m_worldMatrices.swap(m_scratchWorldMatrices);
+            m_localDirtyFlags.swap(m_scratchDirtyFlags);
+            m_worldDirtyFlags.assign(numTransforms, 0);
+            
+            m_dirtyList.clear();
+            for (u32 i = 0; i < numTransforms; ++i)
+            {
+                if (m_localDirtyFlags[i] != 0)
+                {
+                    m_dirtyList.push_back(i);
+                }
+            }
+            
+            m_structureDirty = false;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void TransformHierarchy::PurgeChangedTransforms()
+        {
+            //while notifying, entries are cleared rather than erased so that the notification loop isn't disturbed.
+            for (Transform*& transform : m_changedTransforms)
+            {
+                if (transform != nullptr && transform->m_hierarchy != this)
+                {
+                    transform = nullptr;
+                }
+            }
+            
+            if (m_notifying == false)
+            {
+                m_changedTransforms.erase(std::remove(m_changedTransforms.begin(), m_changedTransforms.end(), nullptr), m_changedTransforms.end());
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        TransformHierarchy::~TransformHierarchy()
+        {
+            RemoveAll();
+        }
+    }
+}
@@ -0,0 +1,210 @@
+//
+//  TransformHierarchy.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_ENTITY_TRANSFORMHIERARCHY_H_
+#define _CHILLISOURCE_CORE_ENTITY_TRANSFORMHIERARCHY_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Event/Event.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+
+#include <functional>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //--------------------------------------------------------------------------------------------------
+        /// An optional store for the world matrices of one or more transform hierarchies. Transforms
+        /// in the store are held in contiguous arrays in breadth first order, so every parent comes
+        /// before its children and each depth of the hierarchy occupies a contiguous range.
+        ///
+        /// Changing a transform in the store only marks it as dirty, rather than recursively
+        /// invalidating its children and notifying listeners. Update() then recalculates the world
+        /// matrices of all dirty transforms and their descendants in a single linear pass, with
+        /// large levels of the hierarchy processed in parallel. Each transform that changed has its
+        /// transform changed event fired once, regardless of how many times it was changed, and the
+        /// full list of changed transforms is reported through a single event.
+        ///
+        /// Reading the world transform of a transform with pending changes on the main thread will
+        /// update the store immediately, so world transforms are always correct. Background threads
+        /// may only read world transforms once the store has been updated; the scene and renderer
+        /// update it before culling and rendering.
+        ///
+        /// @author Jordan Brown
+        //--------------------------------------------------------------------------------------------------
+        class TransformHierarchy final
+        {
+        public:
+            CS_DECLARE_NOCOPY(TransformHierarchy);
+            
+            typedef InlineDelegate<void(const std::vector<Transform*>&)> TransformsChangedDelegate;
+            //--------------------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            //--------------------------------------------------------------------------------------------------
+            TransformHierarchy() = default;
+            //--------------------------------------------------------------------------------------------------
+            /// Adds the given root transform, and all of its descendants, to the store. Any children
+            /// later added to transforms in the store are added automatically.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The root transform. This must not have a parent.
+            //--------------------------------------------------------------------------------------------------
+            void Add(Transform* in_root);
+            //--------------------------------------------------------------------------------------------------
+            /// Removes the given transform, and all of its descendants, from the store. These will go
+            /// back to calculating their world transforms lazily.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The transform to remove.
+            //--------------------------------------------------------------------------------------------------
+            void Remove(Transform* in_transform);
+            //--------------------------------------------------------------------------------------------------
+            /// Removes all transforms from the store.
+            ///
+            /// @author Jordan Brown
+            //--------------------------------------------------------------------------------------------------
+            void RemoveAll();
+            //--------------------------------------------------------------------------------------------------
+            /// Recalculates the world matrices of all dirty transforms and their descendants, then
+            /// notifies listeners of every transform that changed. This should be called once per
+            /// frame, though it is cheap to call when nothing has changed.
+            ///
+            /// @author Jordan Brown
+            //--------------------------------------------------------------------------------------------------
+            void Update();
+            //--------------------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of transforms in the store.
+            //--------------------------------------------------------------------------------------------------
+            u32 GetNumTransforms() const;
+            //--------------------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return An event that is invoked once per update with the list of all transforms whose
+            /// world transform changed.
+            //--------------------------------------------------------------------------------------------------
+            IConnectableEvent<TransformsChangedDelegate>& GetTransformsChangedEvent();
+            //--------------------------------------------------------------------------------------------------
+            /// Destructor. Removes all transforms from the store.
+            ///
+            /// @author Jordan Brown
+            //--------------------------------------------------------------------------------------------------
+            ~TransformHierarchy();
+            
+        private:
+            friend class Transform;
+            
+            static const u32 k_invalidIndex = 0xffffffff;
+            //--------------------------------------------------------------------------------------------------
+            /// Called by transforms in the store when their local transform changes.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The transform that changed.
+            //--------------------------------------------------------------------------------------------------
+            void OnTransformChanged(Transform* in_transform);
+            //--------------------------------------------------------------------------------------------------
+            /// Called by transforms in the store when a child is added to them.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The child transform.
+            //--------------------------------------------------------------------------------------------------
+            void OnChildAdded(Transform* in_child);
+            //--------------------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param A transform in the store.
+            ///
+            /// @return The world transform, updating the store first if it is out of date. The store
+            /// can only be updated on the main thread.
+            //--------------------------------------------------------------------------------------------------
+            const Matrix4& GetWorldTransform(const Transform* in_transform);
+            //--------------------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param A transform in the store.
+            ///
+            /// @return Whether or not the world transform is up to date.
+            //--------------------------------------------------------------------------------------------------
+            bool IsWorldTransformValid(const Transform* in_transform) const;
+            //--------------------------------------------------------------------------------------------------
+            /// Sets which store the given transform, and all of its descendants, belong to.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The transform.
+            /// @param The store, or null if leaving the store.
+            //--------------------------------------------------------------------------------------------------
+            void SetMembership(Transform* in_transform, TransformHierarchy* in_hierarchy);
+            //--------------------------------------------------------------------------------------------------
+            /// Rebuilds the breadth first ordering after transforms have been added or removed. The
+            /// matrices of transforms that were already in the store are carried over.
+            ///
+            /// @author Jordan Brown
+            //--------------------------------------------------------------------------------------------------
+            void RebuildOrder();
+            //--------------------------------------------------------------------------------------------------
+            /// Removes any transforms that are no longer in the store from the changed list.
+            ///
+            /// @author Jordan Brown
+            //--------------------------------------------------------------------------------------------------
+            void PurgeChangedTransforms();
+            
+            std::vector<Transform*> m_roots;
+            
+            std::vector<Transform*> m_transforms;
+            std::vector<s32> m_parentIndices;
+            std::vector<u32> m_levelOffsets;
+            std::vector<Matrix4> m_localMatrices;
+            std::vector<Matrix4> m_worldMatrices;
+            std::vector<u8> m_localDirtyFlags;
+            std::vector<u8> m_worldDirtyFlags;
+            std::vector<u32> m_dirtyList;
+            
+            std::vector<Transform*> m_scratchTransforms;
+            std::vector<Matrix4> m_scratchLocalMatrices;
+            std::vector<Matrix4> m_scratchWorldMatrices;
+            std::vector<u8> m_scratchDirtyFlags;
+            
+            std::vector<Transform*> m_changedTransforms;
+            Event<TransformsChangedDelegate> m_transformsChangedEvent;
+            
+            bool m_structureDirty = false;
+            bool m_notifying = false;
+        };
+    }
+}
+
+#endif
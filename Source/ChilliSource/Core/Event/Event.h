@@ -31,10 +31,12 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/ForwardDeclarations.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 #include <ChilliSource/Core/Event/EventConnection.h>
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 #include <ChilliSource/Core/Event/IDisconnectableEvent.h>
 
+#include <algorithm>
 #include <vector>
 
 namespace ChilliSource
@@ -47,6 +49,10 @@ namespace ChilliSource
         /// Objects should though expose the IConnectableEvent interface
         /// to prevent other objects invoking the event.
         ///
+        /// Frequently notified events should use an InlineDelegate as the
+        /// delegate type, so that connecting lambdas and member functions
+        /// doesn't require a heap allocation per listener.
+        ///
         /// @author S Downie
         //-----------------------------------------------------------------
         template <typename TDelegateType> class Event final : public IConnectableEvent<TDelegateType>, public IDisconnectableEvent
@@ -89,6 +95,7 @@ namespace ChilliSource
 				CloseAllConnections();
 
 				m_isNotifying = in_moveFrom.m_isNotifying;
+				m_hasClosedConnections = in_moveFrom.m_hasClosedConnections;
 				m_connections = std::move(in_moveFrom.m_connections);
 				for (auto& connectionContainer : m_connections)
 				{
@@ -111,6 +118,7 @@ namespace ChilliSource
 				CloseAllConnections();
 
 				m_isNotifying = in_moveFrom.m_isNotifying;
+				m_hasClosedConnections = in_moveFrom.m_hasClosedConnections;
 				m_connections = std::move(in_moveFrom.m_connections);
 				for (auto& connectionContainer : m_connections)
 				{
@@ -163,6 +171,7 @@ namespace ChilliSource
                         else
                         {
                             desc.m_connection = nullptr;
+                            m_hasClosedConnections = true;
                         }
                         
                         return;
@@ -178,6 +187,9 @@ namespace ChilliSource
             //-------------------------------------------------------------
             template <typename... TArgTypes> void NotifyConnections(TArgTypes&&... in_args)
             {
+                //Events can be notified again from within one of their own delegates, in
+                //which case closed connections are only removed by the outermost call.
+                bool wasNotifying = m_isNotifying;
                 m_isNotifying = true;
                 
                 //Take a snapshot of the number of delegates so any new ones added
@@ -191,9 +203,12 @@ namespace ChilliSource
                     }
                 }
                 
-                m_isNotifying = false;
+                m_isNotifying = wasNotifying;
                 
-                RemoveClosedConnections();
+                if(m_isNotifying == false && m_hasClosedConnections == true)
+                {
+                    RemoveClosedConnections();
+                }
             }
             //-------------------------------------------------------------
             /// Closes all the currently open connections
@@ -207,10 +222,20 @@ namespace ChilliSource
                     if(m_connections[i].m_connection != nullptr)
                     {
                         m_connections[i].m_connection->SetOwningEvent(nullptr);
+                        m_connections[i].m_connection = nullptr;
                     }
                 }
                 
-                m_connections.clear();
+                //The notify loop is still iterating the list, so it is cleaned up once that finishes.
+                if(m_isNotifying == true)
+                {
+                    m_hasClosedConnections = true;
+                }
+                else
+                {
+                    m_connections.clear();
+                    m_hasClosedConnections = false;
+                }
             }
     
         private:
@@ -222,17 +247,12 @@ namespace ChilliSource
             //-------------------------------------------------------------------------
             void RemoveClosedConnections()
             {
-                for(typename ConnectionList::iterator it = m_connections.begin(); it != m_connections.end(); )
+                m_connections.erase(std::remove_if(m_connections.begin(), m_connections.end(), [](const ConnectionDesc& in_desc)
                 {
-                    if(it->m_connection == nullptr)
-                    {
-                        it = m_connections.erase(it);
-                    }
-                    else
-                    {
-                        ++it;
-                    }
-                }
+                    return in_desc.m_connection == nullptr;
+                }), m_connections.end());
+                
+                m_hasClosedConnections = false;
             }
     
         private:
@@ -247,6 +267,7 @@ namespace ChilliSource
             ConnectionList m_connections;
         
             bool m_isNotifying = false;
+            bool m_hasClosedConnections = false;
         };
     }
 }
@@ -30,10 +30,93 @@
 
 #include <ChilliSource/Core/Event/IDisconnectableEvent.h>
 
+#include <atomic>
+#include <type_traits>
+
 namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            const u32 k_connectionsPerPage = 256;
+            
+            //----------------------------------------------------------------
+            /// A pool slot, which holds either a connection or a link to the
+            /// next free slot.
+            //----------------------------------------------------------------
+            union ConnectionSlot
+            {
+                ConnectionSlot* m_nextFree;
+                std::aligned_storage<sizeof(EventConnection), std::alignment_of<EventConnection>::value>::type m_connection;
+            };
+            
+            //The pool is constant initialised, and its pages are never released, so connections can
+            //safely be opened and closed during static initialisation and destruction.
+            std::atomic_flag g_poolLock = ATOMIC_FLAG_INIT;
+            ConnectionSlot* g_freeSlots = nullptr;
+            
+            //----------------------------------------------------------------
+            /// Locks the pool for the lifetime of the object. The pool is only
+            /// held for a handful of instructions so a spin lock is used.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------
+            class PoolLock final
+            {
+            public:
+                PoolLock()
+                {
+                    while (g_poolLock.test_and_set(std::memory_order_acquire) == true)
+                    {
+                    }
+                }
+                
+                ~PoolLock()
+                {
+                    g_poolLock.clear(std::memory_order_release);
+                }
+            };
+        }
+        
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void* EventConnection::operator new(std::size_t in_size)
+        {
+            CS_ASSERT(in_size == sizeof(EventConnection), "Only event connections can be allocated from the connection pool.");
+            
+            PoolLock lock;
+            
+            if (g_freeSlots == nullptr)
+            {
+                ConnectionSlot* page = new ConnectionSlot[k_connectionsPerPage];
+                for (u32 i = 0; i < k_connectionsPerPage - 1; ++i)
+                {
+                    page[i].m_nextFree = &page[i + 1];
+                }
+                page[k_connectionsPerPage - 1].m_nextFree = nullptr;
+                g_freeSlots = page;
+            }
+            
+            ConnectionSlot* slot = g_freeSlots;
+            g_freeSlots = slot->m_nextFree;
+            return slot;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void EventConnection::operator delete(void* in_memory)
+        {
+            if (in_memory == nullptr)
+            {
+                return;
+            }
+            
+            PoolLock lock;
+            
+            ConnectionSlot* slot = static_cast<ConnectionSlot*>(in_memory);
+            slot->m_nextFree = g_freeSlots;
+            g_freeSlots = slot;
+        }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
         void EventConnection::SetOwningEvent(IDisconnectableEvent* in_owningEvent)
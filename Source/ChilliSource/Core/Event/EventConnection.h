@@ -31,6 +31,8 @@
 
 #include <ChilliSource/ChilliSource.h>
 
+#include <cstddef>
+
 namespace ChilliSource
 {
     namespace Core
@@ -47,6 +49,26 @@ namespace ChilliSource
         {
         public:
             
+            //----------------------------------------------------------------
+            /// Connections are small and are opened and closed frequently,
+            /// so they are allocated from a shared pool rather than the heap.
+            /// This is thread safe.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The size of the allocation in bytes.
+            ///
+            /// @return The allocated memory.
+            //----------------------------------------------------------------
+            static void* operator new(std::size_t in_size);
+            //----------------------------------------------------------------
+            /// Returns the memory for a connection to the shared pool.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The memory to release.
+            //----------------------------------------------------------------
+            static void operator delete(void* in_memory);
             //----------------------------------------------------------------
             /// Destructor
             ///
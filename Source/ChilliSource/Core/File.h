@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/File/CSBinaryInputStream.h>
 #include <ChilliSource/Core/File/FileStream.h>
 #include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/FileView.h>
 #include <ChilliSource/Core/File/StorageLocation.h>
 #include <ChilliSource/Core/File/TaggedFilePathResolver.h>
 
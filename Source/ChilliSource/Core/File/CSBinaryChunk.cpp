@@ -28,14 +28,18 @@
 
 #include <ChilliSource/Core/File/CSBinaryChunk.h>
 
+#include <ChilliSource/Core/File/FileView.h>
+
+#include <cstring>
+
 namespace ChilliSource
 {
     namespace Core
     {
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        CSBinaryChunk::CSBinaryChunk(std::unique_ptr<u8[]> in_dataBlob, u32 in_dataSize)
-        : m_dataBlob(std::move(in_dataBlob)), m_dataSize(in_dataSize)
+        CSBinaryChunk::CSBinaryChunk(const FileViewSPtr& in_fileView, const u8* in_data, u32 in_dataSize)
+        : m_fileView(in_fileView), m_data(in_data), m_dataSize(in_dataSize)
         {
         }
         //----------------------------------------------------------------
@@ -48,7 +52,7 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const u8* CSBinaryChunk::GetData() const
         {
-            return m_dataBlob.get();
+            return m_data;
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
@@ -65,7 +69,7 @@ namespace ChilliSource
                 CS_LOG_FATAL("Trying to read beyond the end of a Binary Chunk.");
             }
             
-            u8* output = m_dataBlob.get() + m_readPosition;
+            const u8* output = m_data + m_readPosition;
             m_readPosition += in_dataSize;
             return output;
         }
@@ -73,9 +77,14 @@ namespace ChilliSource
         //----------------------------------------------------------------
         std::unique_ptr<u8[]> CSBinaryChunk::ClaimData()
         {
+            std::unique_ptr<u8[]> output(new u8[m_dataSize]);
+            memcpy(output.get(), m_data, m_dataSize);
+            
+            m_fileView.reset();
+            m_data = nullptr;
             m_dataSize = 0;
             m_readPosition = 0;
-            return std::move(m_dataBlob);
+            return output;
         }
     }
 }
\ No newline at end of file
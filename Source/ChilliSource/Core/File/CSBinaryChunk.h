@@ -37,8 +37,9 @@ namespace ChilliSource
     {
         //----------------------------------------------------------------------
         /// A single chunk within a Chilli Source binary "Chunked" file. The
-        /// contents of the chunk are loaded directly into memory on creation
-        /// meaning each call to Read() avoids further disc reads.
+        /// chunk refers directly to the contents of the file view it was read
+        /// from, meaning each call to Read() avoids further disc reads or
+        /// copies.
         ///
         /// CSBinaryChunk is thread agnostic and can be used and accessed on any
         /// thread but it is not thread-safe, so a single instance should not
@@ -98,9 +99,10 @@ namespace ChilliSource
             const u8* Read(u32 in_dataSize);
             //----------------------------------------------------------------
             /// Claims the chunks memory. This is used in cases where the
-            /// entire contents of the chunk is desired without having to
-            /// copy the data, for example image data. After this has been
-            /// called the chunk can no longer be used.
+            /// entire contents of the chunk is desired as an owned block of
+            /// memory, for example image data. As the chunk refers to the
+            /// file view, this copies the chunk. After this has been called
+            /// the chunk can no longer be used.
             ///
             /// @author Ian Copland
             ///
@@ -111,17 +113,20 @@ namespace ChilliSource
             friend class CSBinaryInputStream;
             //----------------------------------------------------------------
             /// Constructor. Creates the chunk with a pointer to the chunk
-            /// data blob. This is private to ensure only the CS Binary Input
-            /// Stream can instantiate it.
+            /// data within the file view. The chunk keeps the view alive
+            /// for as long as it exists. This is private to ensure only the
+            /// CS Binary Input Stream can instantiate it.
             ///
             /// @author Ian Copland
             ///
-            /// @param The chunk data blob.
+            /// @param The file view the chunk belongs to.
+            /// @param The chunk data.
             /// @param The chunk data size.
             //----------------------------------------------------------------
-            CSBinaryChunk(std::unique_ptr<u8[]> in_dataBlob, u32 in_dataSize);
+            CSBinaryChunk(const FileViewSPtr& in_fileView, const u8* in_data, u32 in_dataSize);
             
-            std::unique_ptr<u8[]> m_dataBlob;
+            FileViewSPtr m_fileView;
+            const u8* m_data = nullptr;
             u32 m_dataSize = 0;
             u32 m_readPosition = 0;
         };
@@ -31,6 +31,7 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/File/CSBinaryChunk.h>
 #include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/FileView.h>
 
 namespace ChilliSource
 {
@@ -43,21 +44,26 @@ namespace ChilliSource
             ///
             /// @param Ian Copland
             ///
-            /// @param The file stream.
+            /// @param The file view.
             /// @param [Out] The file format Id.
             /// @param [Out] The file format version.
             /// @param [Out] The number of entries in the chunk table.
             ///
             /// @return Whether reading the header was successful or not.
             //--------------------------------------------------------------
-            bool ReadHeader(FileStream* in_fileStream, const std::string& in_filePath, u32& out_fileFormatId, u32& out_fileFormatVersion, u32& out_numChunkTableEntries)
+            bool ReadHeader(FileView* in_fileView, const std::string& in_filePath, u32& out_fileFormatId, u32& out_fileFormatVersion, u32& out_numChunkTableEntries)
             {
-                CS_ASSERT(in_fileStream != nullptr, "File stream cannot be null.");
+                CS_ASSERT(in_fileView != nullptr, "File view cannot be null.");
                 
                 //read the header data
                 const u32 k_headerSize = 20;
-                std::unique_ptr<u8[]> headerData(new u8[k_headerSize]);
-                in_fileStream->Read(reinterpret_cast<s8*>(headerData.get()), k_headerSize);
+                if (in_fileView->GetSize() < k_headerSize)
+                {
+                    CS_LOG_ERROR("File is too small to be a Chilli Source file: " + in_filePath);
+                    return false;
+                }
+                
+                const u8* headerData = in_fileView->Read(k_headerSize);
                 
                 //test file id.
                 if (headerData[0] != 'C' || headerData[1] != 'S' || headerData[2] != 'C' || headerData[3] != 'S')
@@ -68,7 +74,7 @@ namespace ChilliSource
                 
                 //test file endianness.
                 const u32 k_endiannessCheckFlagOffset = 4;
-                u32 endiannessCheckFlag = *reinterpret_cast<const u32*>(headerData.get() + k_endiannessCheckFlagOffset);
+                u32 endiannessCheckFlag = *reinterpret_cast<const u32*>(headerData + k_endiannessCheckFlagOffset);
                 if (endiannessCheckFlag != 9999)
                 {
                     CS_LOG_ERROR("File is big endian, only little endian is currently supported: " + in_filePath);
@@ -77,15 +83,15 @@ namespace ChilliSource
                 
                 //read the file type
                 const u32 k_fileFormatIdOffset = 8;
-                out_fileFormatId = *reinterpret_cast<const u32*>(headerData.get() + k_fileFormatIdOffset);
+                out_fileFormatId = *reinterpret_cast<const u32*>(headerData + k_fileFormatIdOffset);
                 
                 //read the file version
                 const u32 k_fileFormatVersionOffset = 12;
-                out_fileFormatVersion = *reinterpret_cast<const u32*>(headerData.get() + k_fileFormatVersionOffset);
+                out_fileFormatVersion = *reinterpret_cast<const u32*>(headerData + k_fileFormatVersionOffset);
                 
                 //read the number of chunk table entries
                 const u32 k_numChunkTableEntriesOffset = 16;
-                out_numChunkTableEntries = *reinterpret_cast<const u32*>(headerData.get() + k_numChunkTableEntriesOffset);
+                out_numChunkTableEntries = *reinterpret_cast<const u32*>(headerData + k_numChunkTableEntriesOffset);
                 
                 return true;
             }
@@ -98,18 +104,17 @@ namespace ChilliSource
             FileSystem* fileSystem = Application::Get()->GetFileSystem();
             CS_ASSERT(fileSystem != nullptr, "CSBinaryInputStream missing required system: FileSystem.");
             
-            m_fileStream = fileSystem->CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
-            if (m_fileStream != nullptr && m_fileStream->IsBad() == false && m_fileStream->IsOpen() == true)
+            m_fileView = fileSystem->CreateFileView(in_storageLocation, in_filePath);
+            if (m_fileView != nullptr)
             {
                 u32 numChunkTableEntries;
-                if (ReadHeader(m_fileStream.get(), in_filePath, m_fileFormatId, m_fileFormatVersion, numChunkTableEntries) == false)
+                if (ReadHeader(m_fileView.get(), in_filePath, m_fileFormatId, m_fileFormatVersion, numChunkTableEntries) == false || ReadChunkTable(numChunkTableEntries) == false)
                 {
-                    m_fileStream.reset();
+                    CS_LOG_ERROR("Invalid Chilli Source file: " + in_filePath);
+                    m_fileView.reset();
                     return;
                 }
                 
-                ReadChunkTable(numChunkTableEntries);
-                
                 m_isValid = true;
             }
         }
@@ -140,49 +145,56 @@ namespace ChilliSource
             auto chunkInfoIt = m_chunkInfoMap.find(in_chunkId);
             if (chunkInfoIt != m_chunkInfoMap.end())
             {
-                m_fileStream->SeekG(chunkInfoIt->second.m_offset, SeekDir::k_beginning);
-                CS_ASSERT(m_fileStream->TellG() == chunkInfoIt->second.m_offset, "Seek failed.");
-                
-                std::unique_ptr<u8[]> chunkData(new u8[chunkInfoIt->second.m_size]);
-                m_fileStream->Read(reinterpret_cast<s8*>(chunkData.get()), chunkInfoIt->second.m_size);
-                
-                return CSBinaryChunkUPtr(new CSBinaryChunk(std::move(chunkData), chunkInfoIt->second.m_size));
+                const u8* chunkData = m_fileView->GetData() + chunkInfoIt->second.m_offset;
+                return CSBinaryChunkUPtr(new CSBinaryChunk(m_fileView, chunkData, chunkInfoIt->second.m_size));
             }
             
             return nullptr;
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
-        void CSBinaryInputStream::ReadChunkTable(u32 in_numEntries)
+        bool CSBinaryInputStream::ReadChunkTable(u32 in_numEntries)
         {
-            const u32 k_chunkEntrySize = 12;
+            const u64 k_chunkEntrySize = 12;
             
             //read the chunk table
-            const u32 chunkTableDataSize = k_chunkEntrySize * in_numEntries;
-            std::unique_ptr<u8[]> chunkTableData(new u8[chunkTableDataSize]);
-            m_fileStream->Read(reinterpret_cast<s8*>(chunkTableData.get()), chunkTableDataSize);
+            const u64 chunkTableDataSize = k_chunkEntrySize * in_numEntries;
+            if (chunkTableDataSize > m_fileView->GetSize() - m_fileView->GetReadPosition())
+            {
+                return false;
+            }
+            
+            const u8* chunkTableData = m_fileView->Read(chunkTableDataSize);
             
             //iterate over the chunks
             for (u32 i = 0; i < in_numEntries; ++i)
             {
-                const u32 chunkOffset = i * k_chunkEntrySize;
+                const u64 chunkOffset = i * k_chunkEntrySize;
                 
                 //get the chunk identifier
                 const u32 k_chunkIdSize = 4;
-                std::string chunkId(reinterpret_cast<const s8*>(chunkTableData.get() + chunkOffset), k_chunkIdSize);
+                std::string chunkId(reinterpret_cast<const s8*>(chunkTableData + chunkOffset), k_chunkIdSize);
                 
                 ChunkInfo info;
                 
                 //get the chunk offset.
                 const u32 k_offsetOffset = 4;
-                info.m_offset = *reinterpret_cast<const u32*>(chunkTableData.get() + chunkOffset + k_offsetOffset);
+                info.m_offset = *reinterpret_cast<const u32*>(chunkTableData + chunkOffset + k_offsetOffset);
                 
                 //get the chunk size.
                 const u32 k_sizeOffset = 8;
-                info.m_size = *reinterpret_cast<const u32*>(chunkTableData.get() + chunkOffset + k_sizeOffset);
+                info.m_size = *reinterpret_cast<const u32*>(chunkTableData + chunkOffset + k_sizeOffset);
+                
+                //the chunk must lie within the file
+                if (u64(info.m_offset) + u64(info.m_size) > m_fileView->GetSize())
+                {
+                    return false;
+                }
                 
                 m_chunkInfoMap.emplace(chunkId, info);
             }
+            
+            return true;
         }
     }
 }
@@ -40,7 +40,7 @@ namespace ChilliSource
         //----------------------------------------------------------------------
         /// A file input stream for reading files that use Chilli Source's
         /// "Chunked" binary file format. The input stream wraps around a
-        /// standard file stream and provides an easy and efficient API for
+        /// read-only file view and provides an easy and efficient API for
         /// loading files.
         ///
         /// The Chilli Source "Chunked" file format has 3 sections. The header,
@@ -122,10 +122,10 @@ namespace ChilliSource
             //--------------------------------------------------------------
             u32 GetFileFormatVersion() const;
             //--------------------------------------------------------------
-            /// Reads the contents of the requested chunk into memory and
-            /// returns it as a Binary Chunk to allow efficient and easy access
-            /// to the chunks contents. If the file doesn't contain the
-            /// requested chunk null will be returned.
+            /// Returns the requested chunk as a Binary Chunk to allow efficient
+            /// and easy access to the chunks contents. The chunk refers to the
+            /// file view directly so no data is copied. If the file doesn't
+            /// contain the requested chunk null will be returned.
             ///
             /// @author Ian Copland
             ///
@@ -153,10 +153,12 @@ namespace ChilliSource
             /// @author Ian Copland
             ///
             /// @param The number of entries in the chunk table.
+            ///
+            /// @return Whether the chunk table is valid.
             //--------------------------------------------------------------
-            void ReadChunkTable(u32 in_numEntries);
+            bool ReadChunkTable(u32 in_numEntries);
             
-            FileStreamUPtr m_fileStream;
+            FileViewSPtr m_fileView;
             bool m_isValid = false;
             u32 m_fileFormatId = 0;
             u32 m_fileFormatVersion = 0;
@@ -58,7 +58,7 @@ namespace ChilliSource
             
             SeekG(0);
             
-            const u32 kudwChunkSize = 256;
+            const u32 kudwChunkSize = 16 * 1024;
             s8 byData[kudwChunkSize];
             
             MD5 Hash;
@@ -95,7 +95,7 @@ namespace ChilliSource
             
             SeekG(0);
             
-            const u32 kudwChunkSize = 256;
+            const u32 kudwChunkSize = 16 * 1024;
             s8 byData[kudwChunkSize];
             
             CSHA1 Hash;
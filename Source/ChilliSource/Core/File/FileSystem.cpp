@@ -129,6 +129,42 @@ namespace ChilliSource
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
+        FileViewUPtr FileSystem::CreateFileView(StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            std::string absoluteFilePath = GetAbsolutePathToFile(in_storageLocation, in_filePath);
+            if (absoluteFilePath.empty() == false)
+            {
+                FileViewUPtr fileView = FileView::CreateMapped(absoluteFilePath);
+                if (fileView != nullptr)
+                {
+                    return fileView;
+                }
+            }
+            
+            //The file can't be mapped so read it in its entirety instead.
+            FileStreamUPtr fileStream = CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
+            if (fileStream == nullptr || fileStream->IsOpen() == false || fileStream->IsBad() == true)
+            {
+                return nullptr;
+            }
+            
+            fileStream->SeekG(0, SeekDir::k_end);
+            s32 dataSize = fileStream->TellG();
+            fileStream->SeekG(0, SeekDir::k_beginning);
+            
+            if (dataSize < 0)
+            {
+                return nullptr;
+            }
+            
+            std::unique_ptr<u8[]> data(new u8[dataSize]);
+            fileStream->Read(reinterpret_cast<s8*>(data.get()), dataSize);
+            fileStream->Close();
+            
+            return FileView::CreateBuffered(std::move(data), u64(dataSize));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
         std::vector<std::string> FileSystem::GetFilePathsWithExtension(StorageLocation in_storageLocation, const std::string& in_directoryPath,  bool in_recursive, const std::string& in_extension) const
         {
             std::vector<std::string> filePaths = GetFilePaths(in_storageLocation, in_directoryPath, in_recursive);
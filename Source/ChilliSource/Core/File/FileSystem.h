@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/FileView.h>
 #include <ChilliSource/Core/File/StorageLocation.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 
@@ -113,6 +114,21 @@ namespace ChilliSource
             //--------------------------------------------------------------
             virtual FileStreamUPtr CreateFileStream(StorageLocation in_storageLocation, const std::string& in_filePath, FileMode in_fileMode) const = 0;
             //--------------------------------------------------------------
+            /// Creates a read-only view of the entire contents of the given
+            /// file. The file is memory mapped if possible; files that
+            /// cannot be mapped, such as those inside the Android APK, are
+            /// read into memory with a single read instead.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The storage location.
+            /// @param The file path.
+            ///
+            /// @return The new file view, or null if the file couldn't be
+            /// opened.
+            //--------------------------------------------------------------
+            FileViewUPtr CreateFileView(StorageLocation in_storageLocation, const std::string& in_filePath) const;
+            //--------------------------------------------------------------
             /// Creates the given directory. The full directory hierarchy will
             /// be created.
             ///
@@ -0,0 +1,223 @@
+//
+//  FileView.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/File/FileView.h>
+
+#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined CS_TARGETPLATFORM_WINDOWS
+#include <CSBackend/Platform/Windows/Core/String/WindowsStringUtils.h>
+#include <windows.h>
+#endif
+
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        FileViewUPtr FileView::CreateMapped(const std::string& in_absoluteFilePath)
+        {
+#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID
+            s32 fileDescriptor = open(in_absoluteFilePath.c_str(), O_RDONLY);
+            if (fileDescriptor < 0)
+            {
+                return nullptr;
+            }
+            
+            struct stat fileStat;
+            if (fstat(fileDescriptor, &fileStat) != 0 || S_ISREG(fileStat.st_mode) == false || u64(fileStat.st_size) > u64(std::numeric_limits<size_t>::max()))
+            {
+                close(fileDescriptor);
+                return nullptr;
+            }
+            
+            FileViewUPtr fileView(new FileView());
+            fileView->m_dataSize = u64(fileStat.st_size);
+            
+            //Empty files can't be mapped, but a view of no data is still valid.
+            if (fileView->m_dataSize > 0)
+            {
+                void* mapping = mmap(nullptr, size_t(fileView->m_dataSize), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                if (mapping == MAP_FAILED)
+                {
+                    close(fileDescriptor);
+                    return nullptr;
+                }
+                
+                fileView->m_data = reinterpret_cast<const u8*>(mapping);
+                fileView->m_isMapped = true;
+            }
+            
+            //The mapping remains valid after the file is closed.
+            close(fileDescriptor);
+            return fileView;
+#elif defined CS_TARGETPLATFORM_WINDOWS
+            std::wstring filePath = CSBackend::Windows::WindowsStringUtils::ConvertStandardPathToWindows(in_absoluteFilePath);
+            HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (fileHandle == INVALID_HANDLE_VALUE)
+            {
+                return nullptr;
+            }
+            
+            LARGE_INTEGER fileSize;
+            if (GetFileSizeEx(fileHandle, &fileSize) == FALSE || u64(fileSize.QuadPart) > u64(std::numeric_limits<size_t>::max()))
+            {
+                CloseHandle(fileHandle);
+                return nullptr;
+            }
+            
+            FileViewUPtr fileView(new FileView());
+            fileView->m_dataSize = u64(fileSize.QuadPart);
+            
+            //Empty files can't be mapped, but a view of no data is still valid.
+            if (fileView->m_dataSize == 0)
+            {
+                CloseHandle(fileHandle);
+                return fileView;
+            }
+            
+            HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mappingHandle == nullptr)
+            {
+                CloseHandle(fileHandle);
+                return nullptr;
+            }
+            
+            void* mapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+            if (mapping == nullptr)
+            {
+                CloseHandle(mappingHandle);
+                CloseHandle(fileHandle);
+                return nullptr;
+            }
+            
+            fileView->m_data = reinterpret_cast<const u8*>(mapping);
+            fileView->m_fileHandle = fileHandle;
+            fileView->m_mappingHandle = mappingHandle;
+            fileView->m_isMapped = true;
+            return fileView;
+#else
+            return nullptr;
+#endif
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        FileViewUPtr FileView::CreateBuffered(std::unique_ptr<u8[]> in_data, u64 in_dataSize)
+        {
+            FileViewUPtr fileView(new FileView());
+            fileView->m_buffer = std::move(in_data);
+            fileView->m_data = fileView->m_buffer.get();
+            fileView->m_dataSize = in_dataSize;
+            return fileView;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        bool FileView::IsMapped() const
+        {
+            return m_isMapped;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        u64 FileView::GetSize() const
+        {
+            return m_dataSize;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        const u8* FileView::GetData() const
+        {
+            return m_data;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        u64 FileView::GetReadPosition() const
+        {
+            return m_readPosition;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        bool FileView::SetReadPosition(u64 in_readPosition)
+        {
+            if (in_readPosition > m_dataSize)
+            {
+                CS_LOG_ERROR("Trying to set the read position beyond the end of a File View.");
+                m_readFailed = true;
+                return false;
+            }
+            
+            m_readPosition = in_readPosition;
+            return true;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        const u8* FileView::Read(u64 in_dataSize)
+        {
+            if (in_dataSize > m_dataSize - m_readPosition)
+            {
+                //only the first failure is logged, as loaders will often keep reading until they next check.
+                if (m_readFailed == false)
+                {
+                    CS_LOG_ERROR("Trying to read beyond the end of a File View.");
+                    m_readFailed = true;
+                }
+                return nullptr;
+            }
+            
+            const u8* output = m_data + m_readPosition;
+            m_readPosition += in_dataSize;
+            return output;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        bool FileView::HasReadFailed() const
+        {
+            return m_readFailed;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        FileView::~FileView()
+        {
+            if (m_isMapped == true)
+            {
+#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID
+                munmap(const_cast<u8*>(m_data), size_t(m_dataSize));
+#elif defined CS_TARGETPLATFORM_WINDOWS
+                UnmapViewOfFile(m_data);
+                CloseHandle(m_mappingHandle);
+                CloseHandle(m_fileHandle);
+#endif
+            }
+        }
+    }
+}
@@ -0,0 +1,207 @@
+//
+//  FileView.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_FILE_FILEVIEW_H_
+#define _CHILLISOURCE_CORE_FILE_FILEVIEW_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //----------------------------------------------------------------------
+        /// A read-only view of the entire contents of a file. Where possible
+        /// the file is memory mapped, otherwise it is read into memory with
+        /// a single read. Either way the file's bytes can be accessed
+        /// directly, allowing loaders to parse straight out of the view
+        /// rather than making a stream call for each value.
+        ///
+        /// Sizes and offsets are 64-bit so files beyond 2GB are supported
+        /// wherever the platform can map them.
+        ///
+        /// Like CSBinaryChunk, the view has a read position which can be
+        /// used to read through the data sequentially. A file view is not
+        /// thread-safe, but the underlying data can be safely read from
+        /// multiple threads through GetData().
+        ///
+        /// File views should be created through the File System.
+        ///
+        /// @author Jordan Brown
+        //----------------------------------------------------------------------
+        class FileView final
+        {
+        public:
+            CS_DECLARE_NOCOPY(FileView);
+            //----------------------------------------------------------------
+            /// Creates a new view by memory mapping the file at the given
+            /// absolute path.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The absolute file path.
+            ///
+            /// @return The new view or null if the file couldn't be mapped.
+            //----------------------------------------------------------------
+            static FileViewUPtr CreateMapped(const std::string& in_absoluteFilePath);
+            //----------------------------------------------------------------
+            /// Creates a new view of data that has already been read into
+            /// memory. The view takes ownership of the data.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The data.
+            /// @param The size of the data in bytes.
+            ///
+            /// @return The new view.
+            //----------------------------------------------------------------
+            static FileViewUPtr CreateBuffered(std::unique_ptr<u8[]> in_data, u64 in_dataSize);
+            //----------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not the file is memory mapped.
+            //----------------------------------------------------------------
+            bool IsMapped() const;
+            //----------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The size of the file in bytes.
+            //----------------------------------------------------------------
+            u64 GetSize() const;
+            //----------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The entire contents of the file, disregarding the
+            /// read position. This must not be altered.
+            //----------------------------------------------------------------
+            const u8* GetData() const;
+            //----------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The current read position.
+            //----------------------------------------------------------------
+            u64 GetReadPosition() const;
+            //----------------------------------------------------------------
+            /// Sets the read position. If this is beyond the end of the file
+            /// an error is logged, the read position is left unchanged and
+            /// the view is flagged as having failed a read.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The new read position.
+            ///
+            /// @return Whether or not the read position was set.
+            //----------------------------------------------------------------
+            bool SetReadPosition(u64 in_readPosition);
+            //----------------------------------------------------------------
+            /// Reads a value from the file at the read position. After the
+            /// read, the read position is incremented by the size of the
+            /// requested type. The value doesn't need to be aligned.
+            ///
+            /// If this attempts to read beyond the end of the file an error
+            /// is logged, the view is flagged as having failed a read and a
+            /// value initialised TType is returned. Loaders reading a number
+            /// of values should check HasReadFailed() before using them.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The value.
+            //----------------------------------------------------------------
+            template <typename TType> TType Read();
+            //----------------------------------------------------------------
+            /// Reads the requested size of data from the file at the current
+            /// read position. After the read, the read position is incremented
+            /// by the given data size. The returned data is not a copy and
+            /// should not be altered.
+            ///
+            /// If this attempts to read beyond the end of the file an error
+            /// is logged, the read position is left unchanged, the view is
+            /// flagged as having failed a read and null is returned.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The size of the data to read.
+            ///
+            /// @return The data, or null if there isn't enough data left.
+            //----------------------------------------------------------------
+            const u8* Read(u64 in_dataSize);
+            //----------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not any read or change of read position
+            /// has gone beyond the end of the file, for example because the
+            /// file is truncated.
+            //----------------------------------------------------------------
+            bool HasReadFailed() const;
+            //----------------------------------------------------------------
+            /// Destructor. Unmaps the file if it was mapped.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------
+            ~FileView();
+            
+        private:
+            //----------------------------------------------------------------
+            /// Constructor. Declared private to force the use of the factory
+            /// methods.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------
+            FileView() = default;
+            
+            const u8* m_data = nullptr;
+            u64 m_dataSize = 0;
+            u64 m_readPosition = 0;
+            std::unique_ptr<u8[]> m_buffer;
+            bool m_isMapped = false;
+            bool m_readFailed = false;
+#ifdef CS_TARGETPLATFORM_WINDOWS
+            void* m_fileHandle = nullptr;
+            void* m_mappingHandle = nullptr;
+#endif
+        };
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        template <typename TType> TType FileView::Read()
+        {
+            TType output = TType();
+            
+            const u8* data = Read(sizeof(TType));
+            if (data != nullptr)
+            {
+                memcpy(&output, data, sizeof(TType));
+            }
+            
+            return output;
+        }
+    }
+}
+
+#endif
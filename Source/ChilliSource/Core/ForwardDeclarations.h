@@ -56,12 +56,14 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(IProperty);
         CS_FORWARDDECLARE_CLASS(IPropertyType);
         CS_FORWARDDECLARE_CLASS(PropertyMap);
+        CS_FORWARDDECLARE_CLASS(PropertyName);
         template <typename TKey, typename TValue> class HashedArray;
         template <typename TType> class ObjectPool;
 		template <typename TType> class concurrent_blocking_queue;
         template <typename TType> class concurrent_vector;
         template <typename TType> class dynamic_array;
         template <typename TType> class Property;
+        template <typename TType> class PropertyHandle;
         template <typename TType> class PropertyType;
         template <typename TType> class random_access_iterator;
         template <typename TType> class ReferenceProperty;
@@ -71,6 +73,7 @@ namespace ChilliSource
         //---------------------------------------------------------
         template <typename TReturnType, typename... TArgTypes> class ConnectableDelegate;
         template <typename TReturnType, typename... TArgTypes> class DelegateConnection;
+        template <typename TSignature> class InlineDelegate;
         //---------------------------------------------------------
         /// Dialogue
         //---------------------------------------------------------
@@ -81,6 +84,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(Component);
         CS_FORWARDDECLARE_CLASS(Entity);
         CS_FORWARDDECLARE_CLASS(Transform);
+        CS_FORWARDDECLARE_CLASS(TransformHierarchy);
         //---------------------------------------------------------
         /// Event
         //---------------------------------------------------------
@@ -93,6 +97,7 @@ namespace ChilliSource
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(FileStream);
         CS_FORWARDDECLARE_CLASS(FileSystem);
+        CS_FORWARDDECLARE_CLASS(FileView);
         CS_FORWARDDECLARE_CLASS(AppDataStore);
         CS_FORWARDDECLARE_CLASS(TaggedFilePathResolver);
         CS_FORWARDDECLARE_CLASS(CSBinaryInputStream);
@@ -170,6 +175,7 @@ namespace ChilliSource
         /// Resource
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(Resource);
+        CS_FORWARDDECLARE_CLASS(ResourceLoadGroup);
         CS_FORWARDDECLARE_CLASS(ResourcePool);
         CS_FORWARDDECLARE_CLASS(ResourceProvider);
         template <typename TResourceType> class IResourceOptions;
@@ -195,6 +201,8 @@ namespace ChilliSource
         /// Threading
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(WaitCondition);
+        CS_FORWARDDECLARE_CLASS(Task);
+        CS_FORWARDDECLARE_CLASS(TaskCounter);
         CS_FORWARDDECLARE_CLASS(TaskScheduler);
         CS_FORWARDDECLARE_CLASS(ThreadPool);
         //---------------------------------------------------------
@@ -210,6 +218,7 @@ namespace ChilliSource
         //---------------------------------------------------------
         /// Volume
         //---------------------------------------------------------
+        CS_FORWARDDECLARE_CLASS(BoundingVolumeHierarchy);
         CS_FORWARDDECLARE_CLASS(VolumeComponent);
         //---------------------------------------------------------
         /// XML
@@ -30,6 +30,8 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/FileView.h>
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
@@ -37,6 +39,8 @@
 
 #include <minizip/unzip.h>
 
+#include <cstring>
+
 namespace ChilliSource
 {
     namespace Core
@@ -125,33 +129,45 @@ namespace ChilliSource
             ///
             /// @author S Downie
             ///
-            /// @param Pointer to image data file
+            /// @param The image file view
             /// @param Pointer to resource destination
+            ///
+            /// @return Whether or not the image data could be read.
             //-------------------------------------------------------
-			void ReadFileVersion3(const FileStreamSPtr& in_stream, const ResourceSPtr& out_resource)
+			bool ReadFileVersion3(FileView* in_fileView, const ResourceSPtr& out_resource)
             {
                 //Read the header
                 ImageHeaderVersion3 sHeader;
-                in_stream->Read((s8*)&sHeader.m_width, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_height, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_imageFormat, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_compression, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_checksum, sizeof(u64));
-                in_stream->Read((s8*)&sHeader.m_originalDataSize, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_compressedDataSize, sizeof(u32));
+                sHeader.m_width = in_fileView->Read<u32>();
+                sHeader.m_height = in_fileView->Read<u32>();
+                sHeader.m_imageFormat = in_fileView->Read<u32>();
+                sHeader.m_compression = in_fileView->Read<u32>();
+                sHeader.m_checksum = in_fileView->Read<u64>();
+                sHeader.m_originalDataSize = in_fileView->Read<u32>();
+                sHeader.m_compressedDataSize = in_fileView->Read<u32>();
+                
+                if(in_fileView->HasReadFailed() == true)
+                {
+                    return false;
+                }
                 
                 u32 udwSize = 0;
                 ImageFormat eFormat = ImageFormat::k_RGBA8888;
-                bool bFoundFormat = GetFormatInfo(sHeader.m_imageFormat, sHeader.m_width, sHeader.m_height, eFormat, udwSize);
-                CS_ASSERT(bFoundFormat, "Invalid CSImage Format.");
+                if(GetFormatInfo(sHeader.m_imageFormat, sHeader.m_width, sHeader.m_height, eFormat, udwSize) == false)
+                {
+                    CS_LOG_ERROR("Invalid CSImage Format.");
+                    return false;
+                }
                 
                 u8* pubyBitmapData = nullptr;
                 if(sHeader.m_compression != 0)
                 {
-                    // Allocated memory needed for the compressed image data
-                    u8* pubyCompressedData = (u8*)malloc(sHeader.m_compressedDataSize);
-                    in_stream->Read((s8*)pubyCompressedData, sHeader.m_compressedDataSize);
-                    in_stream->Close();
+                    // The compressed image data is inflated straight out of the file view
+                    const u8* pubyCompressedData = in_fileView->Read(sHeader.m_compressedDataSize);
+                    if(pubyCompressedData == nullptr)
+                    {
+                        return false;
+                    }
                     
                     // Allocated memory need for for the bitmap context
                     pubyBitmapData = new u8[sHeader.m_originalDataSize];
@@ -162,7 +178,7 @@ namespace ChilliSource
                     infstream.zfree = Z_NULL;
                     infstream.opaque = Z_NULL;
                     infstream.avail_in = sHeader.m_compressedDataSize;		// size of input
-                    infstream.next_in = (Bytef*)pubyCompressedData;			// input data
+                    infstream.next_in = (Bytef*)const_cast<u8*>(pubyCompressedData);			// input data
                     infstream.avail_out = sHeader.m_originalDataSize;		// size of output
                     infstream.next_out = (Bytef*)pubyBitmapData;			// output char array
                     
@@ -176,15 +192,19 @@ namespace ChilliSource
                     {
                         CS_LOG_ERROR("CSImage checksum of "+ToString(udwInflatedChecksum)+" does not match expected checksum "+ToString(sHeader.m_checksum));
                     }
-                    
-                    free(pubyCompressedData);
+
                 }
                 else
                 {
+                    const u8* pubyData = in_fileView->Read(udwSize);
+                    if(pubyData == nullptr)
+                    {
+                        return false;
+                    }
+                    
                     // Allocated memory needed for the bitmap context
-                    pubyBitmapData = new u8[sHeader.m_originalDataSize];;
-                    in_stream->Read((s8*)pubyBitmapData, udwSize);
-                    in_stream->Close();
+                    pubyBitmapData = new u8[sHeader.m_originalDataSize];
+                    memcpy(pubyBitmapData, pubyData, udwSize);
                 }
                 
                 Image::ImageDataUPtr imageData(pubyBitmapData);
@@ -198,6 +218,7 @@ namespace ChilliSource
                 
                 Image* outpImage = (Image*)out_resource.get();
                 outpImage->Build(desc, std::move(imageData));
+                return true;
             }
             //----------------------------------------------------
             /// Performs the heavy lifting for the 2 create methods
@@ -211,9 +232,9 @@ namespace ChilliSource
             //----------------------------------------------------
 			void LoadImage(StorageLocation in_storageLocation, const std::string& in_filepath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
             {
-                FileStreamSPtr pImageFile = Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filepath, FileMode::k_readBinary);
+                FileViewUPtr pImageFile = Application::Get()->GetFileSystem()->CreateFileView(in_storageLocation, in_filepath);
                 
-                if(pImageFile == nullptr || pImageFile->IsBad() == true)
+                if(pImageFile == nullptr)
                 {
                     out_resource->SetLoadState(Resource::LoadState::k_failed);
                     if(in_delegate != nullptr)
@@ -223,17 +244,39 @@ namespace ChilliSource
                     return;
                 }
                 
+                bool bSuccess = true;
+                
                 //Read the byte order mark and ensure it is 123456
-                u32 udwByteOrder = 0;
-                pImageFile->Read((s8*)&udwByteOrder, sizeof(u32));
-                CS_ASSERT(udwByteOrder == 123456, "Endianess not supported");
+                u32 udwByteOrder = pImageFile->Read<u32>();
+                if(udwByteOrder != 123456)
+                {
+                    CS_LOG_ERROR("CSImage endianess not supported: " + in_filepath);
+                    bSuccess = false;
+                }
                 
                 //Read the version
-                u32 udwVersion = 0;
-                pImageFile->Read((s8*)&udwVersion, sizeof(u32));
-                CS_ASSERT(udwVersion >= 3, "Only version 3 and above supported");
+                u32 udwVersion = pImageFile->Read<u32>();
+                if(bSuccess == true && udwVersion < 3)
+                {
+                    CS_LOG_ERROR("Only CSImage version 3 and above supported: " + in_filepath);
+                    bSuccess = false;
+                }
    
-                ReadFileVersion3(pImageFile, out_resource);
+                if(bSuccess == true && ReadFileVersion3(pImageFile.get(), out_resource) == false)
+                {
+                    CS_LOG_ERROR("Failed to read CSImage: " + in_filepath);
+                    bSuccess = false;
+                }
+                
+                if(bSuccess == false)
+                {
+                    out_resource->SetLoadState(Resource::LoadState::k_failed);
+                    if(in_delegate != nullptr)
+                    {
+						Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                    }
+                    return;
+                }
                 
                 out_resource->SetLoadState(Resource::LoadState::k_loaded);
                 if(in_delegate != nullptr)
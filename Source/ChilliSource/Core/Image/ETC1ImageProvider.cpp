@@ -30,11 +30,15 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Utils.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/FileView.h>
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
+#include <cstring>
+
 namespace ChilliSource
 {
     namespace Core
@@ -70,9 +74,10 @@ namespace ChilliSource
             //----------------------------------------------------
 			void LoadImage(StorageLocation in_storageLocation, const std::string& in_filepath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
             {
-                FileStreamSPtr pImageFile = Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filepath, FileMode::k_readBinary);
+                FileViewUPtr pImageFile = Application::Get()->GetFileSystem()->CreateFileView(in_storageLocation, in_filepath);
                 
-                if(pImageFile == nullptr || pImageFile->IsBad() == true)
+                const u32 kstrHeaderSize = 16;
+                if(pImageFile == nullptr || pImageFile->GetSize() < kstrHeaderSize)
                 {
                     out_resource->SetLoadState(Resource::LoadState::k_failed);
                     if(in_delegate != nullptr)
@@ -85,33 +90,30 @@ namespace ChilliSource
                 //ETC1 Format is in big endian format. As all the platforms we support are little endian we will have to convert the data to little endian.
                 //read the header.
                 ETC1Header sHeader;
-                pImageFile->Read((s8*)sHeader.m_pkmTag, sizeof(u8) * 6);
+                memcpy(sHeader.m_pkmTag, pImageFile->Read(sizeof(u8) * 6), sizeof(u8) * 6);
                 
-                pImageFile->Read((s8*)&sHeader.m_numberOfMipmaps, sizeof(u16));
+                sHeader.m_numberOfMipmaps = pImageFile->Read<u16>();
                 sHeader.m_numberOfMipmaps = Utils::Endian2ByteSwap(reinterpret_cast<u16*>(&sHeader.m_numberOfMipmaps));
                 
-                pImageFile->Read((s8*)&sHeader.m_textureWidth, sizeof(u16));
+                sHeader.m_textureWidth = pImageFile->Read<u16>();
                 sHeader.m_textureWidth = Utils::Endian2ByteSwap(reinterpret_cast<u16*>(&sHeader.m_textureWidth));
                 
-                pImageFile->Read((s8*)&sHeader.m_textureHeight, sizeof(u16));
+                sHeader.m_textureHeight = pImageFile->Read<u16>();
                 sHeader.m_textureHeight = Utils::Endian2ByteSwap(reinterpret_cast<u16*>(&sHeader.m_textureHeight));
                 
-                pImageFile->Read((s8*)&sHeader.m_originalWidth, sizeof(u16));
+                sHeader.m_originalWidth = pImageFile->Read<u16>();
                 sHeader.m_originalWidth = Utils::Endian2ByteSwap(reinterpret_cast<u16*>(&sHeader.m_originalWidth));
                 
-                pImageFile->Read((s8*)&sHeader.m_originalHeight, sizeof(u16));
+                sHeader.m_originalHeight = pImageFile->Read<u16>();
                 sHeader.m_originalHeight = Utils::Endian2ByteSwap(reinterpret_cast<u16*>(&sHeader.m_originalHeight));
                 
                 //get the size of the rest of the data
-                const u32 kstrHeaderSize = 16;
-                pImageFile->SeekG(0, SeekDir::k_end);
-                u32 dwDataSize = pImageFile->TellG() - kstrHeaderSize;
-                pImageFile->SeekG(kstrHeaderSize, SeekDir::k_beginning);
+                u32 dwDataSize = u32(pImageFile->GetSize() - kstrHeaderSize);
+                pImageFile->SetReadPosition(kstrHeaderSize);
                 
                 //read the rest of the data
                 u8* pData = new u8[dwDataSize];
-                pImageFile->Read((s8*)pData, dwDataSize);
-                pImageFile->Close();
+                memcpy(pData, pImageFile->Read(dwDataSize), dwDataSize);
                 Image::ImageDataUPtr imageData(pData);
                 
                 //setup the output image
@@ -98,5 +98,16 @@ namespace ChilliSource
 		{
 			return m_dataDesc.m_dataSize;
 		}
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        u32 Image::GetCPUMemorySize() const
+        {
+            if(m_imageData == nullptr)
+            {
+                return 0;
+            }
+            
+            return m_dataDesc.m_dataSize;
+        }
 	}
 }
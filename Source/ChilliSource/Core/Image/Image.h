@@ -120,6 +120,13 @@ namespace ChilliSource
 			/// @return Image data.
 			//----------------------------------------------------------------
 			const u8* GetData() const;
+            //----------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The size of the image data, or zero if the data has
+            /// been moved out of the image.
+            //----------------------------------------------------------------
+            u32 GetCPUMemorySize() const override;
             
         private:
             friend class ResourcePool;
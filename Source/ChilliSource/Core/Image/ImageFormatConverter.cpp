@@ -257,6 +257,29 @@ namespace ChilliSource
 
 				return std::move(outputBuffer);
 			}
+			//---------------------------------------------------
+			//---------------------------------------------------
+			u32 GetBytesPerPixel(ImageFormat in_format)
+			{
+				switch(in_format)
+				{
+					case ImageFormat::k_RGBA8888:
+					case ImageFormat::k_Depth32:
+						return 4;
+					case ImageFormat::k_RGB888:
+						return 3;
+					case ImageFormat::k_RGBA4444:
+					case ImageFormat::k_RGB565:
+					case ImageFormat::k_LumA88:
+					case ImageFormat::k_Depth16:
+						return 2;
+					case ImageFormat::k_Lum8:
+						return 1;
+				}
+				
+				CS_LOG_FATAL("Invalid image format.");
+				return 0;
+			}
         }
     }
 }
@@ -191,6 +191,15 @@ namespace ChilliSource
 			/// @return The output Lum8 image data.
 			//---------------------------------------------------
 			ImageBuffer RGBA8888ToLum8(const u8* in_imageData, u32 in_imageDataSize);
+			//---------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @param An uncompressed image format.
+			///
+			/// @return The number of bytes used by each pixel of
+			/// the format.
+			//---------------------------------------------------
+			u32 GetBytesPerPixel(ImageFormat in_format);
         }
     }
 }
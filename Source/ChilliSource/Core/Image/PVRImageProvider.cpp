@@ -30,6 +30,7 @@
 
 #include <CSBackend/Platform/iOS/Core/File/FileSystem.h>
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileView.h>
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
@@ -190,9 +191,9 @@ namespace ChilliSource
             //-----------------------------------------------------------
             void LoadImage(Core::StorageLocation in_storageLocation, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
             {
-                Core::FileStreamSPtr pImageFile = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, Core::FileMode::k_readBinary);
+                Core::FileViewUPtr pImageFile = Core::Application::Get()->GetFileSystem()->CreateFileView(in_storageLocation, in_filePath);
                 
-                if(pImageFile == nullptr || pImageFile->IsBad() == true)
+                if(pImageFile == nullptr)
                 {
                     out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
                     if(in_delegate != nullptr)
@@ -202,10 +203,7 @@ namespace ChilliSource
                     return;
                 }
                 
-                std::string abyData;
-                pImageFile->GetAll(abyData);
-                
-                CreatePVRImageFromFile(abyData.data(), abyData.size(), (Core::Image*)out_resource.get());
+                CreatePVRImageFromFile(reinterpret_cast<const s8*>(pImageFile->GetData()), u32(pImageFile->GetSize()), (Core::Image*)out_resource.get());
                 
                 out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
                 if(in_delegate != nullptr)
@@ -34,10 +34,14 @@ namespace ChilliSource
 {
 	namespace Core
 	{
+        namespace
+        {
+            std::atomic<u32> g_nextInstanceId(1);
+        }
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		Resource::Resource()
-        : m_location(StorageLocation::k_none), m_loadState(LoadState::k_loading)
+        : m_location(StorageLocation::k_none), m_instanceId(g_nextInstanceId++), m_loadState(LoadState::k_loading), m_lastUsedFrame(0)
 		{
 		}
         //-------------------------------------------------------
@@ -54,6 +58,18 @@ namespace ChilliSource
         void Resource::SetLoadState(LoadState in_loadState)
         {
             m_loadState = in_loadState;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u32 Resource::GetCPUMemorySize() const
+        {
+            return 0;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u32 Resource::GetGPUMemorySize() const
+        {
+            return 0;
         }
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -93,6 +109,12 @@ namespace ChilliSource
         }
         //-------------------------------------------------------
         //-------------------------------------------------------
+        u32 Resource::GetInstanceId() const
+        {
+            return m_instanceId;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
         void Resource::SetOptions(const IResourceOptionsBaseCSPtr& in_options)
         {
             m_options = in_options;
@@ -100,6 +100,16 @@ namespace ChilliSource
 			/// @return The resource id as set by the resource pool
 			//-------------------------------------------------------
 			ResourceId GetId() const;
+            //-------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return An id assigned in creation order which is
+            /// unique to this instance for the lifetime of the
+            /// application. Unlike the resource id it isn't a hash
+            /// of the name, so it can be used to order resources
+            /// without collisions.
+            //-------------------------------------------------------
+            u32 GetInstanceId() const;
 			//-------------------------------------------------------
 			/// @author S Downie
 			///
@@ -134,6 +144,28 @@ namespace ChilliSource
             //-------------------------------------------------------
             LoadState GetLoadState() const;
             //-------------------------------------------------------
+            /// Resources which hold a significant amount of data
+            /// should override this so the resource pool can
+            /// enforce memory budgets.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The approximate number of bytes of main
+            /// memory held by the resource.
+            //-------------------------------------------------------
+            virtual u32 GetCPUMemorySize() const;
+            //-------------------------------------------------------
+            /// Resources which hold a significant amount of data
+            /// should override this so the resource pool can
+            /// enforce memory budgets.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The approximate number of bytes of video
+            /// memory held by the resource.
+            //-------------------------------------------------------
+            virtual u32 GetGPUMemorySize() const;
+            //-------------------------------------------------------
             /// Virtual desctructor
             ///
             /// @author S Downie
@@ -201,8 +233,10 @@ namespace ChilliSource
             std::string m_name;
 			StorageLocation m_location;
             ResourceId m_id;
+            u32 m_instanceId;
         
             std::atomic<LoadState> m_loadState;
+            std::atomic<u32> m_lastUsedFrame;
 		};
 	}
 }
@@ -0,0 +1,74 @@
+//
+//  ResourceLoadGroup.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Resource/ResourceLoadGroup.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ResourceLoadGroup::ResourceLoadGroup(Priority in_priority)
+            : m_priority(in_priority), m_isCancelled(false), m_numPendingLoads(0)
+        {
+            CS_ASSERT(m_priority != Priority::k_total, "Invalid resource load group priority.");
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ResourceLoadGroup::Priority ResourceLoadGroup::GetPriority() const
+        {
+            return m_priority;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ResourceLoadGroup::Cancel()
+        {
+            m_isCancelled = true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ResourceLoadGroup::IsCancelled() const
+        {
+            return m_isCancelled;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 ResourceLoadGroup::GetNumPendingLoads() const
+        {
+            return m_numPendingLoads;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ResourceLoadGroup::IsComplete() const
+        {
+            return (m_numPendingLoads == 0);
+        }
+    }
+}
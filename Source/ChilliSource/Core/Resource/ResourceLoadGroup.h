@@ -0,0 +1,124 @@
+//
+//  ResourceLoadGroup.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_RESOURCE_RESOURCELOADGROUP_H_
+#define _CHILLISOURCE_CORE_RESOURCE_RESOURCELOADGROUP_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// A group of asynchronous resource loads which share a priority and can be
+        /// cancelled together. Groups are created by the resource pool and passed to
+        /// LoadResourceAsync(). Loads in a group are queued by the pool and started
+        /// each frame in priority order, so a high priority group requested part way
+        /// through a large level load isn't left waiting behind it. Resources which
+        /// a load depends on, such as the textures and shaders of a material, are
+        /// loaded in the same group.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        class ResourceLoadGroup final
+        {
+        public:
+            CS_DECLARE_NOCOPY(ResourceLoadGroup);
+            //------------------------------------------------------------------------------
+            /// The order in which queued loads are started.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            enum class Priority
+            {
+                k_high,
+                k_medium,
+                k_low,
+                k_total
+            };
+            //------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The priority of the group.
+            //------------------------------------------------------------------------------
+            Priority GetPriority() const;
+            //------------------------------------------------------------------------------
+            /// Cancels all loads in the group. Loads which haven't started yet are
+            /// discarded and removed from the pool, unless they were also requested
+            /// outside of the group, and their delegates are called with the
+            /// resource in the failed state. Loads which are already in progress
+            /// will complete as normal.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            void Cancel();
+            //------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not the group has been cancelled.
+            //------------------------------------------------------------------------------
+            bool IsCancelled() const;
+            //------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of loads in the group which have been requested but
+            /// not yet completed or been discarded.
+            //------------------------------------------------------------------------------
+            u32 GetNumPendingLoads() const;
+            //------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not all loads in the group have completed or been
+            /// discarded.
+            //------------------------------------------------------------------------------
+            bool IsComplete() const;
+
+        private:
+            friend class ResourcePool;
+            //------------------------------------------------------------------------------
+            /// Constructor. Declared private to force the use of
+            /// ResourcePool::CreateLoadGroup().
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The priority of the group.
+            //------------------------------------------------------------------------------
+            ResourceLoadGroup(Priority in_priority);
+
+            Priority m_priority;
+            std::atomic<bool> m_isCancelled;
+            std::atomic<u32> m_numPendingLoads;
+        };
+    }
+}
+
+#endif
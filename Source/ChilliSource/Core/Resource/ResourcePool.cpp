@@ -28,8 +28,12 @@
 
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 
+#include <ChilliSource/Core/Base/AppConfig.h>
+#include <ChilliSource/Core/Time/PerformanceTimer.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace Core
@@ -44,6 +48,12 @@ namespace ChilliSource
         }
         //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
+        ResourcePool::ResourcePool()
+        : m_frameIndex(0)
+        {
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
         bool ResourcePool::IsA(InterfaceIDType in_interfaceId) const
         {
             return in_interfaceId == ResourcePool::InterfaceID;
@@ -53,21 +63,156 @@ namespace ChilliSource
         void ResourcePool::AddProvider(ResourceProvider* in_provider)
         {
             CS_ASSERT(in_provider != nullptr, "Cannot add null resource provider to pool");
-            auto itDescriptor = m_descriptors.find(in_provider->GetResourceType());
             
-            if(itDescriptor == m_descriptors.end())
+            PoolDesc* desc = FindOrCreateDescriptor(in_provider->GetResourceType());
+            
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
+            desc->m_providers.push_back(in_provider);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        ResourceLoadGroupSPtr ResourcePool::CreateLoadGroup(ResourceLoadGroup::Priority in_priority)
+        {
+            return ResourceLoadGroupSPtr(new ResourceLoadGroup(in_priority));
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        ResourceLoadGroupSPtr ResourcePool::GetLoadGroup(const Resource* in_resource) const
+        {
+            CS_ASSERT(in_resource != nullptr, "Cannot get the load group of a null resource");
+            
+            PoolDesc* desc = FindDescriptor(in_resource->GetInterfaceID());
+            if(desc == nullptr)
+            {
+                return nullptr;
+            }
+            
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
+            auto itAsyncLoad = desc->m_asyncLoads.find(in_resource->GetId());
+            if(itAsyncLoad != desc->m_asyncLoads.end())
+            {
+                return itAsyncLoad->second.m_group;
+            }
+            
+            return nullptr;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::SetMaxLoadsStartedPerFrame(u32 in_maxLoads)
+        {
+            m_maxLoadsStartedPerFrame = in_maxLoads;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        u32 ResourcePool::GetNumQueuedLoads() const
+        {
+            std::unique_lock<std::mutex> lock(m_queuedLoadsMutex);
+            
+            u32 numQueuedLoads = 0;
+            for(const auto& queuedLoads : m_queuedLoads)
             {
-                PoolDesc desc;
-                desc.m_providers.push_back(in_provider);
-                m_descriptors.insert(std::make_pair(in_provider->GetResourceType(), desc));
+                numQueuedLoads += (u32)queuedLoads.size();
+            }
+            
+            return numQueuedLoads;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::ScheduleUploadTask(Task in_task)
+        {
+            m_uploadTasks.push(std::move(in_task));
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::SetUploadBudget(f32 in_budgetMS)
+        {
+            CS_ASSERT(in_budgetMS >= 0.0f, "Upload budget cannot be negative.");
+            m_uploadBudgetMS = in_budgetMS;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        u32 ResourcePool::GetNumQueuedUploadTasks() const
+        {
+            return m_uploadTasks.size();
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        std::vector<ResourcePool::MemoryStats> ResourcePool::GetMemoryStats() const
+        {
+            std::vector<MemoryStats> output;
+            
+            std::unique_lock<std::mutex> lock(m_descriptorsMutex);
+            for(const auto& descEntry : m_descriptors)
+            {
+                const PoolDesc* desc = descEntry.second.get();
+                std::unique_lock<std::mutex> descLock(desc->m_mutex);
+                
+                if(desc->m_cachedResources.empty() == true && desc->m_memoryBudget == 0)
+                {
+                    continue;
+                }
+                
+                MemoryStats stats;
+                stats.m_resourceType = descEntry.first;
+                stats.m_typeName = desc->m_typeName;
+                stats.m_memoryBudget = desc->m_memoryBudget;
+                
+                for(const auto& resourceEntry : desc->m_cachedResources)
+                {
+                    const Resource* resource = resourceEntry.second.get();
+                    if(stats.m_typeName.empty() == true)
+                    {
+                        stats.m_typeName = resource->GetInterfaceTypeName();
+                    }
+                    
+                    if(resource->GetLoadState() == Resource::LoadState::k_loaded)
+                    {
+                        stats.m_numResources++;
+                        stats.m_cpuMemorySize += resource->GetCPUMemorySize();
+                        stats.m_gpuMemorySize += resource->GetGPUMemorySize();
+                    }
+                }
+                
+                output.push_back(stats);
             }
-            else
+            
+            return output;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::SetMemoryBudget(InterfaceIDType in_resourceType, const std::string& in_typeName, u64 in_budget)
+        {
+            PoolDesc* desc = FindOrCreateDescriptor(in_resourceType);
+            
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
+            desc->m_typeName = in_typeName;
+            desc->m_memoryBudget = in_budget;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::OnInit()
+        {
+            const AppConfig* appConfig = Application::Get()->GetAppConfig();
+            
+            m_uploadBudgetMS = appConfig->GetResourceUploadBudget();
+            
+            for(const auto& budget : appConfig->GetResourceMemoryBudgets())
             {
-                itDescriptor->second.m_providers.push_back(in_provider);
+                SetMemoryBudget(QueryableInterface::InterfaceIDHash(budget.first), budget.first, budget.second);
             }
         }
         //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
+        void ResourcePool::OnUpdate(f32 in_deltaTime)
+        {
+            StartQueuedLoads();
+            ExecuteUploadTasks();
+            EnforceMemoryBudgets();
+            
+            ++m_frameIndex;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
         ResourceProvider* ResourcePool::FindProvider(const std::string& in_filePath, const PoolDesc& in_desc)
         {
             //Find the resource provider that can handle this extension
@@ -89,6 +234,213 @@ namespace ChilliSource
         }
         //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
+        ResourcePool::PoolDesc* ResourcePool::FindDescriptor(InterfaceIDType in_resourceType) const
+        {
+            std::unique_lock<std::mutex> lock(m_descriptorsMutex);
+            
+            auto itDescriptor = m_descriptors.find(in_resourceType);
+            if(itDescriptor != m_descriptors.end())
+            {
+                return itDescriptor->second.get();
+            }
+            
+            return nullptr;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        ResourcePool::PoolDesc* ResourcePool::FindOrCreateDescriptor(InterfaceIDType in_resourceType)
+        {
+            std::unique_lock<std::mutex> lock(m_descriptorsMutex);
+            
+            std::unique_ptr<PoolDesc>& desc(m_descriptors[in_resourceType]);
+            if(desc == nullptr)
+            {
+                desc.reset(new PoolDesc());
+            }
+            
+            return desc.get();
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::AddAsyncLoadWaiter(AsyncLoad& out_asyncLoad, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceLoadGroupSPtr& in_group)
+        {
+            if(in_group != nullptr)
+            {
+                ++in_group->m_numPendingLoads;
+            }
+            
+            AsyncLoadWaiter waiter;
+            waiter.m_delegate = in_delegate;
+            waiter.m_group = in_group;
+            out_asyncLoad.m_waiters.push_back(std::move(waiter));
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::QueueAsyncLoad(QueuedLoad in_load)
+        {
+            if(in_load.m_group == nullptr)
+            {
+                StartAsyncLoad(in_load);
+                return;
+            }
+            
+            std::unique_lock<std::mutex> lock(m_queuedLoadsMutex);
+            m_queuedLoads[(u32)in_load.m_group->GetPriority()].push_back(std::move(in_load));
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::StartAsyncLoad(const QueuedLoad& in_load)
+        {
+            PoolDesc* desc = in_load.m_desc;
+            ResourceProvider::AsyncLoadDelegate completionDelegate([this, desc](const ResourceSPtr& in_resource)
+            {
+                OnAsyncLoadComplete(desc, in_resource);
+            });
+            
+            const ResourceSPtr& resource(in_load.m_resource);
+            std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(resource->GetStorageLocation(), resource->GetFilePath());
+            in_load.m_provider->CreateResourceFromFileAsync(resource->GetStorageLocation(), deviceFilePath, resource->GetOptions(), completionDelegate, resource);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        bool ResourcePool::TryDiscardAsyncLoad(const QueuedLoad& in_load)
+        {
+            if(in_load.m_group->IsCancelled() == false)
+            {
+                return false;
+            }
+            
+            PoolDesc* desc = in_load.m_desc;
+            const ResourceSPtr& resource(in_load.m_resource);
+            
+            std::vector<AsyncLoadWaiter> waiters;
+            {
+                std::unique_lock<std::mutex> lock(desc->m_mutex);
+                
+                auto itAsyncLoad = desc->m_asyncLoads.find(resource->GetId());
+                CS_ASSERT(itAsyncLoad != desc->m_asyncLoads.end(), "Queued load has no waiters.");
+                
+                //The load is still needed if it was also requested outside of a cancelled group.
+                for(const auto& waiter : itAsyncLoad->second.m_waiters)
+                {
+                    if(waiter.m_group == nullptr || waiter.m_group->IsCancelled() == false)
+                    {
+                        return false;
+                    }
+                }
+                
+                waiters = std::move(itAsyncLoad->second.m_waiters);
+                desc->m_asyncLoads.erase(itAsyncLoad);
+                
+                auto itResource = desc->m_cachedResources.find(resource->GetId());
+                if(itResource != desc->m_cachedResources.end() && itResource->second == resource)
+                {
+                    desc->m_cachedResources.erase(itResource);
+                }
+            }
+            
+            resource->SetLoadState(Resource::LoadState::k_failed);
+            
+            for(const auto& waiter : waiters)
+            {
+                waiter.m_delegate(resource);
+                --waiter.m_group->m_numPendingLoads;
+            }
+            
+            return true;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::OnAsyncLoadComplete(PoolDesc* in_desc, const ResourceSPtr& in_resource)
+        {
+            std::vector<AsyncLoadWaiter> waiters;
+            {
+                std::unique_lock<std::mutex> lock(in_desc->m_mutex);
+                
+                auto itAsyncLoad = in_desc->m_asyncLoads.find(in_resource->GetId());
+                if(itAsyncLoad != in_desc->m_asyncLoads.end())
+                {
+                    waiters = std::move(itAsyncLoad->second.m_waiters);
+                    in_desc->m_asyncLoads.erase(itAsyncLoad);
+                }
+                
+                in_resource->m_lastUsedFrame = m_frameIndex.load();
+            }
+            
+            for(const auto& waiter : waiters)
+            {
+                waiter.m_delegate(in_resource);
+                
+                if(waiter.m_group != nullptr)
+                {
+                    --waiter.m_group->m_numPendingLoads;
+                }
+            }
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::StartQueuedLoads()
+        {
+            u32 numStarted = 0;
+            while(m_maxLoadsStartedPerFrame == 0 || numStarted < m_maxLoadsStartedPerFrame)
+            {
+                QueuedLoad load;
+                {
+                    std::unique_lock<std::mutex> lock(m_queuedLoadsMutex);
+                    for(auto& queuedLoads : m_queuedLoads)
+                    {
+                        if(queuedLoads.empty() == false)
+                        {
+                            load = std::move(queuedLoads.front());
+                            queuedLoads.pop_front();
+                            break;
+                        }
+                    }
+                }
+                
+                if(load.m_resource == nullptr)
+                {
+                    break;
+                }
+                
+                if(TryDiscardAsyncLoad(load) == false)
+                {
+                    StartAsyncLoad(load);
+                    ++numStarted;
+                }
+            }
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::ExecuteUploadTasks()
+        {
+            PerformanceTimer timer;
+            timer.Start();
+            
+            //Only tasks which were queued on entry are considered so that an upload task scheduling
+            //another can't keep this running indefinitely.
+            u32 numTasks = m_uploadTasks.size();
+            u32 numExecuted = 0;
+            
+            Task task;
+            while(numExecuted < numTasks && m_uploadTasks.try_pop(task) == true)
+            {
+                task();
+                task = Task();
+                ++numExecuted;
+                
+                if(m_uploadBudgetMS > 0.0f)
+                {
+                    timer.Stop();
+                    if(timer.GetTimeTakenMS() >= m_uploadBudgetMS)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
         Resource::ResourceId ResourcePool::GenerateResourceId(const std::string& in_uniqueId) const
         {
             return HashCRC32::GenerateHashCode(in_uniqueId);
@@ -118,7 +470,7 @@ namespace ChilliSource
         {
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be released on the main thread");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
+            std::unique_lock<std::mutex> lock(m_descriptorsMutex);
             u32 numReleased = 0;
             
             do
@@ -127,13 +479,16 @@ namespace ChilliSource
                 
                 for(auto& descEntry : m_descriptors)
                 {
-                    for(auto itResource = descEntry.second.m_cachedResources.begin(); itResource != descEntry.second.m_cachedResources.end(); /*NO INCREMENT*/)
+                    PoolDesc* desc = descEntry.second.get();
+                    std::unique_lock<std::mutex> descLock(desc->m_mutex);
+                    
+                    for(auto itResource = desc->m_cachedResources.begin(); itResource != desc->m_cachedResources.end(); /*NO INCREMENT*/)
                     {
                         if(itResource->second.use_count() == 1)
                         {
                             //The pool is the sole owner so we can safely release the object
                             CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second->GetName());
-                            itResource = descEntry.second.m_cachedResources.erase(itResource);
+                            itResource = desc->m_cachedResources.erase(itResource);
                             numReleased++;
                         }
                         else
@@ -153,11 +508,11 @@ namespace ChilliSource
             CS_ASSERT(in_resource != nullptr, "Pool cannot release null resource");
             //Find the descriptor that handles this type of resource
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            auto itDescriptor = m_descriptors.find(in_resource->GetInterfaceID());
-            CS_ASSERT(itDescriptor != m_descriptors.end(), "Failed to find resource pool for " + in_resource->GetInterfaceTypeName());
+            PoolDesc* desc = FindDescriptor(in_resource->GetInterfaceID());
+            CS_ASSERT(desc != nullptr, "Failed to find resource pool for " + in_resource->GetInterfaceTypeName());
             
-            auto& cachedResources(itDescriptor->second.m_cachedResources);
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
+            auto& cachedResources(desc->m_cachedResources);
             
             for(auto itResource = cachedResources.begin(); itResource != cachedResources.end(); /*NO INCREMENT*/)
             {
@@ -182,13 +537,29 @@ namespace ChilliSource
         //------------------------------------------------------------------------------------
         void ResourcePool::Destroy()
         {
+            //Any loads which haven't finished by now never will, so drop the references they hold.
+            {
+                std::unique_lock<std::mutex> lock(m_queuedLoadsMutex);
+                for(auto& queuedLoads : m_queuedLoads)
+                {
+                    queuedLoads.clear();
+                }
+            }
+            m_uploadTasks.clear();
+            
+            for(auto& descEntry : m_descriptors)
+            {
+                std::unique_lock<std::mutex> lock(descEntry.second->m_mutex);
+                descEntry.second->m_asyncLoads.clear();
+            }
+            
             ReleaseAllUnused();
             
             bool error = false;
             
             for(auto& descEntry : m_descriptors)
             {
-                for(auto itResource = descEntry.second.m_cachedResources.begin(); itResource != descEntry.second.m_cachedResources.end(); ++itResource)
+                for(auto itResource = descEntry.second->m_cachedResources.begin(); itResource != descEntry.second->m_cachedResources.end(); ++itResource)
                 {
                     //The pool is the sole owner so we can safely release the object
                     CS_LOG_ERROR("Resource still in use: " + itResource->second->GetName());
@@ -202,6 +573,86 @@ namespace ChilliSource
             }
         }
         //------------------------------------------------------------------------------------
+        /// Resources are only released once the pool holds the last reference to them, so a
+        /// resource which was loaded but never fetched is still a candidate. Resources which
+        /// are still loading are skipped as their providers hold a reference.
+        //------------------------------------------------------------------------------------
+        void ResourcePool::EnforceMemoryBudgets()
+        {
+            //An unused resource which can be released to meet the budget.
+            struct Candidate
+            {
+                u32 m_lastUsedFrame;
+                u64 m_memorySize;
+                Resource::ResourceId m_id;
+            };
+            
+            std::vector<Candidate> candidates;
+            
+            std::unique_lock<std::mutex> lock(m_descriptorsMutex);
+            for(auto& descEntry : m_descriptors)
+            {
+                PoolDesc* desc = descEntry.second.get();
+                std::unique_lock<std::mutex> descLock(desc->m_mutex);
+                
+                if(desc->m_memoryBudget == 0)
+                {
+                    continue;
+                }
+                
+                u64 memorySize = 0;
+                candidates.clear();
+                
+                for(const auto& resourceEntry : desc->m_cachedResources)
+                {
+                    Resource* resource = resourceEntry.second.get();
+                    if(resource->GetLoadState() != Resource::LoadState::k_loaded)
+                    {
+                        continue;
+                    }
+                    
+                    u64 resourceSize = (u64)resource->GetCPUMemorySize() + (u64)resource->GetGPUMemorySize();
+                    memorySize += resourceSize;
+                    
+                    if(resourceEntry.second.use_count() > 1)
+                    {
+                        resource->m_lastUsedFrame = m_frameIndex.load();
+                    }
+                    else
+                    {
+                        Candidate candidate;
+                        candidate.m_lastUsedFrame = resource->m_lastUsedFrame;
+                        candidate.m_memorySize = resourceSize;
+                        candidate.m_id = resourceEntry.first;
+                        candidates.push_back(candidate);
+                    }
+                }
+                
+                if(memorySize <= desc->m_memoryBudget)
+                {
+                    continue;
+                }
+                
+                std::sort(candidates.begin(), candidates.end(), [](const Candidate& in_a, const Candidate& in_b)
+                {
+                    return in_a.m_lastUsedFrame < in_b.m_lastUsedFrame;
+                });
+                
+                for(const auto& candidate : candidates)
+                {
+                    if(memorySize <= desc->m_memoryBudget)
+                    {
+                        break;
+                    }
+                    
+                    auto itResource = desc->m_cachedResources.find(candidate.m_id);
+                    CS_LOG_VERBOSE("Releasing resource from pool to meet memory budget " + itResource->second->GetName());
+                    desc->m_cachedResources.erase(itResource);
+                    memorySize -= candidate.m_memorySize;
+                }
+            }
+        }
+        //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
         void ResourcePool::OnMemoryWarning()
         {
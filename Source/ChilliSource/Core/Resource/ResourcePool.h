@@ -34,11 +34,15 @@
 #include <ChilliSource/Core/File/TaggedFilePathResolver.h>
 #include <ChilliSource/Core/Resource/IResourceOptions.h>
 #include <ChilliSource/Core/Resource/Resource.h>
+#include <ChilliSource/Core/Resource/ResourceLoadGroup.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
+#include <atomic>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
@@ -52,6 +56,17 @@ namespace ChilliSource
         /// same resource will return the cached copy. The resource pool always holds the last
         /// reference to any resource.
         ///
+        /// Each resource type is guarded by its own lock so loads of different types
+        /// don't contend with each other. Asynchronous loads can be placed in a
+        /// ResourceLoadGroup to be started in priority order and cancelled together.
+        /// The main thread part of asynchronous loads, such as uploading textures and
+        /// meshes, is scheduled with ScheduleUploadTask() and limited to a time budget
+        /// each frame.
+        ///
+        /// Each resource type can be given a memory budget. When the resources of that
+        /// type exceed the budget the least recently used of those which are no longer
+        /// referenced are released.
+        ///
         /// @author S Downie
         //------------------------------------------------------------------------------------
         class ResourcePool final : public AppSystem
@@ -60,6 +75,20 @@ namespace ChilliSource
             
             CS_DECLARE_NAMEDTYPE(ResourcePool);
             
+            //------------------------------------------------------------------------------------
+            /// The memory used by the resources of a single type.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------------
+            struct MemoryStats
+            {
+                InterfaceIDType m_resourceType = 0;
+                std::string m_typeName;
+                u32 m_numResources = 0;
+                u64 m_cpuMemorySize = 0;
+                u64 m_gpuMemorySize = 0;
+                u64 m_memoryBudget = 0;
+            };
             //------------------------------------------------------------------------------------
             /// Factory method for creating the system
             ///
@@ -211,6 +240,128 @@ namespace ChilliSource
             /// called on the main thread
             //-------------------------------------------------------------------------------------
             template <typename TResourceType> void LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// Creates a new group for asynchronous loads. Loads in a group are queued and
+            /// started over the following frames in priority order, and can be cancelled.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The priority of loads in the group.
+            ///
+            /// @return The new load group.
+            //-------------------------------------------------------------------------------------
+            ResourceLoadGroupSPtr CreateLoadGroup(ResourceLoadGroup::Priority in_priority = ResourceLoadGroup::Priority::k_medium);
+            //------------------------------------------------------------------------------------
+            /// Load the resource of given type from the file location as part of the given load
+            /// group. If the resource at this location has previously been loaded then the
+            /// cached version will be returned in the delegate. If it is still being loaded by
+            /// an earlier request the delegate will be called once that load has finished.
+            ///
+            /// The resource is immutable
+            ///
+            /// If the file requires loading it will be queued and started once loads of a higher
+            /// priority have been started. If the group is cancelled before the load starts the
+            /// delegate is called with the resource in the failed state.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The load group. If this is null the load is started immediately.
+            /// @param Storage location
+            /// @param File path
+            /// @param Load options that are used by the underlying providers to customise
+            /// initialisation
+            /// @param Delegate to trigger when the resource is loaded or failed. Note: Always
+            /// called on the main thread
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> void LoadResourceAsync(const ResourceLoadGroupSPtr& in_group, StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// Load the resource of given type from the file location as part of the given load
+            /// group. See above for details.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The load group. If this is null the load is started immediately.
+            /// @param Storage location
+            /// @param File path
+            /// @param Delegate to trigger when the resource is loaded or failed. Note: Always
+            /// called on the main thread
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> void LoadResourceAsync(const ResourceLoadGroupSPtr& in_group, StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// This is used by resource providers to load the resources a resource depends on
+            /// in the same group as it.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The resource.
+            ///
+            /// @return The load group of the asynchronous load of the given resource, or null
+            /// if it isn't being loaded asynchronously or isn't in a group.
+            //-------------------------------------------------------------------------------------
+            ResourceLoadGroupSPtr GetLoadGroup(const Resource* in_resource) const;
+            //------------------------------------------------------------------------------------
+            /// Sets the maximum number of queued loads that are started each frame. Loads
+            /// which aren't in a group are always started immediately.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The number of loads. Zero starts all queued loads each frame.
+            //-------------------------------------------------------------------------------------
+            void SetMaxLoadsStartedPerFrame(u32 in_maxLoads);
+            //------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of loads which are queued and waiting to be started.
+            //-------------------------------------------------------------------------------------
+            u32 GetNumQueuedLoads() const;
+            //------------------------------------------------------------------------------------
+            /// Schedules the main thread part of an asynchronous load, such as building a
+            /// texture or mesh from loaded data. Upload tasks are executed during the pool's
+            /// update in the order they were scheduled until the upload budget is used up,
+            /// and the remainder are deferred to the next frame. This can be called from any
+            /// thread.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The task.
+            //-------------------------------------------------------------------------------------
+            void ScheduleUploadTask(Task in_task);
+            //------------------------------------------------------------------------------------
+            /// Sets the maximum time that can be spent executing upload tasks each frame. At
+            /// least one task is executed each frame regardless. This defaults to the
+            /// ResourceUploadBudget value in the App.config.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The budget in milliseconds. Zero disables the budget.
+            //-------------------------------------------------------------------------------------
+            void SetUploadBudget(f32 in_budgetMS);
+            //------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of upload tasks waiting to be executed.
+            //-------------------------------------------------------------------------------------
+            u32 GetNumQueuedUploadTasks() const;
+            //------------------------------------------------------------------------------------
+            /// Sets the maximum number of bytes that resources of the given type can use,
+            /// counting both CPU and GPU memory. The budget is checked each frame and, if it
+            /// has been exceeded, unused resources of the type are released, least recently
+            /// used first, until it is met. Resources which are in use or still loading are
+            /// never released so the budget can still be exceeded. This defaults to the value
+            /// for the type in the ResourceMemoryBudgets section of the App.config.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The budget in bytes. Zero disables the budget.
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> void SetMemoryBudget(u64 in_budget);
+            //------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The memory used by each type of resource in the pool. Only resources
+            /// which have finished loading are counted.
+            //-------------------------------------------------------------------------------------
+            std::vector<MemoryStats> GetMemoryStats() const;
             //-------------------------------------------------------------------------------------
             /// Forces the pool to release its handle to any unused resources of the given type.
             /// If a resource is still in use the pool will keep it in the cache. The pool is
@@ -255,19 +406,82 @@ namespace ChilliSource
             
         private:
             
+            //-------------------------------------------------------------------------------------
+            /// Constructor. Declared private to force the use of the factory method.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------------------------------------
+            ResourcePool();
             //-------------------------------------------------------------------------------------
             /// Descriptor that holds the providers and cached resources for a given type
             ///
             /// @author S Downie
             //-------------------------------------------------------------------------------------
+            struct PoolDesc;
+            //-------------------------------------------------------------------------------------
+            /// A delegate waiting on an asynchronous load, and the group it was requested in.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------------------------------------
+            struct AsyncLoadWaiter
+            {
+                ResourceProvider::AsyncLoadDelegate m_delegate;
+                ResourceLoadGroupSPtr m_group;
+            };
+            //-------------------------------------------------------------------------------------
+            /// An asynchronous load which is queued or in progress.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------------------------------------
+            struct AsyncLoad
+            {
+                ResourceLoadGroupSPtr m_group;
+                std::vector<AsyncLoadWaiter> m_waiters;
+            };
+            //-------------------------------------------------------------------------------------
+            /// An asynchronous load waiting to be started.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------------------------------------
+            struct QueuedLoad
+            {
+                PoolDesc* m_desc = nullptr;
+                ResourceProvider* m_provider = nullptr;
+                ResourceSPtr m_resource;
+                ResourceLoadGroupSPtr m_group;
+            };
+            //-------------------------------------------------------------------------------------
+            /// Descriptor that holds the providers and cached resources for a given type. Each
+            /// descriptor has its own lock for the cached resources and asynchronous loads.
+            ///
+            /// @author S Downie
+            //-------------------------------------------------------------------------------------
             struct PoolDesc
             {
                 std::vector<ResourceProvider*> m_providers;
                 std::unordered_map<Resource::ResourceId, ResourceSPtr> m_cachedResources;
+                std::unordered_map<Resource::ResourceId, AsyncLoad> m_asyncLoads;
+                std::string m_typeName;
+                u64 m_memoryBudget = 0;
+                mutable std::mutex m_mutex;
             };
             //------------------------------------------------------------------------------------
+            /// Reads the upload budget and memory budgets from the app config.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------------
+            void OnInit() override;
+            //------------------------------------------------------------------------------------
+            /// Starts queued loads, executes upload tasks and enforces the memory budgets.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Time since last update in seconds.
+            //------------------------------------------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) override;
+            //------------------------------------------------------------------------------------
             /// Called when the system receieves a memory warning. This will force the pool
-            /// to release any unused resources
+            /// to release any unused resources, regardless of the memory budgets.
             ///
             /// @author S Downie
             //------------------------------------------------------------------------------------
@@ -282,6 +496,101 @@ namespace ChilliSource
             //------------------------------------------------------------------------------------
             ResourceProvider* FindProvider(const std::string& in_filePath, const PoolDesc& in_desc);
             //------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The resource type.
+            ///
+            /// @return The descriptor for the given resource type, or null.
+            //------------------------------------------------------------------------------------
+            PoolDesc* FindDescriptor(InterfaceIDType in_resourceType) const;
+            //------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The resource type.
+            ///
+            /// @return The descriptor for the given resource type, created if it doesn't
+            /// exist.
+            //------------------------------------------------------------------------------------
+            PoolDesc* FindOrCreateDescriptor(InterfaceIDType in_resourceType);
+            //------------------------------------------------------------------------------------
+            /// Adds the waiter to the asynchronous load, counting it as pending in its group.
+            /// The descriptor must be locked.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [Out] The asynchronous load.
+            /// @param The delegate.
+            /// @param The group the delegate was requested in.
+            //------------------------------------------------------------------------------------
+            void AddAsyncLoadWaiter(AsyncLoad& out_asyncLoad, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceLoadGroupSPtr& in_group);
+            //------------------------------------------------------------------------------------
+            /// Starts the load immediately if it isn't in a group, otherwise queues it to be
+            /// started in priority order.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The load.
+            //------------------------------------------------------------------------------------
+            void QueueAsyncLoad(QueuedLoad in_load);
+            //------------------------------------------------------------------------------------
+            /// Hands the load to its provider.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The load.
+            //------------------------------------------------------------------------------------
+            void StartAsyncLoad(const QueuedLoad& in_load);
+            //------------------------------------------------------------------------------------
+            /// Discards a queued load if every delegate waiting on it belongs to a cancelled
+            /// group, removing the resource from the pool.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The load.
+            ///
+            /// @return Whether or not the load was discarded.
+            //------------------------------------------------------------------------------------
+            bool TryDiscardAsyncLoad(const QueuedLoad& in_load);
+            //------------------------------------------------------------------------------------
+            /// Called by the provider when an asynchronous load has finished. Notifies all
+            /// delegates waiting on the load.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The descriptor of the resource type.
+            /// @param The resource.
+            //------------------------------------------------------------------------------------
+            void OnAsyncLoadComplete(PoolDesc* in_desc, const ResourceSPtr& in_resource);
+            //------------------------------------------------------------------------------------
+            /// Starts queued loads, highest priority first, up to the maximum number that
+            /// can be started each frame.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------------
+            void StartQueuedLoads();
+            //------------------------------------------------------------------------------------
+            /// Executes upload tasks until the upload budget is used up.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------------
+            void ExecuteUploadTasks();
+            //------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The resource type.
+            /// @param The name of the resource type.
+            /// @param The budget in bytes. Zero disables the budget.
+            //------------------------------------------------------------------------------------
+            void SetMemoryBudget(InterfaceIDType in_resourceType, const std::string& in_typeName, u64 in_budget);
+            //------------------------------------------------------------------------------------
+            /// Marks resources which are referenced outside of the pool as used this frame,
+            /// then releases unused resources, least recently used first, until each type
+            /// is within its memory budget.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------------
+            void EnforceMemoryBudgets();
+            //------------------------------------------------------------------------------------
             /// @author S Downie
             ///
             /// @param Location
@@ -302,8 +611,17 @@ namespace ChilliSource
             
         private:
             
-            std::unordered_map<InterfaceIDType, PoolDesc> m_descriptors;
-            mutable std::mutex m_mutex;
+            std::unordered_map<InterfaceIDType, std::unique_ptr<PoolDesc>> m_descriptors;
+            mutable std::mutex m_descriptorsMutex;
+            
+            std::deque<QueuedLoad> m_queuedLoads[(u32)ResourceLoadGroup::Priority::k_total];
+            mutable std::mutex m_queuedLoadsMutex;
+            u32 m_maxLoadsStartedPerFrame = 8;
+            
+            concurrent_mpsc_queue<Task> m_uploadTasks;
+            f32 m_uploadBudgetMS = 0.0f;
+            
+            std::atomic<u32> m_frameIndex;
         };
         //------------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------------
@@ -311,23 +629,22 @@ namespace ChilliSource
         {
             CS_ASSERT(in_uniqueId.empty() == false, "Cannot find resource with empty unique Id");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
             
-            if(itDescriptor == m_descriptors.end())
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 return nullptr;
             }
             
-            const PoolDesc& desc(itDescriptor->second);
-            
             //Check descriptor and see if this resource already exists
             Resource::ResourceId resourceId = GenerateResourceId(in_uniqueId);
-            auto itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource != desc.m_cachedResources.end())
+            
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
+            auto itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource != desc->m_cachedResources.end())
             {
+                itResource->second->m_lastUsedFrame = m_frameIndex.load();
                 return std::static_pointer_cast<const TResourceType>(itResource->second);
             }
             
@@ -337,15 +654,13 @@ namespace ChilliSource
         //-------------------------------------------------------------------------------------
         template <typename TResourceType> std::vector<std::shared_ptr<const TResourceType>> ResourcePool::GetAllResources() const
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
             std::vector<std::shared_ptr<const TResourceType>> output;
             
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            if(itDescriptor != m_descriptors.end())
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            if(desc != nullptr)
             {
-                const PoolDesc& desc(itDescriptor->second);
-                for (const auto& resource : desc.m_cachedResources)
+                std::unique_lock<std::mutex> lock(desc->m_mutex);
+                for (const auto& resource : desc->m_cachedResources)
                 {
                     output.push_back(std::static_pointer_cast<const TResourceType>(resource.second));
                 }
@@ -363,22 +678,15 @@ namespace ChilliSource
             std::shared_ptr<TResourceType> resource(TResourceType::Create());
             resource->SetId(resourceId);
             resource->SetName(in_uniqueId);
+            resource->m_lastUsedFrame = m_frameIndex.load();
             
-            std::unique_lock<std::mutex> lock(m_mutex);
+            PoolDesc* desc = FindOrCreateDescriptor(TResourceType::InterfaceID);
             
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            if(itDescriptor == m_descriptors.end())
-            {
-                PoolDesc desc;
-                desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
-                m_descriptors.insert(std::make_pair(TResourceType::InterfaceID, desc));
-                return resource;
-            }
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
             
             //Check to make sure this doesn't already exist
-            PoolDesc& desc(itDescriptor->second);
-            CS_ASSERT(desc.m_cachedResources.find(resourceId) == desc.m_cachedResources.end(), "Resource with Id: " + in_uniqueId + " already exists");
-            desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+            CS_ASSERT(desc->m_cachedResources.find(resourceId) == desc->m_cachedResources.end(), "Resource with Id: " + in_uniqueId + " already exists");
+            desc->m_cachedResources.insert(std::make_pair(resourceId, resource));
             
             return resource;
         }
@@ -389,19 +697,18 @@ namespace ChilliSource
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be loaded on the main thread - use LoadResourceAsync");
             CS_ASSERT(in_filePath.empty() == false, "Cannot load resource with no file path");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
             
-            if(itDescriptor == m_descriptors.end())
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 return nullptr;
             }
             
-            PoolDesc& desc(itDescriptor->second);
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
             
             //Find a provider that can load this resource
-			ResourceProvider* provider = FindProvider(in_filePath, desc);
+			ResourceProvider* provider = FindProvider(in_filePath, *desc);
             if(provider == nullptr)
             {
                 return nullptr;
@@ -418,9 +725,10 @@ namespace ChilliSource
 			Resource::ResourceId resourceId = GenerateResourceId(in_location, in_filePath, options);
             
             lock.lock();
-            auto itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource != desc.m_cachedResources.end())
+            auto itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource != desc->m_cachedResources.end())
             {
+                itResource->second->m_lastUsedFrame = m_frameIndex.load();
                 return std::static_pointer_cast<TResourceType>(itResource->second);
             }
             lock.unlock();
@@ -443,15 +751,16 @@ namespace ChilliSource
             
             lock.lock();
             //Check the async call hasn't sneaked in here with the same resource
-            itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource == desc.m_cachedResources.end())
+            itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource == desc->m_cachedResources.end())
             {
-                desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+                desc->m_cachedResources.insert(std::make_pair(resourceId, resource));
             }
             else
             {
                 resource = itResource->second;
             }
+            resource->m_lastUsedFrame = m_frameIndex.load();
             lock.unlock();
             
             return std::static_pointer_cast<TResourceType>(resource);
@@ -463,19 +772,18 @@ namespace ChilliSource
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be refreshed on the main thread");
             CS_ASSERT(in_filePath.empty() == false, "Cannot refresh resource with no file path");
             
-			std::unique_lock<std::mutex> lock(m_mutex);
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
             
-            if(itDescriptor == m_descriptors.end())
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 return nullptr;
             }
             
-            PoolDesc& desc(itDescriptor->second);
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
             
             //Find a provider that can load this resource
-			ResourceProvider* provider = FindProvider(in_filePath, desc);
+			ResourceProvider* provider = FindProvider(in_filePath, *desc);
             if(provider == nullptr)
             {
                 return nullptr;
@@ -492,8 +800,8 @@ namespace ChilliSource
 			Resource::ResourceId resourceId = GenerateResourceId(in_location, in_filePath, options);
             
             lock.lock();
-            auto itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource == desc.m_cachedResources.end())
+            auto itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource == desc->m_cachedResources.end())
             {
 				CS_LOG_ERROR("Failed to refresh non-existing resource for " + in_filePath);
                 return nullptr;
@@ -521,26 +829,24 @@ namespace ChilliSource
         {
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be refreshed on the main thread");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
             
-            if(itDescriptor == m_descriptors.end())
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 return;
             }
             
-            PoolDesc& desc(itDescriptor->second);
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
             
-            for(auto& resourceEntry : desc.m_cachedResources)
+            for(auto& resourceEntry : desc->m_cachedResources)
             {
                 ResourceSPtr& resource(resourceEntry.second);
                 
                 if(resource->GetStorageLocation() != CSCore::StorageLocation::k_none)
                 {
                     //Find a provider that can load this resource
-                    ResourceProvider* provider = FindProvider(resource->GetFilePath(), desc);
+                    ResourceProvider* provider = FindProvider(resource->GetFilePath(), *desc);
                     if(provider == nullptr)
                     {
                         CS_LOG_ERROR("Failed to find resource provider for " + resource->GetName());
@@ -562,31 +868,43 @@ namespace ChilliSource
         //-------------------------------------------------------------------------------------
         template <typename TResourceType> void ResourcePool::LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
         {
-            LoadResourceAsync(in_location, in_filePath, IResourceOptionsCSPtr<TResourceType>(), in_delegate);
+            LoadResourceAsync(nullptr, in_location, in_filePath, IResourceOptionsCSPtr<TResourceType>(), in_delegate);
         }
         //-------------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------------
         template <typename TResourceType> void ResourcePool::LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
+        {
+            LoadResourceAsync(nullptr, in_location, in_filePath, in_options, in_delegate);
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void ResourcePool::LoadResourceAsync(const ResourceLoadGroupSPtr& in_group, StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
+        {
+            LoadResourceAsync(in_group, in_location, in_filePath, IResourceOptionsCSPtr<TResourceType>(), in_delegate);
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void ResourcePool::LoadResourceAsync(const ResourceLoadGroupSPtr& in_group, StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
         {
             CS_ASSERT(in_filePath.empty() == false, "Cannot load resource async with no file path");
             CS_ASSERT(in_delegate != nullptr, "Cannot load resource async with null delegate");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
             
-            if(itDescriptor == m_descriptors.end())
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 in_delegate(nullptr);
                 return;
             }
             
-            PoolDesc& desc(itDescriptor->second);
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
             
             //Find a provider that can load this resource
-			ResourceProvider* provider = FindProvider(in_filePath, desc);
+			ResourceProvider* provider = FindProvider(in_filePath, *desc);
             if(provider == nullptr)
             {
+                lock.unlock();
                 in_delegate(nullptr);
                 return;
             }
@@ -601,11 +919,28 @@ namespace ChilliSource
             //Check descriptor and see if this resource already exists
 			Resource::ResourceId resourceId = GenerateResourceId(in_location, in_filePath, options);
             
+            ResourceProvider::AsyncLoadDelegate convertDelegate([=](const ResourceSPtr& in_resource)
+            {
+                in_delegate(std::static_pointer_cast<const TResourceType>(in_resource));
+            });
+            
             lock.lock();
-            auto itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource != desc.m_cachedResources.end())
+            auto itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource != desc->m_cachedResources.end())
             {
-                in_delegate(std::static_pointer_cast<const TResourceType>(itResource->second));
+                //If the resource is still being loaded the delegate is called once the load has finished.
+                auto itAsyncLoad = desc->m_asyncLoads.find(resourceId);
+                if(itAsyncLoad != desc->m_asyncLoads.end())
+                {
+                    AddAsyncLoadWaiter(itAsyncLoad->second, convertDelegate, in_group);
+                    return;
+                }
+                
+                ResourceSPtr resource(itResource->second);
+                resource->m_lastUsedFrame = m_frameIndex.load();
+                lock.unlock();
+                
+                in_delegate(std::static_pointer_cast<const TResourceType>(resource));
                 return;
             }
             
@@ -616,18 +951,28 @@ namespace ChilliSource
 			resource->SetName(in_filePath);
             resource->SetOptions(options);
             resource->SetId(resourceId);
+            resource->m_lastUsedFrame = m_frameIndex.load();
 
             //Add it to the cache
-            desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+            desc->m_cachedResources.insert(std::make_pair(resourceId, resource));
+            
+            AsyncLoad& asyncLoad(desc->m_asyncLoads[resourceId]);
+            asyncLoad.m_group = in_group;
+            AddAsyncLoadWaiter(asyncLoad, convertDelegate, in_group);
             lock.unlock();
             
-            ResourceProvider::AsyncLoadDelegate convertDelegate([=](const ResourceSPtr& in_resource)
-            {
-                in_delegate(std::static_pointer_cast<const TResourceType>(in_resource));
-            });
-
-			std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(in_location, in_filePath);
-            provider->CreateResourceFromFileAsync(in_location, deviceFilePath, options, convertDelegate, resource);
+            QueuedLoad queuedLoad;
+            queuedLoad.m_desc = desc;
+            queuedLoad.m_provider = provider;
+            queuedLoad.m_resource = resource;
+            queuedLoad.m_group = in_group;
+            QueueAsyncLoad(std::move(queuedLoad));
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void ResourcePool::SetMemoryBudget(u64 in_budget)
+        {
+            SetMemoryBudget(TResourceType::InterfaceID, TResourceType::TypeName, in_budget);
         }
         //-------------------------------------------------------------------------------------
         /// Resources often have references to other resources and therefore multiple release passes
@@ -637,12 +982,12 @@ namespace ChilliSource
         {
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be released on the main thread");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
             //Find the descriptor that handles this type of resource
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            CS_ASSERT(itDescriptor != m_descriptors.end(), "Failed to find resource provider for " + TResourceType::TypeName);
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            CS_ASSERT(desc != nullptr, "Failed to find resource provider for " + TResourceType::TypeName);
 
-            auto& cachedResources(itDescriptor->second.m_cachedResources);
+            std::unique_lock<std::mutex> lock(desc->m_mutex);
+            auto& cachedResources(desc->m_cachedResources);
             
             u32 numReleased = 0;
             
@@ -85,6 +85,11 @@ namespace ChilliSource
 			{
                 m_entities[i]->OnUpdate(in_timeSinceLastUpdate);
             }
+            
+            if (m_transformHierarchy != nullptr)
+            {
+                m_transformHierarchy->Update();
+            }
 		}
         //-------------------------------------------------------
 		//-------------------------------------------------------
@@ -94,6 +99,11 @@ namespace ChilliSource
 			{
                 m_entities[i]->OnFixedUpdate(in_fixedTimeSinceLastUpdate);
             }
+            
+            if (m_transformHierarchy != nullptr)
+            {
+                m_transformHierarchy->Update();
+            }
 		}
         //-------------------------------------------------------
 		//-------------------------------------------------------
@@ -130,6 +140,13 @@ namespace ChilliSource
 			m_entities.push_back(in_entity);
 
 			in_entity->SetScene(this);
+            
+            //children are added to the store along with their root.
+            if (m_transformHierarchy != nullptr && in_entity->GetParent() == nullptr)
+            {
+                m_transformHierarchy->Add(&in_entity->GetTransform());
+            }
+            
             in_entity->OnAddedToScene();
             
             if (m_entitiesActive == true)
@@ -162,10 +179,21 @@ namespace ChilliSource
                     
                     ent->OnRemovedFromScene();
                     ent->SetScene(nullptr);
+                    
+                    if (m_transformHierarchy != nullptr)
+                    {
+                        m_transformHierarchy->Remove(&ent->GetTransform());
+                    }
                 }
 			}
             
             m_entities.clear();
+            
+            for (auto& registry : m_componentRegistries)
+            {
+                registry.second.m_components.clear();
+                registry.second.m_numRemoved = 0;
+            }
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -187,12 +215,59 @@ namespace ChilliSource
 		}
 		//--------------------------------------------------------------------------------------------------
 		//--------------------------------------------------------------------------------------------------
+        const BoundingVolumeHierarchy& Scene::GetVolumeHierarchy()
+        {
+            //transforms changed since the last scene update have to be applied before the volumes are.
+            if (m_transformHierarchy != nullptr)
+            {
+                m_transformHierarchy->Update();
+            }
+            
+            m_volumeHierarchy.Update();
+            return m_volumeHierarchy;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::SetTransformHierarchyEnabled(bool in_enabled)
+        {
+            if (in_enabled == (m_transformHierarchy != nullptr))
+            {
+                return;
+            }
+            
+            if (in_enabled == true)
+            {
+                m_transformHierarchy = TransformHierarchyUPtr(new TransformHierarchy());
+                
+                for (const EntitySPtr& entity : m_entities)
+                {
+                    if (entity->GetParent() == nullptr)
+                    {
+                        m_transformHierarchy->Add(&entity->GetTransform());
+                    }
+                }
+            }
+            else
+            {
+                //flush any batched changes so listeners don't miss them.
+                m_transformHierarchy->Update();
+                m_transformHierarchy.reset();
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        TransformHierarchy* Scene::GetTransformHierarchy() const
+        {
+            return m_transformHierarchy.get();
+        }
+		//--------------------------------------------------------------------------------------------------
+		//--------------------------------------------------------------------------------------------------
 		void Scene::QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents)
 		{
 			std::vector<VolumeComponent*> intersectableComponents;
-			QuerySceneForComponents(intersectableComponents);
+			GetVolumeHierarchy().QueryRay(in_ray, intersectableComponents);
 			
-			//Loop through the render components and check for intersection
+			//Loop through the candidate components and check for intersection
 			//If any intersect then add them to the intersect list
 			for(std::vector<VolumeComponent*>::iterator it = intersectableComponents.begin(); it != intersectableComponents.end(); ++it)
 			{
@@ -235,9 +310,124 @@ namespace ChilliSource
                 in_entity->OnRemovedFromScene();
                 in_entity->SetScene(nullptr);
                 
+                if (m_transformHierarchy != nullptr && in_entity->GetParent() == nullptr)
+                {
+                    m_transformHierarchy->Remove(&in_entity->GetTransform());
+                }
+                
                 it->swap(m_entities.back());
                 m_entities.pop_back();
             }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::RegisterComponent(Component* in_component)
+        {
+            for (auto& registry : m_componentRegistries)
+            {
+                if (in_component->IsA(registry.first) == true)
+                {
+                    in_component->m_sceneRegistryIndices.push_back(std::make_pair(registry.first, u32(registry.second.m_components.size())));
+                    registry.second.m_components.push_back(in_component);
+                }
+            }
+            
+            if (in_component->IsA(VolumeComponent::InterfaceID) == true)
+            {
+                VolumeComponent* volumeComponent = static_cast<VolumeComponent*>(in_component);
+                CS_ASSERT(volumeComponent->m_volumeProxyId == BoundingVolumeHierarchy::k_nullProxy, "Volume component is already in a bounding volume hierarchy.");
+                
+                volumeComponent->m_volumeProxyId = m_volumeHierarchy.Add(volumeComponent);
+                volumeComponent->m_volumeTransformConnection = in_component->GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection([this, volumeComponent]()
+                {
+                    InvalidateVolume(volumeComponent);
+                });
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::UnregisterComponent(Component* in_component)
+        {
+            for (const auto& registryIndex : in_component->m_sceneRegistryIndices)
+            {
+                ComponentRegistry& registry = m_componentRegistries[registryIndex.first];
+                CS_ASSERT(registryIndex.second < registry.m_components.size() && registry.m_components[registryIndex.second] == in_component, "Component registry index is out of date.");
+                
+                //Leave a null slot rather than erasing or swapping so that the registration order, which the
+                //renderer relies on to pick the active camera, is preserved. The slot is compacted on the next query.
+                registry.m_components[registryIndex.second] = nullptr;
+                ++registry.m_numRemoved;
+            }
+            in_component->m_sceneRegistryIndices.clear();
+            
+            if (in_component->IsA(VolumeComponent::InterfaceID) == true)
+            {
+                VolumeComponent* volumeComponent = static_cast<VolumeComponent*>(in_component);
+                if (volumeComponent->m_volumeProxyId != BoundingVolumeHierarchy::k_nullProxy)
+                {
+                    volumeComponent->m_volumeTransformConnection.reset();
+                    m_volumeHierarchy.Remove(volumeComponent->m_volumeProxyId);
+                    volumeComponent->m_volumeProxyId = BoundingVolumeHierarchy::k_nullProxy;
+                }
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        const std::vector<Component*>& Scene::GetComponentRegistry(InterfaceIDType in_interfaceId)
+        {
+            auto it = m_componentRegistries.find(in_interfaceId);
+            if (it != m_componentRegistries.end())
+            {
+                ComponentRegistry& existingRegistry = it->second;
+                if (existingRegistry.m_numRemoved > 0)
+                {
+                    //Shuffle the remaining components down over the removed slots, in order, updating their stored indices.
+                    u32 numComponents = 0;
+                    for (auto component : existingRegistry.m_components)
+                    {
+                        if (component == nullptr)
+                        {
+                            continue;
+                        }
+                        
+                        for (auto& registryIndex : component->m_sceneRegistryIndices)
+                        {
+                            if (registryIndex.first == in_interfaceId)
+                            {
+                                registryIndex.second = numComponents;
+                                break;
+                            }
+                        }
+                        existingRegistry.m_components[numComponents++] = component;
+                    }
+                    existingRegistry.m_components.resize(numComponents);
+                    existingRegistry.m_numRemoved = 0;
+                }
+                
+                return existingRegistry.m_components;
+            }
+            
+            std::vector<Component*>& registry = m_componentRegistries[in_interfaceId].m_components;
+            for (SharedEntityList::const_iterator entityIt = m_entities.begin(); entityIt != m_entities.end(); ++entityIt)
+            {
+                const ComponentList& components = (*entityIt)->GetComponents();
+                for (ComponentList::const_iterator componentIt = components.begin(); componentIt != components.end(); ++componentIt)
+                {
+                    if ((*componentIt)->IsA(in_interfaceId) == true)
+                    {
+                        (*componentIt)->m_sceneRegistryIndices.push_back(std::make_pair(in_interfaceId, u32(registry.size())));
+                        registry.push_back(componentIt->get());
+                    }
+                }
+            }
+            
+            return registry;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::InvalidateVolume(VolumeComponent* in_volumeComponent)
+        {
+            m_volumeHierarchy.Invalidate(in_volumeComponent->m_volumeProxyId);
         }
 		//--------------------------------------------------------------------------------------------------
 		//--------------------------------------------------------------------------------------------------
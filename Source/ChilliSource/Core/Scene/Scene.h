@@ -32,10 +32,14 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/System/StateSystem.h>
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
+#include <unordered_map>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -151,10 +155,37 @@ namespace ChilliSource
             /// @author Ian Copland
 			//-------------------------------------------------------
 			void SuspendEntities();
+            //--------------------------------------------------------------------------------------------------
+            /// Returns the bounding volume hierarchy containing all volume components in the scene. Any
+            /// pending transform and volume changes are applied before it is returned, so it is ready
+            /// to be queried. This must be called on the main thread.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The bounding volume hierarchy.
+            //--------------------------------------------------------------------------------------------------
+            const BoundingVolumeHierarchy& GetVolumeHierarchy();
+            //--------------------------------------------------------------------------------------------------
+            /// Sets whether the transforms of entities in the scene are held in a transform hierarchy
+            /// store. When enabled, transform changes are batched and world transforms are updated in a
+            /// single pass at the end of each update and fixed update, with change notifications
+            /// delivered once per changed transform. This is disabled by default.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not the transform hierarchy store is enabled.
+            //--------------------------------------------------------------------------------------------------
+            void SetTransformHierarchyEnabled(bool in_enabled);
+            //--------------------------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The transform hierarchy store, or null if it is not enabled.
+            //--------------------------------------------------------------------------------------------------
+            TransformHierarchy* GetTransformHierarchy() const;
 			//--------------------------------------------------------------------------------------------------
-			/// Traverses the contents of the scene and adds any objects that intersect with the ray to the
-			/// list. The list order is undefined. Use the query intersection value on the volume component
-            /// to sort by depth
+			/// Adds any objects that intersect with the ray to the list. The bounding volume hierarchy is
+			/// used to find candidate objects, which are then tested precisely. The list order is undefined.
+			/// Use the query intersection value on the volume component to sort by depth
             ///
             /// @author S Downie
             ///
@@ -163,7 +194,10 @@ namespace ChilliSource
 			//--------------------------------------------------------------------------------------------------
 			void QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents);
             //--------------------------------------------------------------------------------------------------
-			/// Traverse the scene for the given component type and fill the list with those components
+			/// Fill the list with all components in the scene of the given type. The scene keeps a registry
+            /// of components for each queried interface which is updated as components are added and
+            /// removed, so this does not need to traverse the scene. Components are listed in the order they
+            /// joined the scene.
             ///
             /// @author S Downie
             ///
@@ -172,13 +206,12 @@ namespace ChilliSource
 			template <typename TComponentType>
             void QuerySceneForComponents(std::vector<TComponentType*>& out_components)
 			{
-				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-				{
-					(*it)->GetComponents<TComponentType>(out_components);
-				}
+                AppendRegisteredComponents(GetComponentRegistry(TComponentType::InterfaceID), out_components);
 			}
             //--------------------------------------------------------------------------------------------------
-			/// Traverse the scene for the given component types and fill the lists with those components
+			/// Fill the lists with all components in the scene of the given types. The scene keeps a
+            /// registry of components for each queried interface which is updated as components are added
+            /// and removed, so this does not need to traverse the scene.
             //
             /// @author S Downie
             ///
@@ -188,13 +221,13 @@ namespace ChilliSource
 			template <typename TComponentType1, typename TComponentType2>
             void QuerySceneForComponents(std::vector<TComponentType1*>& out_components1, std::vector<TComponentType2*>& out_components2)
 			{
-				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-				{
-					(*it)->GetComponents<TComponentType1, TComponentType2>(out_components1, out_components2);
-				}
+                AppendRegisteredComponents(GetComponentRegistry(TComponentType1::InterfaceID), out_components1);
+                AppendRegisteredComponents(GetComponentRegistry(TComponentType2::InterfaceID), out_components2);
 			}
             //--------------------------------------------------------------------------------------------------
-			/// Traverse the scene for the given component types and fill the lists with those components
+			/// Fill the lists with all components in the scene of the given types. The scene keeps a
+            /// registry of components for each queried interface which is updated as components are added
+            /// and removed, so this does not need to traverse the scene.
             ///
             /// @author S Downie
             ///
@@ -205,14 +238,14 @@ namespace ChilliSource
 			template <typename TComponentType1, typename TComponentType2, typename TComponentType3>
             void QuerySceneForComponents(std::vector<TComponentType1*>& out_components1, std::vector<TComponentType2*>& out_components2, std::vector<TComponentType3*>& out_components3)
 			{
-				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-				{
-					(*it)->GetComponents<TComponentType1, TComponentType2, TComponentType3>(out_components1, out_components2, out_components3);
-				}
+                AppendRegisteredComponents(GetComponentRegistry(TComponentType1::InterfaceID), out_components1);
+                AppendRegisteredComponents(GetComponentRegistry(TComponentType2::InterfaceID), out_components2);
+                AppendRegisteredComponents(GetComponentRegistry(TComponentType3::InterfaceID), out_components3);
 			}
             
         private:
             friend class Entity;
+            friend class VolumeComponent;
             
             //-------------------------------------------------------
             /// Private to enforce use of factory method
@@ -228,10 +261,88 @@ namespace ChilliSource
             /// @param Entity
             //-------------------------------------------------------
             void Remove(Entity* inpEntity);
+            //-------------------------------------------------------
+            /// Adds the component to the registry of each queried
+            /// interface it implements. Called by the owning entity
+            /// whenever a component joins the scene.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Component
+            //-------------------------------------------------------
+            void RegisterComponent(Component* in_component);
+            //-------------------------------------------------------
+            /// Removes the component from all registries. Called by
+            /// the owning entity whenever a component leaves the
+            /// scene.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Component
+            //-------------------------------------------------------
+            void UnregisterComponent(Component* in_component);
+            //-------------------------------------------------------
+            /// Returns the registry of components implementing the
+            /// given interface. If the interface has not been queried
+            /// before the registry is built from the current contents
+            /// of the scene and kept up to date from then on. Any
+            /// slots left by removed components are compacted first.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Interface ID
+            ///
+            /// @return The registered components of that interface
+            //-------------------------------------------------------
+            const std::vector<Component*>& GetComponentRegistry(InterfaceIDType in_interfaceId);
+            //-------------------------------------------------------
+            /// Flags the given volume as having changed so that it
+            /// is updated in the bounding volume hierarchy.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Volume component
+            //-------------------------------------------------------
+            void InvalidateVolume(VolumeComponent* in_volumeComponent);
+            //-------------------------------------------------------
+            /// Appends the components in the given registry to the
+            /// output list, cast to the concrete type.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Registry
+            /// @param [Out] Container to be filled
+            //-------------------------------------------------------
+            template <typename TComponentType>
+            static void AppendRegisteredComponents(const std::vector<Component*>& in_registry, std::vector<TComponentType*>& out_components)
+            {
+                out_components.reserve(out_components.size() + in_registry.size());
+                for (std::vector<Component*>::const_iterator it = in_registry.begin(); it != in_registry.end(); ++it)
+                {
+                    out_components.push_back(static_cast<TComponentType*>(*it));
+                }
+            }
             
 		private:
+            //-------------------------------------------------------
+            /// The components implementing a single interface, in
+            /// the order they joined the scene. Removed components
+            /// leave a null slot, which is compacted out on the next
+            /// query, so that removal is constant time but the order
+            /// is preserved.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            struct ComponentRegistry
+            {
+                std::vector<Component*> m_components;
+                u32 m_numRemoved = 0;
+            };
 			
 			SharedEntityList m_entities;
+            std::unordered_map<InterfaceIDType, ComponentRegistry> m_componentRegistries;
+            BoundingVolumeHierarchy m_volumeHierarchy;
+            TransformHierarchyUPtr m_transformHierarchy;
             Colour m_clearColour;
             bool m_entitiesActive = false;
             bool m_entitiesForegrounded = false;
@@ -0,0 +1,102 @@
+//
+//  Task.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Threading/Task.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        Task::Task()
+            : m_operations(nullptr)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        Task::Task(Task&& in_toMove)
+            : m_operations(in_toMove.m_operations)
+        {
+            if (m_operations != nullptr)
+            {
+                m_operations->m_move(in_toMove.m_storage, m_storage);
+                in_toMove.m_operations = nullptr;
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        Task& Task::operator=(Task&& in_toMove)
+        {
+            if (this != &in_toMove)
+            {
+                if (m_operations != nullptr)
+                {
+                    m_operations->m_destroy(m_storage);
+                }
+
+                m_operations = in_toMove.m_operations;
+                if (m_operations != nullptr)
+                {
+                    m_operations->m_move(in_toMove.m_storage, m_storage);
+                    in_toMove.m_operations = nullptr;
+                }
+            }
+
+            return *this;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Task::operator()()
+        {
+            CS_ASSERT(m_operations != nullptr, "Cannot execute an empty task.");
+            m_operations->m_invoke(m_storage);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        Task::operator bool() const
+        {
+            return (m_operations != nullptr);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Task::IsHeapAllocated() const
+        {
+            return (m_operations != nullptr && m_operations->m_isHeapAllocated == true);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        Task::~Task()
+        {
+            if (m_operations != nullptr)
+            {
+                m_operations->m_destroy(m_storage);
+            }
+        }
+    }
+}
@@ -0,0 +1,191 @@
+//
+//  Task.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_THREADING_TASK_H_
+#define _CHILLISOURCE_CORE_THREADING_TASK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// A move only container for a callable object with the signature void(). This
+        /// is used in place of std::function for tasks scheduled on the thread pool.
+        /// Callables which are small enough, such as lambdas capturing a few pointers,
+        /// are stored inline so that scheduling a task doesn't require a heap
+        /// allocation. Larger callables are stored on the heap.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        class Task final
+        {
+        public:
+            CS_DECLARE_NOCOPY(Task);
+
+            static const u32 k_inlineStorageSize = 48;
+            //------------------------------------------------------------------------------
+            /// Constructs an empty task.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            Task();
+            //------------------------------------------------------------------------------
+            /// Constructs a task from the given callable.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The callable. This must have the signature void().
+            //------------------------------------------------------------------------------
+            template <typename TCallable, typename = typename std::enable_if<!std::is_same<typename std::decay<TCallable>::type, Task>::value>::type>
+            Task(TCallable&& in_callable);
+            //------------------------------------------------------------------------------
+            /// Move constructor.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The task to move.
+            //------------------------------------------------------------------------------
+            Task(Task&& in_toMove);
+            //------------------------------------------------------------------------------
+            /// Move assignment.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The task to move.
+            ///
+            /// @return A reference to this.
+            //------------------------------------------------------------------------------
+            Task& operator=(Task&& in_toMove);
+            //------------------------------------------------------------------------------
+            /// Executes the task. The task must not be empty.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            void operator()();
+            //------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not the task contains a callable.
+            //------------------------------------------------------------------------------
+            explicit operator bool() const;
+            //------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not the callable is stored on the heap.
+            //------------------------------------------------------------------------------
+            bool IsHeapAllocated() const;
+            //------------------------------------------------------------------------------
+            /// Destructor.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            ~Task();
+
+        private:
+            typedef std::aligned_storage<k_inlineStorageSize>::type Storage;
+            //------------------------------------------------------------------------------
+            /// The operations which can be performed on the stored callable.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            struct Operations
+            {
+                void (*m_invoke)(Storage& in_storage);
+                void (*m_move)(Storage& in_source, Storage& out_destination);
+                void (*m_destroy)(Storage& in_storage);
+                bool m_isHeapAllocated;
+            };
+            //------------------------------------------------------------------------------
+            /// The operations for callables stored within the task.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            template <typename TCallable> struct InlineOperations
+            {
+                template <typename TArg> static void Create(Storage& out_storage, TArg&& in_callable) { new (&out_storage) TCallable(std::forward<TArg>(in_callable)); }
+                static void Invoke(Storage& in_storage) { (*reinterpret_cast<TCallable*>(&in_storage))(); }
+                static void Move(Storage& in_source, Storage& out_destination)
+                {
+                    TCallable* source = reinterpret_cast<TCallable*>(&in_source);
+                    new (&out_destination) TCallable(std::move(*source));
+                    source->~TCallable();
+                }
+                static void Destroy(Storage& in_storage) { reinterpret_cast<TCallable*>(&in_storage)->~TCallable(); }
+                static const Operations k_operations;
+            };
+            //------------------------------------------------------------------------------
+            /// The operations for callables stored on the heap.
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            template <typename TCallable> struct HeapOperations
+            {
+                template <typename TArg> static void Create(Storage& out_storage, TArg&& in_callable) { *reinterpret_cast<TCallable**>(&out_storage) = new TCallable(std::forward<TArg>(in_callable)); }
+                static void Invoke(Storage& in_storage) { (**reinterpret_cast<TCallable**>(&in_storage))(); }
+                static void Move(Storage& in_source, Storage& out_destination) { *reinterpret_cast<TCallable**>(&out_destination) = *reinterpret_cast<TCallable**>(&in_source); }
+                static void Destroy(Storage& in_storage) { delete *reinterpret_cast<TCallable**>(&in_storage); }
+                static const Operations k_operations;
+            };
+
+            Storage m_storage;
+            const Operations* m_operations;
+        };
+
+        template <typename TCallable> const Task::Operations Task::InlineOperations<TCallable>::k_operations =
+        {
+            &Task::InlineOperations<TCallable>::Invoke, &Task::InlineOperations<TCallable>::Move, &Task::InlineOperations<TCallable>::Destroy, false
+        };
+
+        template <typename TCallable> const Task::Operations Task::HeapOperations<TCallable>::k_operations =
+        {
+            &Task::HeapOperations<TCallable>::Invoke, &Task::HeapOperations<TCallable>::Move, &Task::HeapOperations<TCallable>::Destroy, true
+        };
+
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TCallable, typename> Task::Task(TCallable&& in_callable)
+        {
+            typedef typename std::decay<TCallable>::type CallableType;
+
+            //selected at compile time so that the inline path is never instantiated for callables which don't fit.
+            const bool fitsInline = (sizeof(CallableType) <= sizeof(Storage) && std::alignment_of<Storage>::value % std::alignment_of<CallableType>::value == 0);
+            typedef typename std::conditional<fitsInline, InlineOperations<CallableType>, HeapOperations<CallableType>>::type OperationsType;
+
+            OperationsType::Create(m_storage, std::forward<TCallable>(in_callable));
+            m_operations = &OperationsType::k_operations;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,87 @@
+//
+//  TaskCounter.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_THREADING_TASKCOUNTER_H_
+#define _CHILLISOURCE_CORE_THREADING_TASKCOUNTER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// Tracks the number of incomplete tasks in a group. Tasks are added to the
+        /// group by passing the counter when scheduling them, and the counter is
+        /// decremented as each completes. The counter can be waited on using the
+        /// task scheduler, or used as a dependency for other tasks.
+        ///
+        /// The counter must outlive all of the tasks it is tracking.
+        ///
+        /// @author Jordan Brown
+        //------------------------------------------------------------------------------
+        class TaskCounter final
+        {
+        public:
+            CS_DECLARE_NOCOPY(TaskCounter);
+            //------------------------------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            TaskCounter();
+            //------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not all of the tasks in the group have completed.
+            //------------------------------------------------------------------------------
+            bool IsComplete() const;
+            //------------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of tasks in the group which are yet to complete.
+            //------------------------------------------------------------------------------
+            u32 GetNumPendingTasks() const;
+            //------------------------------------------------------------------------------
+            /// Destructor
+            ///
+            /// @author Jordan Brown
+            //------------------------------------------------------------------------------
+            ~TaskCounter();
+
+        private:
+            friend class ThreadPool;
+
+            std::atomic<u32> m_numPendingTasks;
+        };
+    }
+}
+
+#endif
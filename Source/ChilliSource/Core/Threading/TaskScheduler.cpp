@@ -28,13 +28,56 @@
 
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
+#include <ChilliSource/Core/Base/AppConfig.h>
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/Time/PerformanceTimer.h>
+
+#include <algorithm>
+#include <atomic>
 
 namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            //-------------------------------------------------
+            /// The state shared between the threads taking
+            /// part in a parallel for.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------
+            struct ParallelForState
+            {
+                const TaskScheduler::ParallelForTaskType* m_task = nullptr;
+                u32 m_numItems = 0;
+                u32 m_batchSize = 0;
+                u32 m_numBatches = 0;
+                std::atomic<u32> m_nextBatch;
+            };
+            //-------------------------------------------------
+            /// Claims and processes batches until there are
+            /// none left.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The parallel for state.
+            //-------------------------------------------------
+            void ProcessParallelForBatches(ParallelForState& in_state)
+            {
+                u32 batch = in_state.m_nextBatch++;
+                while (batch < in_state.m_numBatches)
+                {
+                    u32 begin = batch * in_state.m_batchSize;
+                    u32 end = std::min(begin + in_state.m_batchSize, in_state.m_numItems);
+                    (*in_state.m_task)(begin, end);
+
+                    batch = in_state.m_nextBatch++;
+                }
+            }
+        }
+
 		CS_DEFINE_NAMEDTYPE(TaskScheduler);
 
 		//-------------------------------------------------
@@ -62,6 +105,7 @@ namespace ChilliSource
             Device* device = Core::Application::Get()->GetSystem<Device>();
 			m_threadPool = ThreadPoolUPtr(new Core::ThreadPool(device->GetNumberOfCPUCores() * 2));
             
+            m_mainThreadTaskBudgetMS = Application::Get()->GetAppConfig()->GetMainThreadTaskBudget();
             m_mainThreadId = std::this_thread::get_id();
 		}
         //------------------------------------------------
@@ -72,30 +116,134 @@ namespace ChilliSource
         }
 		//------------------------------------------------
 		//------------------------------------------------
-		void TaskScheduler::ScheduleTask(const GenericTaskType& in_task)
+		void TaskScheduler::ScheduleTask(Task in_task)
+		{
+			m_threadPool->Schedule(std::move(in_task));
+		}
+		//------------------------------------------------
+		//------------------------------------------------
+		void TaskScheduler::ScheduleTask(Task in_task, TaskCounter& in_counter)
+		{
+			m_threadPool->Schedule(std::move(in_task), in_counter);
+		}
+		//------------------------------------------------
+		//------------------------------------------------
+		void TaskScheduler::ScheduleTask(Task in_task, TaskCounter& in_counter, const TaskCounter& in_dependency)
+		{
+			m_threadPool->Schedule(std::move(in_task), in_counter, in_dependency);
+		}
+		//------------------------------------------------
+		//------------------------------------------------
+		void TaskScheduler::WaitForTasks(const TaskCounter& in_counter)
 		{
-			m_threadPool->Schedule(in_task);
+			m_threadPool->Wait(in_counter);
 		}
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void TaskScheduler::ParallelFor(u32 in_numItems, u32 in_minBatchSize, const ParallelForTaskType& in_task)
+        {
+            CS_ASSERT(in_minBatchSize > 0, "Parallel for batch size must be greater than zero.");
+
+            //Aim for a few batches per thread so that uneven batches balance out.
+            const u32 k_batchesPerThread = 4;
+            u32 numThreads = m_threadPool->GetNumThreads() + 1;
+            u32 batchSize = std::max(in_minBatchSize, in_numItems / (numThreads * k_batchesPerThread));
+            u32 numBatches = (in_numItems + batchSize - 1) / batchSize;
+
+            if (numBatches <= 1)
+            {
+                in_task(0, in_numItems);
+                return;
+            }
+
+            ParallelForState state;
+            state.m_task = &in_task;
+            state.m_numItems = in_numItems;
+            state.m_batchSize = batchSize;
+            state.m_numBatches = numBatches;
+            state.m_nextBatch = 0;
+
+            //Helpers which only start once all batches are claimed return immediately. Waiting on the counter
+            //rather than the batches keeps the state alive until every helper is done with it.
+            TaskCounter counter;
+            u32 numHelpers = std::min(numBatches - 1, m_threadPool->GetNumThreads());
+            for (u32 i = 0; i < numHelpers; ++i)
+            {
+                m_threadPool->Schedule([&state]()
+                {
+                    ProcessParallelForBatches(state);
+                }, counter);
+            }
+
+            ProcessParallelForBatches(state);
+            m_threadPool->Wait(counter);
+        }
 		//----------------------------------------------------
 		//----------------------------------------------------
-		void TaskScheduler::ScheduleMainThreadTask(const GenericTaskType& in_task)
+		void TaskScheduler::ScheduleMainThreadTask(Task in_task)
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mainThreadQueueMutex);
-			m_mainThreadTasks.push_back(in_task);
+			m_mainThreadTasks.push(std::move(in_task));
 		}
         //----------------------------------------------------
         //----------------------------------------------------
         void TaskScheduler::ExecuteMainThreadTasks()
         {
-            std::unique_lock<std::recursive_mutex> lock(m_mainThreadQueueMutex);
+            CS_ASSERT(IsMainThread() == true, "Main thread tasks must be executed on the main thread.");
             
-            for (u32 i = 0; i < m_mainThreadTasks.size(); ++i)
+            PerformanceTimer timer;
+            timer.Start();
+            
+            //Only tasks which were queued on entry are considered so that a task scheduling another
+            //main thread task can't keep this running indefinitely.
+            u32 numTasks = m_mainThreadTasks.size();
+            u32 numExecuted = 0;
+            
+            Task task;
+            while (numExecuted < numTasks && m_mainThreadTasks.try_pop(task) == true)
             {
-				m_mainThreadTasks[i]();
+				task();
+                task = Task();
+                ++numExecuted;
+                
+                if (m_mainThreadTaskBudgetMS > 0.0f)
+                {
+                    timer.Stop();
+                    if (timer.GetTimeTakenMS() >= m_mainThreadTaskBudgetMS)
+                    {
+                        break;
+                    }
+                }
             }
             
-			m_mainThreadTasks.clear();
+            timer.Stop();
+            m_numMainThreadTasksExecuted = numExecuted;
+            m_mainThreadTaskDrainTimeMS = static_cast<f32>(timer.GetTimeTakenMS());
 		}
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void TaskScheduler::SetMainThreadTaskBudget(f32 in_budgetMS)
+        {
+            CS_ASSERT(in_budgetMS >= 0.0f, "Main thread task budget cannot be negative.");
+            m_mainThreadTaskBudgetMS = in_budgetMS;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        u32 TaskScheduler::GetNumQueuedMainThreadTasks() const
+        {
+            return m_mainThreadTasks.size();
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        u32 TaskScheduler::GetNumMainThreadTasksExecuted() const
+        {
+            return m_numMainThreadTasksExecuted;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        f32 TaskScheduler::GetMainThreadTaskDrainTime() const
+        {
+            return m_mainThreadTaskDrainTimeMS;
+        }
 		//-------------------------------------------------
 		//-------------------------------------------------
 		void TaskScheduler::Destroy()
@@ -30,9 +30,14 @@
 #define _CHILLISOURCE_CORE_THREADING_TASKSCHEDULER_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/concurrent_mpsc_queue.h>
 #include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Core/Threading/Task.h>
+#include <ChilliSource/Core/Threading/TaskCounter.h>
 #include <ChilliSource/Core/Threading/ThreadPool.h>
 
+#include <functional>
+
 namespace ChilliSource
 {
     namespace Core
@@ -51,6 +56,7 @@ namespace ChilliSource
 			CS_DECLARE_NAMEDTYPE(TaskScheduler);
 
             typedef std::function<void()> GenericTaskType;
+            typedef std::function<void(u32 in_begin, u32 in_end)> ParallelForTaskType;
 
 			//------------------------------------------------
 			/// @author S Downie
@@ -69,24 +75,123 @@ namespace ChilliSource
             ///
             /// @param Task
             //------------------------------------------------
-			void ScheduleTask(const GenericTaskType& in_task);
+			void ScheduleTask(Task in_task);
+            //------------------------------------------------
+            /// The task will be placed into the task queue
+            /// and be performed when a thread becomes
+            /// available. The counter tracks completion of
+            /// the task and can be waited on using
+            /// WaitForTasks() or used as a dependency.
+			///
+			/// @author Jordan Brown
+            ///
+            /// @param Task
+            /// @param The counter for the task's group.
+            //------------------------------------------------
+			void ScheduleTask(Task in_task, TaskCounter& in_counter);
+            //------------------------------------------------
+            /// The task will be placed into the task queue
+            /// once all tasks in the dependency group have
+            /// completed.
+			///
+			/// @author Jordan Brown
+            ///
+            /// @param Task
+            /// @param The counter for the task's group.
+            /// @param The group which must complete first.
+            /// This must remain valid until the task has
+            /// been queued.
+            //------------------------------------------------
+			void ScheduleTask(Task in_task, TaskCounter& in_counter, const TaskCounter& in_dependency);
+            //------------------------------------------------
+            /// Blocks until all tasks in the group have
+            /// completed. Rather than sleeping the calling
+            /// thread executes queued tasks in the group
+            /// while it waits, so this can be called from
+            /// within a task to wait on sub-tasks. Tasks
+            /// outside the group are never executed.
+			///
+			/// @author Jordan Brown
+            ///
+            /// @param The counter for the group.
+            //------------------------------------------------
+			void WaitForTasks(const TaskCounter& in_counter);
+            //------------------------------------------------
+            /// Splits the range [0, in_numItems) into batches
+            /// and executes the task for each batch. Batches
+            /// are processed by the thread pool and by the
+            /// calling thread, and this blocks until all of
+            /// them are complete. This can be called from
+            /// within a task. As the calling thread takes
+            /// part this will not stall if the pool is busy
+            /// with other work. Small ranges are processed
+            /// entirely on the calling thread.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The number of items.
+            /// @param The minimum number of items in a batch.
+            /// @param The task, which is passed the begin and
+            /// end index of each batch.
+            //------------------------------------------------
+            void ParallelFor(u32 in_numItems, u32 in_minBatchSize, const ParallelForTaskType& in_task);
             //----------------------------------------------------
             /// Schedule a task to be executed by the main
-            /// thread
+            /// thread. This is lock-free and can be called
+            /// from any thread.
 			///
 			/// @author S Downie
 			///
 			/// @param Task
             //----------------------------------------------------
-			void ScheduleMainThreadTask(const GenericTaskType& insTask);
+			void ScheduleMainThreadTask(Task in_task);
             //----------------------------------------------------
             /// Execute any tasks that have been scehduled
-            /// for the main thread
+            /// for the main thread. Tasks are executed in the
+            /// order they were scheduled until the main thread
+            /// task budget is used up, at which point the
+            /// remainder are deferred to the next call. Tasks
+            /// scheduled while this is running are always
+            /// deferred.
 			///
 			/// @author S Downie
             //----------------------------------------------------
             void ExecuteMainThreadTasks();
             //----------------------------------------------------
+            /// Sets the maximum time that can be spent
+            /// executing main thread tasks each frame. At
+            /// least one task is executed each frame regardless.
+            /// This defaults to the MainThreadTaskBudget value
+            /// in the App.config.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The budget in milliseconds. Zero disables
+            /// the budget.
+            //----------------------------------------------------
+            void SetMainThreadTaskBudget(f32 in_budgetMS);
+            //----------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of main thread tasks waiting
+            /// to be executed.
+            //----------------------------------------------------
+            u32 GetNumQueuedMainThreadTasks() const;
+            //----------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of main thread tasks executed
+            /// during the last call to ExecuteMainThreadTasks().
+            //----------------------------------------------------
+            u32 GetNumMainThreadTasksExecuted() const;
+            //----------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The time in milliseconds spent in the
+            /// last call to ExecuteMainThreadTasks().
+            //----------------------------------------------------
+            f32 GetMainThreadTaskDrainTime() const;
+            //----------------------------------------------------
             /// @author S Downie
             ///
             /// @return Whether the calling thread is the main
@@ -131,8 +236,10 @@ namespace ChilliSource
         
             ThreadPoolUPtr m_threadPool;
             
-            std::recursive_mutex m_mainThreadQueueMutex;
-            std::vector<GenericTaskType> m_mainThreadTasks;
+            concurrent_mpsc_queue<Task> m_mainThreadTasks;
+            f32 m_mainThreadTaskBudgetMS = 0.0f;
+            u32 m_numMainThreadTasksExecuted = 0;
+            f32 m_mainThreadTaskDrainTimeMS = 0.0f;
             
             std::thread::id m_mainThreadId;
         };
@@ -30,64 +30,424 @@
 
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            const u32 k_numYieldsBeforeSleep = 64;
+        }
+        
+        //----------------------------------------------
+        //----------------------------------------------
+        ThreadPool::QueuedTask::QueuedTask()
+            : m_counter(nullptr), m_dependency(nullptr)
+        {
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        ThreadPool::QueuedTask::QueuedTask(Task in_task, TaskCounter* in_counter, const TaskCounter* in_dependency)
+            : m_task(std::move(in_task)), m_counter(in_counter), m_dependency(in_dependency)
+        {
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        ThreadPool::QueuedTask::QueuedTask(QueuedTask&& in_toMove)
+            : m_task(std::move(in_toMove.m_task)), m_counter(in_toMove.m_counter), m_dependency(in_toMove.m_dependency)
+        {
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        ThreadPool::QueuedTask& ThreadPool::QueuedTask::operator=(QueuedTask&& in_toMove)
+        {
+            m_task = std::move(in_toMove.m_task);
+            m_counter = in_toMove.m_counter;
+            m_dependency = in_toMove.m_dependency;
+            return *this;
+        }
         //----------------------------------------------
         //----------------------------------------------
 		ThreadPool::ThreadPool(u32 in_numThreads)
-			: m_isFinished(false)
+			: m_numQueuedTasks(0), m_nextWorkerQueue(0), m_numSleepingThreads(0), m_numDependentTasks(0), m_isFinished(false)
         {
+            //there is always at least one queue so tasks can still be scheduled, and executed by waiting threads, if there are no workers.
+            u32 numQueues = std::max(in_numThreads, 1u);
+            for (u32 i=0; i<numQueues; ++i)
+            {
+                m_workerQueues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+            }
+            
+            //the sleep mutex is held until all thread ids are known so that workers don't look up their queue before then.
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            
             //create the threads
             for (u32 i=0; i<in_numThreads; ++i)
             {  
                 m_threadGroup.push_back(std::thread(Core::MakeDelegate(this, &ThreadPool::DoTaskOrWait)));
+                m_threadIds.push_back(m_threadGroup.back().get_id());
+            }
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::Schedule(Task in_task)
+        {
+            Push(QueuedTask(std::move(in_task), nullptr, nullptr));
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::Schedule(Task in_task, TaskCounter& in_counter)
+        {
+            ++in_counter.m_numPendingTasks;
+            Push(QueuedTask(std::move(in_task), &in_counter, nullptr));
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::Schedule(Task in_task, TaskCounter& in_counter, const TaskCounter& in_dependency)
+        {
+            ++in_counter.m_numPendingTasks;
+            
+            //the number of dependent tasks is incremented before checking the dependency so that a task completing on
+            //another thread will always either be seen here or see this task in the dependent list.
+            ++m_numDependentTasks;
+            
+            std::unique_lock<std::mutex> lock(m_dependentTasksMutex);
+            if (in_dependency.IsComplete() == false)
+            {
+                m_dependentTasks.push_back(QueuedTask(std::move(in_task), &in_counter, &in_dependency));
+                return;
+            }
+            lock.unlock();
+            
+            --m_numDependentTasks;
+            Push(QueuedTask(std::move(in_task), &in_counter, nullptr));
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::Wait(const TaskCounter& in_counter)
+        {
+            //only tasks in the group being waited on, or in the groups it depends on, are executed, otherwise a long
+            //unrelated task could hold up the waiting thread, or deadlock it if that task was itself waiting on the
+            //waiting thread. The dependency groups must be executed as well, as otherwise they would never run if
+            //every worker was waiting on a group which is held until they complete.
+            std::vector<const TaskCounter*> counters;
+            while (in_counter.IsComplete() == false)
+            {
+                counters.clear();
+                counters.push_back(&in_counter);
+                
+                QueuedTask task;
+                if (TryPop(counters, task) == true)
+                {
+                    Execute(task);
+                    continue;
+                }
+                
+                if (m_numDependentTasks > 0)
+                {
+                    AddDependencies(counters);
+                    if (counters.size() > 1 && TryPop(counters, task) == true)
+                    {
+                        Execute(task);
+                        continue;
+                    }
+                }
+                
+                std::this_thread::yield();
             }
         }
         //----------------------------------------------
         //----------------------------------------------
-        void ThreadPool::Schedule(const GenericTaskType& in_task)
+        bool ThreadPool::TryExecuteTask()
         {
-            m_tasks.push(std::move(in_task));
+            QueuedTask task;
+            if (TryPop(task) == true)
+            {
+                Execute(task);
+                return true;
+            }
+            
+            return false;
         }
         //----------------------------------------------
         //----------------------------------------------
         u32 ThreadPool::GetNumQueuedTasks() const
         {
-            return m_tasks.size();
+            return m_numQueuedTasks;
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        u32 ThreadPool::GetNumThreads() const
+        {
+            return static_cast<u32>(m_threadGroup.size());
         }
         //----------------------------------------------
         //----------------------------------------------
         void ThreadPool::ClearQueuedTasks()
         {
-			m_tasks.clear();
+            std::vector<TaskCounter*> discardedCounters;
+            
+            for (auto& workerQueue : m_workerQueues)
+            {
+                std::unique_lock<std::mutex> lock(workerQueue->m_mutex);
+                for (auto& task : workerQueue->m_tasks)
+                {
+                    discardedCounters.push_back(task.m_counter);
+                }
+                m_numQueuedTasks -= static_cast<u32>(workerQueue->m_tasks.size());
+                workerQueue->m_tasks.clear();
+            }
+            
+            {
+                std::unique_lock<std::mutex> lock(m_dependentTasksMutex);
+                for (auto& task : m_dependentTasks)
+                {
+                    discardedCounters.push_back(task.m_counter);
+                }
+                m_numDependentTasks -= static_cast<u32>(m_dependentTasks.size());
+                m_dependentTasks.clear();
+            }
+            
+            for (auto counter : discardedCounters)
+            {
+                CompleteTask(counter);
+            }
         }
         //----------------------------------------------
         //----------------------------------------------
         void ThreadPool::DoTaskOrWait()
         {
+            //wait for the constructor to finish creating threads.
+            {
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+            }
+            
 			while (m_isFinished == false)
 			{
-				GenericTaskType task;
-				if (m_tasks.pop_or_wait(task) == true)
+				if (TryExecuteTask() == false)
 				{
-					task();
+                    //yield for a short while before sleeping, as tasks are often scheduled in quick succession and
+                    //waking a sleeping worker for each of them costs far more than the tasks themselves.
+                    u32 numYields = 0;
+                    while (m_numQueuedTasks == 0 && m_isFinished == false && numYields++ < k_numYieldsBeforeSleep)
+                    {
+                        std::this_thread::yield();
+                    }
+                    
+                    if (m_numQueuedTasks > 0)
+                    {
+                        continue;
+                    }
+                    
+                    std::unique_lock<std::mutex> lock(m_sleepMutex);
+                    ++m_numSleepingThreads;
+                    m_sleepCondition.wait(lock, [this]() { return (m_numQueuedTasks > 0 || m_isFinished == true); });
+                    --m_numSleepingThreads;
 				}
             }
         }
         //----------------------------------------------
         //----------------------------------------------
+        void ThreadPool::Push(QueuedTask in_task)
+        {
+            s32 workerIndex = GetWorkerIndex();
+            u32 queueIndex = (workerIndex >= 0) ? static_cast<u32>(workerIndex) : (m_nextWorkerQueue++ % static_cast<u32>(m_workerQueues.size()));
+            
+            ++m_numQueuedTasks;
+            
+            {
+                WorkerQueue& workerQueue = *m_workerQueues[queueIndex];
+                std::unique_lock<std::mutex> lock(workerQueue.m_mutex);
+                workerQueue.m_tasks.push_back(std::move(in_task));
+            }
+            
+            if (m_numSleepingThreads > 0)
+            {
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_sleepCondition.notify_one();
+            }
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        bool ThreadPool::TryPop(QueuedTask& out_task)
+        {
+            if (m_numQueuedTasks == 0)
+            {
+                return false;
+            }
+            
+            u32 numQueues = static_cast<u32>(m_workerQueues.size());
+            s32 workerIndex = GetWorkerIndex();
+            
+            //take the most recent task from this worker's own queue, as it is the most likely to still be in the cache.
+            if (workerIndex >= 0)
+            {
+                WorkerQueue& workerQueue = *m_workerQueues[workerIndex];
+                std::unique_lock<std::mutex> lock(workerQueue.m_mutex);
+                if (workerQueue.m_tasks.empty() == false)
+                {
+                    out_task = std::move(workerQueue.m_tasks.back());
+                    workerQueue.m_tasks.pop_back();
+                    --m_numQueuedTasks;
+                    return true;
+                }
+            }
+            
+            //otherwise steal the oldest task from another queue.
+            u32 startIndex = (workerIndex >= 0) ? static_cast<u32>(workerIndex) + 1 : m_nextWorkerQueue.load();
+            for (u32 i = 0; i < numQueues; ++i)
+            {
+                u32 queueIndex = (startIndex + i) % numQueues;
+                if (static_cast<s32>(queueIndex) == workerIndex)
+                {
+                    continue;
+                }
+                
+                WorkerQueue& workerQueue = *m_workerQueues[queueIndex];
+                std::unique_lock<std::mutex> lock(workerQueue.m_mutex);
+                if (workerQueue.m_tasks.empty() == false)
+                {
+                    out_task = std::move(workerQueue.m_tasks.front());
+                    workerQueue.m_tasks.pop_front();
+                    --m_numQueuedTasks;
+                    return true;
+                }
+            }
+            
+            return false;
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        bool ThreadPool::TryPop(const std::vector<const TaskCounter*>& in_counters, QueuedTask& out_task)
+        {
+            if (m_numQueuedTasks == 0)
+            {
+                return false;
+            }
+            
+            for (auto& workerQueue : m_workerQueues)
+            {
+                std::unique_lock<std::mutex> lock(workerQueue->m_mutex);
+                for (auto it = workerQueue->m_tasks.begin(); it != workerQueue->m_tasks.end(); ++it)
+                {
+                    if (std::find(in_counters.begin(), in_counters.end(), it->m_counter) != in_counters.end())
+                    {
+                        out_task = std::move(*it);
+                        workerQueue->m_tasks.erase(it);
+                        --m_numQueuedTasks;
+                        return true;
+                    }
+                }
+            }
+            
+            return false;
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::AddDependencies(std::vector<const TaskCounter*>& inout_counters)
+        {
+            std::unique_lock<std::mutex> lock(m_dependentTasksMutex);
+            
+            //dependencies can be chained through other held tasks, so keep looking until no new groups are found.
+            bool added = true;
+            while (added == true)
+            {
+                added = false;
+                for (const auto& task : m_dependentTasks)
+                {
+                    if (std::find(inout_counters.begin(), inout_counters.end(), task.m_counter) != inout_counters.end() &&
+                        std::find(inout_counters.begin(), inout_counters.end(), task.m_dependency) == inout_counters.end())
+                    {
+                        inout_counters.push_back(task.m_dependency);
+                        added = true;
+                    }
+                }
+            }
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::Execute(QueuedTask& in_task)
+        {
+            in_task.m_task();
+            
+            //destroy the callable before the counter is updated so anything it captured is released before waiting threads resume.
+            in_task.m_task = Task();
+            
+            CompleteTask(in_task.m_counter);
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::CompleteTask(TaskCounter* in_counter)
+        {
+            if (in_counter != nullptr && --in_counter->m_numPendingTasks == 0 && m_numDependentTasks > 0)
+            {
+                ReleaseDependentTasks();
+            }
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::ReleaseDependentTasks()
+        {
+            std::vector<QueuedTask> releasedTasks;
+            
+            {
+                std::unique_lock<std::mutex> lock(m_dependentTasksMutex);
+                for (auto it = m_dependentTasks.begin(); it != m_dependentTasks.end();)
+                {
+                    if (it->m_dependency->IsComplete() == true)
+                    {
+                        it->m_dependency = nullptr;
+                        releasedTasks.push_back(std::move(*it));
+                        it = m_dependentTasks.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                m_numDependentTasks -= static_cast<u32>(releasedTasks.size());
+            }
+            
+            for (auto& task : releasedTasks)
+            {
+                Push(std::move(task));
+            }
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        s32 ThreadPool::GetWorkerIndex() const
+        {
+            std::thread::id threadId = std::this_thread::get_id();
+            for (u32 i = 0; i < m_threadIds.size(); ++i)
+            {
+                if (m_threadIds[i] == threadId)
+                {
+                    return static_cast<s32>(i);
+                }
+            }
+            
+            return -1;
+        }
+        //----------------------------------------------
+        //----------------------------------------------
         ThreadPool::~ThreadPool()
         {
-			m_isFinished = true;
-			m_tasks.abort();
+            {
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_isFinished = true;
+                m_sleepCondition.notify_all();
+            }
             
             //join all threads.
             for (u32 i=0; i<m_threadGroup.size(); ++i)
             {
                 m_threadGroup[i].join();
             }
+            
+            //any tasks which never ran are discarded so their counters are left complete.
+            ClearQueuedTasks();
         }
     }
-}
\ No newline at end of file
+}
@@ -30,9 +30,14 @@
 #define _CHILLISOURCE_CORE_THREADING_THREADPOOL_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Container/concurrent_blocking_queue.h>
+#include <ChilliSource/Core/Threading/Task.h>
+#include <ChilliSource/Core/Threading/TaskCounter.h>
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -40,12 +45,27 @@ namespace ChilliSource
 {
     namespace Core
     {
+        //------------------------------------------------
+        /// A work stealing thread pool. Each worker has
+        /// its own queue of tasks: tasks scheduled from
+        /// a worker are added to its own queue and taken
+        /// back in last-in first-out order, while tasks
+        /// scheduled from other threads are distributed
+        /// between the workers. Workers with no tasks of
+        /// their own steal the oldest tasks from the
+        /// other workers.
+        ///
+        /// Tasks can be grouped with a task counter which
+        /// can be waited on, or used as a dependency which
+        /// must complete before another task will run.
+        ///
+        /// @author Scott Downie
+        //------------------------------------------------
         class ThreadPool
         {
         public:
+            CS_DECLARE_NOCOPY(ThreadPool);
 
-            typedef std::function<void()> GenericTaskType;
-            
             //------------------------------------------------
             /// Constructor
             ///
@@ -62,7 +82,59 @@ namespace ChilliSource
             ///
             /// @param Task to execute.
             //----------------------------------------------
-            void Schedule(const GenericTaskType& in_task);
+            void Schedule(Task in_task);
+            //----------------------------------------------
+            /// Add a task to the queue to be serviced when
+            /// a thread becomes available. The counter is
+            /// incremented now and decremented when the
+            /// task completes.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Task to execute.
+            /// @param The counter for the task's group.
+            //----------------------------------------------
+            void Schedule(Task in_task, TaskCounter& in_counter);
+            //----------------------------------------------
+            /// Add a task to be serviced once all tasks
+            /// tracked by the dependency have completed.
+            /// The counter is incremented now and
+            /// decremented when the task completes.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Task to execute.
+            /// @param The counter for the task's group.
+            /// @param The counter which must be complete
+            /// before the task is queued. This must remain
+            /// valid until the task has been queued.
+            //----------------------------------------------
+            void Schedule(Task in_task, TaskCounter& in_counter, const TaskCounter& in_dependency);
+            //----------------------------------------------
+            /// Blocks until all tasks tracked by the counter
+            /// have completed. While waiting, the calling
+            /// thread executes any queued tasks of the
+            /// counter, or of the groups its held tasks
+            /// depend on, so the wait can't stall when every
+            /// worker is itself waiting. Unrelated tasks are
+            /// never executed, so waiting can't be held up
+            /// by unrelated work. This can safely be called
+            /// from within a task.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The counter to wait on.
+            //----------------------------------------------
+            void Wait(const TaskCounter& in_counter);
+            //----------------------------------------------
+            /// Executes a single queued task on the calling
+            /// thread, if there is one.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not a task was executed.
+            //----------------------------------------------
+            bool TryExecuteTask();
             //----------------------------------------------
             /// @author Scott Downie
             ///
@@ -70,7 +142,15 @@ namespace ChilliSource
             //----------------------------------------------
             u32 GetNumQueuedTasks() const;
             //----------------------------------------------
-            /// Discard all pending tasks from the queue
+            /// @author Jordan Brown
+            ///
+            /// @return Num threads in the pool
+            //----------------------------------------------
+            u32 GetNumThreads() const;
+            //----------------------------------------------
+            /// Discard all pending tasks from the queue.
+            /// The counters of discarded tasks are updated
+            /// as if they had completed.
             ///
             /// @author Scott Downie
             //----------------------------------------------
@@ -80,22 +160,139 @@ namespace ChilliSource
             //----------------------------------------------
             ~ThreadPool();
         private:
+            //----------------------------------------------
+            /// A task along with the counter to decrement
+            /// when it completes. Tasks which are held
+            /// until another group completes also store
+            /// their dependency.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------
+            struct QueuedTask
+            {
+                QueuedTask();
+                QueuedTask(Task in_task, TaskCounter* in_counter, const TaskCounter* in_dependency);
+                QueuedTask(QueuedTask&& in_toMove);
+                QueuedTask& operator=(QueuedTask&& in_toMove);
 
+                Task m_task;
+                TaskCounter* m_counter;
+                const TaskCounter* m_dependency;
+            };
+            //----------------------------------------------
+            /// The task queue owned by a single worker.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------
+            struct WorkerQueue
+            {
+                std::mutex m_mutex;
+                std::deque<QueuedTask> m_tasks;
+            };
             //----------------------------------------------
             /// Continues to perform tasks until there are
             /// none left to perform at which point this
-            /// will sleep until there are new tasks.
-            /// @return The task.
+            /// will briefly yield, then sleep until there
+            /// are new tasks.
+            ///
+            /// @author Scott Downie
             //----------------------------------------------
             void DoTaskOrWait();
+            //----------------------------------------------
+            /// Adds the task to the queue of the calling
+            /// worker, or to the next worker in turn if
+            /// called from another thread, and wakes a
+            /// sleeping worker.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The task.
+            //----------------------------------------------
+            void Push(QueuedTask in_task);
+            //----------------------------------------------
+            /// Takes the newest task from the calling
+            /// worker's queue, otherwise steals the oldest
+            /// task from another worker.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [Out] The task.
+            ///
+            /// @return Whether or not a task was found.
+            //----------------------------------------------
+            bool TryPop(QueuedTask& out_task);
+            //----------------------------------------------
+            /// Takes the oldest queued task tracked by any
+            /// of the given counters from any queue.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The counters.
+            /// @param [Out] The task.
+            ///
+            /// @return Whether or not a task was found.
+            //----------------------------------------------
+            bool TryPop(const std::vector<const TaskCounter*>& in_counters, QueuedTask& out_task);
+            //----------------------------------------------
+            /// Adds the counters of every group which the
+            /// held tasks of the given counters depend on,
+            /// directly or through other held tasks.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [In/Out] The counters. Dependencies
+            /// not already in the list are appended.
+            //----------------------------------------------
+            void AddDependencies(std::vector<const TaskCounter*>& inout_counters);
+            //----------------------------------------------
+            /// Executes the task, updating its counter and
+            /// queuing any dependent tasks which are now
+            /// free to run.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The task.
+            //----------------------------------------------
+            void Execute(QueuedTask& in_task);
+            //----------------------------------------------
+            /// Decrements the counter of a completed or
+            /// discarded task.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The counter. Can be null.
+            //----------------------------------------------
+            void CompleteTask(TaskCounter* in_counter);
+            //----------------------------------------------
+            /// Queues any dependent tasks whose dependency
+            /// has completed.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------
+            void ReleaseDependentTasks();
+            //----------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The index of the calling worker or
+            /// -1 if not called from a worker.
+            //----------------------------------------------
+            s32 GetWorkerIndex() const;
+
+            std::vector<std::thread> m_threadGroup;
+            std::vector<std::thread::id> m_threadIds;
+            std::vector<std::unique_ptr<WorkerQueue>> m_workerQueues;
+
+            std::atomic<u32> m_numQueuedTasks;
+            std::atomic<u32> m_nextWorkerQueue;
 
-			using ThreadGroup = std::vector<std::thread>;
-			using TaskQueue = concurrent_blocking_queue<GenericTaskType>;
+            std::mutex m_sleepMutex;
+            std::condition_variable m_sleepCondition;
+            std::atomic<u32> m_numSleepingThreads;
 
+            std::mutex m_dependentTasksMutex;
+            std::vector<QueuedTask> m_dependentTasks;
+            std::atomic<u32> m_numDependentTasks;
 
-            ThreadGroup m_threadGroup;
-			TaskQueue m_tasks;
-            
             std::atomic<bool> m_isFinished;
         };
     }
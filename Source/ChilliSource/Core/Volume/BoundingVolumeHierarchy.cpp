@@ -0,0 +1,660 @@
+//
+//  BoundingVolumeHierarchy.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
+
+#include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
+#include <ChilliSource/Core/Volume/VolumeComponent.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_maxStackSize = 256;
+            const u32 k_maxBatchSize = 32;
+            const f32 k_fatMarginScale = 0.1f;
+            const f32 k_minFatMargin = 0.01f;
+
+            //-----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Box min
+            /// @param Box max
+            ///
+            /// @return The surface area of the box.
+            //-----------------------------------------------------------------------------
+            f32 CalcSurfaceArea(const Vector3& in_min, const Vector3& in_max)
+            {
+                Vector3 size = in_max - in_min;
+                return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+            }
+            //-----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The frustum
+            /// @param Box min
+            /// @param Box max
+            ///
+            /// @return Whether or not the box is at least partially inside the frustum.
+            //-----------------------------------------------------------------------------
+            bool FrustumOverlapsBox(const Frustum& in_frustum, const Vector3& in_min, const Vector3& in_max)
+            {
+                const Plane* planes[] = { &in_frustum.mLeftClipPlane, &in_frustum.mRightClipPlane, &in_frustum.mTopClipPlane,
+                    &in_frustum.mBottomClipPlane, &in_frustum.mNearClipPlane, &in_frustum.mFarClipPlane };
+
+                for (u32 i = 0; i < 6; ++i)
+                {
+                    //Test the corner furthest along the plane normal; if it is outside then the whole box is.
+                    const Vector3& normal = planes[i]->mvNormal;
+                    Vector3 positiveVertex((normal.x >= 0.0f) ? in_max.x : in_min.x, (normal.y >= 0.0f) ? in_max.y : in_min.y, (normal.z >= 0.0f) ? in_max.z : in_min.z);
+                    if (Vector3::DotProduct(positiveVertex, normal) + planes[i]->mfD < 0.0f)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+            //-----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The sphere
+            /// @param Box min
+            /// @param Box max
+            ///
+            /// @return Whether or not the sphere and box intersect.
+            //-----------------------------------------------------------------------------
+            bool SphereOverlapsBox(const Sphere& in_sphere, const Vector3& in_min, const Vector3& in_max)
+            {
+                Vector3 closest = Vector3::Clamp(in_sphere.vOrigin, in_min, in_max);
+                return (closest - in_sphere.vOrigin).LengthSquared() <= in_sphere.fRadius * in_sphere.fRadius;
+            }
+            //-----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The frustum
+            /// @param The bounding sphere of a leaf
+            ///
+            /// @return Whether or not the sphere is at least partially inside the frustum.
+            //-----------------------------------------------------------------------------
+            bool FrustumOverlapsSphere(const Frustum& in_frustum, const Sphere& in_sphere)
+            {
+                return in_frustum.SphereCullTest(in_sphere);
+            }
+            //-----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The sphere
+            /// @param The bounding sphere of a leaf
+            ///
+            /// @return Whether or not the spheres intersect.
+            //-----------------------------------------------------------------------------
+            bool SphereOverlapsSphere(const Sphere& in_sphere, const Sphere& in_leafSphere)
+            {
+                return ShapeIntersection::Intersects(in_sphere, in_leafSphere);
+            }
+            //-----------------------------------------------------------------------------
+            /// Rays are only tested against leaf boxes, as a ray query is typically
+            /// followed by a precise test against the OOBB.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The ray
+            /// @param The bounding sphere of a leaf
+            ///
+            /// @return Always true.
+            //-----------------------------------------------------------------------------
+            bool RayOverlapsSphere(const Ray& in_ray, const Sphere& in_leafSphere)
+            {
+                return true;
+            }
+            //-----------------------------------------------------------------------------
+            /// Uses the same slab test as ShapeIntersection so that the results are
+            /// consistent with a ray test against an AABB.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The ray
+            /// @param Box min
+            /// @param Box max
+            ///
+            /// @return Whether or not the ray intersects the box.
+            //-----------------------------------------------------------------------------
+            bool RayOverlapsBox(const Ray& in_ray, const Vector3& in_min, const Vector3& in_max)
+            {
+                f32 t2 = std::numeric_limits<f32>::infinity();
+                f32 t1 = -t2;
+                Vector3 direction = in_ray.vDirection * in_ray.fLength;
+
+                return ShapeIntersection::RaySlabIntersect(in_ray.vOrigin.x, direction.x, in_min.x, in_max.x, t1, t2) &&
+                    ShapeIntersection::RaySlabIntersect(in_ray.vOrigin.y, direction.y, in_min.y, in_max.y, t1, t2) &&
+                    ShapeIntersection::RaySlabIntersect(in_ray.vOrigin.z, direction.z, in_min.z, in_max.z, t1, t2);
+            }
+        }
+
+        const u32 BoundingVolumeHierarchy::k_nullProxy = std::numeric_limits<u32>::max();
+
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+        {
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        u32 BoundingVolumeHierarchy::Add(VolumeComponent* in_volume)
+        {
+            CS_ASSERT(in_volume != nullptr, "Cannot add a null volume to the hierarchy.");
+
+            u32 proxyId = AllocateNode();
+            Node& node = m_nodes[proxyId];
+            node.m_volume = in_volume;
+            node.m_height = 0;
+            node.m_inTree = false;
+            node.m_dirty = true;
+            m_dirtyProxies.push_back(proxyId);
+
+            ++m_numVolumes;
+            return proxyId;
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::Remove(u32 in_proxyId)
+        {
+            CS_ASSERT(in_proxyId < m_nodes.size() && m_nodes[in_proxyId].m_volume != nullptr, "Invalid proxy id.");
+
+            if (m_nodes[in_proxyId].m_inTree == true)
+            {
+                RemoveLeaf(in_proxyId);
+            }
+
+            FreeNode(in_proxyId);
+            --m_numVolumes;
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::Invalidate(u32 in_proxyId)
+        {
+            CS_ASSERT(in_proxyId < m_nodes.size() && m_nodes[in_proxyId].m_volume != nullptr, "Invalid proxy id.");
+
+            Node& node = m_nodes[in_proxyId];
+            if (node.m_dirty == false)
+            {
+                node.m_dirty = true;
+                m_dirtyProxies.push_back(in_proxyId);
+            }
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::Update()
+        {
+            for (u32 i = 0; i < m_dirtyProxies.size(); ++i)
+            {
+                u32 proxyId = m_dirtyProxies[i];
+
+                //Proxies may have been removed, or removed and re-added, since being flagged.
+                if (m_nodes[proxyId].m_dirty == false || m_nodes[proxyId].m_volume == nullptr)
+                {
+                    continue;
+                }
+                m_nodes[proxyId].m_dirty = false;
+
+                const Sphere& sphere = m_nodes[proxyId].m_volume->GetBoundingSphere();
+                m_nodes[proxyId].m_sphere = sphere;
+                Vector3 extents(sphere.fRadius, sphere.fRadius, sphere.fRadius);
+                Vector3 min = sphere.vOrigin - extents;
+                Vector3 max = sphere.vOrigin + extents;
+
+                if (m_nodes[proxyId].m_inTree == true)
+                {
+                    const Node& node = m_nodes[proxyId];
+                    if (node.m_min.x <= min.x && node.m_min.y <= min.y && node.m_min.z <= min.z &&
+                        node.m_max.x >= max.x && node.m_max.y >= max.y && node.m_max.z >= max.z)
+                    {
+                        continue;
+                    }
+
+                    RemoveLeaf(proxyId);
+                }
+
+                f32 margin = std::max(sphere.fRadius * k_fatMarginScale, k_minFatMargin);
+                Vector3 marginExtents(margin, margin, margin);
+
+                Node& node = m_nodes[proxyId];
+                node.m_min = min - marginExtents;
+                node.m_max = max + marginExtents;
+                node.m_inTree = true;
+
+                InsertLeaf(proxyId);
+            }
+
+            m_dirtyProxies.clear();
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        u32 BoundingVolumeHierarchy::GetNumVolumes() const
+        {
+            return m_numVolumes;
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::QueryFrustum(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumes) const
+        {
+            Query([&in_frustum](const Vector3& in_min, const Vector3& in_max)
+            {
+                return FrustumOverlapsBox(in_frustum, in_min, in_max);
+            }, [&in_frustum](const Sphere& in_leafSphere)
+            {
+                return FrustumOverlapsSphere(in_frustum, in_leafSphere);
+            }, out_volumes);
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::QuerySphere(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumes) const
+        {
+            Query([&in_sphere](const Vector3& in_min, const Vector3& in_max)
+            {
+                return SphereOverlapsBox(in_sphere, in_min, in_max);
+            }, [&in_sphere](const Sphere& in_leafSphere)
+            {
+                return SphereOverlapsSphere(in_sphere, in_leafSphere);
+            }, out_volumes);
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::QueryRay(const Ray& in_ray, std::vector<VolumeComponent*>& out_volumes) const
+        {
+            Query([&in_ray](const Vector3& in_min, const Vector3& in_max)
+            {
+                return RayOverlapsBox(in_ray, in_min, in_max);
+            }, [&in_ray](const Sphere& in_leafSphere)
+            {
+                return RayOverlapsSphere(in_ray, in_leafSphere);
+            }, out_volumes);
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::QueryFrustums(const std::vector<Frustum>& in_frustums, std::vector<std::vector<VolumeComponent*>>& out_volumes) const
+        {
+            BatchQuery(in_frustums, FrustumOverlapsBox, FrustumOverlapsSphere, out_volumes);
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::QuerySpheres(const std::vector<Sphere>& in_spheres, std::vector<std::vector<VolumeComponent*>>& out_volumes) const
+        {
+            BatchQuery(in_spheres, SphereOverlapsBox, SphereOverlapsSphere, out_volumes);
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::QueryRays(const std::vector<Ray>& in_rays, std::vector<std::vector<VolumeComponent*>>& out_volumes) const
+        {
+            BatchQuery(in_rays, RayOverlapsBox, RayOverlapsSphere, out_volumes);
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        template <typename TOverlapFunc, typename TLeafFunc> void BoundingVolumeHierarchy::Query(TOverlapFunc in_overlapFunc, TLeafFunc in_leafFunc, std::vector<VolumeComponent*>& out_volumes) const
+        {
+            if (m_root == k_nullProxy)
+            {
+                return;
+            }
+
+            u32 stack[k_maxStackSize];
+            u32 stackSize = 0;
+            stack[stackSize++] = m_root;
+
+            while (stackSize > 0)
+            {
+                const Node& node = m_nodes[stack[--stackSize]];
+                if (in_overlapFunc(node.m_min, node.m_max) == false)
+                {
+                    continue;
+                }
+
+                if (node.m_child1 == k_nullProxy)
+                {
+                    if (in_leafFunc(node.m_sphere) == true)
+                    {
+                        out_volumes.push_back(node.m_volume);
+                    }
+                }
+                else
+                {
+                    CS_ASSERT(stackSize + 2 <= k_maxStackSize, "Bounding volume hierarchy query stack overflow.");
+                    stack[stackSize++] = node.m_child1;
+                    stack[stackSize++] = node.m_child2;
+                }
+            }
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        template <typename TShapeType, typename TOverlapFunc, typename TLeafFunc> void BoundingVolumeHierarchy::BatchQuery(const std::vector<TShapeType>& in_shapes, TOverlapFunc in_overlapFunc, TLeafFunc in_leafFunc, std::vector<std::vector<VolumeComponent*>>& out_volumes) const
+        {
+            out_volumes.resize(in_shapes.size());
+
+            if (m_root == k_nullProxy)
+            {
+                return;
+            }
+
+            for (u32 batchStart = 0; batchStart < in_shapes.size(); batchStart += k_maxBatchSize)
+            {
+                u32 batchSize = std::min(static_cast<u32>(in_shapes.size()) - batchStart, k_maxBatchSize);
+
+                u32 nodeStack[k_maxStackSize];
+                u32 maskStack[k_maxStackSize];
+                u32 stackSize = 0;
+                nodeStack[stackSize] = m_root;
+                maskStack[stackSize++] = (batchSize == 32) ? 0xffffffff : ((1u << batchSize) - 1);
+
+                while (stackSize > 0)
+                {
+                    --stackSize;
+                    const Node& node = m_nodes[nodeStack[stackSize]];
+                    u32 parentMask = maskStack[stackSize];
+
+                    u32 mask = 0;
+                    for (u32 i = 0; i < batchSize; ++i)
+                    {
+                        if ((parentMask & (1u << i)) != 0 && in_overlapFunc(in_shapes[batchStart + i], node.m_min, node.m_max) == true)
+                        {
+                            mask |= (1u << i);
+                        }
+                    }
+
+                    if (mask == 0)
+                    {
+                        continue;
+                    }
+
+                    if (node.m_child1 == k_nullProxy)
+                    {
+                        for (u32 i = 0; i < batchSize; ++i)
+                        {
+                            if ((mask & (1u << i)) != 0 && in_leafFunc(in_shapes[batchStart + i], node.m_sphere) == true)
+                            {
+                                out_volumes[batchStart + i].push_back(node.m_volume);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        CS_ASSERT(stackSize + 2 <= k_maxStackSize, "Bounding volume hierarchy query stack overflow.");
+                        nodeStack[stackSize] = node.m_child1;
+                        maskStack[stackSize++] = mask;
+                        nodeStack[stackSize] = node.m_child2;
+                        maskStack[stackSize++] = mask;
+                    }
+                }
+            }
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        u32 BoundingVolumeHierarchy::AllocateNode()
+        {
+            if (m_freeList == k_nullProxy)
+            {
+                m_nodes.push_back(Node());
+                return static_cast<u32>(m_nodes.size() - 1);
+            }
+
+            u32 nodeId = m_freeList;
+            m_freeList = m_nodes[nodeId].m_parent;
+            m_nodes[nodeId] = Node();
+            return nodeId;
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::FreeNode(u32 in_nodeId)
+        {
+            Node& node = m_nodes[in_nodeId];
+            node = Node();
+            node.m_parent = m_freeList;
+            m_freeList = in_nodeId;
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::InsertLeaf(u32 in_leafId)
+        {
+            if (m_root == k_nullProxy)
+            {
+                m_root = in_leafId;
+                m_nodes[m_root].m_parent = k_nullProxy;
+                return;
+            }
+
+            //Find the best sibling by descending the tree, stopping when creating a new parent
+            //here is cheaper than pushing the leaf further down.
+            Vector3 leafMin = m_nodes[in_leafId].m_min;
+            Vector3 leafMax = m_nodes[in_leafId].m_max;
+            u32 index = m_root;
+            while (m_nodes[index].m_child1 != k_nullProxy)
+            {
+                const Node& node = m_nodes[index];
+                f32 area = CalcSurfaceArea(node.m_min, node.m_max);
+                f32 combinedArea = CalcSurfaceArea(Vector3::Min(node.m_min, leafMin), Vector3::Max(node.m_max, leafMax));
+
+                f32 cost = 2.0f * combinedArea;
+                f32 inheritanceCost = 2.0f * (combinedArea - area);
+
+                f32 childCosts[2];
+                u32 children[2] = { node.m_child1, node.m_child2 };
+                for (u32 i = 0; i < 2; ++i)
+                {
+                    const Node& child = m_nodes[children[i]];
+                    f32 childCombinedArea = CalcSurfaceArea(Vector3::Min(child.m_min, leafMin), Vector3::Max(child.m_max, leafMax));
+                    if (child.m_child1 == k_nullProxy)
+                    {
+                        childCosts[i] = childCombinedArea + inheritanceCost;
+                    }
+                    else
+                    {
+                        childCosts[i] = (childCombinedArea - CalcSurfaceArea(child.m_min, child.m_max)) + inheritanceCost;
+                    }
+                }
+
+                if (cost < childCosts[0] && cost < childCosts[1])
+                {
+                    break;
+                }
+
+                index = (childCosts[0] < childCosts[1]) ? children[0] : children[1];
+            }
+
+            u32 sibling = index;
+            u32 oldParent = m_nodes[sibling].m_parent;
+            u32 newParent = AllocateNode();
+
+            Node& parentNode = m_nodes[newParent];
+            parentNode.m_parent = oldParent;
+            parentNode.m_min = Vector3::Min(leafMin, m_nodes[sibling].m_min);
+            parentNode.m_max = Vector3::Max(leafMax, m_nodes[sibling].m_max);
+            parentNode.m_height = m_nodes[sibling].m_height + 1;
+            parentNode.m_child1 = sibling;
+            parentNode.m_child2 = in_leafId;
+
+            if (oldParent != k_nullProxy)
+            {
+                if (m_nodes[oldParent].m_child1 == sibling)
+                {
+                    m_nodes[oldParent].m_child1 = newParent;
+                }
+                else
+                {
+                    m_nodes[oldParent].m_child2 = newParent;
+                }
+            }
+            else
+            {
+                m_root = newParent;
+            }
+
+            m_nodes[sibling].m_parent = newParent;
+            m_nodes[in_leafId].m_parent = newParent;
+
+            RefitAncestors(newParent);
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::RemoveLeaf(u32 in_leafId)
+        {
+            if (in_leafId == m_root)
+            {
+                m_root = k_nullProxy;
+                return;
+            }
+
+            u32 parent = m_nodes[in_leafId].m_parent;
+            u32 grandParent = m_nodes[parent].m_parent;
+            u32 sibling = (m_nodes[parent].m_child1 == in_leafId) ? m_nodes[parent].m_child2 : m_nodes[parent].m_child1;
+
+            if (grandParent != k_nullProxy)
+            {
+                if (m_nodes[grandParent].m_child1 == parent)
+                {
+                    m_nodes[grandParent].m_child1 = sibling;
+                }
+                else
+                {
+                    m_nodes[grandParent].m_child2 = sibling;
+                }
+                m_nodes[sibling].m_parent = grandParent;
+                FreeNode(parent);
+
+                RefitAncestors(grandParent);
+            }
+            else
+            {
+                m_root = sibling;
+                m_nodes[sibling].m_parent = k_nullProxy;
+                FreeNode(parent);
+            }
+
+            m_nodes[in_leafId].m_parent = k_nullProxy;
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::RefitAncestors(u32 in_nodeId)
+        {
+            u32 index = in_nodeId;
+            while (index != k_nullProxy)
+            {
+                index = Balance(index);
+                Refit(index);
+                index = m_nodes[index].m_parent;
+            }
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        void BoundingVolumeHierarchy::Refit(u32 in_nodeId)
+        {
+            Node& node = m_nodes[in_nodeId];
+            const Node& child1 = m_nodes[node.m_child1];
+            const Node& child2 = m_nodes[node.m_child2];
+
+            node.m_height = 1 + std::max(child1.m_height, child2.m_height);
+            node.m_min = Vector3::Min(child1.m_min, child2.m_min);
+            node.m_max = Vector3::Max(child1.m_max, child2.m_max);
+        }
+        //-----------------------------------------------------------------------------
+        //-----------------------------------------------------------------------------
+        u32 BoundingVolumeHierarchy::Balance(u32 in_nodeId)
+        {
+            u32 iA = in_nodeId;
+            if (m_nodes[iA].m_child1 == k_nullProxy || m_nodes[iA].m_height < 2)
+            {
+                return iA;
+            }
+
+            u32 iB = m_nodes[iA].m_child1;
+            u32 iC = m_nodes[iA].m_child2;
+            s32 balance = m_nodes[iC].m_height - m_nodes[iB].m_height;
+
+            //Rotate either the child with the larger height (B or C) up to replace A, with A
+            //taking the shorter of the grandchildren.
+            if (balance > 1 || balance < -1)
+            {
+                u32 iUp = (balance > 1) ? iC : iB;
+                u32 iOther = (balance > 1) ? iB : iC;
+                u32 iF = m_nodes[iUp].m_child1;
+                u32 iG = m_nodes[iUp].m_child2;
+
+                m_nodes[iUp].m_child1 = iA;
+                m_nodes[iUp].m_parent = m_nodes[iA].m_parent;
+                m_nodes[iA].m_parent = iUp;
+
+                u32 upParent = m_nodes[iUp].m_parent;
+                if (upParent != k_nullProxy)
+                {
+                    if (m_nodes[upParent].m_child1 == iA)
+                    {
+                        m_nodes[upParent].m_child1 = iUp;
+                    }
+                    else
+                    {
+                        m_nodes[upParent].m_child2 = iUp;
+                    }
+                }
+                else
+                {
+                    m_root = iUp;
+                }
+
+                u32 iTall = (m_nodes[iF].m_height > m_nodes[iG].m_height) ? iF : iG;
+                u32 iShort = (iTall == iF) ? iG : iF;
+
+                m_nodes[iUp].m_child2 = iTall;
+                if (balance > 1)
+                {
+                    m_nodes[iA].m_child2 = iShort;
+                }
+                else
+                {
+                    m_nodes[iA].m_child1 = iShort;
+                }
+                m_nodes[iShort].m_parent = iA;
+
+                m_nodes[iA].m_min = Vector3::Min(m_nodes[iOther].m_min, m_nodes[iShort].m_min);
+                m_nodes[iA].m_max = Vector3::Max(m_nodes[iOther].m_max, m_nodes[iShort].m_max);
+                m_nodes[iA].m_height = 1 + std::max(m_nodes[iOther].m_height, m_nodes[iShort].m_height);
+
+                m_nodes[iUp].m_min = Vector3::Min(m_nodes[iA].m_min, m_nodes[iTall].m_min);
+                m_nodes[iUp].m_max = Vector3::Max(m_nodes[iA].m_max, m_nodes[iTall].m_max);
+                m_nodes[iUp].m_height = 1 + std::max(m_nodes[iA].m_height, m_nodes[iTall].m_height);
+
+                return iUp;
+            }
+
+            return iA;
+        }
+    }
+}
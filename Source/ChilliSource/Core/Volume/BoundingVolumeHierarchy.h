@@ -0,0 +1,290 @@
+//
+//  BoundingVolumeHierarchy.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_VOLUME_BOUNDINGVOLUMEHIERARCHY_H_
+#define _CHILLISOURCE_CORE_VOLUME_BOUNDINGVOLUMEHIERARCHY_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //-----------------------------------------------------------------------------
+        /// A dynamic bounding volume hierarchy of volume components, used to speed up
+        /// spatial queries such as frustum culling and ray casts. Each volume is stored
+        /// in a leaf with a slightly enlarged ("fat") box around its bounding sphere,
+        /// so that small movements don't require the tree to be restructured. The tree
+        /// is kept height balanced using rotations as volumes are inserted and removed.
+        ///
+        /// Volumes are not read when they are added or invalidated; instead they are
+        /// flagged and their bounds are refreshed on the next call to Update(). This
+        /// allows the many transform changes that occur during a frame to be coalesced.
+        ///
+        /// Frustum and sphere queries test leaves against the bounding sphere read on
+        /// the last Update(), so the results match a direct test against the bounding
+        /// sphere of each volume. Ray queries return every volume whose fat box is hit;
+        /// callers should perform any precise tests on the results themselves.
+        ///
+        /// This is not thread-safe, though queries are const and can be performed
+        /// concurrently once Update() has been called.
+        ///
+        /// @author Jordan Brown
+        //-----------------------------------------------------------------------------
+        class BoundingVolumeHierarchy final
+        {
+        public:
+            CS_DECLARE_NOCOPY(BoundingVolumeHierarchy);
+
+            static const u32 k_nullProxy;
+            //-----------------------------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Jordan Brown
+            //-----------------------------------------------------------------------------
+            BoundingVolumeHierarchy();
+            //-----------------------------------------------------------------------------
+            /// Adds a volume to the hierarchy. The volume will be inserted into the tree
+            /// on the next Update().
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The volume component.
+            ///
+            /// @return The proxy id that should be used to refer to the volume from now on.
+            //-----------------------------------------------------------------------------
+            u32 Add(VolumeComponent* in_volume);
+            //-----------------------------------------------------------------------------
+            /// Removes a volume from the hierarchy.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The proxy id returned when the volume was added.
+            //-----------------------------------------------------------------------------
+            void Remove(u32 in_proxyId);
+            //-----------------------------------------------------------------------------
+            /// Flags a volume as having changed. Its bounds will be re-read on the next
+            /// Update().
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The proxy id returned when the volume was added.
+            //-----------------------------------------------------------------------------
+            void Invalidate(u32 in_proxyId);
+            //-----------------------------------------------------------------------------
+            /// Refreshes the bounds of all volumes that have been added or invalidated
+            /// since the last update, re-inserting any which have moved outside of their
+            /// fat box.
+            ///
+            /// @author Jordan Brown
+            //-----------------------------------------------------------------------------
+            void Update();
+            //-----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The number of volumes in the hierarchy.
+            //-----------------------------------------------------------------------------
+            u32 GetNumVolumes() const;
+            //-----------------------------------------------------------------------------
+            /// Appends all volumes whose bounding sphere is at least partially inside
+            /// the given frustum.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The frustum.
+            /// @param [Out] The list to append the volumes to.
+            //-----------------------------------------------------------------------------
+            void QueryFrustum(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumes) const;
+            //-----------------------------------------------------------------------------
+            /// Appends all volumes whose bounding sphere intersects the given sphere.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The sphere.
+            /// @param [Out] The list to append the volumes to.
+            //-----------------------------------------------------------------------------
+            void QuerySphere(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumes) const;
+            //-----------------------------------------------------------------------------
+            /// Appends all volumes which potentially intersect the given ray.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The ray.
+            /// @param [Out] The list to append the volumes to.
+            //-----------------------------------------------------------------------------
+            void QueryRay(const Ray& in_ray, std::vector<VolumeComponent*>& out_volumes) const;
+            //-----------------------------------------------------------------------------
+            /// Performs a frustum query for each of the given frustums in a single pass
+            /// over the tree. The output list is resized to match the number of frustums
+            /// and the results of each query are appended to the corresponding entry.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The frustums.
+            /// @param [Out] The lists to append the volumes to.
+            //-----------------------------------------------------------------------------
+            void QueryFrustums(const std::vector<Frustum>& in_frustums, std::vector<std::vector<VolumeComponent*>>& out_volumes) const;
+            //-----------------------------------------------------------------------------
+            /// Performs a sphere query for each of the given spheres in a single pass over
+            /// the tree. The output list is resized to match the number of spheres and the
+            /// results of each query are appended to the corresponding entry.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The spheres.
+            /// @param [Out] The lists to append the volumes to.
+            //-----------------------------------------------------------------------------
+            void QuerySpheres(const std::vector<Sphere>& in_spheres, std::vector<std::vector<VolumeComponent*>>& out_volumes) const;
+            //-----------------------------------------------------------------------------
+            /// Performs a ray query for each of the given rays in a single pass over the
+            /// tree. The output list is resized to match the number of rays and the
+            /// results of each query are appended to the corresponding entry.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The rays.
+            /// @param [Out] The lists to append the volumes to.
+            //-----------------------------------------------------------------------------
+            void QueryRays(const std::vector<Ray>& in_rays, std::vector<std::vector<VolumeComponent*>>& out_volumes) const;
+
+        private:
+            //-----------------------------------------------------------------------------
+            /// A node in the tree. Leaves hold a volume, internal nodes hold two children.
+            /// Nodes which are not in use are linked together through m_parent.
+            ///
+            /// @author Jordan Brown
+            //-----------------------------------------------------------------------------
+            struct Node
+            {
+                Vector3 m_min;
+                Vector3 m_max;
+                Sphere m_sphere;
+                VolumeComponent* m_volume = nullptr;
+                u32 m_parent = k_nullProxy;
+                u32 m_child1 = k_nullProxy;
+                u32 m_child2 = k_nullProxy;
+                s32 m_height = -1;
+                bool m_inTree = false;
+                bool m_dirty = false;
+            };
+            //-----------------------------------------------------------------------------
+            /// Performs a single traversal of the tree testing up to 32 query shapes at
+            /// once, using a bit mask to track which of the shapes overlap each subtree.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The query shapes.
+            /// @param The overlap test for a shape against a box.
+            /// @param The test for a shape against the bounding sphere of a leaf.
+            /// @param [Out] The lists to append the volumes to.
+            //-----------------------------------------------------------------------------
+            template <typename TShapeType, typename TOverlapFunc, typename TLeafFunc> void BatchQuery(const std::vector<TShapeType>& in_shapes, TOverlapFunc in_overlapFunc, TLeafFunc in_leafFunc, std::vector<std::vector<VolumeComponent*>>& out_volumes) const;
+            //-----------------------------------------------------------------------------
+            /// Traverses the tree, appending all volumes whose boxes and bounding
+            /// spheres pass the tests.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The overlap test against a box.
+            /// @param The test against the bounding sphere of a leaf.
+            /// @param [Out] The list to append the volumes to.
+            //-----------------------------------------------------------------------------
+            template <typename TOverlapFunc, typename TLeafFunc> void Query(TOverlapFunc in_overlapFunc, TLeafFunc in_leafFunc, std::vector<VolumeComponent*>& out_volumes) const;
+            //-----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return A free node, growing the pool if required.
+            //-----------------------------------------------------------------------------
+            u32 AllocateNode();
+            //-----------------------------------------------------------------------------
+            /// Returns the node to the free list.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The node.
+            //-----------------------------------------------------------------------------
+            void FreeNode(u32 in_nodeId);
+            //-----------------------------------------------------------------------------
+            /// Inserts the leaf into the tree, choosing the sibling which results in the
+            /// smallest increase in surface area.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The leaf.
+            //-----------------------------------------------------------------------------
+            void InsertLeaf(u32 in_leafId);
+            //-----------------------------------------------------------------------------
+            /// Removes the leaf from the tree. The leaf node itself is not freed.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The leaf.
+            //-----------------------------------------------------------------------------
+            void RemoveLeaf(u32 in_leafId);
+            //-----------------------------------------------------------------------------
+            /// Walks from the given node to the root, rebalancing and refitting the boxes
+            /// and heights of each ancestor.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The node to start from.
+            //-----------------------------------------------------------------------------
+            void RefitAncestors(u32 in_nodeId);
+            //-----------------------------------------------------------------------------
+            /// Performs a left or right rotation if the given node is imbalanced.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The node.
+            ///
+            /// @return The new root of the subtree.
+            //-----------------------------------------------------------------------------
+            u32 Balance(u32 in_nodeId);
+            //-----------------------------------------------------------------------------
+            /// Recalculates the box and height of an internal node from its children.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The node.
+            //-----------------------------------------------------------------------------
+            void Refit(u32 in_nodeId);
+
+            std::vector<Node> m_nodes;
+            std::vector<u32> m_dirtyProxies;
+            u32 m_root = k_nullProxy;
+            u32 m_freeList = k_nullProxy;
+            u32 m_numVolumes = 0;
+        };
+    }
+}
+
+#endif
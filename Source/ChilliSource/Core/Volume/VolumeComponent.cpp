@@ -28,10 +28,30 @@
 
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
+
 namespace ChilliSource
 {
     namespace Core
     {
         CS_DEFINE_NAMEDTYPE(VolumeComponent);
+
+        //----------------------------------------------------
+        //----------------------------------------------------
+        VolumeComponent::VolumeComponent()
+            : mfQueryIntersectionValue(0.0f), m_volumeProxyId(BoundingVolumeHierarchy::k_nullProxy)
+        {
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void VolumeComponent::InvalidateVolume()
+        {
+            if (m_volumeProxyId != BoundingVolumeHierarchy::k_nullProxy)
+            {
+                GetEntity()->GetScene()->InvalidateVolume(this);
+            }
+        }
     }
 }
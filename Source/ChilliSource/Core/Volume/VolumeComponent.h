@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Entity/Component.h>
+#include <ChilliSource/Core/Event/EventConnection.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 
 namespace ChilliSource
@@ -47,7 +48,7 @@ namespace ChilliSource
         {
         public:
             CS_DECLARE_NAMEDTYPE(VolumeComponent);
-            VolumeComponent() : mfQueryIntersectionValue(0.0f){};
+            VolumeComponent();
             virtual ~VolumeComponent(){}
 
             //----------------------------------------------------
@@ -86,6 +87,24 @@ namespace ChilliSource
 
         public:
             f32 mfQueryIntersectionValue;
+
+        protected:
+            //----------------------------------------------------
+            /// Notifies the scene that the bounds of this volume
+            /// have changed for a reason other than the entity
+            /// transform changing, e.g. a new mesh being attached.
+            /// Changes to the entity transform are tracked by the
+            /// scene automatically.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------
+            void InvalidateVolume();
+
+        private:
+            friend class Scene;
+
+            u32 m_volumeProxyId;
+            EventConnectionUPtr m_volumeTransformConnection;
         };
     }
 }
@@ -166,10 +166,10 @@ namespace ChilliSource
             Input::PointerSystem* pointerSystem = Core::Application::Get()->GetSystem<Input::PointerSystem>();
             CS_ASSERT(pointerSystem != nullptr, "Gesture system missing required system: Pointer System");
             
-            m_pointerDownConnection = pointerSystem->GetPointerDownEventInternal().OpenConnection(Core::MakeDelegate(this, &GestureSystem::OnPointerDown));
-            m_pointerMovedConnection = pointerSystem->GetPointerMovedEvent().OpenConnection(Core::MakeDelegate(this, &GestureSystem::OnPointerMoved));
-            m_pointerUpConnection = pointerSystem->GetPointerUpEvent().OpenConnection(Core::MakeDelegate(this, &GestureSystem::OnPointerUp));
-            m_pointerScrolledConnection = pointerSystem->GetPointerScrollEventInternal().OpenConnection(Core::MakeDelegate(this, &GestureSystem::OnPointerScrolled));
+            m_pointerDownConnection = pointerSystem->GetPointerDownEventInternal().OpenConnection(Core::MakeInlineDelegate(this, &GestureSystem::OnPointerDown));
+            m_pointerMovedConnection = pointerSystem->GetPointerMovedEvent().OpenConnection(Core::MakeInlineDelegate(this, &GestureSystem::OnPointerMoved));
+            m_pointerUpConnection = pointerSystem->GetPointerUpEvent().OpenConnection(Core::MakeInlineDelegate(this, &GestureSystem::OnPointerUp));
+            m_pointerScrolledConnection = pointerSystem->GetPointerScrollEventInternal().OpenConnection(Core::MakeInlineDelegate(this, &GestureSystem::OnPointerScrolled));
         }
         //--------------------------------------------------------
         //--------------------------------------------------------
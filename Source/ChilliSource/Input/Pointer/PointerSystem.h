@@ -67,7 +67,7 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
             //----------------------------------------------------
-            using PointerDownDelegate = std::function<void(const Pointer&, f64, Pointer::InputType)>;
+            using PointerDownDelegate = Core::InlineDelegate<void(const Pointer&, f64, Pointer::InputType)>;
             //----------------------------------------------------
             /// A delegate that is used to receive pointer moved
             /// events. This could be dragging a touch on screen
@@ -78,7 +78,7 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
             //----------------------------------------------------
-            using PointerMovedDelegate = std::function<void(const Pointer&, f64)>;
+            using PointerMovedDelegate = Core::InlineDelegate<void(const Pointer&, f64)>;
             //----------------------------------------------------
             /// A delegate that is used to receive pointer up
             /// events. This could be releasing a mouse button or
@@ -90,7 +90,7 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
             //----------------------------------------------------
-            using PointerUpDelegate = std::function<void(const Pointer&, f64, Pointer::InputType)>;
+            using PointerUpDelegate = Core::InlineDelegate<void(const Pointer&, f64, Pointer::InputType)>;
             //----------------------------------------------------
             /// A delegate that is used to receive pointer scroll events
             /// (i.e. mouse wheel).
@@ -101,7 +101,7 @@ namespace ChilliSource
             ///
             /// @author Scott Downie
             //----------------------------------------------------
-            using PointerScrollDelegate = std::function<void(const Pointer&, f64, const Core::Vector2&)>;
+            using PointerScrollDelegate = Core::InlineDelegate<void(const Pointer&, f64, const Core::Vector2&)>;
             //----------------------------------------------------
             /// Creates a new platfrom specific instance of pointer
             /// system.
@@ -422,7 +422,7 @@ namespace ChilliSource
             ///
             /// @author S Downie
             //----------------------------------------------------
-            using PointerDownDelegateInternal = std::function<void(const Pointer&, f64, Pointer::InputType, Filter&)>;
+            using PointerDownDelegateInternal = Core::InlineDelegate<void(const Pointer&, f64, Pointer::InputType, Filter&)>;
             //----------------------------------------------------
             /// A delegate that is used to receive pointer scroll
             /// events (i.e. mouse wheel).
@@ -434,7 +434,7 @@ namespace ChilliSource
             ///
             /// @author S Downie
             //----------------------------------------------------
-            using PointerScrollDelegateInternal = std::function<void(const Pointer&, f64, const Core::Vector2&, Filter&)>;
+            using PointerScrollDelegateInternal = Core::InlineDelegate<void(const Pointer&, f64, const Core::Vector2&, Filter&)>;
             //----------------------------------------------------
             /// Event that is triggered when the pointer is first down.
             ///
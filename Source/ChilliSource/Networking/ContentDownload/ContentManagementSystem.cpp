@@ -32,6 +32,7 @@
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Cryptographic/BaseEncoding.h>
 #include <ChilliSource/Core/Cryptographic/HashMD5.h>
+#include <ChilliSource/Core/Cryptographic/HashSHA1.h>
 #include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/File/FileStream.h>
 #include <ChilliSource/Core/File/AppDataStore.h>
@@ -40,6 +41,9 @@
 
 #include <minizip/unzip.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -47,6 +51,24 @@ namespace ChilliSource
         namespace
         {
             const std::string k_adsKeyHasCached = "_CMSCachedDLC";
+            const std::string k_tempDirectory = "Temp";
+            
+            const u32 k_streamBufferSize = 64 * 1024;
+            const u32 k_minFilesPerExtractionBatch = 4;
+            const u32 k_maxFileNameLength = 256;
+            
+            //--------------------------------------------------------
+            /// A single entry in a package that is to be extracted.
+            ///
+            /// @author Jordan Brown
+            //--------------------------------------------------------
+            struct ExtractionEntry final
+            {
+                std::string m_zipFilePath;
+                std::string m_filePath;
+                std::string m_checksum;
+                unz_file_pos m_filePos;
+            };
             
             //--------------------------------------------------------
             /// @author S Downie
@@ -89,6 +111,156 @@ namespace ChilliSource
                 
                 return "";
             }
+            //--------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param A hex SHA1 hash.
+            ///
+            /// @return The hash in the format used by the content
+            /// manifest: lower case, base 64 encoded with the
+            /// trailing '=' removed.
+            //--------------------------------------------------------
+            std::string ToManifestChecksum(std::string in_hexHash)
+            {
+                Core::StringUtils::ToLowerCase(in_hexHash);
+                std::string base64Encoded = Core::BaseEncoding::Base64Encode(in_hexHash);
+                Core::StringUtils::ChopTrailingChars(base64Encoded, '=');
+                return base64Encoded;
+            }
+            //--------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The package id.
+            ///
+            /// @return The path to the temporary package zip.
+            //--------------------------------------------------------
+            std::string GetPackageZipPath(const std::string& in_packageId)
+            {
+                return k_tempDirectory + "/" + in_packageId + ".packzip";
+            }
+            //--------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The package id.
+            ///
+            /// @return The path to the file describing which version
+            /// of the package the temporary zip belongs to.
+            //--------------------------------------------------------
+            std::string GetPackageInfoPath(const std::string& in_packageId)
+            {
+                return k_tempDirectory + "/" + in_packageId + ".packinfo";
+            }
+            //--------------------------------------------------------
+            /// Lists the entries in the given package zip, creating
+            /// the directory structure required for them as it goes.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The absolute path to the zip.
+            /// @param The map of file path to expected checksum.
+            /// @param [Out] The entries to extract.
+            ///
+            /// @return Whether the zip could be read.
+            //--------------------------------------------------------
+            bool ListPackageEntries(const std::string& in_zipFilePath, const std::unordered_map<std::string, std::string>& in_checksums, std::vector<ExtractionEntry>& out_entries)
+            {
+                unzFile zippedFile = unzOpen(in_zipFilePath.c_str());
+                if(zippedFile == nullptr)
+                {
+                    return false;
+                }
+                
+                s8 fileName[k_maxFileNameLength];
+                
+                s32 status = unzGoToFirstFile(zippedFile);
+                while(status == UNZ_OK)
+                {
+                    unz_file_info fileInfo;
+                    unzGetCurrentFileInfo(zippedFile, &fileInfo, fileName, k_maxFileNameLength, nullptr, 0, nullptr, 0);
+                    
+                    std::string filePath(fileName);
+                    if(ContainsDirectoryPath(filePath))
+                    {
+                        //There is a nested folder so we need to create the directory structure
+                        Core::Application::Get()->GetFileSystem()->CreateDirectoryPath(Core::StorageLocation::k_DLC, "/" + GetPathExcludingFileName(filePath));
+                    }
+                    
+                    if(IsFile(filePath))
+                    {
+                        ExtractionEntry entry;
+                        entry.m_zipFilePath = in_zipFilePath;
+                        entry.m_filePath = filePath;
+                        unzGetFilePos(zippedFile, &entry.m_filePos);
+                        
+                        auto checksumIt = in_checksums.find(filePath);
+                        if(checksumIt != in_checksums.end())
+                        {
+                            entry.m_checksum = checksumIt->second;
+                        }
+                        
+                        out_entries.push_back(entry);
+                    }
+                    
+                    status = unzGoToNextFile(zippedFile);
+                }
+                
+                unzClose(zippedFile);
+                return true;
+            }
+            //--------------------------------------------------------
+            /// Streams a single entry out of an open zip into the
+            /// DLC storage location, hashing it in the same pass.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The open zip file.
+            /// @param The entry to extract.
+            /// @param A buffer of k_streamBufferSize bytes.
+            ///
+            /// @return Whether the file was extracted and, if it has
+            /// an expected checksum, matches it.
+            //--------------------------------------------------------
+            bool ExtractEntry(unzFile in_zippedFile, ExtractionEntry& in_entry, s8* in_buffer)
+            {
+                if(unzGoToFilePos(in_zippedFile, &in_entry.m_filePos) != UNZ_OK || unzOpenCurrentFile(in_zippedFile) != UNZ_OK)
+                {
+                    CS_LOG_ERROR("CMS: Cannot read " + in_entry.m_filePath + " from content package.");
+                    return false;
+                }
+                
+                Core::FileStreamUPtr fileStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(Core::StorageLocation::k_DLC, "/" + in_entry.m_filePath, Core::FileMode::k_writeBinary);
+                if(fileStream == nullptr || fileStream->IsOpen() == false || fileStream->IsBad() == true)
+                {
+                    CS_LOG_ERROR("CMS: Cannot write " + in_entry.m_filePath + " to DLC.");
+                    unzCloseCurrentFile(in_zippedFile);
+                    return false;
+                }
+                
+                Core::HashSHA1::Hasher hasher;
+                
+                s32 bytesRead = 0;
+                while((bytesRead = unzReadCurrentFile(in_zippedFile, in_buffer, k_streamBufferSize)) > 0)
+                {
+                    fileStream->Write(in_buffer, bytesRead);
+                    hasher.Update(in_buffer, (u32)bytesRead);
+                }
+                
+                fileStream->Close();
+                
+                //unzCloseCurrentFile checks the CRC of the entry once it has been fully read.
+                bool success = (bytesRead == 0 && unzCloseCurrentFile(in_zippedFile) == UNZ_OK);
+                if(success == false)
+                {
+                    CS_LOG_ERROR("CMS: " + in_entry.m_filePath + " is corrupt in content package.");
+                }
+                else if(in_entry.m_checksum.empty() == false && ToManifestChecksum(hasher.GenerateHexHashCode()) != in_entry.m_checksum)
+                {
+                    CS_LOG_ERROR("CMS: " + in_entry.m_filePath + " does not match the content manifest checksum.");
+                    success = false;
+                }
+                
+                return success;
+            }
         }
         CS_DEFINE_NAMEDTYPE(ContentManagementSystem);
         //--------------------------------------------------------
@@ -151,17 +323,15 @@ namespace ChilliSource
                 return m_checksumDelegate(in_location, in_filePath);
             }
             
-            std::string checksum = Core::Application::Get()->GetFileSystem()->GetFileChecksumSHA1(in_location, in_filePath);
-            CSCore::StringUtils::ToLowerCase(checksum);
-			std::string base64Encoded = Core::BaseEncoding::Base64Encode(checksum);
-			Core::StringUtils::ChopTrailingChars(base64Encoded, '=');
-			return base64Encoded;
+            return ToManifestChecksum(Core::Application::Get()->GetFileSystem()->GetFileChecksumSHA1(in_location, in_filePath));
 		}
         //-----------------------------------------------------------
         //-----------------------------------------------------------
         void ContentManagementSystem::ClearDownloadData()
         {
         	//Clear the old crap
+            m_packageStream.reset();
+            m_packageHasher.reset();
             m_serverManifest.reset();
             m_removePackageIds.clear();
             m_packageDetails.clear();
@@ -204,8 +374,8 @@ namespace ChilliSource
             {
             	//Add a temp directory so that the packages are stored atomically and only overwrite
                 //the originals on full success
-                Core::Application::Get()->GetFileSystem()->CreateDirectoryPath(Core::StorageLocation::k_DLC, "Temp");
-                m_contentDownloader->DownloadPackage(m_packageDetails[m_currentPackageDownload].m_url, Core::MakeDelegate(this, &ContentManagementSystem::OnContentDownloadComplete));
+                Core::Application::Get()->GetFileSystem()->CreateDirectoryPath(Core::StorageLocation::k_DLC, k_tempDirectory);
+                StartPackageDownload();
             }
             else
             {
@@ -217,60 +387,264 @@ namespace ChilliSource
         void ContentManagementSystem::DownloadNextPackage()
         {
             m_currentPackageDownload++;
-            m_contentDownloader->DownloadPackage(m_packageDetails[m_currentPackageDownload].m_url, Core::MakeDelegate(this, &ContentManagementSystem::OnContentDownloadComplete));
+            StartPackageDownload();
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::StartPackageDownload()
+        {
+            const PackageDetails& packageDetails = m_packageDetails[m_currentPackageDownload];
+            Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+            
+            const std::string zipPath = GetPackageZipPath(packageDetails.m_id);
+            const std::string infoPath = GetPackageInfoPath(packageDetails.m_id);
+            
+            m_packageHasher.reset(new Core::HashSHA1::Hasher());
+            
+            //If part of this version of the package was downloaded previously then the
+            //existing data is hashed so that the checksum can be completed as the rest arrives.
+            u32 existingSize = 0;
+            std::string packageInfo;
+            if(fileSystem->ReadFile(Core::StorageLocation::k_DLC, infoPath, packageInfo) == true && packageInfo == packageDetails.m_checksum)
+            {
+                Core::FileStreamUPtr existingStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, zipPath, Core::FileMode::k_readBinary);
+                if(existingStream != nullptr && existingStream->IsOpen() == true && existingStream->IsBad() == false)
+                {
+                    existingStream->SeekG(0, Core::SeekDir::k_end);
+                    existingSize = (u32)existingStream->TellG();
+                    existingStream->SeekG(0);
+                    
+                    std::unique_ptr<s8[]> buffer(new s8[k_streamBufferSize]);
+                    u32 remaining = existingSize;
+                    while(remaining > 0)
+                    {
+                        u32 chunkSize = std::min(remaining, k_streamBufferSize);
+                        existingStream->Read(buffer.get(), (s32)chunkSize);
+                        m_packageHasher->Update(buffer.get(), chunkSize);
+                        remaining -= chunkSize;
+                    }
+                    existingStream->Close();
+                }
+            }
+            
+            if(existingSize > 0 && m_contentDownloader->ResumePackageDownload(packageDetails.m_url, existingSize, Core::MakeDelegate(this, &ContentManagementSystem::OnContentDownloadComplete)) == true)
+            {
+                CS_LOG_VERBOSE("CMS: Resuming download of " + packageDetails.m_id);
+                m_packageStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, zipPath, Core::FileMode::k_writeBinaryAppend);
+            }
+            else
+            {
+                m_packageHasher.reset(new Core::HashSHA1::Hasher());
+                m_packageStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, zipPath, Core::FileMode::k_writeBinaryTruncate);
+                fileSystem->WriteFile(Core::StorageLocation::k_DLC, infoPath, packageDetails.m_checksum);
+                m_contentDownloader->DownloadPackage(packageDetails.m_url, Core::MakeDelegate(this, &ContentManagementSystem::OnContentDownloadComplete));
+            }
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::DeletePackageTempFiles(const PackageDetails& in_packageDetails)
+        {
+            m_packageStream.reset();
+            
+            Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+            fileSystem->DeleteFile(Core::StorageLocation::k_DLC, GetPackageZipPath(in_packageDetails.m_id));
+            fileSystem->DeleteFile(Core::StorageLocation::k_DLC, GetPackageInfoPath(in_packageDetails.m_id));
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
         void ContentManagementSystem::InstallUpdates(const CompleteDelegate& inDelegate)
         {
-            if(!m_packageDetails.empty() || !m_removePackageIds.empty())
-            {
-				if(!m_packageDetails.empty())
-				{
-					//Unzip all the files and overwrite the old manifest
-					for (const auto& details : m_packageDetails)
-					{
-						ExtractFilesFromPackage(details);
-					}
-				}
-                
-                //Remove the temp zips
-                DeleteDirectory("Temp");
-                
-                m_packageDetails.clear();
-			
-				if(!m_removePackageIds.empty())
-				{
-					//Remove any unused files from the documents
-					for (const auto& packageId : m_removePackageIds)
-					{
-						DeleteDirectory(packageId);
-					}
-				}
+            CS_ASSERT(m_installing == false, "CMS: Cannot install updates while an install is already in progress.");
+            
+            if(m_packageDetails.empty() && m_removePackageIds.empty())
+            {
+                //Tell the delegate all is bad
+                inDelegate(Result::k_failed);
+                ClearDownloadData();
+                return;
+            }
+            
+            m_installing = true;
+            
+            std::vector<std::string> packageIds;
+            for (const auto& details : m_packageDetails)
+            {
+                packageIds.push_back(details.m_id);
+            }
+            
+            //Files are verified against the manifest as they are extracted unless a custom
+            //checksum is in use, in which case the packages themselves have already been verified.
+            std::unordered_map<std::string, std::string> checksums;
+            if(!m_checksumDelegate)
+            {
+                checksums = GetServerFileChecksums();
+            }
+            
+            std::string contentDirectory = m_contentDirectory;
+            
+            //Unzip all the files on a background task, streaming the files out in parallel
+            Core::Application::Get()->GetTaskScheduler()->ScheduleTask([=]()
+            {
+                std::atomic<bool> success(true);
                 
-                //Save the new content manifest
-                CSCore::XMLUtils::WriteDocument(m_serverManifest->GetDocument(), Core::StorageLocation::k_DLC, "ContentManifest.moman");
+                std::vector<ExtractionEntry> entries;
+                for (const auto& packageId : packageIds)
+                {
+                    //Remove old content before installing the new stuff
+                    DeleteDirectory(packageId);
+                    
+                    if(ListPackageEntries(contentDirectory + "/" + GetPackageZipPath(packageId), checksums, entries) == false)
+                    {
+                        CS_LOG_ERROR("CMS: Cannot unzip content package: " + packageId);
+                        success = false;
+                    }
+                }
                 
-                m_dlcCachePurged = false;
+                if(entries.empty() == false)
+                {
+                    Core::Application::Get()->GetTaskScheduler()->ParallelFor((u32)entries.size(), k_minFilesPerExtractionBatch, [&](u32 in_begin, u32 in_end)
+                    {
+                        std::unique_ptr<s8[]> buffer(new s8[k_streamBufferSize]);
+                        
+                        //Entries are grouped by package so each batch will usually only open one zip
+                        unzFile zippedFile = nullptr;
+                        std::string zipFilePath;
+                        
+                        for(u32 i = in_begin; i < in_end; ++i)
+                        {
+                            if(zippedFile == nullptr || zipFilePath != entries[i].m_zipFilePath)
+                            {
+                                if(zippedFile != nullptr)
+                                {
+                                    unzClose(zippedFile);
+                                }
+                                
+                                zipFilePath = entries[i].m_zipFilePath;
+                                zippedFile = unzOpen(zipFilePath.c_str());
+                                if(zippedFile == nullptr)
+                                {
+                                    CS_LOG_ERROR("CMS: Cannot open content package: " + zipFilePath);
+                                    success = false;
+                                    break;
+                                }
+                            }
+                            
+                            if(ExtractEntry(zippedFile, entries[i], buffer.get()) == false)
+                            {
+                                success = false;
+                            }
+                        }
+                        
+                        if(zippedFile != nullptr)
+                        {
+                            unzClose(zippedFile);
+                        }
+                    });
+                }
                 
-                //Store that we have DLC cached. If there is no DLC on next check then 
-                //we know the cache has been purged and we have to block on download
-                Core::AppDataStore* ads = Core::Application::Get()->GetSystem<Core::AppDataStore>();
-                ads->SetValue(k_adsKeyHasCached, true);
+                bool result = success;
+                Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask([=]()
+                {
+                    OnPackagesExtracted(result, inDelegate);
+                });
+            });
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::OnPackagesExtracted(bool in_success, const CompleteDelegate& in_delegate)
+        {
+            m_installing = false;
+            
+            //Remove the temp zips
+            DeleteDirectory(k_tempDirectory);
+            
+            m_packageDetails.clear();
+            
+            if(in_success == false)
+            {
+                CS_LOG_ERROR("CMS: Failed to install content packages.");
                 
-                //Tell the delegate all is good
-                inDelegate(Result::k_succeeded);
+                //Tell the delegate all is bad. The manifest is left as it was so that the
+                //packages are downloaded again on the next update check.
+                in_delegate(Result::k_failed);
+                ClearDownloadData();
+                return;
             }
-            else
+            
+            if(!m_removePackageIds.empty())
             {
-                //Tell the delegate all is bad
-                inDelegate(Result::k_failed);
+                //Remove any unused files from the documents
+                for (const auto& packageId : m_removePackageIds)
+                {
+                    DeleteDirectory(packageId);
+                }
             }
             
+            //Save the new content manifest
+            CSCore::XMLUtils::WriteDocument(m_serverManifest->GetDocument(), Core::StorageLocation::k_DLC, "ContentManifest.moman");
+            
+            m_dlcCachePurged = false;
+            
+            //Store that we have DLC cached. If there is no DLC on next check then
+            //we know the cache has been purged and we have to block on download
+            Core::AppDataStore* ads = Core::Application::Get()->GetSystem<Core::AppDataStore>();
+            ads->SetValue(k_adsKeyHasCached, true);
+            
+            //Tell the delegate all is good
+            in_delegate(Result::k_succeeded);
+            
             ClearDownloadData();
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
+        std::unordered_map<std::string, std::string> ContentManagementSystem::GetServerFileChecksums() const
+        {
+            std::unordered_map<std::string, std::string> checksums;
+            
+            Core::XML::Node* serverManifestRootNode = Core::XMLUtils::GetFirstChildElement(m_serverManifest->GetDocument());
+            if(serverManifestRootNode == nullptr)
+            {
+                return checksums;
+            }
+            
+            Core::XML::Node* packageEl = Core::XMLUtils::GetFirstChildElement(serverManifestRootNode, "Package");
+            while(packageEl)
+            {
+                std::string packageId = Core::XMLUtils::GetAttributeValue<std::string>(packageEl, "ID", "");
+                
+                bool isDownloaded = false;
+                for (const auto& details : m_packageDetails)
+                {
+                    if(details.m_id == packageId)
+                    {
+                        isDownloaded = true;
+                        break;
+                    }
+                }
+                
+                if(isDownloaded == true)
+                {
+                    Core::XML::Node* fileEl = Core::XMLUtils::GetFirstChildElement(packageEl, "File");
+                    while(fileEl)
+                    {
+                        std::string fullPath = Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Location", "");
+                        if(fullPath.empty()) //Maintain backwards compatability with old versions
+                        {
+                            fullPath = packageId + "/" + Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Name", "");
+                        }
+                        
+                        checksums.insert(std::make_pair(fullPath, Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Checksum", "")));
+                        fileEl = Core::XMLUtils::GetNextSiblingElement(fileEl, "File");
+                    }
+                }
+                
+                packageEl = Core::XMLUtils::GetNextSiblingElement(packageEl, "Package");
+            }
+            
+            return checksums;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
         void ContentManagementSystem::OnContentManifestDownloadComplete(IContentDownloader::Result in_result, const std::string& in_manifest)
         {
             switch(in_result)
@@ -319,8 +693,9 @@ namespace ChilliSource
                 }
                 case IContentDownloader::Result::k_failed:
                 {
-                    //Delete all temp zip files and cancel the outstanding requests
-                    DeleteDirectory("Temp");
+                    //Keep whatever has been downloaded so far so the package can be
+                    //resumed the next time the updates are downloaded.
+                    m_packageStream.reset();
                     
                     if(m_onDownloadCompleteDelegate)
                     {
@@ -547,86 +922,41 @@ namespace ChilliSource
         //-----------------------------------------------------------
         bool ContentManagementSystem::SavePackageToFile(const PackageDetails& in_packageDetails, const std::string& in_zippedPackage, bool in_fullyDownloaded)
         {
-            std::string strFile = "Temp/" + in_packageDetails.m_id + ".packzip";
-
+            if(m_packageStream == nullptr || m_packageStream->IsOpen() == false || m_packageStream->IsBad() == true)
+            {
+                CS_LOG_ERROR("CMS: Cannot write content package: " + in_packageDetails.m_id);
+                return false;
+            }
+            
             //Append to the file as it can take multiple writes
-            Core::FileStreamSPtr pFileStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(Core::StorageLocation::k_DLC, strFile, Core::FileMode::k_writeBinaryAppend);
-			pFileStream->Write((s8*)in_zippedPackage.data(), (s32)in_zippedPackage.size());
-            pFileStream->Close();
+            m_packageStream->Write(in_zippedPackage.data(), (s32)in_zippedPackage.size());
+            m_packageHasher->Update(in_zippedPackage.data(), (u32)in_zippedPackage.size());
             
             //Check if the full file has been written and perform a checksum validation 
             if(in_fullyDownloaded)
             {
-                std::string strChecksum = CalculateChecksum(Core::StorageLocation::k_DLC, strFile);
-                if(strChecksum != in_packageDetails.m_checksum)
+                m_packageStream->Close();
+                m_packageStream.reset();
+                
+                std::string strChecksum;
+                if(m_checksumDelegate)
                 {
-                    CS_LOG_ERROR("CMS: " + in_packageDetails.m_id + " Package download corrupted");
-                    return false;
+                    strChecksum = CalculateChecksum(Core::StorageLocation::k_DLC, GetPackageZipPath(in_packageDetails.m_id));
                 }
-            }
-                
-            return true;
-        }
-
-        //-----------------------------------------------------------
-        //-----------------------------------------------------------
-        void ContentManagementSystem::ExtractFilesFromPackage(const ContentManagementSystem::PackageDetails& in_packageDetails) const
-        {
-			//Open zip
-			std::string strZipFilePath(m_contentDirectory + "/Temp/" + in_packageDetails.m_id + ".packzip");
-			
-			unzFile ZippedFile = unzOpen(strZipFilePath.c_str());
-			if(!ZippedFile)
-			{
-				CS_LOG_ERROR("CMS: Cannot unzip content package: " + in_packageDetails.m_id);
-				return;
-			}
-
-            //Remove old content before installing the new stuff
-            DeleteDirectory(in_packageDetails.m_id);
-            
-            //Go to the first file in the zip
-            const u64 uddwFilenameLength = 256;
-            s8 byaFileName[uddwFilenameLength];
-            
-            s32 dwStatus = unzGoToFirstFile(ZippedFile);
-            
-            while(dwStatus == UNZ_OK)
-            {
-                //Open the next file
-                if (unzOpenCurrentFile(ZippedFile) != UNZ_OK)
-                    break;
-                
-                //Get file information
-                unz_file_info FileInfo;
-                unzGetCurrentFileInfo(ZippedFile, &FileInfo, byaFileName, uddwFilenameLength, nullptr, 0, nullptr, 0);
-                
-                //Load the file into memory and then save it out to the directory
-                s8* pbyDataBuffer =  new s8[FileInfo.uncompressed_size];
-                unzReadCurrentFile(ZippedFile, pbyDataBuffer, FileInfo.uncompressed_size);
-                
-                //Create new stuff
-                std::string strFilePath = std::string(byaFileName);
-                if(ContainsDirectoryPath(strFilePath))
+                else
                 {
-                    //There is a nested folder so we need to create the directory structure
-                    std::string strPath = GetPathExcludingFileName(strFilePath);
-                    Core::Application::Get()->GetFileSystem()->CreateDirectoryPath(Core::StorageLocation::k_DLC, "/" + strPath);
+                    strChecksum = ToManifestChecksum(m_packageHasher->GenerateHexHashCode());
                 }
                 
-                if(IsFile(strFilePath))
+                if(strChecksum != in_packageDetails.m_checksum)
                 {
-                    Core::Application::Get()->GetFileSystem()->WriteFile(Core::StorageLocation::k_DLC, "/" + strFilePath, pbyDataBuffer, FileInfo.uncompressed_size);
+                    CS_LOG_ERROR("CMS: " + in_packageDetails.m_id + " Package download corrupted");
+                    DeletePackageTempFiles(in_packageDetails);
+                    return false;
                 }
-                
-                //Close current file and jump to the next
-                CS_SAFEDELETE_ARRAY(pbyDataBuffer);
-                unzCloseCurrentFile(ZippedFile);
-                dwStatus = unzGoToNextFile(ZippedFile);
             }
-            
-            //Close the zip
-            unzClose(ZippedFile);
+                
+            return true;
         }
 		//-----------------------------------------------------------
 		//-----------------------------------------------------------
@@ -30,11 +30,14 @@
 #define _CHILLISOURCE_NETWORKING_CONTENTDOWNLOAD_CONTENTMANAGEMENTSYSTEM_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Cryptographic/HashSHA1.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Core/XML/XMLUtils.h>
 #include <ChilliSource/Networking/ContentDownload/IContentDownloader.h>
 
+#include <unordered_map>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -153,7 +156,11 @@ namespace ChilliSource
             void DownloadUpdates(const CompleteDelegate& in_delegate);
             //-----------------------------------------------------------
             /// Having downloaded the update packages this method
-            /// unzips the packages and overwrites any old assets
+            /// unzips the packages and overwrites any old assets.
+            /// The packages are extracted on background threads,
+            /// verifying each file against the manifest as it is
+            /// written, and the delegate is called on the main thread
+            /// once installation has finished.
             ///
             /// @author S Downie
             ///
@@ -286,7 +293,10 @@ namespace ChilliSource
             //-----------------------------------------------------------
             void AddToDownloadListIfNotInBundle(Core::XML::Node* in_packageEl);
             //-----------------------------------------------------------
-            /// Save the zip file to documents directory
+            /// Save the zip file to documents directory. The data is
+            /// appended to the open package file and hashed as it
+            /// arrives so the package doesn't need to be read back
+            /// to validate it.
             ///
             /// @author S Downie
             ///
@@ -297,14 +307,40 @@ namespace ChilliSource
             //-----------------------------------------------------------
             bool SavePackageToFile(const PackageDetails& in_packageDetails, const std::string& in_zippedPackage, bool in_fullyDownloaded);
             //-----------------------------------------------------------
-            /// Unzip the package and save all the files to the
-            /// documents directory
+            /// Starts downloading the current package. If a partial
+            /// download of the same package exists from a previous
+            /// attempt it is resumed rather than restarted.
             ///
-            /// @author S Downie
+            /// @author Jordan Brown
+            //-----------------------------------------------------------
+            void StartPackageDownload();
+            //-----------------------------------------------------------
+            /// Deletes the temporary files for the given package.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Package details
+            //-----------------------------------------------------------
+            void DeletePackageTempFiles(const PackageDetails& in_packageDetails);
+            //-----------------------------------------------------------
+            /// Builds a map from the path of each file in the given
+            /// packages to its checksum in the server manifest.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The map of file path to checksum.
+            //-----------------------------------------------------------
+            std::unordered_map<std::string, std::string> GetServerFileChecksums() const;
+            //-----------------------------------------------------------
+            /// Called on the main thread once the packages have been
+            /// extracted to finish installing the update.
+            ///
+            /// @author Jordan Brown
             ///
-            /// @param Zipped package
+            /// @param Whether all files were extracted successfully.
+            /// @param Delegate to call when Install is complete
             //-----------------------------------------------------------
-            void ExtractFilesFromPackage(const PackageDetails& in_packageDetails) const;
+            void OnPackagesExtracted(bool in_success, const CompleteDelegate& in_delegate);
             //-----------------------------------------------------------
 			/// Deletes a directory from the DLC Storage Location.
             ///
@@ -366,7 +402,11 @@ namespace ChilliSource
 			
             u32 m_currentPackageDownload = 0;
             
+            Core::FileStreamUPtr m_packageStream;
+            std::unique_ptr<Core::HashSHA1::Hasher> m_packageHasher;
+            
             bool m_dlcCachePurged = false;
+            bool m_installing = false;
         };
     }
 }
@@ -89,6 +89,22 @@ namespace ChilliSource
             //---------------------------------------------------------
             virtual void DownloadPackage(const std::string& in_url, const Delegate& in_delegate) = 0;
             //---------------------------------------------------------
+            /// Continue downloading a partially downloaded package
+            /// from the given URL, receiving only the data after the
+            /// given offset. Downloaders which cannot request part of
+            /// a file should return false, in which case the package
+            /// is downloaded again from the start.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param URL string
+            /// @param The number of bytes already downloaded.
+            /// @param Delegate
+            ///
+            /// @return Whether the download has been resumed.
+            //---------------------------------------------------------
+            virtual bool ResumePackageDownload(const std::string& in_url, u32 in_offset, const Delegate& in_delegate) { return false; }
+            //---------------------------------------------------------
             /// The destructor.
             ///
             /// @author S Downie
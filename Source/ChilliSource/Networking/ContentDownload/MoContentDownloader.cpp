@@ -31,10 +31,13 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Device.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
+#include <ChilliSource/Core/String/ToString.h>
 #include <ChilliSource/Networking/Http/HttpResponse.h>
 
 #include <json/json.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -105,10 +108,23 @@ namespace ChilliSource
         void MoContentDownloader::DownloadPackage(const std::string& instrURL, const Delegate& inDelegate)
         {
             mOnContentDownloadCompleteDelegate = inDelegate;
+            m_numBytesToDiscard = 0;
             mpCurrentRequest = mpHttpRequestSystem->MakeGetRequest(instrURL, Core::MakeDelegate(this, &MoContentDownloader::OnContentDownloadComplete));
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
+        bool MoContentDownloader::ResumePackageDownload(const std::string& in_url, u32 in_offset, const Delegate& in_delegate)
+        {
+            mOnContentDownloadCompleteDelegate = in_delegate;
+            m_numBytesToDiscard = in_offset;
+            
+            Core::ParamDictionary headers;
+            headers.SetValue("Range", "bytes=" + Core::ToString(in_offset) + "-");
+            mpCurrentRequest = mpHttpRequestSystem->MakeGetRequest(in_url, headers, Core::MakeDelegate(this, &MoContentDownloader::OnContentDownloadComplete));
+            return true;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
         void MoContentDownloader::OnContentManifestDownloadComplete(const HttpRequest* in_request, const HttpResponse& in_response)
         {
             switch(in_response.GetResult())
@@ -170,6 +186,27 @@ namespace ChilliSource
             if(mpCurrentRequest == in_request)
                 mpCurrentRequest = nullptr;
             
+            //If this is a resumed download and the server has ignored the range the data we
+            //already have is skipped. If the range is past the end the package was already complete.
+            std::string data;
+            if(in_response.GetCode() == HttpResponseCode::k_rangeNotSatisfiable)
+            {
+                m_numBytesToDiscard = 0;
+            }
+            else
+            {
+                data = in_response.GetDataAsString();
+                
+                if(in_response.GetCode() == HttpResponseCode::k_partialContent)
+                {
+                    m_numBytesToDiscard = 0;
+                }
+                
+                u32 numBytesDiscarded = std::min(m_numBytesToDiscard, (u32)data.size());
+                data.erase(0, numBytesDiscarded);
+                m_numBytesToDiscard -= numBytesDiscarded;
+            }
+            
             switch(in_response.GetResult())
             {
                 case HttpResponse::Result::k_completed:
@@ -179,7 +216,7 @@ namespace ChilliSource
                     {
                         default:   //OK
                         case HttpResponseCode::k_ok:
-                            mOnContentDownloadCompleteDelegate(Result::k_succeeded, in_response.GetDataAsString());
+                            mOnContentDownloadCompleteDelegate(Result::k_succeeded, data);
                             break;
                     }
                     break;
@@ -187,12 +224,12 @@ namespace ChilliSource
                 case HttpResponse::Result::k_timeout:
                 case HttpResponse::Result::k_failed:
                 {
-                    mOnContentDownloadCompleteDelegate(Result::k_failed, in_response.GetDataAsString());
+                    mOnContentDownloadCompleteDelegate(Result::k_failed, data);
                     break;
                 }
                 case HttpResponse::Result::k_flushed:
                 {
-                    mOnContentDownloadCompleteDelegate(Result::k_flushed, in_response.GetDataAsString());
+                    mOnContentDownloadCompleteDelegate(Result::k_flushed, data);
                     break;
                 }
             }
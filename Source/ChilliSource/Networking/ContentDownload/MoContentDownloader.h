@@ -68,6 +68,21 @@ namespace ChilliSource
             //----------------------------------------------------------------
             void DownloadPackage(const std::string& instrURL, const Delegate& inDelegate);
             //----------------------------------------------------------------
+            /// Continue downloading a partially downloaded package using
+            /// a HTTP range request. If the server ignores the range the
+            /// data which has already been downloaded is discarded as it
+            /// arrives.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param URL string
+            /// @param The number of bytes already downloaded.
+            /// @param Delegate
+            ///
+            /// @return Whether the download has been resumed.
+            //----------------------------------------------------------------
+            bool ResumePackageDownload(const std::string& in_url, u32 in_offset, const Delegate& in_delegate) override;
+            //----------------------------------------------------------------
             /// Get Tags
             ///
             /// @return The current tags of this downloader
@@ -111,6 +126,8 @@ namespace ChilliSource
             HttpRequestSystem* mpHttpRequestSystem;
             
             HttpRequest* mpCurrentRequest;
+            
+            u32 m_numBytesToDiscard = 0;
         };
     }
 }
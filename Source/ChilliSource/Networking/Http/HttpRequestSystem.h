@@ -46,11 +46,13 @@ namespace ChilliSource
         namespace HttpResponseCode
         {
             const u32 k_ok = 200;
+            const u32 k_partialContent = 206;
             const u32 k_redirect = 301;
             const u32 k_movedTemporarily = 302;
             const u32 k_redirectTemporarily = 307;
             const u32 k_notFound = 404;
             const u32 k_conflict = 409;
+            const u32 k_rangeNotSatisfiable = 416;
             const u32 k_error = 500;
             const u32 k_unavailable = 503;
         }
@@ -47,6 +47,8 @@ namespace ChilliSource
 	{
         namespace
         {
+            const u32 k_maxCachedBuiltTexts = 256;
+            
             //------------------------------------------------------
             /// Converts a 2D transformation matrix to a 3D
             /// Transformation matrix. This will only work for
@@ -67,24 +69,68 @@ namespace ChilliSource
                     in_transform.m[6], in_transform.m[7], in_transform.m[8], 1);
             }
             //----------------------------------------------------------------------------
-            /// Get the width of the character
+            /// A run of consecutive glyphs in the decoded text, used to describe a line
+            /// without copying it.
             ///
-            /// @author S Downie
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct GlyphRun
+            {
+                u32 m_start;
+                u32 m_end;
+            };
+            //----------------------------------------------------------------------------
+            /// Text decoded into code points, along with the font info and scaled width
+            /// of each, so that they are only looked up once per build.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct DecodedText
+            {
+                std::vector<Core::UTF8Char> m_characters;
+                std::vector<const Font::CharacterInfo*> m_infos;
+                std::vector<f32> m_widths;
+            };
+            //----------------------------------------------------------------------------
+            /// Appends a glyph to the decoded text.
+            ///
+            /// @author Jordan Brown
             ///
             /// @param Character
+            /// @param The info for the character, or null if the font doesn't provide it.
+            /// @param The absolute character spacing offset.
+            /// @param The text scale factor.
+            /// @param [In/Out] The decoded text.
+            //----------------------------------------------------------------------------
+            void AddGlyph(Core::UTF8Char in_character, const Font::CharacterInfo* in_info, f32 in_absCharSpacingOffset, f32 in_textScale, DecodedText& inout_text)
+            {
+                inout_text.m_characters.push_back(in_character);
+                inout_text.m_infos.push_back(in_info);
+                inout_text.m_widths.push_back((in_info != nullptr) ? (in_info->m_advance + in_absCharSpacingOffset) * in_textScale : 0.0f);
+            }
+            //----------------------------------------------------------------------------
+            /// Decodes the given UTF-8 text and looks up the info for each character.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Text (UTF-8)
             /// @param Font
             /// @param The absolute character spacing offset.
             /// @param The text scale factor.
+            /// @param [Out] The decoded text.
             //----------------------------------------------------------------------------
-            f32 GetCharacterWidth(Core::UTF8Char in_character, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale)
+            void DecodeText(const std::string& in_text, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale, DecodedText& out_text)
             {
-                Font::CharacterInfo charInfo;
-                if(in_font->TryGetCharacterInfo(in_character, charInfo) == true)
+                out_text.m_characters.reserve(in_text.size());
+                out_text.m_infos.reserve(in_text.size());
+                out_text.m_widths.reserve(in_text.size());
+                
+                auto it = in_text.begin();
+                while(it < in_text.end())
                 {
-                    return (charInfo.m_advance + in_absCharSpacingOffset) * in_textScale;
+                    auto character = Core::UTF8StringUtils::Next(it);
+                    AddGlyph(character, in_font->GetCharacterInfo(character), in_absCharSpacingOffset, in_textScale, out_text);
                 }
-
-                return 0.0f;
             }
             //----------------------------------------------------------------------------
             /// @author S Downie
@@ -102,25 +148,22 @@ namespace ChilliSource
             ///
             /// @author S Downie
             ///
-            /// @param Iterator pointing to start
-            /// @param Iterator pointing to end
-            /// @param Font
-            /// @param The absolute character spacing offset.
-            /// @param The text scale factor.
+            /// @param Decoded text
+            /// @param Index of the first glyph
+            /// @param Index of the end of the line
             //----------------------------------------------------------------------------
-            f32 CalculateDistanceToNextBreak(std::string::const_iterator in_itStart, std::string::const_iterator in_itEnd, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale)
+            f32 CalculateDistanceToNextBreak(const DecodedText& in_text, u32 in_start, u32 in_end)
             {
                 f32 totalWidth = 0.0f;
                 
-                while(in_itStart < in_itEnd)
+                for(u32 i = in_start; i < in_end; ++i)
                 {
-                    auto nextCharacter = Core::UTF8StringUtils::Next(in_itStart);
-                    if (IsBreakableCharacter(nextCharacter) == true)
+                    if (IsBreakableCharacter(in_text.m_characters[i]) == true)
                     {
                         break;
                     }
                     
-                    totalWidth += GetCharacterWidth(nextCharacter, in_font, in_absCharSpacingOffset, in_textScale);
+                    totalWidth += in_text.m_widths[i];
                 }
 
                 return totalWidth;
@@ -131,102 +174,92 @@ namespace ChilliSource
             ///
             /// @author S Downie
             ///
-            /// @param Text (UTF-8)
+            /// @param Decoded text
             /// @param [Out] Array of lines split by '\n'
             //----------------------------------------------------------------------------
-            void SplitByNewLine(const std::string& in_text, std::vector<std::string>& out_lines)
+            void SplitByNewLine(const DecodedText& in_text, std::vector<GlyphRun>& out_lines)
             {
-                auto it = in_text.begin();
-                std::string line;
-                while(it < in_text.end())
+                GlyphRun line = { 0, 0 };
+                for(u32 i = 0; i < in_text.m_characters.size(); ++i)
                 {
-                    auto character = Core::UTF8StringUtils::Next(it);
-
-                    if(character != '\n')
-                    {
-                        Core::UTF8StringUtils::Append(character, line);
-                    }
-                    else
+                    if(in_text.m_characters[i] == '\n')
                     {
+                        line.m_end = i;
                         out_lines.push_back(line);
-                        line.clear();
+                        line.m_start = i + 1;
                     }
                 }
 
-                if(line.size() > 0)
+                line.m_end = in_text.m_characters.size();
+                if(line.m_end > line.m_start)
                 {
                     out_lines.push_back(line);
                 }
             }
             //----------------------------------------------------------------------------
-            /// Split the given text into lines based on the constrained bounds.
+            /// Split the given line into lines based on the constrained bounds.
             /// Splits will prefer to happen on breakable whitespace characters but
             /// will split mid-word if neccessary.
             ///
             /// @author S Downie
             ///
-            /// @param Text (UTF-8)
-            /// @param Font
-            /// @param Text scale
-            /// @param The absolute character spacing offset.
-            /// @param Bounds
+            /// @param Decoded text
+            /// @param The line to split
+            /// @param Bounds width
             /// @param [Out] Array of lines split to fit in bounds
             //----------------------------------------------------------------------------
-            void SplitByBounds(const std::string& in_text, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale, const Core::Vector2& in_bounds, std::vector<std::string>& out_lines)
+            void SplitByBounds(const DecodedText& in_text, const GlyphRun& in_line, f32 in_maxLineWidth, std::vector<GlyphRun>& out_lines)
             {
-                f32 maxLineWidth = in_bounds.x;
-
-                auto it = in_text.begin();
-                std::string line;
+                GlyphRun line = { in_line.m_start, in_line.m_start };
                 f32 currentLineWidth = 0.0f;
 
-                while(it < in_text.end())
+                u32 i = in_line.m_start;
+                while(i < in_line.m_end)
                 {
-                    auto character = Core::UTF8StringUtils::Next(it);
-                    u32 characterWidth = GetCharacterWidth(character, in_font, in_absCharSpacingOffset, in_textScale);
+                    auto character = in_text.m_characters[i];
+                    u32 characterWidth = in_text.m_widths[i];
+                    ++i;
                     
                     //If we come across a character on which we can wrap we need
                     //to check ahead to see if the next space is within the bounds or
                     //whether we need to wrap now
                     if(IsBreakableCharacter(character) == true)
                     {
-                        f32 nextBreakWidth = currentLineWidth + characterWidth + CalculateDistanceToNextBreak(it, in_text.end(), in_font, in_absCharSpacingOffset, in_textScale);
+                        f32 nextBreakWidth = currentLineWidth + characterWidth + CalculateDistanceToNextBreak(in_text, i, in_line.m_end);
 
-                        if(nextBreakWidth >= maxLineWidth && line.size() > 0)
+                        if(nextBreakWidth >= in_maxLineWidth && line.m_end > line.m_start)
                         {
                             out_lines.push_back(line);
-                            line.clear();
                             currentLineWidth = 0.0f;
                             
                             //since we've broken mid line we don't want to start the next line with
                             //whitespace. To ensure this we want to jump the cursor forward to find
                             //the next non-breakable character.
-                            auto nextIt = it;
-                            Core::UTF8Char nextCharacter = Core::UTF8StringUtils::Next(nextIt);
-                            while (IsBreakableCharacter(nextCharacter) == true)
+                            while (i < in_line.m_end && IsBreakableCharacter(in_text.m_characters[i]) == true)
                             {
-                                it = nextIt;
-                                nextCharacter = Core::UTF8StringUtils::Next(nextIt);
+                                ++i;
                             }
                             
+                            line.m_start = i;
+                            line.m_end = i;
                             continue;
                         }
                     }
                     
                     //If this is not a breakable character, but it is still beyond the bounds
                     //then wrap anyway, even though we are mid word.
-                    else if((currentLineWidth + characterWidth) >= maxLineWidth)
+                    else if((currentLineWidth + characterWidth) >= in_maxLineWidth)
                     {
                         out_lines.push_back(line);
-                        line.clear();
+                        line.m_start = line.m_end;
                         currentLineWidth = 0.0f;
                     }
                     
                     currentLineWidth += characterWidth;
-                    Core::UTF8StringUtils::Append(character, line);
+                    line.m_end = i;
                 }
 
-                if(line.size() > 0)
+                if(line.m_end > line.m_start)
                 {
                     out_lines.push_back(line);
                 }
@@ -237,7 +270,7 @@ namespace ChilliSource
             ///
             /// @author S Downie
             ///
-            /// @param Character
+            /// @param The character info, or null if the font doesn't provide it.
             /// @param Font
             /// @param Current cursor X pos
             /// @param Current cursor Y pos
@@ -246,18 +279,17 @@ namespace ChilliSource
             ///
             /// @return Display characer info
             //----------------------------------------------------------------------------
-            CanvasRenderer::DisplayCharacterInfo BuildCharacter(Core::UTF8Char in_character, const FontCSPtr& in_font, f32 in_cursorX, f32 in_cursorY, f32 in_textScale, f32 in_absCharSpacingOffset)
+            CanvasRenderer::DisplayCharacterInfo BuildCharacter(const Font::CharacterInfo* in_info, const FontCSPtr& in_font, f32 in_cursorX, f32 in_cursorY, f32 in_textScale, f32 in_absCharSpacingOffset)
             {
                 CanvasRenderer::DisplayCharacterInfo result;
 
-                Font::CharacterInfo info;
-                if(in_font->TryGetCharacterInfo(in_character, info) == true)
+                if(in_info != nullptr)
                 {
-                    result.m_UVs = info.m_UVs;
-                    result.m_advance = ((info.m_advance + in_absCharSpacingOffset) * in_textScale);
-                    result.m_packedImageSize = info.m_size * in_textScale;
-                    result.m_position.x = in_cursorX + (info.m_offset.x - info.m_origin) * in_textScale;
-                    result.m_position.y = in_cursorY - (info.m_offset.y - in_font->GetVerticalPadding()) * in_textScale;
+                    result.m_UVs = in_info->m_UVs;
+                    result.m_advance = ((in_info->m_advance + in_absCharSpacingOffset) * in_textScale);
+                    result.m_packedImageSize = in_info->m_size * in_textScale;
+                    result.m_position.x = in_cursorX + (in_info->m_offset.x - in_info->m_origin) * in_textScale;
+                    result.m_position.y = in_cursorY - (in_info->m_offset.y - in_font->GetVerticalPadding()) * in_textScale;
                 }
                 else
                 {
@@ -415,58 +447,64 @@ namespace ChilliSource
             //----------------------------------------------------------------------------
             /// Adds an ellipsis to the end of the line of text without increasing the
             /// width of the line of text beyond the given length. If required, characters
-            /// will be removed from the string.
+            /// will be removed from the line. The new line is appended to the end of the
+            /// decoded text and the line is updated to refer to it.
             ///
-            /// If the font doesn't contain '.' the original string will simply be returned.
+            /// If the font doesn't contain '.' the line will be left unchanged.
             ///
             /// @author Ian Copland
             ///
-            /// @param The string to add the ellipsis to.
+            /// @param [In/Out] The decoded text.
+            /// @param [In/Out] The line to add the ellipsis to.
             /// @param The font the string will be renderered with.
             /// @param The absolute pixel offset to regular character spacing.
             /// @param The text scale factor.
             /// @param The maximum pixel width of the text.
-            ///
-            /// @return The output string with ellipsis
             //----------------------------------------------------------------------------
-            std::string AppendEllipsis(const std::string& in_text, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale, f32 in_maxTextWidth)
+            void AppendEllipsis(DecodedText& inout_text, GlyphRun& inout_line, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale, f32 in_maxTextWidth)
             {
                 const u32 k_numDots = 3;
                 
                 //Check the font contains '.' for building the ellipsis.
-                Font::CharacterInfo charInfo;
-                if (in_font->TryGetCharacterInfo((Core::UTF8Char)'.', charInfo) == false)
+                const Font::CharacterInfo* dotInfo = in_font->GetCharacterInfo((Core::UTF8Char)'.');
+                if (dotInfo == nullptr)
                 {
-                    return in_text;
+                    return;
                 }
                 
                 //get the width of an ellipsis
-                f32 dotWidth = GetCharacterWidth((Core::UTF8Char)'.', in_font, in_absCharSpacingOffset, in_textScale);
+                f32 dotWidth = (dotInfo->m_advance + in_absCharSpacingOffset) * in_textScale;
                 f32 ellipsisWidth = dotWidth * k_numDots;
                 
-                //if there is space for some of the text and the ellipsis, then calculate the output string.
-                std::string outputText;
+                //Make sure the copied glyphs cannot be invalidated while being appended.
+                const u32 maxLength = inout_line.m_end - inout_line.m_start + k_numDots;
+                inout_text.m_characters.reserve(inout_text.m_characters.size() + maxLength);
+                inout_text.m_infos.reserve(inout_text.m_infos.size() + maxLength);
+                inout_text.m_widths.reserve(inout_text.m_widths.size() + maxLength);
+                
+                const u32 outputStart = inout_text.m_characters.size();
+                
+                //if there is space for some of the text and the ellipsis, then calculate the output line.
                 if (in_maxTextWidth > ellipsisWidth)
                 {
                     f32 currentLineWidth = 0.0f;
-                    auto it = in_text.begin();
-                    while(it < in_text.end())
+                    for (u32 i = inout_line.m_start; i < inout_line.m_end; ++i)
                     {
-                        auto character = Core::UTF8StringUtils::Next(it);
-                        
-                        currentLineWidth += GetCharacterWidth(character, in_font, in_absCharSpacingOffset, in_textScale);
+                        currentLineWidth += inout_text.m_widths[i];
                         if (currentLineWidth > in_maxTextWidth - ellipsisWidth)
                         {
                             break;
                         }
                         
-                        Core::UTF8StringUtils::Append(character, outputText);
+                        inout_text.m_characters.push_back(inout_text.m_characters[i]);
+                        inout_text.m_infos.push_back(inout_text.m_infos[i]);
+                        inout_text.m_widths.push_back(inout_text.m_widths[i]);
                     }
                     
                     //append the ellipsis
                     for (u32 i = 0; i < k_numDots; ++i)
                     {
-                        Core::UTF8StringUtils::Append((Core::UTF8Char)'.', outputText);
+                        AddGlyph((Core::UTF8Char)'.', dotInfo, in_absCharSpacingOffset, in_textScale, inout_text);
                     }
                 }
                 
@@ -482,11 +520,58 @@ namespace ChilliSource
                             break;
                         }
                         
-                        Core::UTF8StringUtils::Append((Core::UTF8Char)'.', outputText);
+                        AddGlyph((Core::UTF8Char)'.', dotInfo, in_absCharSpacingOffset, in_textScale, inout_text);
                     }
                 }
                 
-                return outputText;
+                inout_line.m_start = outputStart;
+                inout_line.m_end = inout_text.m_characters.size();
+            }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The seed to combine with.
+            /// @param The hash to combine.
+            ///
+            /// @return The combined hash.
+            //----------------------------------------------------------------------------
+            std::size_t CombineHash(std::size_t in_seed, std::size_t in_hash)
+            {
+                return in_seed ^ (in_hash + 0x9e3779b9 + (in_seed << 6) + (in_seed >> 2));
+            }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The text properties.
+            ///
+            /// @return The hash of the text properties.
+            //----------------------------------------------------------------------------
+            std::size_t HashTextProperties(const CanvasRenderer::TextProperties& in_properties)
+            {
+                std::hash<f32> floatHash;
+                
+                std::size_t hash = floatHash(in_properties.m_textScale);
+                hash = CombineHash(hash, floatHash(in_properties.m_absCharSpacingOffset));
+                hash = CombineHash(hash, floatHash(in_properties.m_absLineSpacingOffset));
+                hash = CombineHash(hash, floatHash(in_properties.m_lineSpacingScale));
+                hash = CombineHash(hash, in_properties.m_maxNumLines);
+                hash = CombineHash(hash, (std::size_t)in_properties.m_horizontalJustification);
+                hash = CombineHash(hash, (std::size_t)in_properties.m_verticalJustification);
+                return hash;
+            }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The first text properties.
+            /// @param The second text properties.
+            ///
+            /// @return Whether or not the text properties would build the same text.
+            //----------------------------------------------------------------------------
+            bool AreTextPropertiesEqual(const CanvasRenderer::TextProperties& in_a, const CanvasRenderer::TextProperties& in_b)
+            {
+                return in_a.m_textScale == in_b.m_textScale && in_a.m_absCharSpacingOffset == in_b.m_absCharSpacingOffset && in_a.m_absLineSpacingOffset == in_b.m_absLineSpacingOffset &&
+                    in_a.m_lineSpacingScale == in_b.m_lineSpacingScale && in_a.m_maxNumLines == in_b.m_maxNumLines && in_a.m_horizontalJustification == in_b.m_horizontalJustification &&
+                    in_a.m_verticalJustification == in_b.m_verticalJustification;
             }
         }
 
@@ -514,13 +599,13 @@ namespace ChilliSource
             m_resourcePool = Core::Application::Get()->GetResourcePool();
             CS_ASSERT(m_resourcePool != nullptr, "Must have a resource pool");
 
-            RenderSystem* renderSystem = Core::Application::Get()->GetRenderSystem();
-            CS_ASSERT(renderSystem != nullptr, "Canvas renderer cannot find render system");
+            m_renderSystem = Core::Application::Get()->GetRenderSystem();
+            CS_ASSERT(m_renderSystem != nullptr, "Canvas renderer cannot find render system");
 
             m_screen = Core::Application::Get()->GetSystem<Core::Screen>();
             CS_ASSERT(m_screen != nullptr, "Canvas renderer cannot find screen system");
 
-            m_overlayBatcher = DynamicSpriteBatchUPtr(new DynamicSpriteBatch(renderSystem));
+            m_overlayBatcher = DynamicSpriteBatchUPtr(new DynamicSpriteBatch(m_renderSystem));
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -560,11 +645,12 @@ namespace ChilliSource
 
             in_canvas->Draw(this);
 
-			m_overlayBatcher->DisableScissoring();
-			m_overlayBatcher->ForceRender();
+			m_commandBuffer.DisableSpriteScissoring();
+			m_commandBuffer.FlushSprites();
+			m_commandBuffer.Execute(m_renderSystem, m_overlayBatcher.get());
+			m_commandBuffer.Clear();
 
             m_materialGUICache.clear();
-			m_canvasSprite.pMaterial = nullptr;
 		}
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -597,7 +683,7 @@ namespace ChilliSource
                 m_scissorSizes.push_back(vNewSize);
             }
 
-            m_overlayBatcher->EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
+            m_commandBuffer.EnableSpriteScissoring(m_scissorPositions.back(), m_scissorSizes.back());
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -610,13 +696,13 @@ namespace ChilliSource
 
                 if(!m_scissorPositions.empty())
                 {
-                    m_overlayBatcher->EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
+                    m_commandBuffer.EnableSpriteScissoring(m_scissorPositions.back(), m_scissorSizes.back());
                 }
             }
 
             if(m_scissorPositions.empty())
             {
-                m_overlayBatcher->DisableScissoring();
+                m_commandBuffer.DisableSpriteScissoring();
             }
         }
         //----------------------------------------------------------------------------
@@ -624,11 +710,11 @@ namespace ChilliSource
         void CanvasRenderer::DrawBox(const Core::Matrix3& in_transform, const Core::Vector2& in_size, const Core::Vector2& in_offset, const TextureCSPtr& in_texture, const Rendering::UVs& in_UVs,
                                      const Core::Colour& in_colour, AlignmentAnchor in_anchor)
         {
-            m_canvasSprite.pMaterial = GetGUIMaterialForTexture(in_texture);
+            MaterialCSPtr material = GetGUIMaterialForTexture(in_texture);
 
 			UpdateSpriteData(Convert2DTransformTo3D(in_transform), in_size, in_offset, in_UVs, in_colour, in_anchor, m_canvasSprite);
 
-			m_overlayBatcher->Render(m_canvasSprite);
+			m_commandBuffer.RenderSprite(material, m_canvasSprite.sVerts);
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -646,24 +732,28 @@ namespace ChilliSource
             
             result.m_characters.reserve(in_text.size());
 
+            //Decode the text and look up the glyphs once. Lines are then built as runs of glyphs rather than copies of the text.
+            DecodedText decodedText;
+            DecodeText(in_text, in_font, in_properties.m_absCharSpacingOffset, in_properties.m_textScale, decodedText);
+
             //NOTE: | denotes the bounds of the box
             //- |The quick brown fox| jumped over\nthe ferocious honey badger
 
             //Split the string into lines by the forced line breaks (i.e. the \n)
             //- |The quick brown fox| jumped over
             //- |the ferocious honey| badger
-            std::vector<std::string> linesOnNewLine;
-            SplitByNewLine(in_text, linesOnNewLine);
+            std::vector<GlyphRun> linesOnNewLine;
+            SplitByNewLine(decodedText, linesOnNewLine);
 
             //Split the lines further based on the line width, breakable characters and the bounds
             //- |The quick brown fox|
             //- |jumped over        |
             //- |the ferocious honey|
             //- |badger             |
-            std::vector<std::string> linesOnBounds;
+            std::vector<GlyphRun> linesOnBounds;
             for(const auto& line : linesOnNewLine)
             {
-                SplitByBounds(line, in_font, in_properties.m_absCharSpacingOffset, in_properties.m_textScale, in_bounds, linesOnBounds);
+                SplitByBounds(decodedText, line, in_bounds.x, linesOnBounds);
             }
 
             //Only build as many lines as we have been told to. If ZERO is specified
@@ -677,7 +767,7 @@ namespace ChilliSource
             //add an ellipsis if the text doesn't fit.
             if (linesOnBounds.size() > numLines && numLines > 0)
             {
-                linesOnBounds[numLines-1] = AppendEllipsis(linesOnBounds[numLines-1], in_font, in_properties.m_absCharSpacingOffset, in_properties.m_textScale, in_bounds.x);
+                AppendEllipsis(decodedText, linesOnBounds[numLines-1], in_font, in_properties.m_absCharSpacingOffset, in_properties.m_textScale, in_bounds.x);
             }
             
             //The middle of the text label is 0,0. We want to be starting at the top left.
@@ -689,11 +779,10 @@ namespace ChilliSource
             {
                 u32 lineStartIdx = result.m_characters.size();
 
-                auto characterIt = linesOnBounds[lineIdx].begin();
-                while(characterIt != linesOnBounds[lineIdx].end())
+                const GlyphRun& line = linesOnBounds[lineIdx];
+                for(u32 glyphIdx = line.m_start; glyphIdx < line.m_end; ++glyphIdx)
                 {
-                    auto character = Core::UTF8StringUtils::Next(characterIt);
-                    auto builtCharacter(BuildCharacter(character, in_font, cursorX, cursorY, in_properties.m_textScale, in_properties.m_absCharSpacingOffset));
+                    auto builtCharacter(BuildCharacter(decodedText.m_infos[glyphIdx], in_font, cursorX, cursorY, in_properties.m_textScale, in_properties.m_absCharSpacingOffset));
                     
                     cursorX += builtCharacter.m_advance;
                     
@@ -705,7 +794,10 @@ namespace ChilliSource
                 }
 
                 f32 lineWidth = cursorX - cursorXReturnPos;
-                ApplyHorizontalTextJustifications(in_properties.m_horizontalJustification, in_bounds.x, lineStartIdx, result.m_characters.size() - 1, lineWidth, result.m_characters);
+                if(result.m_characters.size() > lineStartIdx)
+                {
+                    ApplyHorizontalTextJustifications(in_properties.m_horizontalJustification, in_bounds.x, lineStartIdx, result.m_characters.size() - 1, lineWidth, result.m_characters);
+                }
 
                 result.m_width = std::max(lineWidth, result.m_width);
 
@@ -719,10 +811,62 @@ namespace ChilliSource
             return result;
         }
         //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        CanvasRenderer::BuiltTextCSPtr CanvasRenderer::GetBuiltText(const std::string& in_text, const FontCSPtr& in_font, const Core::Vector2& in_bounds, const TextProperties& in_properties)
+        {
+            std::size_t hash = std::hash<std::string>()(in_text);
+            hash = CombineHash(hash, std::hash<const Font*>()(in_font.get()));
+            hash = CombineHash(hash, std::hash<u32>()(in_font->GetBuildVersion()));
+            hash = CombineHash(hash, std::hash<f32>()(in_bounds.x));
+            hash = CombineHash(hash, std::hash<f32>()(in_bounds.y));
+            hash = CombineHash(hash, HashTextProperties(in_properties));
+            
+            auto lookupIt = m_builtTextCacheLookup.find(hash);
+            if (lookupIt != m_builtTextCacheLookup.end())
+            {
+                auto cacheIt = lookupIt->second;
+                
+                //The font is checked through the weak pointer so that a new font allocated in place of a released one isn't matched,
+                //and by build version so that text built before the font was rebuilt in place isn't matched.
+                if (cacheIt->m_fontPtr == in_font.get() && cacheIt->m_font.lock() == in_font && cacheIt->m_fontBuildVersion == in_font->GetBuildVersion() &&
+                    cacheIt->m_bounds == in_bounds && cacheIt->m_text == in_text &&
+                    AreTextPropertiesEqual(cacheIt->m_properties, in_properties) == true)
+                {
+                    m_builtTextCache.splice(m_builtTextCache.begin(), m_builtTextCache, cacheIt);
+                    return cacheIt->m_builtText;
+                }
+                
+                //Either the hash collided or the entry is stale, so it is replaced.
+                m_builtTextCache.erase(cacheIt);
+                m_builtTextCacheLookup.erase(lookupIt);
+            }
+            
+            if (m_builtTextCache.size() >= k_maxCachedBuiltTexts)
+            {
+                m_builtTextCacheLookup.erase(m_builtTextCache.back().m_hash);
+                m_builtTextCache.pop_back();
+            }
+            
+            CachedBuiltText entry;
+            entry.m_hash = hash;
+            entry.m_text = in_text;
+            entry.m_font = in_font;
+            entry.m_fontPtr = in_font.get();
+            entry.m_fontBuildVersion = in_font->GetBuildVersion();
+            entry.m_bounds = in_bounds;
+            entry.m_properties = in_properties;
+            entry.m_builtText = std::make_shared<BuiltText>(BuildText(in_text, in_font, in_bounds, in_properties));
+            
+            m_builtTextCache.push_front(std::move(entry));
+            m_builtTextCacheLookup.insert(std::make_pair(hash, m_builtTextCache.begin()));
+            
+            return m_builtTextCache.front().m_builtText;
+        }
+        //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
 		void CanvasRenderer::DrawText(const std::vector<DisplayCharacterInfo>& in_characters, const Core::Matrix3& in_transform, const Core::Colour& in_colour, const TextureCSPtr& in_texture)
 		{
-            m_canvasSprite.pMaterial = GetGUIMaterialForTexture(in_texture);
+            MaterialCSPtr material = GetGUIMaterialForTexture(in_texture);
 
             Core::Matrix4 matTransform = Convert2DTransformTo3D(in_transform);
             Core::Matrix4 matTransformedLocal;
@@ -731,16 +875,18 @@ namespace ChilliSource
             {
                 matTransformedLocal = Core::Matrix4::CreateTranslation(Core::Vector3(character.m_position, 0.0f)) * matTransform;
                 UpdateSpriteData(matTransformedLocal, character.m_packedImageSize, Core::Vector2::k_zero, character.m_UVs, in_colour, AlignmentAnchor::k_topLeft, m_canvasSprite);
-                m_overlayBatcher->Render(m_canvasSprite);
+                m_commandBuffer.RenderSprite(material, m_canvasSprite.sVerts);
 			}
 		}
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
         void CanvasRenderer::OnDestroy()
         {
+            m_commandBuffer.Clear();
             m_overlayBatcher = nullptr;
             m_materialGUICache.clear();
-            m_canvasSprite.pMaterial = nullptr;
+            m_builtTextCache.clear();
+            m_builtTextCacheLookup.clear();
         }
 	}
 }
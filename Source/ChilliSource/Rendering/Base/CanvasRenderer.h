@@ -33,10 +33,12 @@
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Base/HorizontalTextJustification.h>
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
 #include <ChilliSource/Rendering/Base/VerticalTextJustification.h>
 #include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
 #include <ChilliSource/Rendering/Sprite/SpriteComponent.h>
 
+#include <list>
 #include <unordered_map>
 
 namespace ChilliSource
@@ -93,6 +95,8 @@ namespace ChilliSource
                 f32 m_width;
                 f32 m_height;
             };
+            
+            typedef std::shared_ptr<const BuiltText> BuiltTextCSPtr;
             //----------------------------------------------------------------------------
             /// @author S Downie
             ///
@@ -104,7 +108,8 @@ namespace ChilliSource
             //----------------------------------------------------------
 			/// Render
 			///
-			/// Draw UI
+			/// Draw UI. The canvas is recorded into a command buffer
+			/// which is then executed in a single pass.
 			//----------------------------------------------------------
 			void Render(UI::Canvas* in_canvas);
             //----------------------------------------------------------------------------
@@ -154,6 +159,22 @@ namespace ChilliSource
             //----------------------------------------------------------------------------
             BuiltText BuildText(const std::string& in_text, const FontCSPtr& in_font, const Core::Vector2& in_bounds, const TextProperties& in_textProperties) const;
             //----------------------------------------------------------------------------
+            /// Gets the built text for the given text, font, bounds and properties. The
+            /// most recently used built text is cached, so text shared between
+            /// labels, or rebuilt with the same parameters, is only built once. Text is
+            /// built again if the font has been rebuilt since it was cached.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Text to convert to display characters (UTF-8)
+            /// @param Font
+            /// @param Max bounds
+            /// @param The text properties.
+            ///
+            /// @return The built text. This is shared and must not be modified.
+            //----------------------------------------------------------------------------
+            BuiltTextCSPtr GetBuiltText(const std::string& in_text, const FontCSPtr& in_font, const Core::Vector2& in_bounds, const TextProperties& in_textProperties);
+            //----------------------------------------------------------------------------
             /// Build the sprites for each given character and render them to screen.
             ///
             /// @param Characters in text space
@@ -203,18 +224,40 @@ namespace ChilliSource
             MaterialCSPtr GetGUIMaterialForTexture(const TextureCSPtr& in_texture);
 
 		private:
+            //----------------------------------------------------------------------------
+            /// An entry in the built text cache, containing everything the text was
+            /// built from.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct CachedBuiltText
+            {
+                std::size_t m_hash;
+                std::string m_text;
+                std::weak_ptr<const Font> m_font;
+                const Font* m_fontPtr;
+                u32 m_fontBuildVersion;
+                Core::Vector2 m_bounds;
+                TextProperties m_properties;
+                BuiltTextCSPtr m_builtText;
+            };
             
 			SpriteBatch::SpriteData m_canvasSprite;
 
             DynamicSpriteBatchUPtr m_overlayBatcher;
+            RenderCommandBuffer m_commandBuffer;
 
 			std::vector<Core::Vector2> m_scissorPositions;
             std::vector<Core::Vector2> m_scissorSizes;
 
             std::unordered_map<TextureCSPtr, MaterialCSPtr> m_materialGUICache;
+            
+            std::list<CachedBuiltText> m_builtTextCache;
+            std::unordered_map<std::size_t, std::list<CachedBuiltText>::iterator> m_builtTextCacheLookup;
 
             Core::ResourcePool* m_resourcePool;
             Core::Screen* m_screen;
+            RenderSystem* m_renderSystem;
             MaterialFactory* m_materialFactory;
 		};
 	}
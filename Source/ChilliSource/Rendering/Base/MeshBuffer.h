@@ -66,10 +66,20 @@ namespace ChilliSource
             /// Lock Vertex
             ///
             /// Obtain a handle to the buffer memory in order
-            /// to map data
+            /// to map data. Buffers created with the
+            /// k_writeNoOverwrite access flag lock only the given
+            /// range, and the returned pointer is to the start of
+            /// that range. The range must not be used by any draws
+            /// that are still pending, which allows it to be written
+            /// without waiting on draws using the rest of the buffer.
+            /// Locking from the start of the buffer discards its
+            /// previous contents.
+            ///
             /// @param Outputs the pointer to the buffer
             /// @param The offset to the subset of the buffer
-            /// @param The vertex layout stride
+            /// @param The vertex layout stride, or for
+            /// k_writeNoOverwrite buffers the size in bytes of the
+            /// range to lock. Zero locks to the end of the buffer.
             /// @return If successful
             //-----------------------------------------------------
 			virtual bool LockVertex(f32** outppBuffer, u32 inDataOffset, u32 inDataStride) = 0;
@@ -92,6 +102,21 @@ namespace ChilliSource
             //-----------------------------------------------------
 			virtual bool UnlockVertex() = 0;
             //-----------------------------------------------------
+            /// Releases the buffer from mapping. For buffers created
+            /// with the k_writeNoOverwrite access flag only the given
+            /// number of bytes from the start of the locked range are
+            /// kept, which allows a range to be locked before it is
+            /// known how much of it will be written. Other buffers
+            /// ignore the size.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The number of bytes written to the locked range.
+            ///
+            /// @return If successful
+            //-----------------------------------------------------
+			virtual bool UnlockVertex(u32 in_numBytesWritten) = 0;
+            //-----------------------------------------------------
             /// Unlock Index
             ///
             /// Releases the buffer from mapping
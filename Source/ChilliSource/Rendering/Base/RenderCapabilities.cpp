@@ -28,7 +28,9 @@
 
 #include <ChilliSource/Rendering/Base/RenderCapabilities.h>
 
-#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
+#if defined CS_RENDERBACKEND_NULL
+#include <CSBackend/Rendering/Null/Base/RenderCapabilities.h>
+#elif defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
 #include <CSBackend/Rendering/OpenGL/Base/RenderCapabilities.h>
 #endif
 
@@ -42,7 +44,9 @@ namespace ChilliSource
         //-------------------------------------------------------
         RenderCapabilitiesUPtr RenderCapabilities::Create()
         {
-#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
+#if defined CS_RENDERBACKEND_NULL
+            return RenderCapabilitiesUPtr(new CSBackend::Null::RenderCapabilities());
+#elif defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
             return RenderCapabilitiesUPtr(new CSBackend::OpenGL::RenderCapabilities());
 #else
             return nullptr;
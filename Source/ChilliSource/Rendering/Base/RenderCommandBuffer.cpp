@@ -0,0 +1,424 @@
+//
+//  RenderCommandBuffer.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
+
+#include <ChilliSource/Rendering/Base/MeshBuffer.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
+#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        namespace
+        {
+            //Marks a material that hasn't been given a handle in the sprite batch yet.
+            const u32 k_unresolvedSpriteMaterial = std::numeric_limits<u32>::max();
+        }
+        
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::SetSortKey(u64 in_sortKey)
+        {
+            m_sortKey = in_sortKey;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::ApplyMaterial(const MaterialCSPtr& in_material, ShaderPass in_shaderPass)
+        {
+            CS_ASSERT(in_material != nullptr, "Cannot apply a null material.");
+            
+            AddCommand(CommandType::k_applyMaterial, AddMaterial(in_material), static_cast<u32>(in_shaderPass));
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::ApplyJoints(const std::vector<Core::Vector4>& in_jointPalette)
+        {
+            AddCommand(CommandType::k_applyJoints, static_cast<u32>(m_jointPalettes.size()));
+            m_jointPalettes.push_back(&in_jointPalette);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::UpdateVertexBuffer(MeshBuffer* in_meshBuffer, const std::vector<u8>& in_vertexData)
+        {
+            CS_ASSERT(in_meshBuffer != nullptr, "Cannot update a null mesh buffer.");
+            
+            AddCommand(CommandType::k_updateVertexBuffer, static_cast<u32>(m_vertexUploads.size()));
+            
+            VertexUploadData upload;
+            upload.m_meshBuffer = in_meshBuffer;
+            upload.m_vertexData = &in_vertexData;
+            m_vertexUploads.push_back(upload);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::SetLight(LightComponent* in_lightComponent)
+        {
+            AddCommand(CommandType::k_setLight, static_cast<u32>(m_lights.size()));
+            m_lights.push_back(in_lightComponent);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::EnableAlphaBlending(bool in_enabled)
+        {
+            AddCommand(CommandType::k_enableAlphaBlending, 0, in_enabled ? 1 : 0);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::EnableDepthWriting(bool in_enabled)
+        {
+            AddCommand(CommandType::k_enableDepthWriting, 0, in_enabled ? 1 : 0);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::LockAlphaBlending()
+        {
+            AddCommand(CommandType::k_lockAlphaBlending);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::UnlockAlphaBlending()
+        {
+            AddCommand(CommandType::k_unlockAlphaBlending);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::LockDepthWriting()
+        {
+            AddCommand(CommandType::k_lockDepthWriting);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::UnlockDepthWriting()
+        {
+            AddCommand(CommandType::k_unlockDepthWriting);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::SetBlendFunction(BlendMode in_srcFunc, BlendMode in_dstFunc)
+        {
+            AddCommand(CommandType::k_setBlendFunction, static_cast<u32>(in_srcFunc), static_cast<u32>(in_dstFunc));
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::LockBlendFunction()
+        {
+            AddCommand(CommandType::k_lockBlendFunction);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::UnlockBlendFunction()
+        {
+            AddCommand(CommandType::k_unlockBlendFunction);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::RenderBuffer(MeshBuffer* in_meshBuffer, u32 in_offset, u32 in_numIndices, const Core::Matrix4& in_worldMatrix)
+        {
+            CS_ASSERT(in_meshBuffer != nullptr, "Cannot render a null mesh buffer.");
+            
+            AddCommand(CommandType::k_renderBuffer, static_cast<u32>(m_draws.size()));
+            
+            DrawData draw;
+            draw.m_worldMatrix = in_worldMatrix;
+            draw.m_meshBuffer = in_meshBuffer;
+            draw.m_offset = in_offset;
+            draw.m_count = in_numIndices;
+            m_draws.push_back(draw);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::RenderVertexBuffer(MeshBuffer* in_meshBuffer, u32 in_offset, u32 in_numVertices, const Core::Matrix4& in_worldMatrix)
+        {
+            CS_ASSERT(in_meshBuffer != nullptr, "Cannot render a null mesh buffer.");
+            
+            AddCommand(CommandType::k_renderVertexBuffer, static_cast<u32>(m_draws.size()));
+            
+            DrawData draw;
+            draw.m_worldMatrix = in_worldMatrix;
+            draw.m_meshBuffer = in_meshBuffer;
+            draw.m_offset = in_offset;
+            draw.m_count = in_numVertices;
+            m_draws.push_back(draw);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::RenderSprite(const MaterialCSPtr& in_material, const SpriteBatch::SpriteVertex* in_vertices)
+        {
+            CS_ASSERT(in_material != nullptr, "Cannot render a sprite with a null material.");
+            
+            AddCommand(CommandType::k_renderSprite, AddMaterial(in_material), static_cast<u32>(m_spriteVertices.size()));
+            m_spriteVertices.insert(m_spriteVertices.end(), in_vertices, in_vertices + k_numSpriteVerts);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::EnableSpriteScissoring(const Core::Vector2& in_position, const Core::Vector2& in_size)
+        {
+            AddCommand(CommandType::k_enableSpriteScissoring, static_cast<u32>(m_scissorRegions.size()));
+            m_scissorRegions.push_back(in_position);
+            m_scissorRegions.push_back(in_size);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::DisableSpriteScissoring()
+        {
+            AddCommand(CommandType::k_disableSpriteScissoring);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::FlushSprites()
+        {
+            AddCommand(CommandType::k_flushSprites);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::Append(const RenderCommandBuffer& in_commandBuffer)
+        {
+            CS_ASSERT(&in_commandBuffer != this, "Cannot append a command buffer to itself.");
+            
+            const u32 materialOffset = static_cast<u32>(m_materials.size());
+            const u32 jointOffset = static_cast<u32>(m_jointPalettes.size());
+            const u32 vertexUploadOffset = static_cast<u32>(m_vertexUploads.size());
+            const u32 lightOffset = static_cast<u32>(m_lights.size());
+            const u32 drawOffset = static_cast<u32>(m_draws.size());
+            const u32 spriteVertexOffset = static_cast<u32>(m_spriteVertices.size());
+            const u32 scissorRegionOffset = static_cast<u32>(m_scissorRegions.size());
+            
+            m_materials.insert(m_materials.end(), in_commandBuffer.m_materials.begin(), in_commandBuffer.m_materials.end());
+            m_jointPalettes.insert(m_jointPalettes.end(), in_commandBuffer.m_jointPalettes.begin(), in_commandBuffer.m_jointPalettes.end());
+            m_vertexUploads.insert(m_vertexUploads.end(), in_commandBuffer.m_vertexUploads.begin(), in_commandBuffer.m_vertexUploads.end());
+            m_lights.insert(m_lights.end(), in_commandBuffer.m_lights.begin(), in_commandBuffer.m_lights.end());
+            m_draws.insert(m_draws.end(), in_commandBuffer.m_draws.begin(), in_commandBuffer.m_draws.end());
+            m_spriteVertices.insert(m_spriteVertices.end(), in_commandBuffer.m_spriteVertices.begin(), in_commandBuffer.m_spriteVertices.end());
+            m_scissorRegions.insert(m_scissorRegions.end(), in_commandBuffer.m_scissorRegions.begin(), in_commandBuffer.m_scissorRegions.end());
+            
+            m_commands.reserve(m_commands.size() + in_commandBuffer.m_commands.size());
+            for(Command command : in_commandBuffer.m_commands)
+            {
+                switch(command.m_type)
+                {
+                    case CommandType::k_applyMaterial:
+                        command.m_index += materialOffset;
+                        break;
+                    case CommandType::k_applyJoints:
+                        command.m_index += jointOffset;
+                        break;
+                    case CommandType::k_updateVertexBuffer:
+                        command.m_index += vertexUploadOffset;
+                        break;
+                    case CommandType::k_setLight:
+                        command.m_index += lightOffset;
+                        break;
+                    case CommandType::k_renderBuffer:
+                    case CommandType::k_renderVertexBuffer:
+                        command.m_index += drawOffset;
+                        break;
+                    case CommandType::k_renderSprite:
+                        command.m_index += materialOffset;
+                        command.m_value += spriteVertexOffset;
+                        break;
+                    case CommandType::k_enableSpriteScissoring:
+                        command.m_index += scissorRegionOffset;
+                        break;
+                    default:
+                        break;
+                }
+                
+                m_commands.push_back(command);
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::Sort()
+        {
+            std::stable_sort(m_commands.begin(), m_commands.end(), [](const Command& in_a, const Command& in_b)
+            {
+                return in_a.m_sortKey < in_b.m_sortKey;
+            });
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::Execute(RenderSystem* in_renderSystem, DynamicSpriteBatch* in_spriteBatch)
+        {
+            CS_ASSERT(in_renderSystem != nullptr, "Cannot execute a command buffer without a render system.");
+            CS_ASSERT(in_spriteBatch != nullptr, "Cannot execute a command buffer without a sprite batch.");
+            
+            m_spriteMaterialHandles.assign(m_materials.size(), k_unresolvedSpriteMaterial);
+            
+            for(const auto& command : m_commands)
+            {
+                switch(command.m_type)
+                {
+                    case CommandType::k_applyMaterial:
+                        in_renderSystem->ApplyMaterial(m_materials[command.m_index], static_cast<ShaderPass>(command.m_value));
+                        break;
+                    case CommandType::k_applyJoints:
+                        in_renderSystem->ApplyJoints(*m_jointPalettes[command.m_index]);
+                        break;
+                    case CommandType::k_updateVertexBuffer:
+                    {
+                        const VertexUploadData& upload = m_vertexUploads[command.m_index];
+                        CS_ASSERT(upload.m_vertexData->size() <= upload.m_meshBuffer->GetVertexCapacity(), "Vertex data exceeds the capacity of the mesh buffer.");
+                        
+                        upload.m_meshBuffer->Bind();
+                        
+                        f32* vertexBuffer = nullptr;
+                        if(upload.m_meshBuffer->LockVertex(&vertexBuffer, 0, 0) == true)
+                        {
+                            memcpy(vertexBuffer, upload.m_vertexData->data(), upload.m_vertexData->size());
+                        }
+                        upload.m_meshBuffer->UnlockVertex();
+                        break;
+                    }
+                    case CommandType::k_setLight:
+                        in_renderSystem->SetLight(m_lights[command.m_index]);
+                        break;
+                    case CommandType::k_enableAlphaBlending:
+                        in_renderSystem->EnableAlphaBlending(command.m_value != 0);
+                        break;
+                    case CommandType::k_enableDepthWriting:
+                        in_renderSystem->EnableDepthWriting(command.m_value != 0);
+                        break;
+                    case CommandType::k_lockAlphaBlending:
+                        in_renderSystem->LockAlphaBlending();
+                        break;
+                    case CommandType::k_unlockAlphaBlending:
+                        in_renderSystem->UnlockAlphaBlending();
+                        break;
+                    case CommandType::k_lockDepthWriting:
+                        in_renderSystem->LockDepthWriting();
+                        break;
+                    case CommandType::k_unlockDepthWriting:
+                        in_renderSystem->UnlockDepthWriting();
+                        break;
+                    case CommandType::k_setBlendFunction:
+                        in_renderSystem->SetBlendFunction(static_cast<BlendMode>(command.m_index), static_cast<BlendMode>(command.m_value));
+                        break;
+                    case CommandType::k_lockBlendFunction:
+                        in_renderSystem->LockBlendFunction();
+                        break;
+                    case CommandType::k_unlockBlendFunction:
+                        in_renderSystem->UnlockBlendFunction();
+                        break;
+                    case CommandType::k_renderBuffer:
+                    {
+                        const DrawData& draw = m_draws[command.m_index];
+                        draw.m_meshBuffer->Bind();
+                        in_renderSystem->RenderBuffer(draw.m_meshBuffer, draw.m_offset, draw.m_count, draw.m_worldMatrix);
+                        break;
+                    }
+                    case CommandType::k_renderVertexBuffer:
+                    {
+                        const DrawData& draw = m_draws[command.m_index];
+                        draw.m_meshBuffer->Bind();
+                        in_renderSystem->RenderVertexBuffer(draw.m_meshBuffer, draw.m_offset, draw.m_count, draw.m_worldMatrix);
+                        break;
+                    }
+                    case CommandType::k_renderSprite:
+                    {
+                        //Sorted sprites often alternate between materials, which defeats the batch's most recent material check, so resolve each handle once.
+                        u32& materialHandle = m_spriteMaterialHandles[command.m_index];
+                        if(materialHandle == k_unresolvedSpriteMaterial)
+                        {
+                            materialHandle = in_spriteBatch->GetMaterialHandle(m_materials[command.m_index]);
+                        }
+                        
+                        in_spriteBatch->Render(materialHandle, m_spriteVertices.data() + command.m_value);
+                        break;
+                    }
+                    case CommandType::k_enableSpriteScissoring:
+                        in_spriteBatch->EnableScissoring(m_scissorRegions[command.m_index], m_scissorRegions[command.m_index + 1]);
+                        break;
+                    case CommandType::k_disableSpriteScissoring:
+                        in_spriteBatch->DisableScissoring();
+                        break;
+                    case CommandType::k_flushSprites:
+                        //Flushing releases the batch's material handles.
+                        in_spriteBatch->ForceRender();
+                        std::fill(m_spriteMaterialHandles.begin(), m_spriteMaterialHandles.end(), k_unresolvedSpriteMaterial);
+                        break;
+                }
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::Clear()
+        {
+            m_sortKey = 0;
+            m_commands.clear();
+            m_materials.clear();
+            m_jointPalettes.clear();
+            m_vertexUploads.clear();
+            m_lights.clear();
+            m_draws.clear();
+            m_spriteVertices.clear();
+            m_scissorRegions.clear();
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool RenderCommandBuffer::IsEmpty() const
+        {
+            return m_commands.empty();
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        const std::vector<RenderCommandBuffer::Command>& RenderCommandBuffer::GetCommands() const
+        {
+            return m_commands;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderCommandBuffer::AddCommand(CommandType in_type, u32 in_index, u32 in_value)
+        {
+            Command command;
+            command.m_sortKey = m_sortKey;
+            command.m_index = in_index;
+            command.m_value = in_value;
+            command.m_type = in_type;
+            m_commands.push_back(command);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        u32 RenderCommandBuffer::AddMaterial(const MaterialCSPtr& in_material)
+        {
+            //Consecutive commands usually share a material, so only the most recent one is checked.
+            if(m_materials.empty() == false && m_materials.back() == in_material)
+            {
+                return static_cast<u32>(m_materials.size() - 1);
+            }
+            
+            m_materials.push_back(in_material);
+            return static_cast<u32>(m_materials.size() - 1);
+        }
+	}
+}
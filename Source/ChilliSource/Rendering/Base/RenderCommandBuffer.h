@@ -0,0 +1,378 @@
+//
+//  RenderCommandBuffer.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_RENDERCOMMANDBUFFER_H_
+#define _CHILLISOURCE_RENDERING_BASE_RENDERCOMMANDBUFFER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Rendering/Base/BlendMode.h>
+#include <ChilliSource/Rendering/Base/ShaderPass.h>
+#include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //----------------------------------------------------------------------------
+        /// A recorded list of the calls needed to render part of a frame. Render
+        /// components and the canvas renderer record into a command buffer rather
+        /// than calling into the render system directly, so the frame can be built
+        /// off the main thread, merged, sorted and then executed by the render
+        /// system in a single pass.
+        ///
+        /// Recording does not touch the render system, so separate command buffers
+        /// can be recorded concurrently. A single command buffer is not thread safe.
+        ///
+        /// Every command is tagged with the current sort key. Sorting the buffer
+        /// re-orders commands by key while keeping commands with the same key in the
+        /// order they were recorded, so everything recorded under one key is kept
+        /// together.
+        ///
+        /// Command buffers retain their storage when cleared so that, once a scene
+        /// has reached a steady state, recording doesn't allocate.
+        ///
+        /// @author Jordan Brown
+        //----------------------------------------------------------------------------
+        class RenderCommandBuffer final
+        {
+        public:
+            CS_DECLARE_NOCOPY(RenderCommandBuffer);
+            //----------------------------------------------------------------------------
+            /// The type of a recorded command.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            enum class CommandType : u8
+            {
+                k_applyMaterial,
+                k_applyJoints,
+                k_updateVertexBuffer,
+                k_setLight,
+                k_enableAlphaBlending,
+                k_enableDepthWriting,
+                k_lockAlphaBlending,
+                k_unlockAlphaBlending,
+                k_lockDepthWriting,
+                k_unlockDepthWriting,
+                k_setBlendFunction,
+                k_lockBlendFunction,
+                k_unlockBlendFunction,
+                k_renderBuffer,
+                k_renderVertexBuffer,
+                k_renderSprite,
+                k_enableSpriteScissoring,
+                k_disableSpriteScissoring,
+                k_flushSprites
+            };
+            //----------------------------------------------------------------------------
+            /// A single recorded command. The meaning of the index and value depends on
+            /// the command type; for most types the index refers to data held in one of
+            /// the buffer's data lists.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct Command
+            {
+                u64 m_sortKey;
+                u32 m_index;
+                u32 m_value;
+                CommandType m_type;
+            };
+            //----------------------------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            RenderCommandBuffer() = default;
+            //----------------------------------------------------------------------------
+            /// Sets the sort key that subsequently recorded commands are tagged with.
+            /// This is reset to 0 when the buffer is cleared.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The sort key.
+            //----------------------------------------------------------------------------
+            void SetSortKey(u64 in_sortKey);
+            //----------------------------------------------------------------------------
+            /// Records applying the given material for the given shader pass.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The material.
+            /// @param The shader pass.
+            //----------------------------------------------------------------------------
+            void ApplyMaterial(const MaterialCSPtr& in_material, ShaderPass in_shaderPass);
+            //----------------------------------------------------------------------------
+            /// Records applying the given joint palette. The palette is not copied, so
+            /// must remain alive and unchanged until the buffer has been executed.
+            /// Palettes are owned by the animation group they were built by, which
+            /// only rebuilds them when its pose changes.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The joint palette.
+            //----------------------------------------------------------------------------
+            void ApplyJoints(const std::vector<Core::Vector4>& in_jointPalette);
+            //----------------------------------------------------------------------------
+            /// Records writing the given vertex data into the given mesh buffer. Neither
+            /// is copied, so both must remain alive and unchanged until the buffer has
+            /// been executed. This allows vertex data to be built while recording, which
+            /// may be off the main thread, and uploaded when the buffer is executed.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The mesh buffer. This should have been created with dynamic
+            /// usage.
+            /// @param The vertex data. This must not be larger than the vertex
+            /// capacity of the mesh buffer.
+            //----------------------------------------------------------------------------
+            void UpdateVertexBuffer(MeshBuffer* in_meshBuffer, const std::vector<u8>& in_vertexData);
+            //----------------------------------------------------------------------------
+            /// Records setting the current light. The light must remain alive until
+            /// the buffer has been executed.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The light component. Can be null.
+            //----------------------------------------------------------------------------
+            void SetLight(LightComponent* in_lightComponent);
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Whether alpha blending should be enabled.
+            //----------------------------------------------------------------------------
+            void EnableAlphaBlending(bool in_enabled);
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param Whether depth writing should be enabled.
+            //----------------------------------------------------------------------------
+            void EnableDepthWriting(bool in_enabled);
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void LockAlphaBlending();
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void UnlockAlphaBlending();
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void LockDepthWriting();
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void UnlockDepthWriting();
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The source blend function.
+            /// @param The destination blend function.
+            //----------------------------------------------------------------------------
+            void SetBlendFunction(BlendMode in_srcFunc, BlendMode in_dstFunc);
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void LockBlendFunction();
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void UnlockBlendFunction();
+            //----------------------------------------------------------------------------
+            /// Records binding the given mesh buffer and rendering it using its index
+            /// buffer. The mesh buffer must remain alive until the buffer has been
+            /// executed.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The mesh buffer.
+            /// @param The offset into the index buffer.
+            /// @param The number of indices to render.
+            /// @param The world matrix.
+            //----------------------------------------------------------------------------
+            void RenderBuffer(MeshBuffer* in_meshBuffer, u32 in_offset, u32 in_numIndices, const Core::Matrix4& in_worldMatrix);
+            //----------------------------------------------------------------------------
+            /// Records binding the given mesh buffer and rendering its vertices without
+            /// an index buffer. The mesh buffer must remain alive until the buffer has
+            /// been executed.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The mesh buffer.
+            /// @param The offset into the vertex buffer.
+            /// @param The number of vertices to render.
+            /// @param The world matrix.
+            //----------------------------------------------------------------------------
+            void RenderVertexBuffer(MeshBuffer* in_meshBuffer, u32 in_offset, u32 in_numVertices, const Core::Matrix4& in_worldMatrix);
+            //----------------------------------------------------------------------------
+            /// Records submitting a sprite to the dynamic sprite batch. The vertices are
+            /// copied, as recording can happen off the main thread, and are written
+            /// into the batch's mapped vertex buffer when the buffer is executed.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The material to render the sprite with.
+            /// @param The four vertices of the sprite, in the order given by
+            /// SpriteBatch::Verts.
+            //----------------------------------------------------------------------------
+            void RenderSprite(const MaterialCSPtr& in_material, const SpriteBatch::SpriteVertex* in_vertices);
+            //----------------------------------------------------------------------------
+            /// Records enabling scissoring in the dynamic sprite batch.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Bottom left position of the scissor rect.
+            /// @param Size of the scissor rect.
+            //----------------------------------------------------------------------------
+            void EnableSpriteScissoring(const Core::Vector2& in_position, const Core::Vector2& in_size);
+            //----------------------------------------------------------------------------
+            /// Records disabling scissoring in the dynamic sprite batch.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void DisableSpriteScissoring();
+            //----------------------------------------------------------------------------
+            /// Records flushing the dynamic sprite batch. This should be recorded before
+            /// anything which must be drawn after the sprites already submitted.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void FlushSprites();
+            //----------------------------------------------------------------------------
+            /// Appends the commands recorded in the given buffer to the end of this one.
+            /// This is used to merge buffers that were recorded in parallel.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The buffer to append.
+            //----------------------------------------------------------------------------
+            void Append(const RenderCommandBuffer& in_commandBuffer);
+            //----------------------------------------------------------------------------
+            /// Re-orders the commands by sort key. Commands with the same sort key keep
+            /// the order they were recorded in.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void Sort();
+            //----------------------------------------------------------------------------
+            /// Executes all recorded commands in order.
+            ///
+            /// This must be called on the main thread. The sprite batch's handle to each
+            /// material is looked up once, on the first sprite that uses it, rather
+            /// than for every sprite.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The render system to execute the commands with.
+            /// @param The dynamic sprite batch that sprite commands are submitted to.
+            //----------------------------------------------------------------------------
+            void Execute(RenderSystem* in_renderSystem, DynamicSpriteBatch* in_spriteBatch);
+            //----------------------------------------------------------------------------
+            /// Removes all recorded commands and releases the materials they reference.
+            /// The storage is retained.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void Clear();
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not any commands have been recorded.
+            //----------------------------------------------------------------------------
+            bool IsEmpty() const;
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The recorded commands.
+            //----------------------------------------------------------------------------
+            const std::vector<Command>& GetCommands() const;
+            
+        private:
+            //----------------------------------------------------------------------------
+            /// The data needed to render a mesh buffer.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct DrawData
+            {
+                Core::Matrix4 m_worldMatrix;
+                MeshBuffer* m_meshBuffer;
+                u32 m_offset;
+                u32 m_count;
+            };
+            //----------------------------------------------------------------------------
+            /// The data needed to write vertex data into a mesh buffer.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct VertexUploadData
+            {
+                MeshBuffer* m_meshBuffer;
+                const std::vector<u8>* m_vertexData;
+            };
+            //----------------------------------------------------------------------------
+            /// Adds a command of the given type, tagged with the current sort key.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The command type.
+            /// @param The command index.
+            /// @param The command value.
+            //----------------------------------------------------------------------------
+            void AddCommand(CommandType in_type, u32 in_index = 0, u32 in_value = 0);
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The material.
+            ///
+            /// @return The index of the material in the material list, adding it if it
+            /// isn't the most recently added material.
+            //----------------------------------------------------------------------------
+            u32 AddMaterial(const MaterialCSPtr& in_material);
+            
+            u64 m_sortKey = 0;
+            std::vector<Command> m_commands;
+            std::vector<MaterialCSPtr> m_materials;
+            std::vector<const std::vector<Core::Vector4>*> m_jointPalettes;
+            std::vector<VertexUploadData> m_vertexUploads;
+            std::vector<LightComponent*> m_lights;
+            std::vector<DrawData> m_draws;
+            std::vector<SpriteBatch::SpriteVertex> m_spriteVertices;
+            std::vector<Core::Vector2> m_scissorRegions;
+            std::vector<u32> m_spriteMaterialHandles;
+        };
+	}
+}
+
+#endif
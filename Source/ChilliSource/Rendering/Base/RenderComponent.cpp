@@ -84,6 +84,12 @@ namespace ChilliSource
 			mpMaterial = inpMaterial;
 		}
 		//-----------------------------------------------------------
+		//-----------------------------------------------------------
+		void RenderComponent::InvalidateBounds()
+		{
+			InvalidateVolume();
+		}
+		//-----------------------------------------------------------
 		/// Get Material
 		//-----------------------------------------------------------
 		const MaterialCSPtr& RenderComponent::GetMaterial() const
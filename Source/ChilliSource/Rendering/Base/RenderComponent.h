@@ -77,6 +77,17 @@ namespace ChilliSource
 			/// @return bounding sphere
 			//----------------------------------------------------
 			virtual const Core::Sphere& GetBoundingSphere(){return mBoundingSphere;}
+            //----------------------------------------------------
+            /// Discards any cached bounds and notifies the scene
+            /// that they have changed. Setters which change the
+            /// local bounds call this themselves; it only needs to
+            /// be called directly when a resource the bounds depend
+            /// on changes in place, e.g. a texture being reloaded.
+            /// This must be called from the main thread.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------
+            virtual void InvalidateBounds();
 			//----------------------------------------------------
 			/// Is Visible
 			///
@@ -123,24 +134,28 @@ namespace ChilliSource
             /// Render 
             ///
             /// Purely abstract method that render components
-            /// overload in order to draw themselves. 
+            /// overload in order to draw themselves. The draw
+            /// calls are recorded into the given command buffer
+            /// rather than issued directly, so this may be called
+            /// off the main thread if the renderer has parallel
+            /// recording enabled.
             ///
-            /// @param Render system
+            /// @param Command buffer to record into
             /// @param Active camera component
             /// @param The current shader pass.
             //-----------------------------------------------------
-            virtual void Render(RenderSystem* inpRenderSystem, CameraComponent* inpCam, ShaderPass inePass) = 0;
+            virtual void Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, ShaderPass inePass) = 0;
             //-----------------------------------------------------
             /// Render Shadow Map
             ///
             /// Render the mesh to the shadow map
             ///
-            /// @param Render system
+            /// @param Command buffer to record into
             /// @param Active camera component
             /// @param Material to render static shadows with
             /// @param Material to render skinned shadows with
             //-----------------------------------------------------
-            virtual void RenderShadowMap(RenderSystem* inpRenderSystem, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap) = 0;
+            virtual void RenderShadowMap(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap) = 0;
             //-----------------------------------------------------------
 			/// Set Material
 			///
@@ -0,0 +1,141 @@
+//
+//  RenderQueue.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Base/RenderQueue.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderQueue::BeginFrame()
+        {
+            m_renderables.clear();
+            m_cameras.clear();
+            m_lights.clear();
+            m_directionalLights.clear();
+            m_pointLights.clear();
+            m_animatedMeshes.clear();
+            m_visibleRenderables.clear();
+            m_opaqueRenderables.clear();
+            m_transparentRenderables.clear();
+            m_shadowCasters.clear();
+            m_pointLightRenderables.clear();
+            m_volumeQueryResults.clear();
+            m_ambientLight = nullptr;
+
+            for (u32 i = 0; i < m_frameStartCapacities.size(); ++i)
+            {
+                m_frameStartCapacities[i] = GetCapacity(static_cast<Queue>(i));
+            }
+
+            m_currentStats = FrameStats();
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderQueue::EndFrame()
+        {
+            for (u32 i = 0; i < m_frameStartCapacities.size(); ++i)
+            {
+                if (GetCapacity(static_cast<Queue>(i)) != m_frameStartCapacities[i])
+                {
+                    ++m_currentStats.m_numAllocations;
+                }
+            }
+
+            m_currentStats.m_numRenderables = static_cast<u32>(m_renderables.size());
+            m_currentStats.m_numCameras = static_cast<u32>(m_cameras.size());
+            m_currentStats.m_numDirectionalLights = static_cast<u32>(m_directionalLights.size());
+            m_currentStats.m_numPointLights = static_cast<u32>(m_pointLights.size());
+            m_currentStats.m_numVisibleRenderables = static_cast<u32>(m_visibleRenderables.size());
+            m_currentStats.m_numOpaqueRenderables = static_cast<u32>(m_opaqueRenderables.size());
+            m_currentStats.m_numTransparentRenderables = static_cast<u32>(m_transparentRenderables.size());
+            m_currentStats.m_numShadowCasters = static_cast<u32>(m_shadowCasters.size());
+
+            m_frameStats = m_currentStats;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderQueue::BeginPointLightPass()
+        {
+            m_pointLightRenderables.clear();
+            m_pointLightPassStartCapacity = m_pointLightRenderables.capacity();
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void RenderQueue::EndPointLightPass()
+        {
+            if (m_pointLightRenderables.capacity() != m_pointLightPassStartCapacity)
+            {
+                ++m_currentStats.m_numAllocations;
+            }
+
+            m_currentStats.m_numPointLightRenderables += static_cast<u32>(m_pointLightRenderables.size());
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        std::size_t RenderQueue::GetCapacity(Queue in_queue) const
+        {
+            switch (in_queue)
+            {
+                case Queue::k_renderables:
+                    return m_renderables.capacity();
+                case Queue::k_cameras:
+                    return m_cameras.capacity();
+                case Queue::k_lights:
+                    return m_lights.capacity();
+                case Queue::k_directionalLights:
+                    return m_directionalLights.capacity();
+                case Queue::k_pointLights:
+                    return m_pointLights.capacity();
+                case Queue::k_animatedMeshes:
+                    return m_animatedMeshes.capacity();
+                case Queue::k_visibleRenderables:
+                    return m_visibleRenderables.capacity();
+                case Queue::k_opaqueRenderables:
+                    return m_opaqueRenderables.capacity();
+                case Queue::k_transparentRenderables:
+                    return m_transparentRenderables.capacity();
+                case Queue::k_shadowCasters:
+                    return m_shadowCasters.capacity();
+                case Queue::k_volumeQueryResults:
+                    return m_volumeQueryResults.capacity();
+                case Queue::k_filterResults:
+                    return m_filterResults.capacity();
+                case Queue::k_sortKeys:
+                    return m_sortKeys.capacity();
+                case Queue::k_sortKeyMergeBuffer:
+                    return m_sortKeyMergeBuffer.capacity();
+                default:
+                    CS_LOG_FATAL("Invalid render queue.");
+                    return 0;
+            }
+        }
+	}
+}
@@ -0,0 +1,277 @@
+//
+//  RenderQueue.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_RENDERQUEUE_H_
+#define _CHILLISOURCE_RENDERING_BASE_RENDERQUEUE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <array>
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //----------------------------------------------------------------------------
+        /// The set of render lists used by the renderer to build a frame. The lists
+        /// are retained between frames so that, once the scene has reached a steady
+        /// state, no memory is allocated while rendering. Each call to BeginFrame()
+        /// clears the lists without releasing their storage.
+        ///
+        /// The queue also tracks how many of its lists had to grow during the frame
+        /// and how many items ended up in each, which can be used to confirm that
+        /// rendering is allocation free.
+        ///
+        /// @author Jordan Brown
+        //----------------------------------------------------------------------------
+        class RenderQueue final
+        {
+        public:
+            CS_DECLARE_NOCOPY(RenderQueue);
+            //----------------------------------------------------------------------------
+            /// A renderable paired with the key it is sorted by.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct SortKey
+            {
+                u64 m_key;
+                RenderComponent* m_renderable;
+            };
+            //----------------------------------------------------------------------------
+            /// Counters describing the contents of the queue over a single frame.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct FrameStats
+            {
+                u32 m_numAllocations = 0;
+                u32 m_numRenderables = 0;
+                u32 m_numCameras = 0;
+                u32 m_numDirectionalLights = 0;
+                u32 m_numPointLights = 0;
+                u32 m_numVisibleRenderables = 0;
+                u32 m_numOpaqueRenderables = 0;
+                u32 m_numTransparentRenderables = 0;
+                u32 m_numShadowCasters = 0;
+                u32 m_numPointLightRenderables = 0;
+            };
+            //----------------------------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            RenderQueue() = default;
+            //----------------------------------------------------------------------------
+            /// Clears all lists, retaining their storage, and resets the frame stats.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void BeginFrame();
+            //----------------------------------------------------------------------------
+            /// Finalises the frame stats for the frame started with BeginFrame().
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void EndFrame();
+            //----------------------------------------------------------------------------
+            /// Clears the point light render list ready for culling against a new point
+            /// light. The list is shared between all point lights in the frame.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void BeginPointLightPass();
+            //----------------------------------------------------------------------------
+            /// Records the stats for the point light render list after it has been
+            /// filled for the current point light.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            void EndPointLightPass();
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return All render components found in the scene.
+            //----------------------------------------------------------------------------
+            std::vector<RenderComponent*>& GetRenderables() { return m_renderables; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return All cameras found in the scene.
+            //----------------------------------------------------------------------------
+            std::vector<CameraComponent*>& GetCameras() { return m_cameras; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Scratch list of all lights found in the scene, prior to them
+            /// being split by type.
+            //----------------------------------------------------------------------------
+            std::vector<LightComponent*>& GetLights() { return m_lights; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return All directional lights found in the scene.
+            //----------------------------------------------------------------------------
+            std::vector<DirectionalLightComponent*>& GetDirectionalLights() { return m_directionalLights; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return All point lights found in the scene.
+            //----------------------------------------------------------------------------
+            std::vector<PointLightComponent*>& GetPointLights() { return m_pointLights; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Scratch list of the animated meshes being posed.
+            //----------------------------------------------------------------------------
+            std::vector<AnimatedMeshComponent*>& GetAnimatedMeshes() { return m_animatedMeshes; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The render components which survived camera culling.
+            //----------------------------------------------------------------------------
+            std::vector<RenderComponent*>& GetVisibleRenderables() { return m_visibleRenderables; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The visible opaque render components.
+            //----------------------------------------------------------------------------
+            std::vector<RenderComponent*>& GetOpaqueRenderables() { return m_opaqueRenderables; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The visible transparent render components.
+            //----------------------------------------------------------------------------
+            std::vector<RenderComponent*>& GetTransparentRenderables() { return m_transparentRenderables; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The render components which should be drawn into shadow maps.
+            //----------------------------------------------------------------------------
+            std::vector<RenderComponent*>& GetShadowCasters() { return m_shadowCasters; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The opaque render components lit by the current point light.
+            //----------------------------------------------------------------------------
+            std::vector<RenderComponent*>& GetPointLightRenderables() { return m_pointLightRenderables; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Scratch space for the results of bounding volume hierarchy
+            /// queries made while culling. This should be cleared before each use.
+            //----------------------------------------------------------------------------
+            std::vector<Core::VolumeComponent*>& GetVolumeQueryResults() { return m_volumeQueryResults; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Scratch space for per-renderable results when filtering lists in
+            /// parallel. This should be resized before each use.
+            //----------------------------------------------------------------------------
+            std::vector<u8>& GetFilterResults() { return m_filterResults; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Scratch space for sort keys.
+            //----------------------------------------------------------------------------
+            std::vector<SortKey>& GetSortKeys() { return m_sortKeys; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Additional scratch space for sort keys, used when merging.
+            //----------------------------------------------------------------------------
+            std::vector<SortKey>& GetSortKeyMergeBuffer() { return m_sortKeyMergeBuffer; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The ambient light found in the scene, or null.
+            //----------------------------------------------------------------------------
+            AmbientLightComponent*& GetAmbientLight() { return m_ambientLight; }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The stats for the last completed frame.
+            //----------------------------------------------------------------------------
+            const FrameStats& GetFrameStats() const { return m_frameStats; }
+
+        private:
+            enum class Queue
+            {
+                k_renderables,
+                k_cameras,
+                k_lights,
+                k_directionalLights,
+                k_pointLights,
+                k_animatedMeshes,
+                k_visibleRenderables,
+                k_opaqueRenderables,
+                k_transparentRenderables,
+                k_shadowCasters,
+                k_volumeQueryResults,
+                k_filterResults,
+                k_sortKeys,
+                k_sortKeyMergeBuffer,
+                k_total
+            };
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The queue.
+            ///
+            /// @return The current capacity of the given queue.
+            //----------------------------------------------------------------------------
+            std::size_t GetCapacity(Queue in_queue) const;
+
+            std::vector<RenderComponent*> m_renderables;
+            std::vector<CameraComponent*> m_cameras;
+            std::vector<LightComponent*> m_lights;
+            std::vector<DirectionalLightComponent*> m_directionalLights;
+            std::vector<PointLightComponent*> m_pointLights;
+            std::vector<AnimatedMeshComponent*> m_animatedMeshes;
+            std::vector<RenderComponent*> m_visibleRenderables;
+            std::vector<RenderComponent*> m_opaqueRenderables;
+            std::vector<RenderComponent*> m_transparentRenderables;
+            std::vector<RenderComponent*> m_shadowCasters;
+            std::vector<RenderComponent*> m_pointLightRenderables;
+            std::vector<Core::VolumeComponent*> m_volumeQueryResults;
+            std::vector<u8> m_filterResults;
+            std::vector<SortKey> m_sortKeys;
+            std::vector<SortKey> m_sortKeyMergeBuffer;
+            AmbientLightComponent* m_ambientLight = nullptr;
+
+            std::array<std::size_t, static_cast<u32>(Queue::k_total)> m_frameStartCapacities;
+            std::size_t m_pointLightPassStartCapacity = 0;
+
+            FrameStats m_currentStats;
+            FrameStats m_frameStats;
+        };
+	}
+}
+
+#endif
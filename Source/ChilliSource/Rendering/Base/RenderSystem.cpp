@@ -31,7 +31,9 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 
-#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
+#if defined CS_RENDERBACKEND_NULL
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+#elif defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
 #include <CSBackend/Rendering/OpenGL/Base/RenderSystem.h>
 #endif
 
@@ -45,7 +47,9 @@ namespace ChilliSource
         //-------------------------------------------------------
         RenderSystemUPtr RenderSystem::Create(RenderCapabilities* in_renderCapabilities)
         {
-#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
+#if defined CS_RENDERBACKEND_NULL
+            return RenderSystemUPtr(new CSBackend::Null::RenderSystem(in_renderCapabilities));
+#elif defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
             return RenderSystemUPtr(new CSBackend::OpenGL::RenderSystem(in_renderCapabilities));
 #else
             return nullptr;
@@ -74,6 +78,27 @@ namespace ChilliSource
             }
             
             return mpSpriteBatcher;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void RenderSystem::RecordSpriteBatchFlush(u32 in_numSprites, u32 in_numDrawCommands)
+        {
+            m_currentSpriteBatchStats.m_numFlushes++;
+            m_currentSpriteBatchStats.m_numSprites += in_numSprites;
+            m_currentSpriteBatchStats.m_numDrawCommands += in_numDrawCommands;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        void RenderSystem::EndSpriteBatchStatsFrame()
+        {
+            m_spriteBatchStats = m_currentSpriteBatchStats;
+            m_currentSpriteBatchStats = SpriteBatchStats();
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        const RenderSystem::SpriteBatchStats& RenderSystem::GetSpriteBatchStats() const
+        {
+            return m_spriteBatchStats;
         }
 		//-------------------------------------------------------
 		/// Destructor
@@ -44,6 +44,19 @@ namespace ChilliSource
 		public:
 			CS_DECLARE_NAMEDTYPE(RenderSystem);
             
+            //-------------------------------------------------------
+            /// Counters for the work done by all dynamic sprite
+            /// batches over a frame.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            struct SpriteBatchStats
+            {
+                u32 m_numFlushes = 0;
+                u32 m_numSprites = 0;
+                u32 m_numDrawCommands = 0;
+            };
+            
             //-------------------------------------------------------
             /// Create the platform dependent backend
             ///
@@ -85,7 +98,16 @@ namespace ChilliSource
 			virtual void EndFrame(RenderTarget* inpActiveRenderTarget) = 0;
 
 			virtual void ApplyMaterial(const MaterialCSPtr& inMaterial, ShaderPass in_shaderPass) = 0;
-            virtual void ApplyJoints(const std::vector<Core::Matrix4>& inaJoints) = 0;
+            //----------------------------------------------------------
+            /// Applies the joint palette to the next render batch. The
+            /// palette contains the top 3 rows of each skinning matrix,
+            /// as built by SkinnedAnimationGroup::GetJointPalette().
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The joint palette.
+            //----------------------------------------------------------
+            virtual void ApplyJoints(const std::vector<Core::Vector4>& in_jointPalette) = 0;
 			virtual void ApplyCamera(const Core::Vector3& invPosition, const Core::Matrix4& inmatInvView, const Core::Matrix4& inmatProj, const Core::Colour& inClearCol) = 0;
             virtual void SetLight(LightComponent* inpLightComponent) = 0;
 			
@@ -121,6 +143,31 @@ namespace ChilliSource
             /// @return Pointer to dynamic sprite batcher
             //----------------------------------------------------
             DynamicSpriteBatch* GetDynamicSpriteBatchPtr();
+            //----------------------------------------------------
+            /// Records a flush of a dynamic sprite batch in the
+            /// counters for the current frame.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The number of sprites flushed.
+            /// @param The number of draw commands issued.
+            //----------------------------------------------------
+            void RecordSpriteBatchFlush(u32 in_numSprites, u32 in_numDrawCommands);
+            //----------------------------------------------------
+            /// Stores the dynamic sprite batch counters for the
+            /// frame that has just been rendered and resets them
+            /// for the next frame.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------
+            void EndSpriteBatchStatsFrame();
+            //----------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The dynamic sprite batch counters for the
+            /// last frame rendered.
+            //----------------------------------------------------
+            const SpriteBatchStats& GetSpriteBatchStats() const;
             
         protected:
             //-------------------------------------------------------
@@ -133,6 +180,9 @@ namespace ChilliSource
 		protected:
             
             DynamicSpriteBatch* mpSpriteBatcher;
+            
+            SpriteBatchStats m_currentSpriteBatchStats;
+            SpriteBatchStats m_spriteBatchStats;
 		};
 	}
 }
@@ -31,8 +31,8 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
-#include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
 #include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/BlendMode.h>
 #include <ChilliSource/Rendering/Base/CullingPredicates.h>
 #include <ChilliSource/Rendering/Base/RenderComponent.h>
@@ -45,6 +45,8 @@
 #include <ChilliSource/Rendering/Lighting/DirectionalLightComponent.h>
 #include <ChilliSource/Rendering/Lighting/PointLightComponent.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
+#include <ChilliSource/Rendering/Model/AnimatedMeshComponent.h>
+#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 
 #include <ChilliSource/UI/Base/Canvas.h>
@@ -60,6 +62,27 @@ namespace ChilliSource
 
 		typedef std::function<bool(RenderComponent*, RenderComponent*)> RenderSortDelegate;
 
+        namespace
+        {
+            const u32 k_minFilterBatchSize = 512;
+            const u32 k_sortChunkSize = 1024;
+            const u32 k_recordChunkSize = 256;
+
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The first sort key.
+            /// @param The second sort key.
+            ///
+            /// @return Whether the first key should be ordered before
+            /// the second.
+            //----------------------------------------------------------
+            bool CompareSortKeys(const RenderQueue::SortKey& in_lhs, const RenderQueue::SortKey& in_rhs)
+            {
+                return in_lhs.m_key < in_rhs.m_key;
+            }
+        }
+
         CS_DEFINE_NAMEDTYPE(Renderer);
         //-------------------------------------------------------
         //-------------------------------------------------------
@@ -132,6 +155,18 @@ namespace ChilliSource
 		{
 			return mpActiveCamera;
 		}
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        const RenderQueue::FrameStats& Renderer::GetRenderQueueStats() const
+        {
+            return m_renderQueue.GetFrameStats();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Renderer::SetParallelRecordingEnabled(bool in_enabled)
+        {
+            m_parallelRecordingEnabled = in_enabled;
+        }
 		//----------------------------------------------------------
 		/// Render To Screen
 		//----------------------------------------------------------
@@ -169,15 +204,28 @@ namespace ChilliSource
 		void Renderer::RenderSceneToTarget(Core::Scene* inpScene, UI::Canvas* in_canvas, RenderTarget* inpRenderTarget)
         {
             //TODO: Remove old UI render code
+            m_renderQueue.BeginFrame();
+            
+            //Apply any transform changes made since the scene update, e.g. in State::OnUpdate(), so that nothing
+            //renders with stale transforms and no world transforms are lazily updated by the parallel passes below.
+            Core::TransformHierarchy* pTransformHierarchy = inpScene->GetTransformHierarchy();
+            if (pTransformHierarchy != nullptr)
+            {
+                pTransformHierarchy->Update();
+            }
+
 			//Traverse the scene graph and get all renderable objects
-            std::vector<RenderComponent*> aPreFilteredRenderCache;
-            std::vector<CameraComponent*> aCameraCache;
-            std::vector<DirectionalLightComponent*> aDirLightCache;
-            std::vector<PointLightComponent*> aPointLightCache;
-            AmbientLightComponent* pAmbientLight = nullptr;
+            std::vector<RenderComponent*>& aPreFilteredRenderCache = m_renderQueue.GetRenderables();
+            std::vector<DirectionalLightComponent*>& aDirLightCache = m_renderQueue.GetDirectionalLights();
+            std::vector<PointLightComponent*>& aPointLightCache = m_renderQueue.GetPointLights();
+            AmbientLightComponent*& pAmbientLight = m_renderQueue.GetAmbientLight();
 
-			FindRenderableObjectsInScene(inpScene, aPreFilteredRenderCache, aCameraCache, aDirLightCache, aPointLightCache, pAmbientLight);
-            mpActiveCamera = (aCameraCache.empty() ? nullptr : aCameraCache.back());
+			FindRenderableObjectsInScene(inpScene, aPreFilteredRenderCache, m_renderQueue.GetCameras(), aDirLightCache, aPointLightCache, pAmbientLight);
+
+            const Core::BoundingVolumeHierarchy& volumeHierarchy = inpScene->GetVolumeHierarchy();
+            
+            //The scene lists components in the order they joined it, so the active camera is the one added most recently.
+            mpActiveCamera = (m_renderQueue.GetCameras().empty() ? nullptr : m_renderQueue.GetCameras().back());
 
             if(mpActiveCamera)
             {
@@ -186,59 +234,82 @@ namespace ChilliSource
                 //Calculate the view-projection matrix as we will need it for sorting
 				matViewProjCache = mpActiveCamera->GetView() * mpActiveCamera->GetProjection();
 
-                //Render shadow maps
-                RenderShadowMap(mpActiveCamera, aDirLightCache, aPreFilteredRenderCache);
-
                 //Cull items based on camera
-                std::vector<RenderComponent*> aCameraRenderCache;
-                std::vector<RenderComponent*> aCameraOpaqueCache;
-                std::vector<RenderComponent*> aCameraTransparentCache;
-                CullRenderables(mpActiveCamera, aPreFilteredRenderCache, aCameraRenderCache);
+                std::vector<RenderComponent*>& aCameraRenderCache = m_renderQueue.GetVisibleRenderables();
+                std::vector<RenderComponent*>& aCameraOpaqueCache = m_renderQueue.GetOpaqueRenderables();
+                std::vector<RenderComponent*>& aCameraTransparentCache = m_renderQueue.GetTransparentRenderables();
+                CullRenderables(mpActiveCamera, volumeHierarchy, aPreFilteredRenderCache, aCameraRenderCache);
                 FilterSceneRenderables(aCameraRenderCache, aCameraOpaqueCache, aCameraTransparentCache);
 
-                //Render scene
-                mpRenderSystem->BeginFrame(inpRenderTarget);
+                //Cull items based on whether they cast shadows
+                std::vector<RenderComponent*>& aShadowCasterCache = m_renderQueue.GetShadowCasters();
+                if(aDirLightCache.empty() == false)
+                {
+                    FilterShadowMapRenderables(aPreFilteredRenderCache, aShadowCasterCache);
+                }
+
+                //Pose only the animated meshes which will be drawn, so that skeletons are evaluated in parallel
+                //rather than lazily during recording. Posing moves entities attached to bones, so the transform
+                //changes are applied again before anything is recorded.
+                PoseAnimatedMeshes(aCameraRenderCache);
+                PoseAnimatedMeshes(aShadowCasterCache);
+                if (pTransformHierarchy != nullptr)
+                {
+                    pTransformHierarchy->Update();
+                }
+
+                //Render shadow maps
+                RenderShadowMap(mpActiveCamera, aDirLightCache, aShadowCasterCache);
+
+                //Record the scene into a command buffer and then execute it in a single pass
+                m_commandBuffer.Clear();
 
                 //Perform the ambient pass
-                mpRenderSystem->SetLight(pAmbientLight);
+                m_commandBuffer.SetLight(pAmbientLight);
                 SortOpaque(mpActiveCamera, aCameraOpaqueCache);
                 Render(mpActiveCamera, ShaderPass::k_ambient, aCameraOpaqueCache);
 
                 //Perform the diffuse pass
                 if(aDirLightCache.empty() == false || aPointLightCache.empty() == false)
                 {
-                    mpRenderSystem->SetBlendFunction(BlendMode::k_one, BlendMode::k_one);
-                    mpRenderSystem->LockBlendFunction();
+                    m_commandBuffer.SetBlendFunction(BlendMode::k_one, BlendMode::k_one);
+                    m_commandBuffer.LockBlendFunction();
 
-                    mpRenderSystem->EnableDepthWriting(false);
-                    mpRenderSystem->LockDepthWriting();
+                    m_commandBuffer.EnableDepthWriting(false);
+                    m_commandBuffer.LockDepthWriting();
 
-                    mpRenderSystem->EnableAlphaBlending(true);
-                    mpRenderSystem->LockAlphaBlending();
+                    m_commandBuffer.EnableAlphaBlending(true);
+                    m_commandBuffer.LockAlphaBlending();
 
                     for(u32 i=0; i<aDirLightCache.size(); ++i)
                     {
-                        mpRenderSystem->SetLight(aDirLightCache[i]);
+                        m_commandBuffer.SetLight(aDirLightCache[i]);
                         Render(mpActiveCamera, ShaderPass::k_directional, aCameraOpaqueCache);
                     }
 
                     for(u32 i=0; i<aPointLightCache.size(); ++i)
                     {
-                        mpRenderSystem->SetLight(aPointLightCache[i]);
-                        std::vector<RenderComponent*> aPointLightOpaqueCache;
-                        CullRenderables(aPointLightCache[i], aCameraOpaqueCache, aPointLightOpaqueCache);
-                        Render(mpActiveCamera, ShaderPass::k_point, aPointLightOpaqueCache);
+                        m_commandBuffer.SetLight(aPointLightCache[i]);
+                        m_renderQueue.BeginPointLightPass();
+                        CullRenderables(aPointLightCache[i], mpActiveCamera, volumeHierarchy, m_renderQueue.GetPointLightRenderables());
+                        m_renderQueue.EndPointLightPass();
+                        Render(mpActiveCamera, ShaderPass::k_point, m_renderQueue.GetPointLightRenderables());
                     }
 
-                    mpRenderSystem->UnlockAlphaBlending();
-                    mpRenderSystem->UnlockDepthWriting();
-                    mpRenderSystem->UnlockBlendFunction();
+                    m_commandBuffer.UnlockAlphaBlending();
+                    m_commandBuffer.UnlockDepthWriting();
+                    m_commandBuffer.UnlockBlendFunction();
                 }
 
                 SortTransparent(mpActiveCamera, aCameraTransparentCache);
                 Render(mpActiveCamera, ShaderPass::k_ambient, aCameraTransparentCache);
 
-                mpRenderSystem->SetLight(nullptr);
+                m_commandBuffer.SetLight(nullptr);
+
+                //Render scene
+                mpRenderSystem->BeginFrame(inpRenderTarget);
+                m_commandBuffer.Execute(mpRenderSystem, mpRenderSystem->GetDynamicSpriteBatchPtr());
+                m_commandBuffer.Clear();
 
                 if (in_canvas != nullptr)
                 {
@@ -251,6 +322,8 @@ namespace ChilliSource
                 	inpRenderTarget->Discard();
                 }
                 mpRenderSystem->EndFrame(inpRenderTarget);
+                mpRenderSystem->EndSpriteBatchStatsFrame();
+                m_renderQueue.EndFrame();
             }
             else
             {
@@ -271,15 +344,17 @@ namespace ChilliSource
                 	inpRenderTarget->Discard();
                 }
                 mpRenderSystem->EndFrame(inpRenderTarget);
+                mpRenderSystem->EndSpriteBatchStatsFrame();
+                m_renderQueue.EndFrame();
             }
         }
         //----------------------------------------------------------
 		/// Find Renderable Objects In Scene
 		//----------------------------------------------------------
         void Renderer::FindRenderableObjectsInScene(Core::Scene* pScene, std::vector<RenderComponent*>& outaRenderCache, std::vector<CameraComponent*>& outaCameraCache,
-                                          std::vector<DirectionalLightComponent*>& outaDirectionalLightComponentCache, std::vector<PointLightComponent*>& outaPointLightComponentCache, AmbientLightComponent*& outpAmbientLight) const
+                                          std::vector<DirectionalLightComponent*>& outaDirectionalLightComponentCache, std::vector<PointLightComponent*>& outaPointLightComponentCache, AmbientLightComponent*& outpAmbientLight)
 		{
-            static std::vector<LightComponent*> aLightComponentCache;
+            std::vector<LightComponent*>& aLightComponentCache = m_renderQueue.GetLights();
             aLightComponentCache.clear();
 
             pScene->QuerySceneForComponents<RenderComponent, CameraComponent, LightComponent>(outaRenderCache, outaCameraCache, aLightComponentCache);
@@ -323,7 +398,7 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Sort Opaque
         //----------------------------------------------------------
-        void Renderer::SortOpaque(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const
+        void Renderer::SortOpaque(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables)
         {
             RendererSortPredicateSPtr pOpaqueSort = inpCameraComponent->GetOpaqueSortPredicate();
             if(!pOpaqueSort)
@@ -333,14 +408,13 @@ namespace ChilliSource
 
             if(pOpaqueSort)
             {
-                pOpaqueSort->PrepareForSort(&inaRenderables);
-				std::sort(inaRenderables.begin(), inaRenderables.end(), Core::MakeDelegate(pOpaqueSort.get(), &RendererSortPredicate::SortItem));
+                SortRenderables(pOpaqueSort.get(), inaRenderables);
             }
         }
         //----------------------------------------------------------
         /// Sort Transparent
         //----------------------------------------------------------
-        void Renderer::SortTransparent(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const
+        void Renderer::SortTransparent(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables)
         {
             RendererSortPredicateSPtr pTransparentSort = inpCameraComponent->GetTransparentSortPredicate();
             if(!pTransparentSort)
@@ -350,29 +424,85 @@ namespace ChilliSource
 
 			if(pTransparentSort)
             {
-				pTransparentSort->PrepareForSort(&inaRenderables);
-				std::sort(inaRenderables.begin(), inaRenderables.end(), Core::MakeDelegate(pTransparentSort.get(), &RendererSortPredicate::SortItem));
+				SortRenderables(pTransparentSort.get(), inaRenderables);
 			}
         }
         //----------------------------------------------------------
-        /// Render Shadow Map
         //----------------------------------------------------------
-        void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, std::vector<RenderComponent*>& inaRenderables)
+        void Renderer::SortRenderables(RendererSortPredicate* in_sortPredicate, std::vector<RenderComponent*>& inout_renderables)
         {
-            std::vector<RenderComponent*> aFilteredShadowMapRenderCache;
+            in_sortPredicate->PrepareForSort(&inout_renderables);
 
-            if(inaLightComponents.size() > 0)
+            if(in_sortPredicate->UsesSortKeys() == false)
             {
-                //Cull items based on whether they cast shadows
-                FilterShadowMapRenderables(inaRenderables, aFilteredShadowMapRenderCache);
+                std::sort(inout_renderables.begin(), inout_renderables.end(), Core::MakeDelegate(in_sortPredicate, &RendererSortPredicate::SortItem));
+                return;
+            }
+
+            //Generate keys and sort fixed size chunks of the list in parallel, then merge pairs of sorted
+            //chunks, doubling the chunk size each pass until the whole list is sorted.
+            u32 numRenderables = static_cast<u32>(inout_renderables.size());
+            std::vector<RenderQueue::SortKey>* pKeys = &m_renderQueue.GetSortKeys();
+            std::vector<RenderQueue::SortKey>* pMergedKeys = &m_renderQueue.GetSortKeyMergeBuffer();
+            pKeys->resize(numRenderables);
+
+            Core::TaskScheduler* pTaskScheduler = Core::Application::Get()->GetTaskScheduler();
+            u32 numChunks = (numRenderables + k_sortChunkSize - 1) / k_sortChunkSize;
+            pTaskScheduler->ParallelFor(numChunks, 1, [&](u32 in_beginChunk, u32 in_endChunk)
+            {
+                for(u32 chunk = in_beginChunk; chunk < in_endChunk; ++chunk)
+                {
+                    u32 begin = chunk * k_sortChunkSize;
+                    u32 end = std::min(begin + k_sortChunkSize, numRenderables);
+                    for(u32 i = begin; i < end; ++i)
+                    {
+                        RenderQueue::SortKey& key = (*pKeys)[i];
+                        key.m_key = in_sortPredicate->GenerateSortKey(inout_renderables[i]);
+                        key.m_renderable = inout_renderables[i];
+                    }
+
+                    std::sort(pKeys->begin() + begin, pKeys->begin() + end, CompareSortKeys);
+                }
+            });
+
+            if(numChunks > 1)
+            {
+                pMergedKeys->resize(numRenderables);
             }
 
+            for(u32 width = k_sortChunkSize; width < numRenderables; width *= 2)
+            {
+                u32 numMerges = (numRenderables + (2 * width) - 1) / (2 * width);
+                pTaskScheduler->ParallelFor(numMerges, 1, [&](u32 in_beginMerge, u32 in_endMerge)
+                {
+                    for(u32 merge = in_beginMerge; merge < in_endMerge; ++merge)
+                    {
+                        u32 begin = merge * 2 * width;
+                        u32 middle = std::min(begin + width, numRenderables);
+                        u32 end = std::min(begin + 2 * width, numRenderables);
+                        std::merge(pKeys->begin() + begin, pKeys->begin() + middle, pKeys->begin() + middle, pKeys->begin() + end, pMergedKeys->begin() + begin, CompareSortKeys);
+                    }
+                });
+
+                std::swap(pKeys, pMergedKeys);
+            }
+
+            for(u32 i = 0; i < numRenderables; ++i)
+            {
+                inout_renderables[i] = (*pKeys)[i].m_renderable;
+            }
+        }
+        //----------------------------------------------------------
+        /// Render Shadow Map
+        //----------------------------------------------------------
+        void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, std::vector<RenderComponent*>& inaShadowCasters)
+        {
             for(u32 i=0; i<inaLightComponents.size(); ++i)
             {
                 if(inaLightComponents[i]->GetShadowMapPtr() != nullptr)
                 {
                     mpRenderSystem->SetLight(inaLightComponents[i]);
-                    RenderShadowMap(mpActiveCamera, inaLightComponents[i], aFilteredShadowMapRenderCache);
+                    RenderShadowMap(mpActiveCamera, inaLightComponents[i], inaShadowCasters);
                 }
             }
         }
@@ -385,14 +515,16 @@ namespace ChilliSource
 			RenderTarget* pRenderTarget = mpRenderSystem->CreateRenderTarget(inpLightComponent->GetShadowMapPtr()->GetWidth(), inpLightComponent->GetShadowMapPtr()->GetHeight());
 			pRenderTarget->SetTargetTextures(inpLightComponent->GetShadowMapDebugPtr(), inpLightComponent->GetShadowMapPtr());
 
-            mpRenderSystem->BeginFrame(pRenderTarget);
-
             //Only opaque objects cast and receive shadows
-            for(std::vector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
+            m_commandBuffer.Clear();
+            RecordRenderables(inaRenderables, [this, inpCameraComponent](RenderComponent* in_renderable, RenderCommandBuffer* in_commandBuffer)
             {
-                (*it)->RenderShadowMap(mpRenderSystem, inpCameraComponent, m_staticDirShadowMaterial, m_animDirShadowMaterial);
-            }
+                in_renderable->RenderShadowMap(in_commandBuffer, inpCameraComponent, m_staticDirShadowMaterial, m_animDirShadowMaterial);
+            });
 
+            mpRenderSystem->BeginFrame(pRenderTarget);
+            m_commandBuffer.Execute(mpRenderSystem, mpRenderSystem->GetDynamicSpriteBatchPtr());
+            m_commandBuffer.Clear();
             mpRenderSystem->EndFrame(pRenderTarget);
 
             CS_SAFEDELETE(pRenderTarget);
@@ -402,13 +534,58 @@ namespace ChilliSource
 		//----------------------------------------------------------
 		void Renderer::Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, std::vector<RenderComponent*>& inaRenderables)
 		{
-            for(std::vector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
+            RecordRenderables(inaRenderables, [inpCameraComponent, ineShaderPass](RenderComponent* in_renderable, RenderCommandBuffer* in_commandBuffer)
             {
-                (*it)->Render(mpRenderSystem, inpCameraComponent, ineShaderPass);
-            }
+                in_renderable->Render(in_commandBuffer, inpCameraComponent, ineShaderPass);
+            });
 
             //The final dynamic sprite batch needs to be flushed
-            mpRenderSystem->GetDynamicSpriteBatchPtr()->ForceRender();
+            m_commandBuffer.FlushSprites();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Renderer::RecordRenderables(const std::vector<RenderComponent*>& in_renderables, const std::function<void(RenderComponent*, RenderCommandBuffer*)>& in_recordFunction)
+        {
+            u32 numRenderables = static_cast<u32>(in_renderables.size());
+            u32 numChunks = (numRenderables + k_recordChunkSize - 1) / k_recordChunkSize;
+
+            if(m_parallelRecordingEnabled == false || numChunks < 2)
+            {
+                for(auto renderable : in_renderables)
+                {
+                    in_recordFunction(renderable, &m_commandBuffer);
+                }
+                return;
+            }
+
+            //Each chunk is recorded into its own buffer, which are then merged in order so the
+            //result is the same as recording the whole list in one go.
+            while(m_workerCommandBuffers.size() < numChunks)
+            {
+                m_workerCommandBuffers.push_back(RenderCommandBufferUPtr(new RenderCommandBuffer()));
+            }
+
+            Core::Application::Get()->GetTaskScheduler()->ParallelFor(numChunks, 1, [&](u32 in_beginChunk, u32 in_endChunk)
+            {
+                for(u32 chunk = in_beginChunk; chunk < in_endChunk; ++chunk)
+                {
+                    RenderCommandBuffer* commandBuffer = m_workerCommandBuffers[chunk].get();
+                    commandBuffer->Clear();
+
+                    u32 begin = chunk * k_recordChunkSize;
+                    u32 end = std::min(begin + k_recordChunkSize, numRenderables);
+                    for(u32 i = begin; i < end; ++i)
+                    {
+                        in_recordFunction(in_renderables[i], commandBuffer);
+                    }
+                }
+            });
+
+            for(u32 chunk = 0; chunk < numChunks; ++chunk)
+            {
+                m_commandBuffer.Append(*m_workerCommandBuffers[chunk]);
+                m_workerCommandBuffers[chunk]->Clear();
+            }
         }
         //----------------------------------------------------------
         /// Render UI
@@ -421,7 +598,7 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Cull Renderables
         //----------------------------------------------------------
-		void Renderer::CullRenderables(CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const
+		void Renderer::CullRenderables(CameraComponent* inpCamera, const Core::BoundingVolumeHierarchy& in_volumeHierarchy, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache)
 		{
             ICullingPredicate * pCullingPredicate = GetCullPredicate(inpCamera).get();
 
@@ -433,6 +610,46 @@ namespace ChilliSource
 
             outaRenderCache.reserve(inaRenderCache.size());
 
+            if(pCullingPredicate == mpPerspectiveCullPredicate.get())
+            {
+                //Renderables with culling disabled are always drawn. The rest are found by querying the
+                //hierarchy with the camera frustum, which tests each bounding sphere in the same way as the
+                //frustum cull predicate, leaving only cheap checks which are performed in parallel.
+                for(std::vector<RenderComponent*>::const_iterator it = inaRenderCache.begin(); it != inaRenderCache.end(); ++it)
+                {
+                    if((*it)->IsVisible() == true && (*it)->IsCullingEnabled() == false)
+                    {
+                        outaRenderCache.push_back(*it);
+                    }
+                }
+
+                std::vector<Core::VolumeComponent*>& aCandidates = m_renderQueue.GetVolumeQueryResults();
+                aCandidates.clear();
+                in_volumeHierarchy.QueryFrustum(inpCamera->GetFrustum(), aCandidates);
+
+                std::vector<u8>& aResults = m_renderQueue.GetFilterResults();
+                aResults.resize(aCandidates.size());
+                Core::Application::Get()->GetTaskScheduler()->ParallelFor(static_cast<u32>(aCandidates.size()), k_minFilterBatchSize, [&aCandidates, &aResults](u32 in_begin, u32 in_end)
+                {
+                    for(u32 i = in_begin; i < in_end; ++i)
+                    {
+                        Core::VolumeComponent* pCandidate = aCandidates[i];
+                        aResults[i] = (pCandidate->IsA(RenderComponent::InterfaceID) == true && pCandidate->IsVisible() == true &&
+                            static_cast<RenderComponent*>(pCandidate)->IsCullingEnabled() == true) ? 1 : 0;
+                    }
+                });
+
+                for(u32 i = 0; i < aCandidates.size(); ++i)
+                {
+                    if(aResults[i] != 0)
+                    {
+                        outaRenderCache.push_back(static_cast<RenderComponent*>(aCandidates[i]));
+                    }
+                }
+
+                return;
+            }
+
 			for(std::vector<RenderComponent*>::const_iterator it = inaRenderCache.begin(); it != inaRenderCache.end(); ++it)
 			{
 				RenderComponent* pRenderable = (*it);
@@ -452,36 +669,64 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Cull Renderables
         //----------------------------------------------------------
-		void Renderer::CullRenderables(PointLightComponent* inpLightComponent, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const
+		void Renderer::CullRenderables(PointLightComponent* inpLightComponent, CameraComponent* inpCamera, const Core::BoundingVolumeHierarchy& in_volumeHierarchy, std::vector<RenderComponent*>& outaRenderCache)
         {
-            //Reserve estimated space
-            outaRenderCache.reserve(inaRenderCache.size());
-
             Core::Sphere aLightSphere;
             aLightSphere.vOrigin = inpLightComponent->GetWorldPosition();
             aLightSphere.fRadius = inpLightComponent->GetRangeOfInfluence();
 
-            for(std::vector<RenderComponent*>::const_iterator it = inaRenderCache.begin(); it != inaRenderCache.end(); ++it)
+            //The hierarchy tests the bounding sphere of each renderable against the light sphere.
+            std::vector<Core::VolumeComponent*>& aCandidates = m_renderQueue.GetVolumeQueryResults();
+            aCandidates.clear();
+            in_volumeHierarchy.QuerySphere(aLightSphere, aCandidates);
+
+            ICullingPredicate * pCullingPredicate = GetCullPredicate(inpCamera).get();
+
+            for(std::vector<Core::VolumeComponent*>::const_iterator it = aCandidates.begin(); it != aCandidates.end(); ++it)
             {
-                if(Core::ShapeIntersection::Intersects(aLightSphere, (*it)->GetBoundingSphere()) == true)
+                if((*it)->IsA(RenderComponent::InterfaceID) == false)
                 {
-                    outaRenderCache.push_back(*it);
+                    continue;
                 }
+
+                //Only the opaque renderables which survived camera culling are lit by the point light pass.
+                RenderComponent* pRenderable = static_cast<RenderComponent*>(*it);
+                if(pRenderable->IsVisible() == false || pRenderable->IsTransparent() == true)
+                {
+                    continue;
+                }
+
+                if(pCullingPredicate != nullptr && pRenderable->IsCullingEnabled() == true && pCullingPredicate->CullItem(inpCamera, pRenderable) == true)
+                {
+                    continue;
+                }
+
+                outaRenderCache.push_back(pRenderable);
             }
         }
         //----------------------------------------------------------
         /// Filter Scene Renderables
         //----------------------------------------------------------
-		void Renderer::FilterSceneRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaOpaque, std::vector<RenderComponent*>& outaTransparent) const
+		void Renderer::FilterSceneRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaOpaque, std::vector<RenderComponent*>& outaTransparent)
 		{
             //Reserve estimated space
             outaOpaque.reserve(inaRenderables.size());
             outaTransparent.reserve(inaRenderables.size());
 
-			for(std::vector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
+            //Check transparency in parallel, then split the list in order.
+            std::vector<u8>& aResults = m_renderQueue.GetFilterResults();
+            aResults.resize(inaRenderables.size());
+            Core::Application::Get()->GetTaskScheduler()->ParallelFor(static_cast<u32>(inaRenderables.size()), k_minFilterBatchSize, [&inaRenderables, &aResults](u32 in_begin, u32 in_end)
+            {
+                for(u32 i = in_begin; i < in_end; ++i)
+                {
+                    aResults[i] = inaRenderables[i]->IsTransparent() ? 1 : 0;
+                }
+            });
+
+			for(u32 i = 0; i < inaRenderables.size(); ++i)
 			{
-				RenderComponent* pRenderable = (*it);
-                pRenderable->IsTransparent() ? outaTransparent.push_back(pRenderable) : outaOpaque.push_back(pRenderable);
+                aResults[i] != 0 ? outaTransparent.push_back(inaRenderables[i]) : outaOpaque.push_back(inaRenderables[i]);
 			}
 		}
         //----------------------------------------------------------
@@ -502,6 +747,24 @@ namespace ChilliSource
 			}
         }
         //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Renderer::PoseAnimatedMeshes(const std::vector<RenderComponent*>& in_renderables)
+        {
+            std::vector<AnimatedMeshComponent*>& aAnimatedMeshCache = m_renderQueue.GetAnimatedMeshes();
+            aAnimatedMeshCache.clear();
+
+            for(auto renderable : in_renderables)
+            {
+                if(renderable->IsA(AnimatedMeshComponent::InterfaceID) == true)
+                {
+                    aAnimatedMeshCache.push_back(static_cast<AnimatedMeshComponent*>(renderable));
+                }
+            }
+
+            //Meshes already posed this frame are no longer dirty, so are skipped.
+            AnimatedMeshComponent::UpdatePoses(aAnimatedMeshCache);
+        }
+        //----------------------------------------------------------
         /// Create Overlay Projection
         //----------------------------------------------------------
         Core::Matrix4 Renderer::CreateOverlayProjection(const Core::Vector2& in_size) const
@@ -515,6 +778,8 @@ namespace ChilliSource
         //------------------------------------------------
         void Renderer::OnDestroy()
         {
+            m_commandBuffer.Clear();
+            m_workerCommandBuffers.clear();
             m_canvas = nullptr;
             m_staticDirShadowMaterial = nullptr;
             m_animDirShadowMaterial = nullptr;
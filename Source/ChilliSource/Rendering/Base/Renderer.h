@@ -32,6 +32,10 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Base/CanvasRenderer.h>
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
+#include <ChilliSource/Rendering/Base/RenderQueue.h>
+
+#include <functional>
 
 namespace ChilliSource
 {
@@ -116,6 +120,37 @@ namespace ChilliSource
 			/// @return A weak pointer to the active scene camera
 			//----------------------------------------------------------
 			CameraComponent* GetActiveCameraPtr();
+            //----------------------------------------------------------
+            /// The render lists used to build each frame are retained
+            /// between frames. The stats report how many of these had
+            /// to grow and how many items they held during the last
+            /// rendered scene; a steady state scene should report no
+            /// allocations.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The render queue stats for the last rendered
+            /// scene.
+            //----------------------------------------------------------
+            const RenderQueue::FrameStats& GetRenderQueueStats() const;
+            //----------------------------------------------------------
+            /// Sets whether render components are recorded into
+            /// command buffers on worker threads. Each worker records
+            /// a contiguous range of the sorted render list into its
+            /// own buffer, and the buffers are merged in order before
+            /// being executed, so the result is the same as recording
+            /// on the main thread.
+            ///
+            /// This should only be enabled if every render component
+            /// in the scene can be recorded off the main thread; all
+            /// of the engine's render components can. This is
+            /// disabled by default.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not parallel recording is enabled.
+            //----------------------------------------------------------
+            void SetParallelRecordingEnabled(bool in_enabled);
 
             static Core::Matrix4 matViewProjCache;
 
@@ -155,9 +190,9 @@ namespace ChilliSource
             ///
             /// @param Camera component
             /// @param Light components
-            /// @param Render components
+            /// @param Shadow casting render components
             //----------------------------------------------------------
-            void RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, std::vector<RenderComponent*>& inaRenderables);
+            void RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, std::vector<RenderComponent*>& inaShadowCasters);
             //----------------------------------------------------------
             /// Render Shadow Map
             ///
@@ -171,9 +206,8 @@ namespace ChilliSource
 			//----------------------------------------------------------
 			/// Render
 			///
-			/// This function renders the contents of the scene to the
-			/// currently bound render target (i.e. the frame buffer or
-			/// an offscreen buffer) for the given shader pass.
+			/// This function records the contents of the scene for
+			/// the given shader pass into the frame's command buffer.
             ///
             /// @param Camera component
             /// @param The shader pass.
@@ -210,23 +244,34 @@ namespace ChilliSource
             /// @param Out: Point lights
 			//----------------------------------------------------------
 			void FindRenderableObjectsInScene(Core::Scene* pScene, std::vector<RenderComponent*>& outaRenderCache, std::vector<CameraComponent*>& outaCameraCache,
-                                              std::vector<DirectionalLightComponent*>& outaDirectionalLightComponentCache, std::vector<PointLightComponent*>& outaPointLightComponentCache, AmbientLightComponent*& outpAmbientLight) const;
+                                              std::vector<DirectionalLightComponent*>& outaDirectionalLightComponentCache, std::vector<PointLightComponent*>& outaPointLightComponentCache, AmbientLightComponent*& outpAmbientLight);
             //----------------------------------------------------------
             /// Cull Renderables
             ///
+            /// If the default perspective cull predicate is in use the
+            /// scene's bounding volume hierarchy is used to find the
+            /// renderables inside the frustum, otherwise each
+            /// renderable is tested in turn.
+            ///
             /// @param Camera to cull against
+            /// @param The scene's bounding volume hierarchy
             /// @param Renderables to cull
             /// @param [Out]: Visible renderables
             //----------------------------------------------------------
-            void CullRenderables(CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const;
+            void CullRenderables(CameraComponent* inpCamera, const Core::BoundingVolumeHierarchy& in_volumeHierarchy, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache);
             //----------------------------------------------------------
             /// Cull Renderables
             ///
+            /// Finds the visible opaque renderables lit by the given
+            /// light, using the scene's bounding volume hierarchy to
+            /// find those within its range of influence.
+            ///
             /// @param Light to cull against
-            /// @param Renderables to cull
+            /// @param Camera the renderables must be visible to
+            /// @param The scene's bounding volume hierarchy
             /// @param [Out]: Visible renderables
             //----------------------------------------------------------
-            void CullRenderables(PointLightComponent* inpLightComponent, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const;
+            void CullRenderables(PointLightComponent* inpLightComponent, CameraComponent* inpCamera, const Core::BoundingVolumeHierarchy& in_volumeHierarchy, std::vector<RenderComponent*>& outaRenderCache);
 			//----------------------------------------------------------
 			/// Filter Scene Renderables
 			///
@@ -236,7 +281,7 @@ namespace ChilliSource
             /// @param Out: Opaque renderables
             /// @param Out: Transparent renderables
 			//----------------------------------------------------------
-			void FilterSceneRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaOpaque, std::vector<RenderComponent*>& outaTransparent) const;
+			void FilterSceneRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaOpaque, std::vector<RenderComponent*>& outaTransparent);
             //----------------------------------------------------------
 			/// Filter Shadow Map Renderables
 			///
@@ -248,6 +293,16 @@ namespace ChilliSource
 			//----------------------------------------------------------
 			void FilterShadowMapRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaRenderables) const;
             //----------------------------------------------------------
+            /// Poses the animated meshes in the given list whose
+            /// animation data is dirty. This must be called from the
+            /// main thread before the renderables are recorded.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The renderables which will be drawn.
+            //----------------------------------------------------------
+            void PoseAnimatedMeshes(const std::vector<RenderComponent*>& in_renderables);
+            //----------------------------------------------------------
             /// Get Cull Predicate
             ///
             /// @param Camera
@@ -272,7 +327,7 @@ namespace ChilliSource
             /// @param Camera component
             /// @param Renderables
             //----------------------------------------------------------
-            void SortOpaque(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const;
+            void SortOpaque(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables);
             //----------------------------------------------------------
             /// Sort Transparent
             ///
@@ -282,7 +337,31 @@ namespace ChilliSource
             /// @param Camera component
             /// @param Renderables
             //----------------------------------------------------------
-            void SortTransparent(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const;
+            void SortTransparent(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables);
+            //----------------------------------------------------------
+            /// Sorts the renderables using the given predicate. If the
+            /// predicate generates sort keys then the keys are
+            /// generated and sorted in parallel, otherwise the
+            /// predicate is used as the comparator.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The sort predicate
+            /// @param [In/Out] The renderables to sort
+            //----------------------------------------------------------
+            void SortRenderables(RendererSortPredicate* in_sortPredicate, std::vector<RenderComponent*>& inout_renderables);
+            //----------------------------------------------------------
+            /// Records the given renderables into the frame's command
+            /// buffer, in order, using the given function. If parallel
+            /// recording is enabled the list is split into chunks
+            /// which are recorded concurrently and then merged.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The renderables to record.
+            /// @param The function which records a single renderable.
+            //----------------------------------------------------------
+            void RecordRenderables(const std::vector<RenderComponent*>& in_renderables, const std::function<void(RenderComponent*, RenderCommandBuffer*)>& in_recordFunction);
             //------------------------------------------------
             /// Called when the application is being destroyed.
             /// This should be used to cleanup memory and
@@ -308,6 +387,12 @@ namespace ChilliSource
 
             MaterialCSPtr m_staticDirShadowMaterial;
             MaterialCSPtr m_animDirShadowMaterial;
+
+            RenderQueue m_renderQueue;
+
+            RenderCommandBuffer m_commandBuffer;
+            std::vector<RenderCommandBufferUPtr> m_workerCommandBuffers;
+            bool m_parallelRecordingEnabled = false;
 		};
 	}
 }
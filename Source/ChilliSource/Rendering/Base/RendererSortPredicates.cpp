@@ -33,12 +33,51 @@
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Entity/Transform.h>
 
+#include <cstring>
+
 using namespace ChilliSource::Core;
 
 namespace ChilliSource
 {
 	namespace Rendering
     {
+        namespace
+        {
+            //---------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param A float.
+            ///
+            /// @return The bits of the float, adjusted so that they
+            /// compare as unsigned integers in the same order as the
+            /// original floats.
+            //---------------------------------------------------------
+            u32 ConvertToOrderedBits(f32 in_value)
+            {
+                u32 bits = 0;
+                std::memcpy(&bits, &in_value, sizeof(bits));
+                return ((bits & 0x80000000) != 0) ? ~bits : (bits | 0x80000000);
+            }
+            //---------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param A resource. Can be null.
+            ///
+            /// @return A 31-bit value identifying the resource, or
+            /// zero if there isn't one.
+            //---------------------------------------------------------
+            u32 GetResourceBits(const Resource* in_resource)
+            {
+                if (in_resource == nullptr)
+                {
+                    return 0;
+                }
+                
+                CS_ASSERT(in_resource->GetInstanceId() <= 0x7fffffff, "Resource instance id is out of range for a sort key.");
+                return in_resource->GetInstanceId();
+            }
+        }
+        
 		void BackToFrontSortPredicate::PrepareForSort(std::vector<RenderComponent*> * inpRenderable)
         {
 			mCameraViewProj = Renderer::matViewProjCache;
@@ -60,6 +99,12 @@ namespace ChilliSource
 			return p1->GetSortValue() > p2->GetSortValue();
 		}
         
+        u64 BackToFrontSortPredicate::GenerateSortKey(const RenderComponent* in_renderable) const
+        {
+            //Invert the depth so that the furthest renderables have the lowest keys.
+            return static_cast<u64>(~ConvertToOrderedBits(in_renderable->GetSortValue())) << 32;
+        }
+        
         bool MaterialSortPredicate::SortItem(const RenderComponent* p1, const RenderComponent* p2) const
         {
             const Material* pM1 = p1->GetMaterial().get();
@@ -82,5 +127,22 @@ namespace ChilliSource
                 return p1->GetMaterial().get() < p2->GetMaterial().get();
             }
 		}
+        
+        u64 MaterialSortPredicate::GenerateSortKey(const RenderComponent* in_renderable) const
+        {
+            //The material is in the upper bits so that renderables are grouped by material, then static
+            //meshes are grouped by mesh ahead of all other renderables using that material.
+            //Resources are identified by instance id rather than address, as addresses don't fit in the key on 64-bit.
+            u64 key = static_cast<u64>(GetResourceBits(in_renderable->GetMaterial().get())) << 32;
+            if (in_renderable->IsA(StaticMeshComponent::InterfaceID) == true)
+            {
+                key |= GetResourceBits(static_cast<const StaticMeshComponent*>(in_renderable)->GetMesh().get());
+            }
+            else
+            {
+                key |= 0x80000000;
+            }
+            return key;
+        }
 	}
 }
@@ -39,7 +39,13 @@ namespace ChilliSource
 	namespace Rendering
     {
 		//---------------------------------------------------------
-		/// An abstract base for classes representing different ordering operations
+		/// An abstract base for classes representing different ordering operations.
+		///
+		/// Predicates can optionally describe their ordering as a 64-bit key per
+		/// renderable, in which case the renderer will generate keys in parallel and
+		/// sort on those rather than calling SortItem() for every comparison. Keys are
+		/// sorted in ascending order and must only be generated from state that is
+		/// safe to read from any thread, such as that set up in PrepareForSort().
 		//---------------------------------------------------------
 		class RendererSortPredicate
         {
@@ -47,6 +53,21 @@ namespace ChilliSource
 			virtual ~RendererSortPredicate(){}
 			virtual void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) = 0;
 			virtual bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const = 0;
+            //---------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether or not this predicate generates sort keys.
+            //---------------------------------------------------------
+            virtual bool UsesSortKeys() const { return false; }
+            //---------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The renderable.
+            ///
+            /// @return The sort key for the renderable. Only called if
+            /// UsesSortKeys() returns true.
+            //---------------------------------------------------------
+            virtual u64 GenerateSortKey(const RenderComponent* in_renderable) const { return 0; }
 			bool operator()(const RenderComponent* p1, const RenderComponent* p2) const
             {
 				return SortItem(p1, p2);
@@ -71,6 +92,8 @@ namespace ChilliSource
 		public:
             void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) override;
             bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const override;
+            bool UsesSortKeys() const override { return true; }
+            u64 GenerateSortKey(const RenderComponent* in_renderable) const override;
 		private:
 			Core::Matrix4 mCameraViewProj;
 		};
@@ -83,6 +106,8 @@ namespace ChilliSource
 		public:
             void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) override {}
             bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const override;
+            bool UsesSortKeys() const override { return true; }
+            u64 GenerateSortKey(const RenderComponent* in_renderable) const override;
 		};
 	}
 }
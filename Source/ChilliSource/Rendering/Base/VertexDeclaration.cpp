@@ -126,6 +126,31 @@ namespace ChilliSource
 			return Offset;
 		}
 		//-------------------------------------------------------
+		/// Try Get Element Offset
+		///
+		/// @param The semantic of the element.
+		/// @param [Out] The offset of the element in the layout.
+		///
+		/// @return Whether or not the layout contains an element
+		/// with the given semantic.
+		//-------------------------------------------------------
+		bool VertexDeclaration::TryGetElementOffset(VertexDataSemantic in_semantic, u32& out_offset) const
+		{
+			u32 offset = 0;
+			
+			for(const auto& element : mElements)
+			{
+				if(element.eSemantic == in_semantic)
+				{
+					out_offset = offset;
+					return true;
+				}
+				offset += GetSizeOfElement(element);
+			}
+			
+			return false;
+		}
+		//-------------------------------------------------------
 		/// Get Size Of Element
 		///
 		/// @return the size of the element type 
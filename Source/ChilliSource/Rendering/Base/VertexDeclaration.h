@@ -101,6 +101,7 @@ namespace ChilliSource
 			const VertexElement& GetElementAtIndex(const u32 inIndex) const;
 			const u32 GetSizeOfElement(const VertexElement &inElement) const;
 			const u32 GetElementOffset(const VertexElement &inElement) const;
+			bool TryGetElementOffset(VertexDataSemantic in_semantic, u32& out_offset) const;
 			const u32 GetTotalSize() const;
 			const u32 GetTotalNumValues() const;
             const std::vector<VertexElement>& GetElements() const;
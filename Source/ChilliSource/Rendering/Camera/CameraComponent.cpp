@@ -200,7 +200,7 @@ namespace ChilliSource
         //--------------------------------------------------------------------------------------------------
         void CameraComponent::OnAddedToEntity()
         {
-            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &CameraComponent::OnTransformChanged));
+            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeInlineDelegate(this, &CameraComponent::OnTransformChanged));
         }
         //--------------------------------------------------------------------------------------------------
         //--------------------------------------------------------------------------------------------------
@@ -39,6 +39,10 @@ namespace ChilliSource
         namespace
         {
             const u32 k_spacesPerTab = 5;
+            
+            //Characters beyond this are looked up in a map rather than by direct index.
+            const Core::UTF8Char k_maxBMPCharacter = 0xffff;
+            const u16 k_noCharacterIndex = 0xffff;
         }
         
         CS_DEFINE_NAMEDTYPE(Font);
@@ -62,6 +66,9 @@ namespace ChilliSource
             CS_ASSERT(in_desc.m_supportedCharacters.size() > 0, "Font: Cannot build characters with empty character set");
             
             m_characterInfos.clear();
+            m_bmpCharacterIndices.clear();
+            m_extendedCharacterIndices.clear();
+            ++m_buildVersion;
             m_characters = in_desc.m_supportedCharacters;
             m_texture = in_desc.m_texture;
 			
@@ -95,7 +102,7 @@ namespace ChilliSource
                 
                 m_lineHeight = std::max((f32)frame.m_height, m_lineHeight);
                 
-				m_characterInfos.insert(std::make_pair(character, info));
+				AddCharacterInfo(character, info);
                 
                 ++frameIdx;
 			}
@@ -116,17 +123,17 @@ namespace ChilliSource
             spaceCharacter.m_advance = in_desc.m_spaceAdvance;
             
             //Space
-            m_characterInfos.insert(std::make_pair(k_spaceCharacter, spaceCharacter));
+            AddCharacterInfo(k_spaceCharacter, spaceCharacter);
             
             //Non-breaking space
-            m_characterInfos.insert(std::make_pair(k_nbspCharacter, spaceCharacter));
+            AddCharacterInfo(k_nbspCharacter, spaceCharacter);
             
             //Tab
             spaceCharacter.m_size.x *= k_spacesPerTab;
-            m_characterInfos.insert(std::make_pair(k_tabCharacter, spaceCharacter));
+            AddCharacterInfo(k_tabCharacter, spaceCharacter);
             
             //Return
-            m_characterInfos.insert(std::make_pair(k_returnCharacter, CharacterInfo()));
+            AddCharacterInfo(k_returnCharacter, CharacterInfo());
         }
 		//-------------------------------------------
 		//-------------------------------------------
@@ -136,6 +143,12 @@ namespace ChilliSource
 		}
         //---------------------------------------------------------------------
         //---------------------------------------------------------------------
+        u32 Font::GetBuildVersion() const
+        {
+            return m_buildVersion;
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
         u32 Font::GetPointSize() const
         {
             return m_pointSize;
@@ -168,15 +181,67 @@ namespace ChilliSource
 		//-------------------------------------------
 		bool Font::TryGetCharacterInfo(Core::UTF8Char in_char, CharacterInfo& out_info) const
 		{
-			auto itCharEntry = m_characterInfos.find(in_char);
+			const CharacterInfo* info = GetCharacterInfo(in_char);
 			
-			if (itCharEntry != m_characterInfos.end())
+			if (info != nullptr)
             {
-				out_info = itCharEntry->second;
+				out_info = *info;
 				return true;
 			}
 			
 			return false;
 		}
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        const Font::CharacterInfo* Font::GetCharacterInfo(Core::UTF8Char in_char) const
+        {
+            if (in_char <= k_maxBMPCharacter)
+            {
+                if (in_char < m_bmpCharacterIndices.size() && m_bmpCharacterIndices[in_char] != k_noCharacterIndex)
+                {
+                    return &m_characterInfos[m_bmpCharacterIndices[in_char]];
+                }
+                
+                return nullptr;
+            }
+            
+            auto it = m_extendedCharacterIndices.find(in_char);
+            if (it != m_extendedCharacterIndices.end())
+            {
+                return &m_characterInfos[it->second];
+            }
+            
+            return nullptr;
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        void Font::AddCharacterInfo(Core::UTF8Char in_char, const CharacterInfo& in_info)
+        {
+            if (GetCharacterInfo(in_char) != nullptr)
+            {
+                return;
+            }
+            
+            u32 index = (u32)m_characterInfos.size();
+            
+            if (in_char <= k_maxBMPCharacter)
+            {
+                CS_ASSERT(index < k_noCharacterIndex, "Font: Too many characters for the glyph table.");
+                
+                //The table only spans up to the highest character in the font, which for most fonts is small.
+                if (in_char >= m_bmpCharacterIndices.size())
+                {
+                    m_bmpCharacterIndices.resize(in_char + 1, k_noCharacterIndex);
+                }
+                
+                m_bmpCharacterIndices[in_char] = (u16)index;
+            }
+            else
+            {
+                m_extendedCharacterIndices.insert(std::make_pair(in_char, index));
+            }
+            
+            m_characterInfos.push_back(in_info);
+        }
 	}
 }
@@ -139,6 +139,15 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			const TextureCSPtr& GetTexture() const;
             //---------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return A number which changes each time the font is built. This
+            /// allows anything derived from the font's glyphs to detect that the
+            /// font has been rebuilt in place, for example when resources are
+            /// refreshed.
+            //---------------------------------------------------------------------
+            u32 GetBuildVersion() const;
+            //---------------------------------------------------------------------
             /// @author Ian Copland
             ///
             /// @return The point size of the font the bitmap font was created from.
@@ -178,6 +187,19 @@ namespace ChilliSource
 			/// @return Whether the character exists in the font
 			//---------------------------------------------------------------------
 			bool TryGetCharacterInfo(Core::UTF8Char in_char, CharacterInfo& out_info) const;
+            //---------------------------------------------------------------------
+            /// Looks up the info for a character without copying it. Characters
+            /// in the basic multilingual plane are looked up by direct index.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param UTF-8 Character
+            ///
+            /// @return The info for the character, or null if the character
+            /// doesn't exist in the font. This remains valid until the font is
+            /// rebuilt.
+            //---------------------------------------------------------------------
+            const CharacterInfo* GetCharacterInfo(Core::UTF8Char in_char) const;
 		
         private:
             
@@ -195,10 +217,22 @@ namespace ChilliSource
             /// @author S Downie
             //---------------------------------------------------------------------
             Font() = default;
+            //---------------------------------------------------------------------
+            /// Adds the info for a character to the glyph table. If the
+            /// character already has info then it is left unchanged.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param UTF-8 Character
+            /// @param The character info.
+            //---------------------------------------------------------------------
+            void AddCharacterInfo(Core::UTF8Char in_char, const CharacterInfo& in_info);
             
         private:
             
-			std::unordered_map<Core::UTF8Char, CharacterInfo> m_characterInfos;
+            std::vector<CharacterInfo> m_characterInfos;
+            std::vector<u16> m_bmpCharacterIndices;
+            std::unordered_map<Core::UTF8Char, u32> m_extendedCharacterIndices;
 			CharacterSet m_characters;
             
             TextureCSPtr m_texture;
@@ -207,6 +241,7 @@ namespace ChilliSource
             f32 m_lineHeight = 0.0f;
             f32 m_descent = 0.0f;
             f32 m_verticalPadding;
+            u32 m_buildVersion = 0;
             
             static f32 s_globalKerningOffset;
 		};
@@ -277,7 +277,8 @@ namespace ChilliSource
             }
             else
             {
-                Core::Application::Get()->GetResourcePool()->LoadResourceAsync<Texture>(in_location, textureFilePath, [out_resource, in_delegate, in_location, in_filePath](const TextureCSPtr& in_texture)
+                Core::ResourcePool* resourcePool = Core::Application::Get()->GetResourcePool();
+                resourcePool->LoadResourceAsync<Texture>(resourcePool->GetLoadGroup(out_resource.get()), in_location, textureFilePath, [out_resource, in_delegate, in_location, in_filePath](const TextureCSPtr& in_texture)
                 {
                     if(in_texture != nullptr)
                     {
@@ -47,9 +47,11 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(MeshBatch);
         CS_FORWARDDECLARE_CLASS(MeshBuffer);
         CS_FORWARDDECLARE_CLASS(RenderCapabilities);
+        CS_FORWARDDECLARE_CLASS(RenderCommandBuffer);
         CS_FORWARDDECLARE_CLASS(RenderComponent);
         CS_FORWARDDECLARE_CLASS(RenderComponentFactory);
         CS_FORWARDDECLARE_CLASS(Renderer);
+        CS_FORWARDDECLARE_CLASS(RenderQueue);
         CS_FORWARDDECLARE_CLASS(RendererSortPredicate);
         CS_FORWARDDECLARE_CLASS(NullSortPredicate);
         CS_FORWARDDECLARE_CLASS(BackToFrontSortPredicate);
@@ -97,6 +99,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_STRUCT(MeshFeatureDescriptor);
         CS_FORWARDDECLARE_STRUCT(SubMeshDescriptor);
         CS_FORWARDDECLARE_STRUCT(MeshDescriptor);
+        CS_FORWARDDECLARE_CLASS(MeshResourceOptions);
         CS_FORWARDDECLARE_STRUCT(SkeletonDescriptor);
         CS_FORWARDDECLARE_CLASS(CSAnimProvider);
         CS_FORWARDDECLARE_CLASS(CSModelProvider);
@@ -104,6 +107,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(SkinnedAnimation);
         CS_FORWARDDECLARE_STRUCT(SkeletonNode);
         CS_FORWARDDECLARE_CLASS(SkinnedAnimationGroup);
+        CS_FORWARDDECLARE_CLASS(SkinnedAnimationResourceOptions);
         CS_FORWARDDECLARE_CLASS(StaticMeshComponent);
         CS_FORWARDDECLARE_CLASS(SubMesh);
         //------------------------------------------------------------
@@ -113,7 +117,7 @@ namespace ChilliSource
 		CS_FORWARDDECLARE_CLASS(CSParticleProvider);
 		CS_FORWARDDECLARE_CLASS(ParticleEffect);
 		CS_FORWARDDECLARE_CLASS(ParticleEffectComponent);
-		CS_FORWARDDECLARE_STRUCT(Particle);
+		CS_FORWARDDECLARE_CLASS(ParticlePool);
 		CS_FORWARDDECLARE_CLASS(ParticleDrawable);
 		CS_FORWARDDECLARE_CLASS(ParticleDrawableDef);
 		CS_FORWARDDECLARE_CLASS(ParticleDrawableDefFactory);
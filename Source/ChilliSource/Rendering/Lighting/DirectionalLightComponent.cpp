@@ -140,7 +140,7 @@ namespace ChilliSource
         //----------------------------------------------------
         void DirectionalLightComponent::OnAddedToScene()
         {
-            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &DirectionalLightComponent::OnEntityTransformChanged));
+            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeInlineDelegate(this, &DirectionalLightComponent::OnEntityTransformChanged));
         }
         //----------------------------------------------------
         //----------------------------------------------------
@@ -132,7 +132,7 @@ namespace ChilliSource
         //----------------------------------------------------
         void PointLightComponent::OnAddedToScene()
         {
-            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &PointLightComponent::OnEntityTransformChanged));
+            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeInlineDelegate(this, &PointLightComponent::OnEntityTransformChanged));
         }
         //----------------------------------------------------
         //----------------------------------------------------
@@ -43,6 +43,8 @@
 #include <ChilliSource/Rendering/Texture/CubemapResourceOptions.h>
 #include <ChilliSource/Rendering/Texture/TextureResourceOptions.h>
 
+#include <atomic>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -65,7 +67,7 @@ namespace ChilliSource
             ///
             /// @author S Downie
             //-------------------------------------------------------------------------
-            struct ChainedLoadDesc
+            struct DependencyLoadDesc
             {
                 ResourceType m_type;
                 std::string m_filePath;
@@ -562,114 +564,136 @@ namespace ChilliSource
                 }
             }
             //----------------------------------------------------------------------------
-            /// Load the resource from the given descs at the given index. On
-            /// completion this will recursively kick off the next load if one
-            /// is required, otherwise will call the delegate
+            /// The state shared by the parallel loads of a material's dependencies.
             ///
-            /// @author S Downie
+            /// @author Jordan Brown
+            //----------------------------------------------------------------------------
+            struct DependencyLoadState
+            {
+                std::vector<DependencyLoadDesc> m_descs;
+                std::vector<Core::ResourceCSPtr> m_resources;
+                std::atomic<u32> m_numPendingLoads;
+                std::atomic<bool> m_hasFailed;
+                Core::ResourceProvider::AsyncLoadDelegate m_delegate;
+                MaterialSPtr m_material;
+            };
+            //----------------------------------------------------------------------------
+            /// Called as each dependency finishes loading. Once all of them have
+            /// finished they are applied to the material in the order they were
+            /// described, and the delegate is called.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The index of the dependency.
+            /// @param The dependency, or null if it couldn't be loaded.
+            /// @param The shared load state.
+            //----------------------------------------------------------------------------
+            void OnDependencyLoaded(u32 in_loadIndex, const Core::ResourceCSPtr& in_resource, const std::shared_ptr<DependencyLoadState>& in_state)
+            {
+                if(in_resource == nullptr || in_resource->GetLoadState() != Core::Resource::LoadState::k_loaded)
+                {
+                    in_state->m_hasFailed = true;
+                }
+                else
+                {
+                    in_state->m_resources[in_loadIndex] = in_resource;
+                }
+                
+                if(--in_state->m_numPendingLoads > 0)
+                {
+                    return;
+                }
+                
+                const MaterialSPtr& material(in_state->m_material);
+                if(in_state->m_hasFailed == true)
+                {
+                    material->SetLoadState(Core::Resource::LoadState::k_failed);
+                    Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_state->m_delegate, material));
+                    return;
+                }
+                
+                for(u32 i = 0; i < in_state->m_descs.size(); ++i)
+                {
+                    switch(in_state->m_descs[i].m_type)
+                    {
+                        case ResourceType::k_shader:
+                            material->SetShader(in_state->m_descs[i].m_pass, std::static_pointer_cast<const Shader>(in_state->m_resources[i]));
+                            break;
+                        case ResourceType::k_texture:
+                            material->AddTexture(std::static_pointer_cast<const Texture>(in_state->m_resources[i]));
+                            break;
+                        case ResourceType::k_cubemap:
+                            material->SetCubemap(std::static_pointer_cast<const Cubemap>(in_state->m_resources[i]));
+                            break;
+                    }
+                }
+                
+                material->SetLoadState(Core::Resource::LoadState::k_loaded);
+                Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_state->m_delegate, material));
+            }
+            //----------------------------------------------------------------------------
+            /// Requests all of the given resources at once so they are loaded in
+            /// parallel, in the same load group as the material. Once they have all
+            /// finished loading they are applied to the material and the delegate
+            /// is called.
+            ///
+            /// @author Jordan Brown
             ///
-            /// @param Index of desc to load
             /// @param Descs
             /// @param Completion delegate
             /// @param [Out] Material
             //----------------------------------------------------------------------------
-            void LoadResourcesChained(u32 in_loadIndex, const std::vector<ChainedLoadDesc>& in_descs, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const MaterialSPtr& out_material)
+            void LoadDependencies(const std::vector<DependencyLoadDesc>& in_descs, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const MaterialSPtr& out_material)
             {
+                if(in_descs.empty() == true)
+                {
+                    out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
+                    Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
+                    return;
+                }
+                
                 Core::ResourcePool* resourcePool = Core::Application::Get()->GetResourcePool();
+                Core::ResourceLoadGroupSPtr loadGroup = resourcePool->GetLoadGroup(out_material.get());
+                
+                std::shared_ptr<DependencyLoadState> state = std::make_shared<DependencyLoadState>();
+                state->m_descs = in_descs;
+                state->m_resources.resize(in_descs.size());
+                state->m_numPendingLoads = (u32)in_descs.size();
+                state->m_hasFailed = false;
+                state->m_delegate = in_delegate;
+                state->m_material = out_material;
                 
-                switch(in_descs[in_loadIndex].m_type)
+                for(u32 i = 0; i < in_descs.size(); ++i)
                 {
-                    case ResourceType::k_shader:
+                    const DependencyLoadDesc& desc(in_descs[i]);
+                    switch(desc.m_type)
                     {
-                        resourcePool->LoadResourceAsync<Shader>(in_descs[in_loadIndex].m_location, in_descs[in_loadIndex].m_filePath, [in_loadIndex, in_descs, in_delegate, out_material](const ShaderCSPtr& in_shader)
+                        case ResourceType::k_shader:
                         {
-                            if(in_shader->GetLoadState() == Core::Resource::LoadState::k_loaded)
-                            {
-                                out_material->SetShader(in_descs[in_loadIndex].m_pass, in_shader);
-                                
-                                u32 newLoadIndex = in_loadIndex + 1;
-                                
-                                if(newLoadIndex < in_descs.size())
-                                {
-                                    LoadResourcesChained(newLoadIndex, in_descs, in_delegate, out_material);
-                                }
-                                else
-                                {
-                                    out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
-									Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                    return;
-                                }
-                            }
-                            else
+                            resourcePool->LoadResourceAsync<Shader>(loadGroup, desc.m_location, desc.m_filePath, [i, state](const ShaderCSPtr& in_shader)
                             {
-                                out_material->SetLoadState(Core::Resource::LoadState::k_failed);
-								Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                return;
-                            }
-                        });
-                        break;
-                    }
-                    case ResourceType::k_texture:
-                    {
-                        auto options(std::make_shared<TextureResourceOptions>(in_descs[in_loadIndex].m_shouldMipMap, in_descs[in_loadIndex].m_filterMode, in_descs[in_loadIndex].m_wrapModeU, in_descs[in_loadIndex].m_wrapModeV, true));
-                        resourcePool->LoadResourceAsync<Texture>(in_descs[in_loadIndex].m_location, in_descs[in_loadIndex].m_filePath, options, [in_loadIndex, in_descs, in_delegate, out_material](const TextureCSPtr& in_texture)
+                                OnDependencyLoaded(i, in_shader, state);
+                            });
+                            break;
+                        }
+                        case ResourceType::k_texture:
                         {
-                            if(in_texture->GetLoadState() == Core::Resource::LoadState::k_loaded)
+                            auto options(std::make_shared<TextureResourceOptions>(desc.m_shouldMipMap, desc.m_filterMode, desc.m_wrapModeU, desc.m_wrapModeV, true));
+                            resourcePool->LoadResourceAsync<Texture>(loadGroup, desc.m_location, desc.m_filePath, options, [i, state](const TextureCSPtr& in_texture)
                             {
-                                out_material->AddTexture(in_texture);
-                                
-                                u32 newLoadIndex = in_loadIndex + 1;
-                                
-                                if(newLoadIndex < in_descs.size())
-                                {
-                                    LoadResourcesChained(newLoadIndex, in_descs, in_delegate, out_material);
-                                }
-                                else
-                                {
-                                    out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
-									Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                    return;
-                                }
-                            }
-                            else
-                            {
-                                out_material->SetLoadState(Core::Resource::LoadState::k_failed);
-								Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                return;
-                            }
-                        });
-                        break;
-                    }
-                    case ResourceType::k_cubemap:
-                    {
-                        auto options(std::make_shared<CubemapResourceOptions>(in_descs[in_loadIndex].m_shouldMipMap, in_descs[in_loadIndex].m_filterMode, in_descs[in_loadIndex].m_wrapModeU, in_descs[in_loadIndex].m_wrapModeV, true));
-                        resourcePool->LoadResourceAsync<Cubemap>(in_descs[in_loadIndex].m_location, in_descs[in_loadIndex].m_filePath, options, [in_loadIndex, in_descs, in_delegate, out_material](const CubemapCSPtr& in_cubemap)
+                                OnDependencyLoaded(i, in_texture, state);
+                            });
+                            break;
+                        }
+                        case ResourceType::k_cubemap:
                         {
-                            if(in_cubemap->GetLoadState() == Core::Resource::LoadState::k_loaded)
-                            {
-                                out_material->SetCubemap(in_cubemap);
-
-                                u32 newLoadIndex = in_loadIndex + 1;
-
-                                if(newLoadIndex < in_descs.size())
-                                {
-                                    LoadResourcesChained(newLoadIndex, in_descs, in_delegate, out_material);
-                                }
-                                else
-                                {
-                                    out_material->SetLoadState(Core::Resource::LoadState::k_loaded);
-									Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                    return;
-                                }
-                            }
-                            else
+                            auto options(std::make_shared<CubemapResourceOptions>(desc.m_shouldMipMap, desc.m_filterMode, desc.m_wrapModeU, desc.m_wrapModeV, true));
+                            resourcePool->LoadResourceAsync<Cubemap>(loadGroup, desc.m_location, desc.m_filePath, options, [i, state](const CubemapCSPtr& in_cubemap)
                             {
-                                out_material->SetLoadState(Core::Resource::LoadState::k_failed);
-								Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_material));
-                                return;
-                            }
-                        });
-                        break;
+                                OnDependencyLoaded(i, in_cubemap, state);
+                            });
+                            break;
+                        }
                     }
                 }
             }
@@ -798,12 +822,12 @@ namespace ChilliSource
             
             MaterialSPtr material = std::static_pointer_cast<Material>(out_resource);
             
-            std::vector<ChainedLoadDesc> resourceFiles;
+            std::vector<DependencyLoadDesc> resourceFiles;
             resourceFiles.reserve(shaderFiles.size() + textureFiles.size() + cubemapFiles.size());
             
             for(const auto& shaderDesc : shaderFiles)
             {
-                ChainedLoadDesc desc;
+                DependencyLoadDesc desc;
                 desc.m_filePath = shaderDesc.m_filePath;
                 desc.m_location = shaderDesc.m_location;
                 desc.m_pass = shaderDesc.m_pass;
@@ -813,7 +837,7 @@ namespace ChilliSource
             
             for(const auto& textureDesc : textureFiles)
             {
-                ChainedLoadDesc desc;
+                DependencyLoadDesc desc;
                 desc.m_filePath = textureDesc.m_filePath;
                 desc.m_location = textureDesc.m_location;
                 desc.m_shouldMipMap = textureDesc.m_shouldMipMap;
@@ -826,7 +850,7 @@ namespace ChilliSource
             
             for(const auto& cubemapDesc : cubemapFiles)
             {
-                ChainedLoadDesc desc;
+                DependencyLoadDesc desc;
                 desc.m_filePath = cubemapDesc.m_filePath;
                 desc.m_location = cubemapDesc.m_location;
                 desc.m_shouldMipMap = cubemapDesc.m_shouldMipMap;
@@ -837,7 +861,7 @@ namespace ChilliSource
                 resourceFiles.push_back(desc);
             }
             
-            LoadResourcesChained(0, resourceFiles, in_delegate, material);
+            LoadDependencies(resourceFiles, in_delegate, material);
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
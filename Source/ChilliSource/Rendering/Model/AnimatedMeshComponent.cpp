@@ -33,14 +33,14 @@
 #include <ChilliSource/Rendering/Lighting/PointLightComponent.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
-#include <ChilliSource/Rendering/Base/RenderSystem.h>
-#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
 
 #include <ChilliSource/Core/Entity/Entity.h>
 
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 #include <ChilliSource/Rendering/Model/SubMesh.h>
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 #include <algorithm>
 #include <limits>
@@ -57,7 +57,7 @@ namespace ChilliSource
 		AnimatedMeshComponent::AnimatedMeshComponent() 
         : mfPlaybackPosition(0.0f), mfPlaybackSpeedMultiplier(1.0f), mfBlendlinePosition(0.0f),
         meBlendType(AnimationBlendType::k_linear), mePlaybackType(AnimationPlaybackType::k_once), meFadeType(AnimationBlendType::k_linear), mfFadeTimer(0.0f), mfFadeMaxTime(0.0f), mfFadePlaybackPosition(0.0f),
-        mfFadeBlendlinePosition(0.0f), mbFinished(false), mbAnimationDataDirty(true)
+        mfFadeBlendlinePosition(0.0f), mbFinished(false), mbAnimationDataDirty(true), m_cpuSkinningEnabled(false)
 		{
             mMaterials.push_back(mpMaterial);
 		}
@@ -275,6 +275,7 @@ namespace ChilliSource
             // Update OOBB
             mOBBoundingBox.SetSize(mpModel->GetAABB().GetSize());
             mOBBoundingBox.SetOrigin(mpModel->GetAABB().GetOrigin());
+            InvalidateVolume();
             
             Reset();
 		}
@@ -293,6 +294,7 @@ namespace ChilliSource
             // Update OOBB
             mOBBoundingBox.SetSize(mpModel->GetAABB().GetSize());
             mOBBoundingBox.SetOrigin(mpModel->GetAABB().GetOrigin());
+            InvalidateVolume();
             Reset();
             
             SetMaterial(inpMaterial);
@@ -343,7 +345,7 @@ namespace ChilliSource
             if (nullptr != mActiveAnimationGroup && true == mActiveAnimationGroup->IsPrepared())
             {
                 mFadingAnimationGroup = mActiveAnimationGroup;
-                mActiveAnimationGroup = SkinnedAnimationGroupSPtr(new SkinnedAnimationGroup(mpModel->GetSkeleton()));
+                mActiveAnimationGroup = CreateAnimationGroup();
                 mfFadePlaybackPosition = mfPlaybackPosition;
                 mfFadeBlendlinePosition = mfBlendlinePosition;
                 mfFadeMaxTime = infFadeOutTime;
@@ -496,6 +498,33 @@ namespace ChilliSource
             meBlendType = ineBlendType;
         }
         //----------------------------------------------------------
+        //----------------------------------------------------------
+        void AnimatedMeshComponent::SetCPUSkinningEnabled(bool in_enabled)
+        {
+            m_cpuSkinningEnabled = in_enabled;
+            
+            for (const auto& group : { mActiveAnimationGroup, mFadingAnimationGroup })
+            {
+                if (group != nullptr)
+                {
+                    if (m_cpuSkinningEnabled == true)
+                    {
+                        group->EnableCPUSkinning(mpModel.get());
+                    }
+                    else
+                    {
+                        group->DisableCPUSkinning();
+                    }
+                }
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool AnimatedMeshComponent::IsCPUSkinningEnabled() const
+        {
+            return m_cpuSkinningEnabled;
+        }
+        //----------------------------------------------------------
         /// Get Animation Changed Event
         //----------------------------------------------------------
         AnimationChangedEvent& AnimatedMeshComponent::GetAnimationChangedEvent()
@@ -581,7 +610,47 @@ namespace ChilliSource
         //----------------------------------------------------------
         void AnimatedMeshComponent::OnUpdate(f32 infDeltaTime)
         {
-            UpdateAnimation(infDeltaTime);
+            if (CanAnimate() == true)
+            {
+                UpdateAnimationTimer(infDeltaTime);
+                mbAnimationDataDirty = true;
+                
+                //entities attached to the skeleton need their transforms this frame, so
+                //they can't wait for the batched pose update in the renderer.
+                if (maAttachedEntities.empty() == false)
+                {
+                    UpdatePose();
+                }
+            }
+        }
+        //----------------------------------------------------------
+        /// Update Poses
+        //----------------------------------------------------------
+        void AnimatedMeshComponent::UpdatePoses(std::vector<AnimatedMeshComponent*>& inout_components)
+        {
+            inout_components.erase(std::remove_if(inout_components.begin(), inout_components.end(), [](AnimatedMeshComponent* in_component)
+            {
+                return (in_component->mbAnimationDataDirty == false || in_component->CanAnimate() == false);
+            }), inout_components.end());
+            
+            if (inout_components.empty() == true)
+            {
+                return;
+            }
+            
+            Core::Application::Get()->GetTaskScheduler()->ParallelFor(static_cast<u32>(inout_components.size()), 1, [&inout_components](u32 in_begin, u32 in_end)
+            {
+                for (u32 i = in_begin; i < in_end; ++i)
+                {
+                    inout_components[i]->BuildPose();
+                }
+            });
+            
+            for (AnimatedMeshComponent* pComponent : inout_components)
+            {
+                pComponent->UpdateAttachedEntities();
+                pComponent->mbAnimationDataDirty = false;
+            }
         }
         //----------------------------------------------------------
 		/// Destructor
@@ -604,83 +673,94 @@ namespace ChilliSource
 		//----------------------------------------------------------
         /// Render
         //----------------------------------------------------------
-        void AnimatedMeshComponent::Render(RenderSystem* inpRenderSystem, CameraComponent* inpCam, ShaderPass ineShaderPass)
+        void AnimatedMeshComponent::Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, ShaderPass ineShaderPass)
 		{
             if (nullptr != mActiveAnimationGroup)
             {
                 if (mbAnimationDataDirty == true)
                 {
-                    UpdateAnimation(0.0f);
+                    UpdatePose();
                 }
                 
                 if(IsTransparent())
                 {
                     //Flush the sprite cache to maintain order
-                    inpRenderSystem->GetDynamicSpriteBatchPtr()->ForceRender();
+                    in_commandBuffer->FlushSprites();
                 }
                 
                 //render the model with the animation data.
                 if (mActiveAnimationGroup->IsPrepared() == true)
                 {
-                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), mMaterials,ineShaderPass, mActiveAnimationGroup);
+                    mpModel->Render(in_commandBuffer, GetEntity()->GetTransform().GetWorldTransform(), mMaterials,ineShaderPass, mActiveAnimationGroup);
                 }
                 else if (mFadingAnimationGroup != nullptr && mFadingAnimationGroup->IsPrepared() == true)
                 {
-                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), mMaterials, ineShaderPass, mFadingAnimationGroup);
+                    mpModel->Render(in_commandBuffer, GetEntity()->GetTransform().GetWorldTransform(), mMaterials, ineShaderPass, mFadingAnimationGroup);
                 }
             }
 		}
         //-----------------------------------------------------
         /// Render Shadow Map
         //-----------------------------------------------------
-        void AnimatedMeshComponent::RenderShadowMap(RenderSystem* inpRenderSystem, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap)
+        void AnimatedMeshComponent::RenderShadowMap(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap)
         {
             if (nullptr != mActiveAnimationGroup)
             {
                 if (mbAnimationDataDirty == true)
                 {
-                    UpdateAnimation(0.0f);
+                    UpdatePose();
                 }
                 
                 //render the model with the animation data.
                 if (mActiveAnimationGroup->IsPrepared() == true)
                 {
-                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), {in_animShadowMap}, ShaderPass::k_ambient, mActiveAnimationGroup);
+                    mpModel->Render(in_commandBuffer, GetEntity()->GetTransform().GetWorldTransform(), {in_animShadowMap}, ShaderPass::k_ambient, mActiveAnimationGroup);
                 }
                 else if (mFadingAnimationGroup != nullptr && mFadingAnimationGroup->IsPrepared() == true)
                 {
-                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), {in_animShadowMap}, ShaderPass::k_ambient, mFadingAnimationGroup);
+                    mpModel->Render(in_commandBuffer, GetEntity()->GetTransform().GetWorldTransform(), {in_animShadowMap}, ShaderPass::k_ambient, mFadingAnimationGroup);
                 }
             }
         }
         //----------------------------------------------------------
-        /// Update Animation
+        /// Can Animate
+        //----------------------------------------------------------
+        bool AnimatedMeshComponent::CanAnimate()
+        {
+            return (nullptr != GetEntity() && nullptr != GetEntity()->GetScene() && nullptr != mActiveAnimationGroup && mActiveAnimationGroup->GetAnimationCount() != 0);
+        }
+        //----------------------------------------------------------
+        /// Build Pose
         //----------------------------------------------------------
-        void AnimatedMeshComponent::UpdateAnimation(f32 infDeltaTime)
+        void AnimatedMeshComponent::BuildPose()
         {
-            if (nullptr != GetEntity() && nullptr != GetEntity()->GetScene() && nullptr != mActiveAnimationGroup && mActiveAnimationGroup->GetAnimationCount() != 0)
+            //calculate the animation data and convert to matrices.
+            mActiveAnimationGroup->BuildAnimationData(meBlendType, mfPlaybackPosition, mfBlendlinePosition);
+            
+            //if there is a group fading out, then apply this to the active data.
+            if (nullptr != mFadingAnimationGroup)
             {
-                //update the animation timer.
-                UpdateAnimationTimer(infDeltaTime);
-                
-                //calculate the animation data and convert to matrices.
-                mActiveAnimationGroup->BuildAnimationData(meBlendType, mfPlaybackPosition, mfBlendlinePosition);
-                
-                //if there is a group fading out, then apply this to the active data.
-                if (nullptr != mFadingAnimationGroup)
+                if (mfFadeMaxTime > 0.0f && mfFadeTimer < mfFadeMaxTime)
                 {
-                    if (mfFadeMaxTime > 0.0f && mfFadeTimer < mfFadeMaxTime)
-                    {
-                        mFadingAnimationGroup->BuildAnimationData(meBlendType, mfFadePlaybackPosition, mfFadeBlendlinePosition);
-                        f32 fGroupBlendFactor = 1.0f - (mfFadeTimer / mfFadeMaxTime);
-                        mActiveAnimationGroup->BlendGroup(meBlendType, mFadingAnimationGroup, fGroupBlendFactor);
-                    }
-                    else
-                    {
-                        mFadingAnimationGroup = SkinnedAnimationGroupSPtr();
-                    }
+                    mFadingAnimationGroup->BuildAnimationData(meBlendType, mfFadePlaybackPosition, mfFadeBlendlinePosition);
+                    f32 fGroupBlendFactor = 1.0f - (mfFadeTimer / mfFadeMaxTime);
+                    mActiveAnimationGroup->BlendGroup(meBlendType, mFadingAnimationGroup, fGroupBlendFactor);
                 }
-                mActiveAnimationGroup->BuildMatrices();
+                else
+                {
+                    mFadingAnimationGroup = SkinnedAnimationGroupSPtr();
+                }
+            }
+            mActiveAnimationGroup->BuildMatrices();
+        }
+        //----------------------------------------------------------
+        /// Update Pose
+        //----------------------------------------------------------
+        void AnimatedMeshComponent::UpdatePose()
+        {
+            if (CanAnimate() == true)
+            {
+                BuildPose();
                 UpdateAttachedEntities();
                 
                 mbAnimationDataDirty = false;
@@ -756,11 +836,23 @@ namespace ChilliSource
         void AnimatedMeshComponent::Reset()
         {
             DetatchAllEntities();
-			mActiveAnimationGroup = SkinnedAnimationGroupSPtr(new SkinnedAnimationGroup(mpModel->GetSkeleton()));
+			mActiveAnimationGroup = CreateAnimationGroup();
             mFadingAnimationGroup.reset();
             mfBlendlinePosition = 0.0f;
             mfFadeTimer = 0.0f;
             SetPlaybackPosition(0.0f);
         }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        SkinnedAnimationGroupSPtr AnimatedMeshComponent::CreateAnimationGroup() const
+        {
+            SkinnedAnimationGroupSPtr group(new SkinnedAnimationGroup(mpModel->GetSkeleton()));
+            if (m_cpuSkinningEnabled == true)
+            {
+                group->EnableCPUSkinning(mpModel.get());
+            }
+            
+            return group;
+        }
 	}
 }
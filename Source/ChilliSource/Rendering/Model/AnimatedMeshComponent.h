@@ -307,6 +307,30 @@ namespace ChilliSource
             /// @param The blend type.
 			//----------------------------------------------------------
 			void SetBlendType(AnimationBlendType ineBlendType);
+            //----------------------------------------------------------
+			/// Sets whether or not the mesh is skinned on the CPU rather
+            /// than in the vertex shader. The mesh is then skinned once
+            /// per pose into a dynamic mesh buffer which every pass
+            /// draws from, and sub meshes that were split by joint
+            /// count are drawn in a single call. This trades memory and
+            /// CPU time for fewer joint uploads and draws, so suits
+            /// meshes that are lit by many lights. Disabled by default.
+            ///
+            /// The mesh must have been loaded with CPU skinning
+            /// supported in its MeshResourceOptions, otherwise it will
+            /// continue to be skinned on the GPU.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not CPU skinning is enabled.
+			//----------------------------------------------------------
+			void SetCPUSkinningEnabled(bool in_enabled);
+            //----------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+			/// @return Whether or not the mesh is skinned on the CPU.
+			//----------------------------------------------------------
+			bool IsCPUSkinningEnabled() const;
             //----------------------------------------------------------
 			/// Get Animation Changed Event
             ///
@@ -387,6 +411,24 @@ namespace ChilliSource
             /// @param The delta time.
 			//----------------------------------------------------------
 			void OnUpdate(f32 infDeltaTime) override;
+            //----------------------------------------------------------
+			/// Update Poses
+			///
+			/// Rebuilds the skeleton pose of each of the given components
+            /// whose animation data is dirty. The poses are evaluated in
+            /// parallel on the task scheduler, after which the attached
+            /// entities are updated on the calling thread. This must be
+            /// called from the main thread.
+            ///
+            /// The list is filtered in place rather than copied, so that
+            /// a list retained between frames doesn't cause allocations.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [In/Out] The components to pose. On return this
+            /// only contains the components which were posed.
+			//----------------------------------------------------------
+			static void UpdatePoses(std::vector<AnimatedMeshComponent*>& inout_components);
             
 		private:
 			//----------------------------------------------------
@@ -408,30 +450,50 @@ namespace ChilliSource
 			///
 			/// NotifyConnections render on objects mesh
             ///
-            /// @param Render system visitor
+            /// @param Command buffer to record into
             /// @param Active camera component
             /// @param The current shader pass.
 			//----------------------------------------------------------
-			void Render(RenderSystem* inpRenderSystem, CameraComponent* inpCam, ShaderPass ineShaderPass) override;
+			void Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, ShaderPass ineShaderPass) override;
             //-----------------------------------------------------
             /// Render Shadow Map
             ///
             /// Render the mesh to the shadow map
             ///
-            /// @param Render system
+            /// @param Command buffer to record into
             /// @param Active camera component
             /// @param Material to render static shadows with
             /// @param Material to render skinned shadows with
             //-----------------------------------------------------
-            void RenderShadowMap(RenderSystem* inpRenderSystem, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap) override;
+            void RenderShadowMap(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap) override;
             //----------------------------------------------------------
-			/// Update Animation
+			/// Can Animate
 			///
-			/// Updates the animation, rebuilding the animation matrices.
+            /// @author Jordan Brown
             ///
-            /// @param The delta time.
+			/// @return Whether or not the component is in a state where
+            /// its animation can be updated.
 			//----------------------------------------------------------
-			void UpdateAnimation(f32 infDeltaTime);
+			bool CanAnimate();
+            //----------------------------------------------------------
+			/// Build Pose
+			///
+			/// Builds the animation data for the active and fading
+            /// groups and converts it to matrices. This only touches
+            /// state owned by this component so it is safe to call
+            /// for different components in parallel.
+            ///
+            /// @author Jordan Brown
+			//----------------------------------------------------------
+			void BuildPose();
+            //----------------------------------------------------------
+			/// Update Pose
+			///
+			/// Rebuilds the pose and updates the attached entities.
+            ///
+            /// @author Jordan Brown
+			//----------------------------------------------------------
+			void UpdatePose();
 			//----------------------------------------------------------
 			/// Update Animation Timer
 			///
@@ -454,6 +516,13 @@ namespace ChilliSource
             /// to start a new animation.
 			//----------------------------------------------------------
 			void Reset();
+            //----------------------------------------------------------
+			/// @author Jordan Brown
+            ///
+            /// @return A new animation group for the current mesh, with
+            /// CPU skinning enabled if it is enabled for the component.
+			//----------------------------------------------------------
+			SkinnedAnimationGroupSPtr CreateAnimationGroup() const;
             
 		private:
             typedef std::vector<std::pair<Core::EntityWPtr, s32> > AttachedEntityList;
@@ -474,6 +543,7 @@ namespace ChilliSource
             f32 mfFadeBlendlinePosition;
             bool mbFinished;
             bool mbAnimationDataDirty;
+            bool m_cpuSkinningEnabled;
             AnimationCompletionEvent mAnimationCompletionEvent;
             AnimationLoopedEvent mAnimationLoopedEvent;
             AnimationChangedEvent mAnimationChangedEvent;
@@ -29,10 +29,13 @@
 #include <ChilliSource/Rendering/Model/CSAnimProvider.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/FileView.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimationResourceOptions.h>
 
 namespace ChilliSource
 {
@@ -47,30 +50,28 @@ namespace ChilliSource
             const u32 k_fileCheckValue = 7777;
             
             //----------------------------------------------------------------------------
-            /// Read value of the given type and size from the binary file stream
+            /// Read value of the given type and size from the binary file view
             ///
 			/// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param File view
 			/// @return Value of type TType
 			//----------------------------------------------------------------------------
-			template <typename TType> TType ReadValue(const Core::FileStreamSPtr& in_fileStream)
+			template <typename TType> TType ReadValue(Core::FileView* in_fileView)
 			{
-				TType value;
-				in_fileStream->Read(reinterpret_cast<s8*>(&value), sizeof(TType));
-				return value;
+				return in_fileView->Read<TType>();
 			}
             //----------------------------------------------------------------------------
             /// Reads all of the data for the animation into the SkinnedAnimation resource
             ///
             /// @author Ian Copland
             ///
-            /// @param The file stream.
+            /// @param The file view.
             /// @param The number of frames.
             /// @param The number of skeleton nodes.
             /// @param [Out] Animation resource to populate
             //----------------------------------------------------------------------------
-            void ReadAnimationData(const Core::FileStreamSPtr& in_fileStream, u32 in_numFrames, s32 in_numSkeletonNodes, const SkinnedAnimationSPtr& out_resource)
+            void ReadAnimationData(Core::FileView* in_fileView, u32 in_numFrames, s32 in_numSkeletonNodes, const SkinnedAnimationSPtr& out_resource)
             {
                 for (u32 frameCount=0; frameCount<in_numFrames; ++frameCount)
                 {
@@ -82,22 +83,22 @@ namespace ChilliSource
                     {
                         //create new translation
                         Core::Vector3 translation;
-                        translation.x = ReadValue<f32>(in_fileStream);
-                        translation.y = ReadValue<f32>(in_fileStream);
-                        translation.z = ReadValue<f32>(in_fileStream);
+                        translation.x = ReadValue<f32>(in_fileView);
+                        translation.y = ReadValue<f32>(in_fileView);
+                        translation.z = ReadValue<f32>(in_fileView);
                         
                         //create new orientation
                         Core::Quaternion orientation;
-                        orientation.x = ReadValue<f32>(in_fileStream);
-                        orientation.y = ReadValue<f32>(in_fileStream);
-                        orientation.z = ReadValue<f32>(in_fileStream);
-                        orientation.w = ReadValue<f32>(in_fileStream);
+                        orientation.x = ReadValue<f32>(in_fileView);
+                        orientation.y = ReadValue<f32>(in_fileView);
+                        orientation.z = ReadValue<f32>(in_fileView);
+                        orientation.w = ReadValue<f32>(in_fileView);
                         
                         //create new scale
                         Core::Vector3 scale;
-                        scale.x = ReadValue<f32>(in_fileStream);
-                        scale.y = ReadValue<f32>(in_fileStream);
-                        scale.z = ReadValue<f32>(in_fileStream);
+                        scale.x = ReadValue<f32>(in_fileView);
+                        scale.y = ReadValue<f32>(in_fileView);
+                        scale.z = ReadValue<f32>(in_fileView);
                         
                         //add to the frame
                         frame->m_nodeTranslations.push_back(translation);
@@ -114,28 +115,28 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param The file stream.
+			/// @param The file view.
 			/// @param the Skeletal Animation that this data is being loaded into.
             ///
 			/// @return whether or not this was successful
 			//----------------------------------------------------------------------------
-			bool ReadHeader(const Core::FileStreamSPtr& in_stream, const std::string & in_filePath, const SkinnedAnimationSPtr& out_resource, u32& out_numFrames, s32& out_numSkeletonNodes)
+			bool ReadHeader(Core::FileView* in_fileView, const std::string & in_filePath, const SkinnedAnimationSPtr& out_resource, u32& out_numFrames, s32& out_numSkeletonNodes)
             {
                 //Check file for corruption
-                if(in_stream == nullptr || in_stream->IsBad() == true)
+                if(in_fileView == nullptr)
                 {
                     CS_LOG_ERROR("Cannot open CSAnim file: " + in_filePath);
                     return false;
                 }
                 
-                u32 fileCheckValue = ReadValue<u32>(in_stream);
+                u32 fileCheckValue = ReadValue<u32>(in_fileView);
                 if(fileCheckValue != k_fileCheckValue)
                 {
                     CS_LOG_ERROR("CSAnim file has corruption(incorrect File Check Value): " + in_filePath);
                     return false;
                 }
                 
-                u32 versionNum = ReadValue<u32>(in_stream);
+                u32 versionNum = ReadValue<u32>(in_fileView);
                 if (versionNum < k_minVersion || versionNum > k_maxVersion)
                 {
                     CS_LOG_ERROR("Unsupported CSAnim version: " + in_filePath);
@@ -143,25 +144,34 @@ namespace ChilliSource
                 }
                 
                 //build the feature declaration from the file
-                u32 numFeatures = (u32)ReadValue<u8>(in_stream);
+                u32 numFeatures = (u32)ReadValue<u8>(in_fileView);
                 if (numFeatures != 0)
                 {
                     CS_LOG_ERROR("Unknown feature type in CSAnim (" + in_filePath + ") feature declaration!");
                 }
                 
                 //read num frames and skeleton nodes
-                out_numFrames = (u32)ReadValue<u16>(in_stream);
-                out_numSkeletonNodes = (s32)ReadValue<s16>(in_stream);
+                out_numFrames = (u32)ReadValue<u16>(in_fileView);
+                out_numSkeletonNodes = (s32)ReadValue<s16>(in_fileView);
                 
                 //read frame time
-                f32 frameTime = ReadValue<f32>(in_stream);
+                f32 frameTime = ReadValue<f32>(in_fileView);
                 out_resource->SetFrameTime(frameTime);
+                
+                if (in_fileView->HasReadFailed() == true)
+                {
+                    CS_LOG_ERROR("CSAnim file is truncated: " + in_filePath);
+                    return false;
+                }
+                
                 return true;
             }
         }
         
         CS_DEFINE_NAMEDTYPE(CSAnimProvider);
         
+        const Core::IResourceOptionsBaseCSPtr CSAnimProvider::s_defaultOptions(std::make_shared<SkinnedAnimationResourceOptions>());
+        
         //-------------------------------------------------------------------------
 		//-------------------------------------------------------------------------
         CSAnimProviderUPtr CSAnimProvider::Create()
@@ -186,31 +196,37 @@ namespace ChilliSource
 		{
 			return (in_extension == k_fileExtension);
 		}
+        //----------------------------------------------------
+        //----------------------------------------------------
+        Core::IResourceOptionsBaseCSPtr CSAnimProvider::GetDefaultOptions() const
+        {
+            return s_defaultOptions;
+        }
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
 		void CSAnimProvider::CreateResourceFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceSPtr& out_resource)
 		{
 			SkinnedAnimationSPtr anim = std::static_pointer_cast<SkinnedAnimation>(out_resource);
             
-            ReadSkinnedAnimationFromFile(in_location, in_filePath, nullptr, anim);
+            ReadSkinnedAnimationFromFile(in_location, in_filePath, in_options, nullptr, anim);
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
 		void CSAnimProvider::CreateResourceFromFileAsync(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
 		{
 			SkinnedAnimationSPtr anim = std::static_pointer_cast<SkinnedAnimation>(out_resource);
-			auto task = std::bind(&CSAnimProvider::ReadSkinnedAnimationFromFile, this, in_location, in_filePath, in_delegate, anim);
+			auto task = std::bind(&CSAnimProvider::ReadSkinnedAnimationFromFile, this, in_location, in_filePath, in_options, in_delegate, anim);
 			Core::Application::Get()->GetTaskScheduler()->ScheduleTask(task);
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
-		void CSAnimProvider::ReadSkinnedAnimationFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const
+		void CSAnimProvider::ReadSkinnedAnimationFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const
 		{
-			Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
+			Core::FileViewUPtr fileView = Core::Application::Get()->GetFileSystem()->CreateFileView(in_location, in_filePath);
 			
 			u32 numFrames = 0;
 			s32 numSkeletonNodes = 0;
-			if(ReadHeader(stream, in_filePath, out_resource, numFrames, numSkeletonNodes) == false)
+			if(ReadHeader(fileView.get(), in_filePath, out_resource, numFrames, numSkeletonNodes) == false)
             {
                 CS_LOG_ERROR("Failed to read header in anim: " + in_filePath);
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
@@ -221,7 +237,24 @@ namespace ChilliSource
                 return;
             }
             
-			ReadAnimationData(stream, numFrames, numSkeletonNodes, out_resource);
+			ReadAnimationData(fileView.get(), numFrames, numSkeletonNodes, out_resource);
+            
+            if (fileView->HasReadFailed() == true)
+            {
+                CS_LOG_ERROR("CSAnim file is truncated: " + in_filePath);
+                out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
+                if(in_delegate != nullptr)
+                {
+					Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                }
+                return;
+            }
+            
+            const SkinnedAnimationResourceOptions* options = static_cast<const SkinnedAnimationResourceOptions*>(in_options.get());
+            if (options != nullptr && options->IsCompressionEnabled() == true)
+            {
+                out_resource->Compress(options->GetTranslationTolerance(), options->GetOrientationTolerance(), options->GetScaleTolerance());
+            }
 			
             out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
             
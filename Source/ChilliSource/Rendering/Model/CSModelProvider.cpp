@@ -29,10 +29,15 @@
 #include <ChilliSource/Rendering/Model/CSModelProvider.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/FileView.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Model/MeshDescriptor.h>
+#include <ChilliSource/Rendering/Model/MeshResourceOptions.h>
 
+#include <cstring>
 #include <unordered_map>
 
 namespace ChilliSource
@@ -91,47 +96,49 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
             ///
-			/// @param File stream
+			/// @param File view
             ///
 			/// @return Value of type T
 			//----------------------------------------------------------------------------
-			template <typename TType> TType ReadValue(const Core::FileStreamSPtr& in_meshStream)
+			template <typename TType> TType ReadValue(Core::FileView* in_meshView)
 			{
-				TType value;
-				in_meshStream->Read(reinterpret_cast<s8*>(&value), sizeof(TType));
-				return value;
+				return in_meshView->Read<TType>();
 			}
             //----------------------------------------------------------------------------
 			/// Read block of data in for given type
             ///
             /// @author Ian Copland
             ///
-			/// @param File stream
+			/// @param File view
             /// @param Num to read
 			/// @param [Out] data
 			//----------------------------------------------------------------------------
-			template <typename TType> void ReadBlock(const Core::FileStreamSPtr& in_meshStream, u32 in_numToRead, TType* out_data)
+			template <typename TType> void ReadBlock(Core::FileView* in_meshView, u32 in_numToRead, TType* out_data)
 			{
-				in_meshStream->Read(reinterpret_cast<s8*>(out_data), sizeof(TType) * in_numToRead);
+				const u8* data = in_meshView->Read(sizeof(TType) * in_numToRead);
+				if (data != nullptr)
+				{
+					memcpy(out_data, data, sizeof(TType) * in_numToRead);
+				}
 			}
             //-----------------------------------------------------------------------------
-            /// Read the vertex declaration from the mesh filestream. The declaration
+            /// Read the vertex declaration from the mesh file view. The declaration
             /// is variable
             ///
             /// @author Ian Copland
             ///
-            /// @param Mesh stream
+            /// @param Mesh file view
             /// @param [Out] Mesh description
             //-----------------------------------------------------------------------------
-            void ReadVertexDeclaration(const Core::FileStreamSPtr& in_meshStream, MeshDescriptor& out_meshDesc)
+            void ReadVertexDeclaration(Core::FileView* in_meshView, MeshDescriptor& out_meshDesc)
             {
                 //build the vertex declaration from the file
-                u8 numVertexElements = ReadValue<u8>(in_meshStream);
+                u8 numVertexElements = ReadValue<u8>(in_meshView);
                 
                 VertexElement* vertexElements = new VertexElement[numVertexElements];
                 for (int i = 0; i < numVertexElements; ++i)
                 {
-                    u8 vertexAttrib = ReadValue<u8>(in_meshStream);
+                    u8 vertexAttrib = ReadValue<u8>(in_meshView);
                     
                     switch (VertexAttribute(vertexAttrib))
                     {
@@ -173,11 +180,11 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param File view
 			/// @param Mesh description
             /// @param [Out] Submesh description
             //-----------------------------------------------------------------------------
-            void ReadSubMeshData(const Core::FileStreamSPtr& in_meshStream, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
+            void ReadSubMeshData(Core::FileView* in_meshView, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
             {
                 //read the inverse bind matrices
                 if(true == in_meshDesc.mFeatures.mbHasAnimationData)
@@ -185,35 +192,45 @@ namespace ChilliSource
                     for(u32 i=0; i<in_meshDesc.m_skeletonDesc.m_jointIndices.size(); ++i)
                     {
                         CSCore::Matrix4 IBPMat;
-                        ReadBlock<f32>(in_meshStream, 16, IBPMat.m);
+                        ReadBlock<f32>(in_meshView, 16, IBPMat.m);
                         out_subMeshDesc.mInverseBindPoseMatrices.push_back(IBPMat);
                     }
                 }
                 
                 //read the vertex data
-                out_subMeshDesc.mpVertexData = new u8[in_meshDesc.mVertexDeclaration.GetTotalSize() * out_subMeshDesc.mudwNumVertices];
-                in_meshStream->Read((s8*)out_subMeshDesc.mpVertexData, in_meshDesc.mVertexDeclaration.GetTotalSize() * out_subMeshDesc.mudwNumVertices);
+                const u32 vertexDataSize = in_meshDesc.mVertexDeclaration.GetTotalSize() * out_subMeshDesc.mudwNumVertices;
+                out_subMeshDesc.mpVertexData = new u8[vertexDataSize];
+                const u8* vertexData = in_meshView->Read(vertexDataSize);
+                if (vertexData != nullptr)
+                {
+                    memcpy(out_subMeshDesc.mpVertexData, vertexData, vertexDataSize);
+                }
                 
                 //read the index data
-                out_subMeshDesc.mpIndexData = new u8[in_meshDesc.mudwIndexSize * out_subMeshDesc.mudwNumIndices];
-                in_meshStream->Read((s8*)out_subMeshDesc.mpIndexData, in_meshDesc.mudwIndexSize * out_subMeshDesc.mudwNumIndices);
+                const u32 indexDataSize = in_meshDesc.mudwIndexSize * out_subMeshDesc.mudwNumIndices;
+                out_subMeshDesc.mpIndexData = new u8[indexDataSize];
+                const u8* indexData = in_meshView->Read(indexDataSize);
+                if (indexData != nullptr)
+                {
+                    memcpy(out_subMeshDesc.mpIndexData, indexData, indexDataSize);
+                }
             }
             //-----------------------------------------------------------------------------
 			/// Reads the sub-mesh header section of the file
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param File view
             /// @param Mesh description
 			/// @param [Out] Sube mesh description
             //-----------------------------------------------------------------------------
-            void ReadSubMeshHeader(const Core::FileStreamSPtr& in_meshStream, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
+            void ReadSubMeshHeader(Core::FileView* in_meshView, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
             {
                 //read mesh name
                 u8 nextChar = 0;
                 do
                 {
-                    nextChar = ReadValue<u8>(in_meshStream);
+                    nextChar = ReadValue<u8>(in_meshView);
                     out_subMeshDesc.mstrName += nextChar;
                     
                 } while(nextChar != 0);
@@ -221,22 +238,22 @@ namespace ChilliSource
                 //read num verts and triangles
                 if (2 == in_meshDesc.mudwIndexSize)
                 {
-                    out_subMeshDesc.mudwNumVertices = (u32)ReadValue<u16>(in_meshStream);
-                    out_subMeshDesc.mudwNumIndices = ((u32)ReadValue<u16>(in_meshStream)) * 3;
+                    out_subMeshDesc.mudwNumVertices = (u32)ReadValue<u16>(in_meshView);
+                    out_subMeshDesc.mudwNumIndices = ((u32)ReadValue<u16>(in_meshView)) * 3;
                 }
                 else
                 {
-                    out_subMeshDesc.mudwNumVertices = ReadValue<u32>(in_meshStream);
-                    out_subMeshDesc.mudwNumIndices = ReadValue<u32>(in_meshStream) * 3;
+                    out_subMeshDesc.mudwNumVertices = ReadValue<u32>(in_meshView);
+                    out_subMeshDesc.mudwNumIndices = ReadValue<u32>(in_meshView) * 3;
                 }
                 
                 //read bounds
-                out_subMeshDesc.mvMinBounds.x = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMinBounds.y = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMinBounds.z = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.x = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.y = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.z = ReadValue<f32>(in_meshStream);
+                out_subMeshDesc.mvMinBounds.x = ReadValue<f32>(in_meshView);
+                out_subMeshDesc.mvMinBounds.y = ReadValue<f32>(in_meshView);
+                out_subMeshDesc.mvMinBounds.z = ReadValue<f32>(in_meshView);
+                out_subMeshDesc.mvMaxBounds.x = ReadValue<f32>(in_meshView);
+                out_subMeshDesc.mvMaxBounds.y = ReadValue<f32>(in_meshView);
+                out_subMeshDesc.mvMaxBounds.z = ReadValue<f32>(in_meshView);
                 
                 //TODO: Remove texture and material from mesh
                 //in the meantime just read and discard.
@@ -245,7 +262,7 @@ namespace ChilliSource
                     u8 nextCharacter = 0;
                     do
                     {
-                        nextCharacter = ReadValue<u8>(in_meshStream);
+                        nextCharacter = ReadValue<u8>(in_meshView);
                         
                     } while(nextCharacter != 0);
                 }
@@ -255,7 +272,7 @@ namespace ChilliSource
                     u8 nextCharacter = 0;
                     do
                     {
-                        nextCharacter = ReadValue<u8>(in_meshStream);
+                        nextCharacter = ReadValue<u8>(in_meshView);
                         
                     } while(nextCharacter != 0);
                 }
@@ -265,11 +282,11 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param File view
             /// @param Container holding the num of meshes, joints and bones
 			/// @param [Out] Skeleton description
             //-----------------------------------------------------------------------------
-            void ReadSkeletonData(const Core::FileStreamSPtr& in_meshStream, const MeshDataQuantities& in_quantities, SkeletonDescriptor& out_skeletonDesc)
+            void ReadSkeletonData(Core::FileView* in_meshView, const MeshDataQuantities& in_quantities, SkeletonDescriptor& out_skeletonDesc)
             {
                 //read the skeleton nodes
                 out_skeletonDesc.m_nodeNames.reserve(in_quantities.m_numSkeletonNodes);
@@ -283,19 +300,19 @@ namespace ChilliSource
                     u8 nextChar = 0;
                     do
                     {
-                        nextChar = ReadValue<u8>(in_meshStream);
+                        nextChar = ReadValue<u8>(in_meshView);
                         nodeName += nextChar;
                     } while(nextChar != 0);
                     
                     //get the parent index
-                    s32 parentIndex = (s32)ReadValue<s16>(in_meshStream);
+                    s32 parentIndex = (s32)ReadValue<s16>(in_meshView);
                     
                     //get the type
                     const u32 k_isJoint = 1;
-                    u8 type = ReadValue<u8>(in_meshStream);
+                    u8 type = ReadValue<u8>(in_meshView);
                     if (type == k_isJoint)
                     {
-                        u32 jointIndex = (u32)ReadValue<u8>(in_meshStream);
+                        u32 jointIndex = (u32)ReadValue<u8>(in_meshView);
                         jointToNodeMap.insert(std::pair<u32, s32>(jointIndex, (s32)i));
                     }
                     
@@ -315,23 +332,23 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param File view
 			/// @param the file path
             /// @param [Out] Mesh description
             /// @param [Out] A struct containing info on the number of meshes, nodes and joints.
             ///
 			/// @return Whether the file is correct
             //-----------------------------------------------------------------------------
-            bool ReadGlobalHeader(const Core::FileStreamSPtr& in_meshStream, const std::string& in_filePath, MeshDescriptor& out_meshDesc, MeshDataQuantities& out_meshQuantities)
+            bool ReadGlobalHeader(Core::FileView* in_meshView, const std::string& in_filePath, MeshDescriptor& out_meshDesc, MeshDataQuantities& out_meshQuantities)
             {
-                u32 fileCheckValue = ReadValue<u32>(in_meshStream);
+                u32 fileCheckValue = ReadValue<u32>(in_meshView);
                 if(fileCheckValue != k_fileCheckValue)
                 {
                     CS_LOG_ERROR("csmodel file has corruption(incorrect File Check Value): " + in_filePath);
                     return false;
                 }
                 
-                u32 versionNum = ReadValue<u32>(in_meshStream);
+                u32 versionNum = ReadValue<u32>(in_meshView);
                 if (versionNum < k_minVersion || versionNum > k_maxVersion)
                 {
                     CS_LOG_ERROR("Unsupported csmodel version: " + in_filePath);
@@ -344,10 +361,10 @@ namespace ChilliSource
                 out_meshDesc.mFeatures.mbHasTexture = false;
                 
                 //build the feature declaration from the file
-                u32 numFeatures = (u32)ReadValue<u8>(in_meshStream);
+                u32 numFeatures = (u32)ReadValue<u8>(in_meshView);
                 for (u32 i=0; i<numFeatures; ++i)
                 {
-                    u32 featureType = (u32)ReadValue<u8>(in_meshStream);
+                    u32 featureType = (u32)ReadValue<u8>(in_meshView);
                     
                     switch (Feature(featureType))
                     {
@@ -361,29 +378,29 @@ namespace ChilliSource
                 }
                 
                 //read the vertex declaration
-                ReadVertexDeclaration(in_meshStream, out_meshDesc);
+                ReadVertexDeclaration(in_meshView, out_meshDesc);
                 
                 //read index declaration
-                out_meshDesc.mudwIndexSize = ReadValue<u8>(in_meshStream);
+                out_meshDesc.mudwIndexSize = ReadValue<u8>(in_meshView);
                 
                 //read the min and max bounds
-                out_meshDesc.mvMinBounds.x = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMinBounds.y = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMinBounds.z = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.x = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.y = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.z = ReadValue<f32>(in_meshStream);
+                out_meshDesc.mvMinBounds.x = ReadValue<f32>(in_meshView);
+                out_meshDesc.mvMinBounds.y = ReadValue<f32>(in_meshView);
+                out_meshDesc.mvMinBounds.z = ReadValue<f32>(in_meshView);
+                out_meshDesc.mvMaxBounds.x = ReadValue<f32>(in_meshView);
+                out_meshDesc.mvMaxBounds.y = ReadValue<f32>(in_meshView);
+                out_meshDesc.mvMaxBounds.z = ReadValue<f32>(in_meshView);
                 
                 //read the number of meshes
-                out_meshQuantities.m_numMeshes = (u32)ReadValue<u16>(in_meshStream);
+                out_meshQuantities.m_numMeshes = (u32)ReadValue<u16>(in_meshView);
                 out_meshQuantities.m_numSkeletonNodes = 0;
                 out_meshQuantities.m_numJoints = 0;
                 
                 //read num skeleton nodes and joints if used
                 if (true == out_meshDesc.mFeatures.mbHasAnimationData)
                 {
-                    out_meshQuantities.m_numSkeletonNodes = (s32)ReadValue<s16>(in_meshStream);
-                    out_meshQuantities.m_numJoints = (u32)ReadValue<u8>(in_meshStream);
+                    out_meshQuantities.m_numSkeletonNodes = (s32)ReadValue<s16>(in_meshView);
+                    out_meshQuantities.m_numJoints = (u32)ReadValue<u8>(in_meshView);
                 }
                 
                 return true;
@@ -395,50 +412,79 @@ namespace ChilliSource
 			///
             /// @param The storage location to load from
 			/// @param File path
+            /// @param Options to customise the creation
 			/// @param [Out] Mesh description
             ///
 			/// @return true if successful, false if not
             //----------------------------------------------------------------------------
-            bool ReadFile(Core::StorageLocation in_location, const std::string& in_filePath, MeshDescriptor& out_meshDesc)
+            bool ReadFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, MeshDescriptor& out_meshDesc)
             {
-                Core::FileStreamSPtr meshStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
+                const MeshResourceOptions* options = static_cast<const MeshResourceOptions*>(in_options.get());
+                out_meshDesc.m_cpuSkinningSupported = (options != nullptr && options->IsCPUSkinningSupported() == true);
+                
+                Core::FileViewUPtr meshView = Core::Application::Get()->GetFileSystem()->CreateFileView(in_location, in_filePath);
                 
                 //Check file for corruption
-                if(nullptr == meshStream || true == meshStream->IsBad())
+                if(nullptr == meshView)
                 {
                     CS_LOG_ERROR("Cannot open csmodel file: " + in_filePath);
                     return false;
                 }
                 
                 MeshDataQuantities quantities;
-                if(ReadGlobalHeader(meshStream, in_filePath, out_meshDesc, quantities) == false)
+                if(ReadGlobalHeader(meshView.get(), in_filePath, out_meshDesc, quantities) == false)
                 {
                     return false;
                 }
                 
                 if (true == out_meshDesc.mFeatures.mbHasAnimationData)
                 {
-                    ReadSkeletonData(meshStream, quantities, out_meshDesc.m_skeletonDesc);
+                    ReadSkeletonData(meshView.get(), quantities, out_meshDesc.m_skeletonDesc);
+                }
+                
+                if (meshView->HasReadFailed() == true)
+                {
+                    CS_LOG_ERROR("csmodel file is truncated: " + in_filePath);
+                    return false;
                 }
                 
                 for(u32 i=0; i<quantities.m_numMeshes; ++i)
                 {
                     SubMeshDescriptor subMeshDesc;
                     
-                    ReadSubMeshHeader(meshStream, out_meshDesc, subMeshDesc);
-                    ReadSubMeshData(meshStream, out_meshDesc, subMeshDesc);
+                    ReadSubMeshHeader(meshView.get(), out_meshDesc, subMeshDesc);
+                    
+                    if (meshView->HasReadFailed() == false)
+                    {
+                        ReadSubMeshData(meshView.get(), out_meshDesc, subMeshDesc);
+                    }
                     
                     out_meshDesc.mMeshes.push_back(subMeshDesc);
+                    
+                    if (meshView->HasReadFailed() == true)
+                    {
+                        CS_LOG_ERROR("csmodel file is truncated: " + in_filePath);
+                        
+                        //the sub-mesh data is only cleaned up when the mesh is built, so it has to be released here instead.
+                        for (auto it = out_meshDesc.mMeshes.begin(); it != out_meshDesc.mMeshes.end(); ++it)
+                        {
+                            delete[] it->mpVertexData;
+                            delete[] it->mpIndexData;
+                        }
+                        out_meshDesc.mMeshes.clear();
+                        
+                        return false;
+                    }
                 }
                 
-                meshStream->Close();
-                
                 return true;
             }
         }
         
         CS_DEFINE_NAMEDTYPE(CSModelProvider);
         
+        const Core::IResourceOptionsBaseCSPtr CSModelProvider::s_defaultOptions(std::make_shared<MeshResourceOptions>());
+        
         //-------------------------------------------------------------------------
 		//-------------------------------------------------------------------------
         CSModelProviderUPtr CSModelProvider::Create()
@@ -463,6 +509,12 @@ namespace ChilliSource
 		{
 			return in_extension == k_modelFileExtension;
 		}
+        //----------------------------------------------------
+        //----------------------------------------------------
+        Core::IResourceOptionsBaseCSPtr CSModelProvider::GetDefaultOptions() const
+        {
+            return s_defaultOptions;
+        }
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
 		void CSModelProvider::CreateResourceFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceSPtr& out_resource)
@@ -471,7 +523,7 @@ namespace ChilliSource
 			
             MeshDescriptor descriptor;
 			
-			if (ReadFile(in_location, in_filePath, descriptor) == false)
+			if (ReadFile(in_location, in_filePath, in_options, descriptor) == false)
 			{
                 meshResource->SetLoadState(Core::Resource::LoadState::k_failed);
 				return;
@@ -488,16 +540,16 @@ namespace ChilliSource
 			MeshSPtr meshResource = std::static_pointer_cast<Mesh>(out_resource);
 			
             //Load model as task
-			auto task = std::bind(&CSModelProvider::LoadMeshDataTask, this, in_location, in_filePath, in_delegate, meshResource);
+			auto task = std::bind(&CSModelProvider::LoadMeshDataTask, this, in_location, in_filePath, in_options, in_delegate, meshResource);
 			Core::Application::Get()->GetTaskScheduler()->ScheduleTask(task);
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
-		void CSModelProvider::LoadMeshDataTask(Core::StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const MeshSPtr& out_resource)
+		void CSModelProvider::LoadMeshDataTask(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const AsyncLoadDelegate& in_delegate, const MeshSPtr& out_resource)
 		{
 			//read the mesh data into a MoStaticDeclaration
 			MeshDescriptor descriptor;
-			if (false == ReadFile(in_location, in_filePath, descriptor))
+			if (false == ReadFile(in_location, in_filePath, in_options, descriptor))
 			{
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
 				Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
@@ -505,7 +557,7 @@ namespace ChilliSource
 			}
 			
 			//start a main thread task for loading the data into a mesh
-			Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(&CSModelProvider::BuildMesh, this, in_delegate, descriptor, out_resource));
+			Core::Application::Get()->GetResourcePool()->ScheduleUploadTask(std::bind(&CSModelProvider::BuildMesh, this, in_delegate, descriptor, out_resource));
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
@@ -73,6 +73,13 @@ namespace ChilliSource
 			/// @return Whether the object can create a resource with the given extension
 			//----------------------------------------------------------------------------
 			bool CanCreateResourceWithFileExtension(const std::string& in_extension) const override;
+            //----------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Default options for mesh loading. These
+            /// don't support CPU skinning.
+            //----------------------------------------------------
+            Core::IResourceOptionsBaseCSPtr GetDefaultOptions() const override;
 
 		private:
             
@@ -110,10 +117,11 @@ namespace ChilliSource
 			///
             /// @param The storage location to load from
 			/// @param File path
+            /// @param Options to customise the creation
             /// @param Delegate to callback on completion either success or failure
 			/// @param the output resource pointer
 			//----------------------------------------------------------------------------
-			void LoadMeshDataTask(Core::StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const MeshSPtr& out_resource);
+			void LoadMeshDataTask(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const AsyncLoadDelegate& in_delegate, const MeshSPtr& out_resource);
 			//----------------------------------------------------------------------------
 			/// Constructs the mesh buffer from the mesh description
 			///
@@ -124,6 +132,8 @@ namespace ChilliSource
 			/// @param [Out] The mesh resource
 			//----------------------------------------------------------------------------
 			void BuildMesh(const AsyncLoadDelegate& in_delegate, MeshDescriptor& out_meshDesc, const MeshSPtr& out_resource);
+            
+            static const Core::IResourceOptionsBaseCSPtr s_defaultOptions;
 		};
 	}
 }
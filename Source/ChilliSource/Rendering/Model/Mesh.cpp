@@ -35,11 +35,245 @@
 #include <ChilliSource/Rendering/Model/MeshDescriptor.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace ChilliSource
 {
 	namespace Rendering
 	{
+        namespace
+        {
+            //Influences with a smaller weight than this don't count towards the joints a partition references.
+            const f32 k_minJointWeight = 0.0001f;
+            //---------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The index data.
+            /// @param The size of an index in bytes.
+            /// @param The index of the index.
+            ///
+            /// @return The vertex index.
+            //---------------------------------------------------------------------
+            u32 ReadIndex(const u8* in_indexData, u32 in_indexSize, u32 in_index)
+            {
+                if (in_indexSize == sizeof(u16))
+                {
+                    return reinterpret_cast<const u16*>(in_indexData)[in_index];
+                }
+                
+                return reinterpret_cast<const u32*>(in_indexData)[in_index];
+            }
+            //---------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The index data.
+            /// @param The size of an index in bytes.
+            /// @param The vertex index to append.
+            //---------------------------------------------------------------------
+            void AppendIndex(std::vector<u8>& inout_indexData, u32 in_indexSize, u32 in_vertexIndex)
+            {
+                inout_indexData.resize(inout_indexData.size() + in_indexSize);
+                u8* index = inout_indexData.data() + inout_indexData.size() - in_indexSize;
+                
+                if (in_indexSize == sizeof(u16))
+                {
+                    *reinterpret_cast<u16*>(index) = static_cast<u16>(in_vertexIndex);
+                }
+                else
+                {
+                    *reinterpret_cast<u32*>(index) = in_vertexIndex;
+                }
+            }
+            //---------------------------------------------------------------------
+            /// Gets the skeleton joints that the given vertex is influenced by.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The vertex.
+            /// @param The offset of the weights in the vertex.
+            /// @param The offset of the joint indices in the vertex.
+            /// @param The number of joints in the skeleton.
+            /// @param [Out] The joints. Joints already in the list are not
+            /// added again.
+            //---------------------------------------------------------------------
+            void GetVertexJoints(const u8* in_vertex, u32 in_weightOffset, u32 in_jointIndexOffset, u32 in_numJoints, std::vector<u32>& out_joints)
+            {
+                const f32* weights = reinterpret_cast<const f32*>(in_vertex + in_weightOffset);
+                const u8* jointIndices = in_vertex + in_jointIndexOffset;
+                
+                //The fourth weight is implied by the other three, as in the built-in animated shaders.
+                const f32 influenceWeights[4] = { weights[0], weights[1], weights[2], 1.0f - weights[0] - weights[1] - weights[2] };
+                for (u32 influence = 0; influence < 4; ++influence)
+                {
+                    const u32 joint = jointIndices[influence];
+                    if (influenceWeights[influence] >= k_minJointWeight && joint < in_numJoints && std::find(out_joints.begin(), out_joints.end(), joint) == out_joints.end())
+                    {
+                        out_joints.push_back(joint);
+                    }
+                }
+            }
+            //---------------------------------------------------------------------
+            /// Splits the given sub mesh into partitions which each reference no
+            /// more joints than can be used in a single draw. Triangles are added
+            /// to the current partition until one would take it over the limit,
+            /// at which point a new partition is started. The vertices of each
+            /// partition are duplicated so that their joint indices can be
+            /// remapped to the partition's own compact joint palette.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The sub mesh descriptor.
+            /// @param The vertex declaration.
+            /// @param The size of an index in bytes.
+            /// @param The number of joints in the skeleton.
+            /// @param [Out] The vertex data of the split sub mesh.
+            /// @param [Out] The index data of the split sub mesh.
+            /// @param [Out] The joint partitions.
+            ///
+            /// @return Whether or not the sub mesh was split. It is not if it
+            /// doesn't need to be, or if it cannot be.
+            //---------------------------------------------------------------------
+            bool TrySplitByJoints(const SubMeshDescriptor& in_subMeshDesc, const VertexDeclaration& in_vertexDeclaration, u32 in_indexSize, u32 in_numJoints,
+                                  std::vector<u8>& out_vertexData, std::vector<u8>& out_indexData, std::vector<SubMesh::JointPartition>& out_jointPartitions)
+            {
+                u32 weightOffset = 0;
+                u32 jointIndexOffset = 0;
+                if (in_subMeshDesc.ePrimitiveType != PrimitiveType::k_tri || in_subMeshDesc.mudwNumIndices == 0 || in_numJoints <= SubMesh::k_maxJointsPerDraw ||
+                    in_vertexDeclaration.TryGetElementOffset(VertexDataSemantic::k_weight, weightOffset) == false ||
+                    in_vertexDeclaration.TryGetElementOffset(VertexDataSemantic::k_jointIndex, jointIndexOffset) == false)
+                {
+                    return false;
+                }
+                
+                const u32 vertexSize = in_vertexDeclaration.GetTotalSize();
+                
+                //Most sub meshes reference few enough joints to be drawn at once, so check before doing any work.
+                std::vector<u32> referencedJoints;
+                for (u32 vertex = 0; vertex < in_subMeshDesc.mudwNumVertices; ++vertex)
+                {
+                    GetVertexJoints(in_subMeshDesc.mpVertexData + vertex * vertexSize, weightOffset, jointIndexOffset, in_numJoints, referencedJoints);
+                }
+                
+                if (referencedJoints.size() <= SubMesh::k_maxJointsPerDraw)
+                {
+                    return false;
+                }
+                
+                std::vector<s32> localJoints(in_numJoints, -1);
+                std::vector<s32> localVertices(in_subMeshDesc.mudwNumVertices, -1);
+                std::vector<u32> partitionJoints;
+                std::vector<u32> partitionIndices;
+                std::vector<u32> triangleJoints;
+                u32 numVertices = 0;
+                
+                auto addPartition = [&]()
+                {
+                    SubMesh::JointPartition partition;
+                    partition.m_indexOffset = static_cast<u32>(out_indexData.size()) / in_indexSize;
+                    partition.m_numIndices = static_cast<u32>(partitionIndices.size());
+                    partition.m_vertexOffset = numVertices;
+                    
+                    for (u32 index : partitionIndices)
+                    {
+                        if (localVertices[index] < 0)
+                        {
+                            localVertices[index] = static_cast<s32>(numVertices++);
+                            
+                            const u8* sourceVertex = in_subMeshDesc.mpVertexData + index * vertexSize;
+                            out_vertexData.insert(out_vertexData.end(), sourceVertex, sourceVertex + vertexSize);
+                            
+                            //Unused influences may reference joints outside the partition, but have no weight so can use any joint.
+                            u8* jointIndices = out_vertexData.data() + out_vertexData.size() - vertexSize + jointIndexOffset;
+                            for (u32 influence = 0; influence < 4; ++influence)
+                            {
+                                const s32 localJoint = (jointIndices[influence] < in_numJoints ? localJoints[jointIndices[influence]] : -1);
+                                jointIndices[influence] = static_cast<u8>(localJoint >= 0 ? localJoint : 0);
+                            }
+                        }
+                        
+                        AppendIndex(out_indexData, in_indexSize, static_cast<u32>(localVertices[index]));
+                    }
+                    
+                    partition.m_numVertices = numVertices - partition.m_vertexOffset;
+                    
+                    InverseBindPosePtr inverseBindPose(new InverseBindPose());
+                    inverseBindPose->mJointIndices = partitionJoints;
+                    for (u32 joint : partitionJoints)
+                    {
+                        inverseBindPose->mInverseBindPoseMatrices.push_back(joint < in_subMeshDesc.mInverseBindPoseMatrices.size() ? in_subMeshDesc.mInverseBindPoseMatrices[joint] : Core::Matrix4::k_identity);
+                    }
+                    partition.m_inverseBindPose = inverseBindPose;
+                    out_jointPartitions.push_back(partition);
+                    
+                    //Vertices shared with the next partition are duplicated rather than shared.
+                    for (u32 index : partitionIndices)
+                    {
+                        localVertices[index] = -1;
+                    }
+                    for (u32 joint : partitionJoints)
+                    {
+                        localJoints[joint] = -1;
+                    }
+                    partitionIndices.clear();
+                    partitionJoints.clear();
+                };
+                
+                for (u32 triangle = 0; triangle + 2 < in_subMeshDesc.mudwNumIndices; triangle += 3)
+                {
+                    triangleJoints.clear();
+                    for (u32 corner = 0; corner < 3; ++corner)
+                    {
+                        const u32 index = ReadIndex(in_subMeshDesc.mpIndexData, in_indexSize, triangle + corner);
+                        GetVertexJoints(in_subMeshDesc.mpVertexData + index * vertexSize, weightOffset, jointIndexOffset, in_numJoints, triangleJoints);
+                    }
+                    
+                    u32 numNewJoints = 0;
+                    for (u32 joint : triangleJoints)
+                    {
+                        if (localJoints[joint] < 0)
+                        {
+                            ++numNewJoints;
+                        }
+                    }
+                    
+                    if (partitionJoints.size() + numNewJoints > SubMesh::k_maxJointsPerDraw)
+                    {
+                        addPartition();
+                    }
+                    
+                    for (u32 joint : triangleJoints)
+                    {
+                        if (localJoints[joint] < 0)
+                        {
+                            localJoints[joint] = static_cast<s32>(partitionJoints.size());
+                            partitionJoints.push_back(joint);
+                        }
+                    }
+                    
+                    for (u32 corner = 0; corner < 3; ++corner)
+                    {
+                        partitionIndices.push_back(ReadIndex(in_subMeshDesc.mpIndexData, in_indexSize, triangle + corner));
+                    }
+                }
+                
+                if (partitionIndices.empty() == false)
+                {
+                    addPartition();
+                }
+                
+                if (in_indexSize == sizeof(u16) && numVertices > static_cast<u32>(std::numeric_limits<u16>::max()) + 1)
+                {
+                    CS_LOG_ERROR("Cannot split sub mesh '" + in_subMeshDesc.mstrName + "' by joints as the duplicated vertices exceed the range of its indices.");
+                    out_vertexData.clear();
+                    out_indexData.clear();
+                    out_jointPartitions.clear();
+                    return false;
+                }
+                
+                return true;
+            }
+        }
+        
         CS_DEFINE_NAMEDTYPE(Mesh);
         //---------------------------------------------------------------------
         //---------------------------------------------------------------------
@@ -78,9 +312,27 @@ namespace ChilliSource
             int count = 0;
             for (auto it = in_meshDesc.mMeshes.begin(); it != in_meshDesc.mMeshes.end(); ++it)
             {
+                u8* vertexData = it->mpVertexData;
+                u8* indexData = it->mpIndexData;
+                u32 numVertices = it->mudwNumVertices;
+                u32 numIndices = it->mudwNumIndices;
+                
+                //sub meshes which reference more joints than can be drawn at once are split into partitions that can be.
+                std::vector<u8> splitVertexData;
+                std::vector<u8> splitIndexData;
+                std::vector<SubMesh::JointPartition> jointPartitions;
+                if (in_meshDesc.mFeatures.mbHasAnimationData == true &&
+                    TrySplitByJoints(*it, in_meshDesc.mVertexDeclaration, in_meshDesc.mudwIndexSize, m_skeleton->GetNumJoints(), splitVertexData, splitIndexData, jointPartitions) == true)
+                {
+                    vertexData = splitVertexData.data();
+                    indexData = splitIndexData.data();
+                    numVertices = static_cast<u32>(splitVertexData.size()) / in_meshDesc.mVertexDeclaration.GetTotalSize();
+                    numIndices = static_cast<u32>(splitIndexData.size()) / in_meshDesc.mudwIndexSize;
+                }
+                
                 //caclulate the mesh capacities
-                u32 udwVertexDataCapacity = it->mudwNumVertices * in_meshDesc.mVertexDeclaration.GetTotalSize();
-                u32 udwIndexDataCapacity  = it->mudwNumIndices * in_meshDesc.mudwIndexSize;
+                u32 udwVertexDataCapacity = numVertices * in_meshDesc.mVertexDeclaration.GetTotalSize();
+                u32 udwIndexDataCapacity  = numIndices * in_meshDesc.mudwIndexSize;
                 
                 //prepare the mesh if it needs it, otherwise just update the vertex and index declarations.
                 SubMesh* newSubMesh = CreateSubMesh(it->mstrName);
@@ -90,7 +342,7 @@ namespace ChilliSource
                 if (udwVertexDataCapacity <= newSubMesh->GetInternalMeshBuffer()->GetVertexCapacity() &&
                     udwIndexDataCapacity <= newSubMesh->GetInternalMeshBuffer()->GetIndexCapacity())
                 {
-                    newSubMesh->Build(it->mpVertexData, it->mpIndexData, it->mudwNumVertices, it->mudwNumIndices, it->mvMinBounds, it->mvMaxBounds);
+                    newSubMesh->Build(vertexData, indexData, numVertices, numIndices, it->mvMinBounds, it->mvMaxBounds);
                 }
                 else
                 {
@@ -104,6 +356,13 @@ namespace ChilliSource
                     InverseBindPosePtr ibp(new InverseBindPose());
                     ibp->mInverseBindPoseMatrices = it->mInverseBindPoseMatrices;
                     newSubMesh->SetInverseBindPose(ibp);
+                    newSubMesh->SetJointPartitions(jointPartitions);
+                    
+                    //keep the source data only if it was requested, so the sub mesh can be skinned on the CPU.
+                    if (in_meshDesc.m_cpuSkinningSupported == true)
+                    {
+                        newSubMesh->SetSourceData(vertexData, udwVertexDataCapacity, indexData, udwIndexDataCapacity);
+                    }
                 }
                 
                 count++;
@@ -146,6 +405,23 @@ namespace ChilliSource
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
+		u32 Mesh::GetGPUMemorySize() const
+		{
+			u32 size = 0;
+			for(const auto& subMesh : m_subMeshes)
+			{
+				MeshBuffer* meshBuffer = subMesh->GetInternalMeshBuffer();
+				if(meshBuffer != nullptr)
+				{
+					const BufferDescription& bufferDesc = meshBuffer->GetBufferDescription();
+					size += bufferDesc.VertexDataCapacity + bufferDesc.IndexDataCapacity;
+				}
+			}
+			
+			return size;
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
 		const SubMesh* Mesh::GetSubMeshAtIndex(u32 in_index) const
 		{
             CS_ASSERT(in_index < m_subMeshes.size(), "Sub mesh index out of bounds");
@@ -197,7 +473,7 @@ namespace ChilliSource
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		void Mesh::Render(RenderSystem* in_renderSystem, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& in_animGroup) const
+		void Mesh::Render(RenderCommandBuffer* in_commandBuffer, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& in_animGroup) const
 		{
             CS_ASSERT(in_materials.size() > 0, "Must have at least one material to render");
 
@@ -233,7 +509,7 @@ namespace ChilliSource
                 ++udwCurrMaterial;
                 udwCurrMaterial = std::min(udwCurrMaterial, (u32)in_materials.size()-1);
 					
-                (*it)->Render(in_renderSystem, in_worldMat, pMaterial, in_shaderPass, in_animGroup);
+                (*it)->Render(in_commandBuffer, in_worldMat, pMaterial, in_shaderPass, in_animGroup);
 			}
 			
 			//then transparent stuff
@@ -244,7 +520,7 @@ namespace ChilliSource
                 ++udwCurrMaterial;
                 udwCurrMaterial = (u32)std::min(udwCurrMaterial, (u32)in_materials.size()-1);
 				
-                (*it)->Render(in_renderSystem, in_worldMat, pMaterial, in_shaderPass, in_animGroup);
+                (*it)->Render(in_commandBuffer, in_worldMat, pMaterial, in_shaderPass, in_animGroup);
 			}
 		}
 		//-----------------------------------------------------------------
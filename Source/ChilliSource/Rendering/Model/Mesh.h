@@ -98,6 +98,13 @@ namespace ChilliSource
             /// @return Number of sub meshes.
             //-----------------------------------------------------------------
             u32 GetNumSubMeshes() const;
+            //-----------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The combined size of the vertex and index buffers of
+            /// all sub meshes.
+            //-----------------------------------------------------------------
+            u32 GetGPUMemorySize() const override;
 			//-----------------------------------------------------------------
 			/// @author Ian Copland
 			///
@@ -128,13 +135,13 @@ namespace ChilliSource
             ///
             /// @author S Downie
 			///
-			/// @param the render system.
+			/// @param The command buffer to record into.
 			/// @param World transform matrix
 			/// @param The array of materials.
             /// @param Shader pass
             /// @param Skinned animation group
 			//-----------------------------------------------------------------
-			void Render(RenderSystem* in_renderSystem, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& in_animGroup = SkinnedAnimationGroupSPtr()) const;
+			void Render(RenderCommandBuffer* in_commandBuffer, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& in_animGroup = SkinnedAnimationGroupSPtr()) const;
 		private:
             
             friend class Core::ResourcePool;
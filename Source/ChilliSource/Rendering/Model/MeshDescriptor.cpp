@@ -60,6 +60,7 @@ namespace ChilliSource
 		MeshDescriptor::MeshDescriptor()
 		{
 			mudwIndexSize = 0;
+            m_cpuSkinningSupported = false;
 		}
 	}
 }
\ No newline at end of file
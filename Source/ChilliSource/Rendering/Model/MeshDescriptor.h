@@ -91,6 +91,7 @@ namespace ChilliSource
 			Core::Vector3 mvMinBounds;
 			Core::Vector3 mvMaxBounds;
             u32 mudwIndexSize;
+            bool m_cpuSkinningSupported;
 		};
 	}
 }
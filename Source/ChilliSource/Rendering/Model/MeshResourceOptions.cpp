@@ -0,0 +1,57 @@
+//
+//  MeshResourceOptions.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Model/MeshResourceOptions.h>
+
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        MeshResourceOptions::MeshResourceOptions(bool in_cpuSkinningSupported)
+        {
+            m_options.m_cpuSkinningSupported = in_cpuSkinningSupported ? 1 : 0;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u32 MeshResourceOptions::GenerateHash() const
+        {
+            return Core::HashCRC32::GenerateHashCode((const s8*)&m_options, sizeof(Options));
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool MeshResourceOptions::IsCPUSkinningSupported() const
+        {
+            return (m_options.m_cpuSkinningSupported != 0);
+        }
+	}
+}
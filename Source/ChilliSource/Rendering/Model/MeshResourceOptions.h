@@ -0,0 +1,102 @@
+//
+//  MeshResourceOptions.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_MESHRESOURCEOPTIONS_H_
+#define _CHILLISOURCE_RENDERING_MODEL_MESHRESOURCEOPTIONS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
+#include <ChilliSource/Rendering/Model/Mesh.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //-------------------------------------------------------
+        /// Custom options for loading a mesh. By default only
+        /// the GPU copy of the mesh data is kept. Animated meshes
+        /// which will be skinned on the CPU need to be loaded
+        /// with CPU skinning supported, which keeps a copy of the
+        /// source vertex and index data in memory.
+        ///
+        /// @author Jordan Brown
+        //-------------------------------------------------------
+		class MeshResourceOptions final : public Core::IResourceOptions<Mesh>
+		{
+		public:
+            //-------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            MeshResourceOptions() = default;
+            //-------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not the sub-meshes of an animated
+            /// mesh can be skinned on the CPU.
+            //-------------------------------------------------------
+            MeshResourceOptions(bool in_cpuSkinningSupported);
+            //-------------------------------------------------------
+            /// Generate a unique hash based on the
+            /// currently set options
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return Hash of the options contents
+            //-------------------------------------------------------
+            u32 GenerateHash() const override;
+            //-------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether the sub-meshes of an animated mesh
+            /// can be skinned on the CPU.
+            //-------------------------------------------------------
+            bool IsCPUSkinningSupported() const;
+        private:
+            
+            //-------------------------------------------------------
+            /// The options for loading meshes. These are held
+            /// in a struct to more easily allow hashing of the data
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            struct Options
+            {
+                u32 m_cpuSkinningSupported = 0;
+            };
+            
+            Options m_options;
+		};
+	}
+}
+
+#endif
@@ -41,6 +41,7 @@ namespace ChilliSource
         void Skeleton::Build(const SkeletonDescriptor& in_desc)
         {
             mapNodes.reserve(in_desc.m_nodeNames.size());
+            m_parentIndices.reserve(in_desc.m_nodeNames.size());
             
             for(u32 i=0; i<in_desc.m_nodeNames.size(); ++i)
             {
@@ -48,9 +49,12 @@ namespace ChilliSource
                 node->mstrName = in_desc.m_nodeNames[i];
                 node->mdwParentIndex = in_desc.m_parentNodeIndices[i];
                 mapNodes.push_back(SkeletonNodeCUPtr(node));
+                m_parentIndices.push_back(node->mdwParentIndex);
             }
             
             madwJoints = in_desc.m_jointIndices;
+            
+            BuildNodeEvaluationOrder();
         }
 		//-------------------------------------------------------------------------
 		/// Get Node By Name
@@ -123,5 +127,79 @@ namespace ChilliSource
         {
             return madwJoints;
         }
+        //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        const std::vector<s32>& Skeleton::GetParentIndices() const
+        {
+            return m_parentIndices;
+        }
+        //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        const std::vector<u32>& Skeleton::GetNodeEvaluationOrder() const
+        {
+            return m_nodeEvaluationOrder;
+        }
+        //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        void Skeleton::BuildNodeEvaluationOrder()
+        {
+            const u32 numNodes = static_cast<u32>(m_parentIndices.size());
+            
+            //store the children of each node contiguously, with the range for each node given by the child offsets.
+            std::vector<u32> childOffsets(numNodes + 1, 0);
+            for (u32 i = 0; i < numNodes; ++i)
+            {
+                s32 parentIndex = m_parentIndices[i];
+                if (parentIndex >= static_cast<s32>(numNodes) || parentIndex < -1 || parentIndex == static_cast<s32>(i))
+                {
+                    CS_LOG_ERROR("Skeleton node '" + mapNodes[i]->mstrName + "' has an invalid parent index. It will be treated as a root node.");
+                    m_parentIndices[i] = -1;
+                }
+                else if (parentIndex >= 0)
+                {
+                    ++childOffsets[parentIndex + 1];
+                }
+            }
+            
+            for (u32 i = 0; i < numNodes; ++i)
+            {
+                childOffsets[i + 1] += childOffsets[i];
+            }
+            
+            std::vector<u32> children(childOffsets[numNodes]);
+            std::vector<u32> childInsertPositions(childOffsets.begin(), childOffsets.end() - 1);
+            for (u32 i = 0; i < numNodes; ++i)
+            {
+                if (m_parentIndices[i] >= 0)
+                {
+                    children[childInsertPositions[m_parentIndices[i]]++] = i;
+                }
+            }
+            
+            //the evaluation order doubles as the breadth first queue.
+            m_nodeEvaluationOrder.clear();
+            m_nodeEvaluationOrder.reserve(numNodes);
+            for (u32 i = 0; i < numNodes; ++i)
+            {
+                if (m_parentIndices[i] < 0)
+                {
+                    m_nodeEvaluationOrder.push_back(i);
+                }
+            }
+            
+            for (u32 i = 0; i < m_nodeEvaluationOrder.size(); ++i)
+            {
+                u32 nodeIndex = m_nodeEvaluationOrder[i];
+                for (u32 j = childOffsets[nodeIndex]; j < childOffsets[nodeIndex + 1]; ++j)
+                {
+                    m_nodeEvaluationOrder.push_back(children[j]);
+                }
+            }
+            
+            if (m_nodeEvaluationOrder.size() != numNodes)
+            {
+                CS_LOG_ERROR("Skeleton contains a cycle in its node hierarchy. Nodes in the cycle will not be animated.");
+            }
+        }
 	}
 }
\ No newline at end of file
@@ -121,11 +121,34 @@ namespace ChilliSource
 			/// @return the array of joint indices
 			//-------------------------------------------------------------------------
 			const std::vector<s32>& GetJointIndices() const;
+            //-------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The parent index of each node, or -1 for root nodes.
+            //-------------------------------------------------------------------------
+            const std::vector<s32>& GetParentIndices() const;
+            //-------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The indices of all nodes ordered such that every node comes
+            /// after its parent. Evaluating the nodes in this order allows the whole
+            /// hierarchy to be transformed in a single pass.
+            //-------------------------------------------------------------------------
+            const std::vector<u32>& GetNodeEvaluationOrder() const;
 			
 		private:
+            //-------------------------------------------------------------------------
+            /// Builds the node evaluation order from the parent indices with a
+            /// breadth first traversal from the root nodes.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------------------------
+            void BuildNodeEvaluationOrder();
 			
 			std::vector<SkeletonNodeCUPtr> mapNodes;
             std::vector<s32> madwJoints;
+            std::vector<s32> m_parentIndices;
+            std::vector<u32> m_nodeEvaluationOrder;
 		};
 	}
 }
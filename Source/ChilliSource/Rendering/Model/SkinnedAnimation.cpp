@@ -28,10 +28,256 @@
 
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 
+#include <ChilliSource/Core/Math/MathUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace ChilliSource
 {
 	namespace Rendering
 	{
+        namespace
+        {
+            const u32 k_maxKeySpan = 64;
+            const u32 k_quaternionComponentBits = 15;
+            const u32 k_quaternionComponentMask = (1 << k_quaternionComponentBits) - 1;
+            const f32 k_quaternionComponentRange = 0.70710678f;
+            
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The first vector.
+            /// @param The second vector.
+            ///
+            /// @return The distance between the two vectors.
+            //----------------------------------------------------------------------------
+            f32 CalculateVectorError(const Core::Vector3& in_a, const Core::Vector3& in_b)
+            {
+                return (in_a - in_b).Length();
+            }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The first orientation.
+            /// @param The second orientation.
+            ///
+            /// @return The angle between the two orientations in radians.
+            //----------------------------------------------------------------------------
+            f32 CalculateOrientationError(const Core::Quaternion& in_a, const Core::Quaternion& in_b)
+            {
+                //the angle is derived from the chord length rather than the dot product, as acos loses
+                //too much precision for the small angles compared against the tolerance.
+                f32 sign = (Core::Quaternion::Dot(in_a, in_b) < 0.0f) ? -1.0f : 1.0f;
+                f32 dx = in_a.x - sign * in_b.x;
+                f32 dy = in_a.y - sign * in_b.y;
+                f32 dz = in_a.z - sign * in_b.z;
+                f32 dw = in_a.w - sign * in_b.w;
+                f32 chordLength = std::sqrt(dx * dx + dy * dy + dz * dz + dw * dw);
+                return 4.0f * std::asin(std::min(0.5f * chordLength, 1.0f));
+            }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The first vector.
+            /// @param The second vector.
+            /// @param The interpolation factor.
+            ///
+            /// @return The linearly interpolated vector.
+            //----------------------------------------------------------------------------
+            Core::Vector3 InterpolateVector(const Core::Vector3& in_a, const Core::Vector3& in_b, f32 in_t)
+            {
+                return Core::MathUtils::Lerp(in_t, in_a, in_b);
+            }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The first orientation.
+            /// @param The second orientation.
+            /// @param The interpolation factor.
+            ///
+            /// @return The spherically interpolated orientation.
+            //----------------------------------------------------------------------------
+            Core::Quaternion InterpolateOrientation(const Core::Quaternion& in_a, const Core::Quaternion& in_b, f32 in_t)
+            {
+                return Core::Quaternion::Slerp(in_a, in_b, in_t);
+            }
+            //----------------------------------------------------------------------------
+            /// Selects the subset of the given key values which must be kept so that
+            /// every reference value can be reconstructed by interpolating between its
+            /// surrounding keys to within the given tolerance. The first and last keys
+            /// are always kept unless all values are within tolerance of the first key,
+            /// in which case only the first is kept.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The value that would be stored for each frame's key. This may
+            /// differ from the reference value if keys are quantised.
+            /// @param The original value for every frame.
+            /// @param The maximum allowed error.
+            /// @param The function used to interpolate between two values.
+            /// @param The function used to measure the error between two values.
+            /// @param [Out] The indices of the values that should be kept.
+            //----------------------------------------------------------------------------
+            template <typename TValue, typename TInterpolateFunc, typename TErrorFunc> void ReduceKeys(const std::vector<TValue>& in_keyValues, const std::vector<TValue>& in_referenceValues, f32 in_tolerance, TInterpolateFunc in_interpolate, TErrorFunc in_error, std::vector<u32>& out_keys)
+            {
+                out_keys.clear();
+                out_keys.push_back(0);
+                
+                const u32 numValues = static_cast<u32>(in_keyValues.size());
+                
+                bool isConstant = true;
+                for (u32 i = 1; i < numValues; ++i)
+                {
+                    if (in_error(in_keyValues[0], in_referenceValues[i]) > in_tolerance)
+                    {
+                        isConstant = false;
+                        break;
+                    }
+                }
+                
+                if (isConstant == true)
+                {
+                    return;
+                }
+                
+                //greedily extend each key span for as long as all the values it covers are within tolerance.
+                u32 spanStart = 0;
+                for (u32 spanEnd = 2; spanEnd < numValues; ++spanEnd)
+                {
+                    bool canSpan = (spanEnd - spanStart <= k_maxKeySpan);
+                    for (u32 i = spanStart + 1; i < spanEnd && canSpan == true; ++i)
+                    {
+                        f32 t = f32(i - spanStart) / f32(spanEnd - spanStart);
+                        canSpan = (in_error(in_interpolate(in_keyValues[spanStart], in_keyValues[spanEnd], t), in_referenceValues[i]) <= in_tolerance);
+                    }
+                    
+                    if (canSpan == false)
+                    {
+                        spanStart = spanEnd - 1;
+                        out_keys.push_back(spanStart);
+                    }
+                }
+                
+                out_keys.push_back(numValues - 1);
+            }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The unit quaternion to pack.
+            ///
+            /// @return The quaternion in smallest three form.
+            //----------------------------------------------------------------------------
+            template <typename TPackedQuaternion> TPackedQuaternion PackQuaternion(const Core::Quaternion& in_orientation)
+            {
+                Core::Quaternion normalised = Core::Quaternion::Normalise(in_orientation);
+                const f32 components[4] = { normalised.x, normalised.y, normalised.z, normalised.w };
+                
+                u32 largestIndex = 0;
+                for (u32 i = 1; i < 4; ++i)
+                {
+                    if (std::abs(components[i]) > std::abs(components[largestIndex]))
+                    {
+                        largestIndex = i;
+                    }
+                }
+                
+                //q and -q are the same orientation, so flip the sign to make the dropped component positive.
+                const f32 sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+                
+                TPackedQuaternion packed;
+                u32 packedIndex = 0;
+                for (u32 i = 0; i < 4; ++i)
+                {
+                    if (i != largestIndex)
+                    {
+                        f32 normalisedComponent = (Core::MathUtils::Clamp(sign * components[i], -k_quaternionComponentRange, k_quaternionComponentRange) + k_quaternionComponentRange) / (2.0f * k_quaternionComponentRange);
+                        packed.m_components[packedIndex++] = static_cast<u16>(normalisedComponent * k_quaternionComponentMask + 0.5f);
+                    }
+                }
+                
+                packed.m_components[0] |= static_cast<u16>((largestIndex & 0x1) << k_quaternionComponentBits);
+                packed.m_components[1] |= static_cast<u16>((largestIndex >> 1) << k_quaternionComponentBits);
+                return packed;
+            }
+            //----------------------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The quaternion in smallest three form.
+            ///
+            /// @return The unpacked unit quaternion.
+            //----------------------------------------------------------------------------
+            template <typename TPackedQuaternion> Core::Quaternion UnpackQuaternion(const TPackedQuaternion& in_packed)
+            {
+                const u32 largestIndex = (in_packed.m_components[0] >> k_quaternionComponentBits) | ((in_packed.m_components[1] >> k_quaternionComponentBits) << 1);
+                
+                f32 components[4];
+                f32 sumOfSquares = 0.0f;
+                u32 packedIndex = 0;
+                for (u32 i = 0; i < 4; ++i)
+                {
+                    if (i != largestIndex)
+                    {
+                        f32 normalisedComponent = f32(in_packed.m_components[packedIndex++] & k_quaternionComponentMask) / f32(k_quaternionComponentMask);
+                        components[i] = normalisedComponent * (2.0f * k_quaternionComponentRange) - k_quaternionComponentRange;
+                        sumOfSquares += components[i] * components[i];
+                    }
+                }
+                components[largestIndex] = std::sqrt(std::max(1.0f - sumOfSquares, 0.0f));
+                
+                return Core::Quaternion(components[0], components[1], components[2], components[3]);
+            }
+            //----------------------------------------------------------------------------
+            /// Samples a single track of a compressed animation, stepping the cursor key
+            /// forward from where it was last left. If the requested frame is before the
+            /// cached key, as happens when an animation loops, the key is found with a
+            /// binary search instead.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The first key in the track.
+            /// @param The number of keys in the track.
+            /// @param The frame index of every key.
+            /// @param The value of every key.
+            /// @param The frame to sample at.
+            /// @param The function used to decode a key.
+            /// @param The function used to interpolate between two values.
+            /// @param [In/Out] The cursor key for the track.
+            ///
+            /// @return The sampled value.
+            //----------------------------------------------------------------------------
+            template <typename TKey, typename TDecodeFunc, typename TInterpolateFunc> auto SampleTrack(u32 in_firstKey, u32 in_numKeys, const std::vector<u16>& in_keyFrames, const std::vector<TKey>& in_keys, f32 in_frame,
+                                                                                                     TDecodeFunc in_decode, TInterpolateFunc in_interpolate, u32& inout_cursorKey) -> decltype(in_decode(in_keys[0]))
+            {
+                if (in_numKeys == 1)
+                {
+                    return in_decode(in_keys[in_firstKey]);
+                }
+                
+                const u16* keyFrames = &in_keyFrames[in_firstKey];
+                
+                u32 key = inout_cursorKey;
+                if (key >= in_numKeys - 1 || keyFrames[key] > in_frame)
+                {
+                    const u16* upperBound = std::upper_bound(keyFrames, keyFrames + in_numKeys, static_cast<u16>(in_frame));
+                    key = (upperBound == keyFrames) ? 0 : static_cast<u32>(upperBound - keyFrames) - 1;
+                    key = std::min(key, in_numKeys - 2);
+                }
+                
+                while (key + 2 < in_numKeys && keyFrames[key + 1] <= in_frame)
+                {
+                    ++key;
+                }
+                inout_cursorKey = key;
+                
+                f32 t = (in_frame - f32(keyFrames[key])) / f32(keyFrames[key + 1] - keyFrames[key]);
+                t = Core::MathUtils::Clamp(t, 0.0f, 1.0f);
+                
+                return in_interpolate(in_decode(in_keys[in_firstKey + key]), in_decode(in_keys[in_firstKey + key + 1]), t);
+            }
+        }
+        
 		CS_DEFINE_NAMEDTYPE(SkinnedAnimation);
         //---------------------------------------------------------------------
         //---------------------------------------------------------------------
@@ -42,7 +288,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------
 		//--------------------------------------------------------------------
 		SkinnedAnimation::SkinnedAnimation()
-        : m_frameTime(0.0f)
+        : m_frameTime(0.0f), m_compressed(false), m_numFrames(0), m_numNodes(0)
 		{
 		}
 		//---------------------------------------------------------------------
@@ -55,8 +301,68 @@ namespace ChilliSource
 		//---------------------------------------------------------------------
 		const SkinnedAnimation::Frame* SkinnedAnimation::GetFrameAtIndex(u32 in_index) const
 		{
+            CS_ASSERT(m_compressed == false, "Cannot get the frames of a compressed skinned animation.");
             CS_ASSERT(in_index < m_frames.size(), "Skinned animation frame out of bounds");
             return m_frames[in_index].get();
+		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		void SkinnedAnimation::Sample(f32 in_playbackPosition, Cursor& inout_cursor, Frame& out_frame) const
+		{
+            if (m_numFrames == 0)
+            {
+                return;
+            }
+            
+            f32 frame = (m_frameTime > 0.0f) ? in_playbackPosition / m_frameTime : 0.0f;
+            frame = Core::MathUtils::Clamp(frame, 0.0f, f32(m_numFrames - 1));
+            
+            if (m_compressed == false)
+            {
+                //uncompressed frames are evenly spaced, so can be looked up directly.
+                u32 frameAIndex = static_cast<u32>(std::floor(frame));
+                u32 frameBIndex = std::min(static_cast<u32>(std::ceil(frame)), m_numFrames - 1);
+                f32 t = frame - f32(frameAIndex);
+                
+                const Frame& frameA = *m_frames[frameAIndex];
+                const Frame& frameB = *m_frames[frameBIndex];
+                
+                out_frame.m_nodeTranslations.resize(m_numNodes);
+                out_frame.m_nodeOrientations.resize(m_numNodes);
+                out_frame.m_nodeScales.resize(m_numNodes);
+                for (u32 i = 0; i < m_numNodes; ++i)
+                {
+                    out_frame.m_nodeTranslations[i] = InterpolateVector(frameA.m_nodeTranslations[i], frameB.m_nodeTranslations[i], t);
+                    out_frame.m_nodeOrientations[i] = InterpolateOrientation(frameA.m_nodeOrientations[i], frameB.m_nodeOrientations[i], t);
+                    out_frame.m_nodeScales[i] = InterpolateVector(frameA.m_nodeScales[i], frameB.m_nodeScales[i], t);
+                }
+                return;
+            }
+            
+            if (inout_cursor.m_keyIndices.size() != m_numNodes * 3)
+            {
+                inout_cursor.m_keyIndices.assign(m_numNodes * 3, 0);
+            }
+            
+            auto decodeVector = [](const Core::Vector3& in_key) -> Core::Vector3 { return in_key; };
+            auto decodeOrientation = [](const PackedQuaternion& in_key) -> Core::Quaternion { return UnpackQuaternion(in_key); };
+            
+            out_frame.m_nodeTranslations.resize(m_numNodes);
+            out_frame.m_nodeOrientations.resize(m_numNodes);
+            out_frame.m_nodeScales.resize(m_numNodes);
+            for (u32 i = 0; i < m_numNodes; ++i)
+            {
+                u32* cursorKeys = &inout_cursor.m_keyIndices[i * 3];
+                
+                const Track& translationTrack = m_translationTracks[i];
+                out_frame.m_nodeTranslations[i] = SampleTrack(translationTrack.m_firstKey, translationTrack.m_numKeys, m_translationKeyFrames, m_translationKeys, frame, decodeVector, InterpolateVector, cursorKeys[0]);
+                
+                const Track& orientationTrack = m_orientationTracks[i];
+                out_frame.m_nodeOrientations[i] = SampleTrack(orientationTrack.m_firstKey, orientationTrack.m_numKeys, m_orientationKeyFrames, m_orientationKeys, frame, decodeOrientation, InterpolateOrientation, cursorKeys[1]);
+                
+                const Track& scaleTrack = m_scaleTracks[i];
+                out_frame.m_nodeScales[i] = SampleTrack(scaleTrack.m_firstKey, scaleTrack.m_numKeys, m_scaleKeyFrames, m_scaleKeys, frame, decodeVector, InterpolateVector, cursorKeys[2]);
+            }
 		}
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
@@ -68,13 +374,24 @@ namespace ChilliSource
 		//---------------------------------------------------------------------
 		u32 SkinnedAnimation::GetNumFrames() const
 		{
-			return m_frames.size();
+			return m_numFrames;
 		}
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
 		void SkinnedAnimation::AddFrame(SkinnedAnimation::FrameCUPtr in_frame)
 		{
+            CS_ASSERT(m_compressed == false, "Cannot add frames to a compressed skinned animation.");
+            
+            if (m_frames.empty() == true)
+            {
+                m_numNodes = static_cast<u32>(in_frame->m_nodeTranslations.size());
+            }
+            
+            CS_ASSERT(in_frame->m_nodeTranslations.size() == m_numNodes && in_frame->m_nodeOrientations.size() == m_numNodes && in_frame->m_nodeScales.size() == m_numNodes,
+                      "All frames in a skinned animation must contain the same number of nodes.");
+            
 			m_frames.push_back(std::move(in_frame));
+            m_numFrames = static_cast<u32>(m_frames.size());
 		}
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
@@ -82,6 +399,89 @@ namespace ChilliSource
 		{
 			m_frameTime = in_timeBetweenFrames;
 		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		void SkinnedAnimation::Compress(f32 in_translationTolerance, f32 in_orientationTolerance, f32 in_scaleTolerance)
+		{
+            CS_ASSERT(m_compressed == false, "Skinned animation is already compressed.");
+            CS_ASSERT(m_numFrames <= static_cast<u32>(std::numeric_limits<u16>::max()) + 1, "Too many frames to compress skinned animation.");
+            
+            m_translationTracks.resize(m_numNodes);
+            m_orientationTracks.resize(m_numNodes);
+            m_scaleTracks.resize(m_numNodes);
+            
+            std::vector<Core::Vector3> vectors(m_numFrames);
+            std::vector<PackedQuaternion> packedOrientations(m_numFrames);
+            std::vector<Core::Quaternion> orientations(m_numFrames);
+            std::vector<Core::Quaternion> unpackedOrientations(m_numFrames);
+            std::vector<u32> keys;
+            
+            for (u32 node = 0; node < m_numNodes; ++node)
+            {
+                //translations
+                for (u32 frame = 0; frame < m_numFrames; ++frame)
+                {
+                    vectors[frame] = m_frames[frame]->m_nodeTranslations[node];
+                }
+                
+                ReduceKeys(vectors, vectors, in_translationTolerance, InterpolateVector, CalculateVectorError, keys);
+                m_translationTracks[node].m_firstKey = static_cast<u32>(m_translationKeys.size());
+                m_translationTracks[node].m_numKeys = static_cast<u32>(keys.size());
+                for (u32 key : keys)
+                {
+                    m_translationKeyFrames.push_back(static_cast<u16>(key));
+                    m_translationKeys.push_back(vectors[key]);
+                }
+                
+                //orientations are quantised before reduction so that the quantisation error is accounted for.
+                for (u32 frame = 0; frame < m_numFrames; ++frame)
+                {
+                    orientations[frame] = m_frames[frame]->m_nodeOrientations[node];
+                    packedOrientations[frame] = PackQuaternion<PackedQuaternion>(orientations[frame]);
+                    unpackedOrientations[frame] = UnpackQuaternion(packedOrientations[frame]);
+                }
+                
+                ReduceKeys(unpackedOrientations, orientations, in_orientationTolerance, InterpolateOrientation, CalculateOrientationError, keys);
+                m_orientationTracks[node].m_firstKey = static_cast<u32>(m_orientationKeys.size());
+                m_orientationTracks[node].m_numKeys = static_cast<u32>(keys.size());
+                for (u32 key : keys)
+                {
+                    m_orientationKeyFrames.push_back(static_cast<u16>(key));
+                    m_orientationKeys.push_back(packedOrientations[key]);
+                }
+                
+                //scales
+                for (u32 frame = 0; frame < m_numFrames; ++frame)
+                {
+                    vectors[frame] = m_frames[frame]->m_nodeScales[node];
+                }
+                
+                ReduceKeys(vectors, vectors, in_scaleTolerance, InterpolateVector, CalculateVectorError, keys);
+                m_scaleTracks[node].m_firstKey = static_cast<u32>(m_scaleKeys.size());
+                m_scaleTracks[node].m_numKeys = static_cast<u32>(keys.size());
+                for (u32 key : keys)
+                {
+                    m_scaleKeyFrames.push_back(static_cast<u16>(key));
+                    m_scaleKeys.push_back(vectors[key]);
+                }
+            }
+            
+            m_translationKeyFrames.shrink_to_fit();
+            m_orientationKeyFrames.shrink_to_fit();
+            m_scaleKeyFrames.shrink_to_fit();
+            m_translationKeys.shrink_to_fit();
+            m_orientationKeys.shrink_to_fit();
+            m_scaleKeys.shrink_to_fit();
+            
+            std::vector<SkinnedAnimation::FrameCUPtr>().swap(m_frames);
+            m_compressed = true;
+		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		bool SkinnedAnimation::IsCompressed() const
+		{
+			return m_compressed;
+		}
 	}
 }
 
@@ -64,6 +64,19 @@ namespace ChilliSource
             using FrameSPtr = std::shared_ptr<Frame>;
             using FrameCUPtr = std::unique_ptr<const Frame>;
             using FrameCSPtr = std::shared_ptr<const Frame>;
+            //---------------------------------------------------------------------
+            /// Caches the key each track of a compressed animation was last sampled
+            /// at. Sampling with the same cursor at increasing playback positions
+            /// only has to step forward from the cached keys, so playback is
+            /// amortised constant time per track. Each playing instance of an
+            /// animation should own its own cursor.
+            ///
+            /// @author Jordan Brown
+            //---------------------------------------------------------------------
+            struct Cursor
+            {
+                std::vector<u32> m_keyIndices;
+            };
             
 			CS_DECLARE_NAMEDTYPE(SkinnedAnimation);
 			
@@ -76,6 +89,9 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
 			//---------------------------------------------------------------------
+			/// This is only available for uncompressed animations. Use Sample()
+			/// to read frame data from any animation.
+			///
 			/// @author Ian Copland
 			///
 			/// @param the index to the frame
@@ -83,6 +99,18 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			const SkinnedAnimation::Frame* GetFrameAtIndex(u32 in_index) const;
 			//---------------------------------------------------------------------
+			/// Calculates the transforms of every node at the given playback
+			/// position, interpolating between the surrounding frames.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The playback position in seconds.
+			/// @param [In/Out] The cursor for the instance being sampled.
+			/// @param [Out] The frame to write into. This is resized as needed so
+			/// can be reused without allocating.
+			//---------------------------------------------------------------------
+			void Sample(f32 in_playbackPosition, Cursor& inout_cursor, Frame& out_frame) const;
+			//---------------------------------------------------------------------
 			/// @author Ian Copland
 			///
 			/// @return the time between frames in seconds
@@ -112,8 +140,54 @@ namespace ChilliSource
 			/// @param The time between frames in seconds
 			//---------------------------------------------------------------------
 			void SetFrameTime(f32 in_timeBetweenFrames);
+			//---------------------------------------------------------------------
+			/// Converts the frames added so far into the compressed format. Each
+			/// node channel becomes a track of keys: orientations are quantised
+			/// and any key which can be reconstructed from its neighbours to
+			/// within the given tolerance is discarded, reducing constant
+			/// channels to a single key. No further frames can be added once
+			/// the animation is compressed.
+            ///
+            /// @author Jordan Brown
+			///
+			/// @param The maximum error allowed in a translation.
+			/// @param The maximum error allowed in an orientation, in radians.
+			/// @param The maximum error allowed in a scale.
+			//---------------------------------------------------------------------
+			void Compress(f32 in_translationTolerance, f32 in_orientationTolerance, f32 in_scaleTolerance);
+			//---------------------------------------------------------------------
+            /// @author Jordan Brown
+			///
+			/// @return Whether or not the animation is stored compressed.
+			//---------------------------------------------------------------------
+			bool IsCompressed() const;
             
 		private:
+            //---------------------------------------------------------------------
+            /// The range of keys for a single channel of a single node. Tracks
+            /// with a single key are constant.
+            ///
+            /// @author Jordan Brown
+            //---------------------------------------------------------------------
+            struct Track
+            {
+                u32 m_firstKey;
+                u32 m_numKeys;
+            };
+            //---------------------------------------------------------------------
+            /// A unit quaternion stored using the smallest three encoding. The
+            /// largest component is dropped and the remaining three are stored
+            /// as 15 bit values, with the index of the dropped component held
+            /// in the top bits of the first two.
+            ///
+            /// @author Jordan Brown
+            //---------------------------------------------------------------------
+            struct PackedQuaternion
+            {
+                u16 m_components[3];
+            };
+            
+
             
             friend class Core::ResourcePool;
             //---------------------------------------------------------------------
@@ -137,6 +211,19 @@ namespace ChilliSource
 			
 			f32 m_frameTime;
 			std::vector<SkinnedAnimation::FrameCUPtr> m_frames;
+            
+            bool m_compressed;
+            u32 m_numFrames;
+            u32 m_numNodes;
+            std::vector<Track> m_translationTracks;
+            std::vector<Track> m_orientationTracks;
+            std::vector<Track> m_scaleTracks;
+            std::vector<u16> m_translationKeyFrames;
+            std::vector<u16> m_orientationKeyFrames;
+            std::vector<u16> m_scaleKeyFrames;
+            std::vector<Core::Vector3> m_translationKeys;
+            std::vector<PackedQuaternion> m_orientationKeys;
+            std::vector<Core::Vector3> m_scaleKeys;
 		};
 	}
 }
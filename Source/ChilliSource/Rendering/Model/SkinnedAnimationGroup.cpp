@@ -30,9 +30,14 @@
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/MathUtils.h>
+#include <ChilliSource/Rendering/Base/MeshBuffer.h>
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
+#include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace Rendering
@@ -41,12 +46,10 @@ namespace ChilliSource
         /// Constructor
         //-----------------------------------------------------------
         SkinnedAnimationGroup::SkinnedAnimationGroup(const Skeleton* inpSkeleton)
-        : mpSkeleton(inpSkeleton), mbAnimationLengthDirty(true), mfAnimationLength(0.0f), mbPrepared(false)
+        : mpSkeleton(inpSkeleton), m_poseVersion(1), mbAnimationLengthDirty(true), mfAnimationLength(0.0f), mbPrepared(false)
         {
-            for (s32 i = 0; i < mpSkeleton->GetNumNodes(); ++i)
-            {
-                mCurrentAnimationMatrices.push_back(Core::Matrix4());
-            }
+            mLocalAnimationMatrices.resize(mpSkeleton->GetNumNodes(), Core::Matrix4::k_identity);
+            mCurrentAnimationMatrices.resize(mpSkeleton->GetNumNodes(), Core::Matrix4::k_identity);
         }
         //----------------------------------------------------------
         /// Attach Animation
@@ -105,38 +108,31 @@ namespace ChilliSource
                     }
                 }
                 
-                //get the animation frames
-                SkinnedAnimation::FrameCUPtr pFrame1;
-                if (pAnimItem1 != nullptr)
-                    pFrame1 = CalculateAnimationFrame(pAnimItem1->pSkinnedAnimation, infPlaybackPosition);
-                
-                SkinnedAnimation::FrameCUPtr pFrame2;
-                if (pAnimItem2 != nullptr)
-                    pFrame2 = CalculateAnimationFrame(pAnimItem2->pSkinnedAnimation, infPlaybackPosition);
-                
-                //check that we do indeed have two animations to blend. if not, just return the frame we do have.
-                if (pFrame1 != nullptr && pFrame2 != nullptr && pAnimItem1.get() != pAnimItem2.get())
+                //check that we do indeed have two animations to blend. if not, just use the frame we do have.
+                if (pAnimItem1 != nullptr && pAnimItem2 != nullptr && pAnimItem1.get() != pAnimItem2.get())
                 {
+                    CalculateAnimationFrame(*pAnimItem1, infPlaybackPosition, mCurrentAnimationData);
+                    CalculateAnimationFrame(*pAnimItem2, infPlaybackPosition, mBlendAnimationData);
+                    
                     //get the interpolation factor and then apply the requested blend to the two frames.
                     f32 fFactor = (infBlendlinePosition - pAnimItem1->fBlendlinePosition) / (pAnimItem2->fBlendlinePosition - pAnimItem1->fBlendlinePosition);
                     switch (ineBlendType)
                     {
                         case AnimationBlendType::k_linear:
-                            mCurrentAnimationData = LerpBetweenFrames(pFrame1.get(), pFrame2.get(), fFactor);
+                            LerpBetweenFrames(mCurrentAnimationData, mBlendAnimationData, fFactor, mCurrentAnimationData);
                             break;
                         default:
                             CS_LOG_ERROR("Invalid animation blend type given.");
-                            mCurrentAnimationData = std::move(pFrame1);
                             break;
                     }
                 }
-                else if (pFrame1 != nullptr)
+                else if (pAnimItem1 != nullptr)
                 {
-                    mCurrentAnimationData = std::move(pFrame1);
+                    CalculateAnimationFrame(*pAnimItem1, infPlaybackPosition, mCurrentAnimationData);
                 }
-                else if (pFrame2 != nullptr)
+                else if (pAnimItem2 != nullptr)
                 {
-                    mCurrentAnimationData = std::move(pFrame2);
+                    CalculateAnimationFrame(*pAnimItem2, infPlaybackPosition, mCurrentAnimationData);
                 }
                 else 
                 {
@@ -147,8 +143,7 @@ namespace ChilliSource
             }
             else if (mAnimations.size() > 0) 
             {
-                const SkinnedAnimationCSPtr& pAnim = mAnimations[0]->pSkinnedAnimation;
-                mCurrentAnimationData = CalculateAnimationFrame(pAnim, infPlaybackPosition);
+                CalculateAnimationFrame(*mAnimations[0], infPlaybackPosition, mCurrentAnimationData);
                 mbPrepared = true;
             }
             else
@@ -165,7 +160,7 @@ namespace ChilliSource
             switch (ineBlendType)
             {
                 case AnimationBlendType::k_linear:
-                    mCurrentAnimationData = LerpBetweenFrames(mCurrentAnimationData.get(), inpAnimationGroup->mCurrentAnimationData.get(), infBlendFactor);
+                    LerpBetweenFrames(mCurrentAnimationData, inpAnimationGroup->mCurrentAnimationData, infBlendFactor, mCurrentAnimationData);
                     break;
                 default:
                     CS_LOG_ERROR("Invalid animation blend type given.");
@@ -175,30 +170,41 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Build Matrices
         //----------------------------------------------------------
-        void SkinnedAnimationGroup::BuildMatrices(s32 indwCurrentParent, const Core::Matrix4& inParentMatrix)
+        void SkinnedAnimationGroup::BuildMatrices()
         {
-            const std::vector<SkeletonNodeCUPtr>& nodes = mpSkeleton->GetNodes();
-			u32 currIndex = 0;
-			for (auto it = nodes.begin(); it != nodes.end(); ++it)
-			{
-				if ((*it)->mdwParentIndex == indwCurrentParent)
-				{
-					//get the world translation and orientation
-					Core::Matrix4 localMat;
-                    if(mCurrentAnimationData->m_nodeTranslations.empty() == false)
-                    {
-						localMat = Core::Matrix4::CreateTransform(mCurrentAnimationData->m_nodeTranslations[currIndex], mCurrentAnimationData->m_nodeScales[currIndex], mCurrentAnimationData->m_nodeOrientations[currIndex]);
-                    }
-					
-					//convert to matrix and store
-					mCurrentAnimationMatrices[currIndex] =  localMat * inParentMatrix;
-					
-					//Apply to all children
-					BuildMatrices(currIndex, mCurrentAnimationMatrices[currIndex]);
-				}
+            const std::vector<u32>& evaluationOrder = mpSkeleton->GetNodeEvaluationOrder();
+            const std::vector<s32>& parentIndices = mpSkeleton->GetParentIndices();
+            const u32 numNodes = static_cast<u32>(parentIndices.size());
+            
+            const bool hasAnimationData = (mCurrentAnimationData.m_nodeTranslations.size() >= numNodes && mCurrentAnimationData.m_nodeOrientations.size() >= numNodes &&
+                                           mCurrentAnimationData.m_nodeScales.size() >= numNodes);
+            
+            //parents are always evaluated before their children so the parent world matrix is always ready.
+            for (u32 nodeIndex : evaluationOrder)
+            {
+                Core::Matrix4& localMat = mLocalAnimationMatrices[nodeIndex];
+                if (hasAnimationData == true)
+                {
+                    localMat = Core::Matrix4::CreateTransform(mCurrentAnimationData.m_nodeTranslations[nodeIndex], mCurrentAnimationData.m_nodeScales[nodeIndex], mCurrentAnimationData.m_nodeOrientations[nodeIndex]);
+                }
+                else
+                {
+                    localMat = Core::Matrix4::k_identity;
+                }
                 
-				currIndex++;
-			}
+                s32 parentIndex = parentIndices[nodeIndex];
+                if (parentIndex >= 0)
+                {
+                    mCurrentAnimationMatrices[nodeIndex] = localMat * mCurrentAnimationMatrices[parentIndex];
+                }
+                else
+                {
+                    mCurrentAnimationMatrices[nodeIndex] = localMat;
+                }
+            }
+            
+            //Palettes and CPU skinned vertices are rebuilt lazily the next time they are needed.
+            ++m_poseVersion;
         }
         //----------------------------------------------------------
         /// Get Matrix At Index
@@ -212,38 +218,98 @@ namespace ChilliSource
             return Core::Matrix4::k_identity;
         }
         //----------------------------------------------------------
-        /// Apply Inverse Bind Pose
         //----------------------------------------------------------
-        void SkinnedAnimationGroup::ApplyInverseBindPose(const std::vector<Core::Matrix4>& inInverseBindPoseMatrices, std::vector<Core::Matrix4>& outCombinedMatrices)
+        const std::vector<Core::Vector4>& SkinnedAnimationGroup::GetJointPalette(const InverseBindPosePtr& in_inverseBindPose)
         {
-            const std::vector<s32>& kadwJoints = mpSkeleton->GetJointIndices();
+            CS_ASSERT(in_inverseBindPose != nullptr, "Cannot get the joint palette for a null inverse bind pose.");
+            
+            JointPalette* jointPalette = nullptr;
+            for (const auto& existingPalette : m_jointPalettes)
+            {
+                if (existingPalette->m_inverseBindPose == in_inverseBindPose.get())
+                {
+                    jointPalette = existingPalette.get();
+                    break;
+                }
+            }
+            
+            if (jointPalette == nullptr)
+            {
+                //Palettes are held by pointer so that those already recorded into command buffers stay valid.
+                JointPaletteUPtr newPalette(new JointPalette());
+                newPalette->m_inverseBindPose = in_inverseBindPose.get();
+                newPalette->m_poseVersion = 0;
+                jointPalette = newPalette.get();
+                m_jointPalettes.push_back(std::move(newPalette));
+                
+                if (in_inverseBindPose->mJointIndices.empty() == true && in_inverseBindPose->mInverseBindPoseMatrices.size() != mpSkeleton->GetJointIndices().size())
+                {
+                    CS_LOG_ERROR("Cannot apply bind pose matrices to joint matrices, because they are not from the same skeleton.");
+                }
+            }
             
-            outCombinedMatrices.clear();
-            for (u32 i = 0; i < kadwJoints.size(); ++i)
+            if (jointPalette->m_poseVersion != m_poseVersion)
+            {
+                BuildJointPalette(*jointPalette);
+                jointPalette->m_poseVersion = m_poseVersion;
+            }
+            
+            return jointPalette->m_rows;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void SkinnedAnimationGroup::EnableCPUSkinning(const Mesh* in_mesh)
+        {
+            CS_ASSERT(in_mesh != nullptr, "Cannot enable CPU skinning for a null mesh.");
+            
+            DisableCPUSkinning();
+            
+            for (u32 i = 0; i < in_mesh->GetNumSubMeshes(); ++i)
+            {
+                CPUSkinnedSubMeshUPtr skinnedSubMesh(new CPUSkinnedSubMesh());
+                skinnedSubMesh->m_subMesh = in_mesh->GetSubMeshAtIndex(i);
+                skinnedSubMesh->m_meshBuffer = skinnedSubMesh->m_subMesh->CreateCPUSkinnedMeshBuffer(skinnedSubMesh->m_vertexData);
+                skinnedSubMesh->m_poseVersion = 0;
+                
+                if (skinnedSubMesh->m_meshBuffer != nullptr)
+                {
+                    m_cpuSkinnedSubMeshes.push_back(std::move(skinnedSubMesh));
+                }
+            }
+            
+            if (m_cpuSkinnedSubMeshes.empty() == true && in_mesh->GetNumSubMeshes() > 0)
+            {
+                CS_LOG_WARNING("Cannot skin mesh on the CPU. It must be loaded with CPU skinning supported in its MeshResourceOptions.");
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void SkinnedAnimationGroup::DisableCPUSkinning()
+        {
+            m_cpuSkinnedSubMeshes.clear();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        MeshBuffer* SkinnedAnimationGroup::GetCPUSkinnedMeshBuffer(const SubMesh* in_subMesh, RenderCommandBuffer* in_commandBuffer)
+        {
+            for (const auto& skinnedSubMesh : m_cpuSkinnedSubMeshes)
             {
-                outCombinedMatrices.push_back(Core::Matrix4());
+                if (skinnedSubMesh->m_subMesh == in_subMesh)
+                {
+                    //Passes are executed in the order they are recorded, so the upload only needs to be recorded
+                    //by the first pass to render the sub mesh with this pose.
+                    if (skinnedSubMesh->m_poseVersion != m_poseVersion)
+                    {
+                        in_subMesh->Skin(this, skinnedSubMesh->m_vertexData);
+                        in_commandBuffer->UpdateVertexBuffer(skinnedSubMesh->m_meshBuffer.get(), skinnedSubMesh->m_vertexData);
+                        skinnedSubMesh->m_poseVersion = m_poseVersion;
+                    }
+                    
+                    return skinnedSubMesh->m_meshBuffer.get();
+                }
             }
             
-            //check that they have the same number of joints
-			if (kadwJoints.size() != inInverseBindPoseMatrices.size())
-			{
-				CS_LOG_ERROR("Cannot apply bind pose matrices to joint matrices, because they are not from the same skeleton.");
-			}
-			
-			//iterate through and multiply together to get the new array
-			s32 count = 0;
-			std::vector<s32>::const_iterator joint = kadwJoints.begin();
-			for (std::vector<Core::Matrix4>::const_iterator ibp = inInverseBindPoseMatrices.begin(); 
-				 joint != kadwJoints.end() && ibp != inInverseBindPoseMatrices.end();)
-			{
-				//multiply together
-				outCombinedMatrices[count] = ((*ibp) * (mCurrentAnimationMatrices[*joint]));
-				
-				//incriment the iterators
-				++joint;
-				++ibp;
-				count++;
-			}
+            return nullptr;
         }
         //----------------------------------------------------------
         /// Get Animation Length
@@ -278,6 +344,36 @@ namespace ChilliSource
             }
         }
         //----------------------------------------------------------
+        //----------------------------------------------------------
+        void SkinnedAnimationGroup::BuildJointPalette(JointPalette& inout_jointPalette) const
+        {
+            const std::vector<s32>& kadwJoints = mpSkeleton->GetJointIndices();
+            const std::vector<Core::Matrix4>& inverseBindPoseMatrices = inout_jointPalette.m_inverseBindPose->mInverseBindPoseMatrices;
+            const std::vector<u32>& jointIndices = inout_jointPalette.m_inverseBindPose->mJointIndices;
+            
+            //A palette for the whole skeleton covers every joint, while a partial one covers only its own matrices.
+            const u32 numPaletteJoints = static_cast<u32>(jointIndices.empty() == true ? kadwJoints.size() : inverseBindPoseMatrices.size());
+            inout_jointPalette.m_rows.resize(numPaletteJoints * 3);
+            
+            //Any joints without an inverse bind pose are left as identity. The final column of each skinning
+            //matrix is always [0 0 0 1] so only the first 3 rows are stored.
+            for (u32 i = 0; i < numPaletteJoints; ++i)
+            {
+                const u32 joint = (jointIndices.empty() == true ? i : jointIndices[i]);
+                
+                Core::Matrix4 skinningMatrix = Core::Matrix4::k_identity;
+                if (i < inverseBindPoseMatrices.size() && joint < kadwJoints.size())
+                {
+                    skinningMatrix = inverseBindPoseMatrices[i] * mCurrentAnimationMatrices[kadwJoints[joint]];
+                }
+                
+                Core::Vector4* rows = inout_jointPalette.m_rows.data() + i * 3;
+                rows[0] = Core::Vector4(skinningMatrix.m[0], skinningMatrix.m[4], skinningMatrix.m[8], skinningMatrix.m[12]);
+                rows[1] = Core::Vector4(skinningMatrix.m[1], skinningMatrix.m[5], skinningMatrix.m[9], skinningMatrix.m[13]);
+                rows[2] = Core::Vector4(skinningMatrix.m[2], skinningMatrix.m[6], skinningMatrix.m[10], skinningMatrix.m[14]);
+            }
+        }
+        //----------------------------------------------------------
         /// Calculate Animation Length
         //----------------------------------------------------------
         void SkinnedAnimationGroup::CalculateAnimationLength()
@@ -307,7 +403,7 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Calculate Animation Frame
         //----------------------------------------------------------
-        SkinnedAnimation::FrameCUPtr SkinnedAnimationGroup::CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition)
+        void SkinnedAnimationGroup::CalculateAnimationFrame(AnimationItem& inAnimationItem, f32 infPlaybackPosition, SkinnedAnimation::Frame& outFrame)
         {
             //report errors if the playback position provided does not make sense
             if (infPlaybackPosition < 0.0f)
@@ -315,105 +411,34 @@ namespace ChilliSource
                 CS_LOG_ERROR("A playback position below 0 does not make sense.");
             }
             
-            //calculate the two frame indices this is between
-			f32 frames = infPlaybackPosition / inpAnimation->GetFrameTime();
-			s32 dwFrameAIndex = (s32)floorf(frames);
-			s32 dwFrameBIndex = (s32)ceilf(frames);
-			
-			//ensure the frame numbers make sense
-            if(dwFrameAIndex < 0)
-            {
-                dwFrameAIndex = 0;
-            }
-            
-            if(dwFrameAIndex >= (s32)inpAnimation->GetNumFrames())
-            {
-                dwFrameAIndex = inpAnimation->GetNumFrames() - 1;
-            }
-            
-            if(dwFrameBIndex < 0)
+            inAnimationItem.pSkinnedAnimation->Sample(infPlaybackPosition, inAnimationItem.mCursor, outFrame);
+        }
+        //--------------------------------------------------------------
+        /// Lerp Between Frames
+        //--------------------------------------------------------------
+        void SkinnedAnimationGroup::LerpBetweenFrames(const SkinnedAnimation::Frame& inFrameA, const SkinnedAnimation::Frame& inFrameB, f32 infInterpFactor, SkinnedAnimation::Frame& outFrame)
+        {
+            //each element is read from both inputs before being written, so the output can safely alias either input.
+            const u32 numTranslations = std::min(static_cast<u32>(inFrameA.m_nodeTranslations.size()), static_cast<u32>(inFrameB.m_nodeTranslations.size()));
+            outFrame.m_nodeTranslations.resize(numTranslations);
+            for (u32 i = 0; i < numTranslations; ++i)
             {
-                dwFrameBIndex = 0;
+                outFrame.m_nodeTranslations[i] = Core::MathUtils::Lerp(infInterpFactor, inFrameA.m_nodeTranslations[i], inFrameB.m_nodeTranslations[i]);
             }
             
-			if (dwFrameBIndex >= (s32)inpAnimation->GetNumFrames())
+            const u32 numOrientations = std::min(static_cast<u32>(inFrameA.m_nodeOrientations.size()), static_cast<u32>(inFrameB.m_nodeOrientations.size()));
+            outFrame.m_nodeOrientations.resize(numOrientations);
+            for (u32 i = 0; i < numOrientations; ++i)
             {
-                dwFrameBIndex = inpAnimation->GetNumFrames() - 1;
+                outFrame.m_nodeOrientations[i] = Core::Quaternion::Slerp(inFrameA.m_nodeOrientations[i], inFrameB.m_nodeOrientations[i], infInterpFactor);
             }
             
-			//get the frames
-			const SkinnedAnimation::Frame* frameA = inpAnimation->GetFrameAtIndex(dwFrameAIndex);
-			const SkinnedAnimation::Frame* frameB = inpAnimation->GetFrameAtIndex(dwFrameBIndex);
-			
-			//get the ratio of one frame to the next
-			f32 interpFactor = (infPlaybackPosition - (dwFrameAIndex * inpAnimation->GetFrameTime())) / inpAnimation->GetFrameTime();
-			
-			//blend between frames
-            return LerpBetweenFrames(frameA, frameB, interpFactor);
-        }
-        //--------------------------------------------------------------
-        /// Lerp Between Frames
-        //--------------------------------------------------------------
-        SkinnedAnimation::FrameCUPtr SkinnedAnimationGroup::LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor)
-        {
-            SkinnedAnimation::FrameUPtr outFrame(new SkinnedAnimation::Frame());
-			
-            if(inFrameA != nullptr && inFrameB != nullptr)
+            const u32 numScales = std::min(static_cast<u32>(inFrameA.m_nodeScales.size()), static_cast<u32>(inFrameB.m_nodeScales.size()));
+            outFrame.m_nodeScales.resize(numScales);
+            for (u32 i = 0; i < numScales; ++i)
             {
-                //iterate through each translation
-                outFrame->m_nodeTranslations.reserve(inFrameB->m_nodeTranslations.size());
-                std::vector<Core::Vector3>::const_iterator transAIt = inFrameA->m_nodeTranslations.begin();
-                for (std::vector<Core::Vector3>::const_iterator transBIt = inFrameB->m_nodeTranslations.begin();
-                     transAIt != inFrameA->m_nodeTranslations.end() && transBIt != inFrameB->m_nodeTranslations.end();)
-                {
-                    //lerp
-                    Core::Vector3 newTrans = Core::MathUtils::Lerp(infInterpFactor, *transAIt, *transBIt);
-                    
-                    //add to frame
-                    outFrame->m_nodeTranslations.push_back(newTrans);
-                    
-                    //incriment the iterators
-                    ++transAIt;
-                    ++transBIt;
-                }
-                
-                //iterate through each orientation
-                outFrame->m_nodeOrientations.reserve(inFrameB->m_nodeOrientations.size());
-                std::vector<Core::Quaternion>::const_iterator orientAIt = inFrameA->m_nodeOrientations.begin();
-                for (std::vector<Core::Quaternion>::const_iterator orientBIt = inFrameB->m_nodeOrientations.begin();
-                     orientAIt != inFrameA->m_nodeOrientations.end() && orientBIt != inFrameB->m_nodeOrientations.end();)
-                {
-                    //lerp
-                    Core::Quaternion newOrient = Core::Quaternion::Slerp(*orientAIt, *orientBIt, infInterpFactor);
-                    
-                    //add to frame
-                    outFrame->m_nodeOrientations.push_back(newOrient);
-                    
-                    //incriment the iterators
-                    ++orientAIt;
-                    ++orientBIt;
-                }
-                
-                //iterate through each scale
-                outFrame->m_nodeScales.reserve(inFrameB->m_nodeScales.size());
-                std::vector<Core::Vector3>::const_iterator scaleAIt = inFrameA->m_nodeScales.begin();
-                for (std::vector<Core::Vector3>::const_iterator scaleBIt = inFrameB->m_nodeScales.begin();
-                     scaleAIt != inFrameA->m_nodeScales.end() && scaleBIt != inFrameB->m_nodeScales.end();)
-                {
-                    //lerp
-                    Core::Vector3 newScale = Core::MathUtils::Lerp(infInterpFactor, *scaleAIt, *scaleBIt);
-                    
-                    //add to frame
-                    outFrame->m_nodeScales.push_back(newScale);
-                    
-                    //incriment the iterators
-                    ++scaleAIt;
-                    ++scaleBIt;
-                }
+                outFrame.m_nodeScales[i] = Core::MathUtils::Lerp(infInterpFactor, inFrameA.m_nodeScales[i], inFrameB.m_nodeScales[i]);
             }
-			
-			return SkinnedAnimation::FrameCUPtr(std::move(outFrame));
         }
     }
 }
-
@@ -32,7 +32,9 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Vector4.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+#include <ChilliSource/Rendering/Model/SubMesh.h>
 
 namespace ChilliSource
 {
@@ -110,12 +112,14 @@ namespace ChilliSource
 			/// Build Matrices
             ///
             /// Builds the animation matrix data from the current
-            /// animation data.
+            /// animation data. This is a single pass over the nodes
+            /// in the skeleton's evaluation order and writes into
+            /// preallocated buffers.
             ///
-            /// @param the current parent.
-            /// @param the parent matrix.
+            /// This only touches data owned by the group, so groups
+            /// can be built in parallel.
 			//----------------------------------------------------------
-			void BuildMatrices(s32 indwCurrentParent = -1, const Core::Matrix4& inParentMatrix = Core::Matrix4());
+			void BuildMatrices();
             //----------------------------------------------------------
 			/// Get Matrix At Index
             ///
@@ -124,15 +128,67 @@ namespace ChilliSource
 			//----------------------------------------------------------
             const Core::Matrix4& GetMatrixAtIndex(s32 indwIndex) const;
             //----------------------------------------------------------
-			/// Apply Inverse Bind Pose
+			/// Get Joint Palette
             ///
-            /// outputs a copy of the current animation matrix data with
-            /// the inverse bind pose matrices applied.
+            /// Combines the current animation matrix data with the
+            /// given inverse bind pose to produce the joint palette:
+            /// the top 3 rows of each skinning matrix, in the layout
+            /// expected by RenderSystem::ApplyJoints().
             ///
-            /// @param the inverse bind pose matrices.
-            /// @param OUT: The combined matrices.
+            /// A palette is kept for each inverse bind pose and only
+            /// rebuilt the first time it is requested after the pose
+            /// changes, so every pass that renders the mesh shares a
+            /// single conversion. The palette is owned by the group
+            /// and is not modified again until the next pose is built.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param the inverse bind pose.
+            /// @return The joint palette.
+			//----------------------------------------------------------
+			const std::vector<Core::Vector4>& GetJointPalette(const InverseBindPosePtr& in_inverseBindPose);
+            //----------------------------------------------------------
+			/// Enable CPU Skinning
+            ///
+            /// Skins the given mesh on the CPU rather than in the
+            /// vertex shader. Each sub mesh is skinned into its own
+            /// dynamic mesh buffer, once per pose, and can then be
+            /// drawn in a single call with an identity palette. This
+            /// suits meshes that are rendered in many passes, or that
+            /// reference too many joints to be drawn at once. This
+            /// must be called on the main thread.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The mesh that will be rendered with this group.
+			//----------------------------------------------------------
+			void EnableCPUSkinning(const Mesh* in_mesh);
+            //----------------------------------------------------------
+			/// Disable CPU Skinning
+            ///
+            /// Releases the CPU skinned mesh buffers. This must be
+            /// called on the main thread.
+            ///
+            /// @author Jordan Brown
+			//----------------------------------------------------------
+			void DisableCPUSkinning();
+            //----------------------------------------------------------
+			/// Get CPU Skinned Mesh Buffer
+            ///
+            /// Gets the mesh buffer the given sub mesh is skinned into
+            /// on the CPU. If the pose has changed since the sub mesh
+            /// was last skinned it is skinned again, and the upload of
+            /// the new vertices is recorded into the command buffer.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The sub mesh.
+            /// @param The command buffer to record the upload into.
+            ///
+            /// @return The skinned mesh buffer, or null if the sub mesh
+            /// is not skinned on the CPU.
 			//----------------------------------------------------------
-			void ApplyInverseBindPose(const std::vector<Core::Matrix4>& inInverseBindPoseMatrices, std::vector<Core::Matrix4>& outCombinedMatrices);
+			MeshBuffer* GetCPUSkinnedMeshBuffer(const SubMesh* in_subMesh, RenderCommandBuffer* in_commandBuffer);
             //----------------------------------------------------------
 			/// Get Animation Length
             ///
@@ -167,9 +223,35 @@ namespace ChilliSource
             struct AnimationItem
             {
                 SkinnedAnimationCSPtr pSkinnedAnimation;
+                SkinnedAnimation::Cursor mCursor;
                 f32 fBlendlinePosition;
             };
             typedef std::shared_ptr<AnimationItem> AnimationItemPtr;
+            //----------------------------------------------------------
+            /// The joint palette built for a single inverse bind pose.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            struct JointPalette
+            {
+                const InverseBindPose* m_inverseBindPose;
+                std::vector<Core::Vector4> m_rows;
+                u32 m_poseVersion;
+            };
+            typedef std::unique_ptr<JointPalette> JointPaletteUPtr;
+            //----------------------------------------------------------
+            /// A sub mesh that is skinned on the CPU.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------------
+            struct CPUSkinnedSubMesh
+            {
+                const SubMesh* m_subMesh;
+                MeshBufferUPtr m_meshBuffer;
+                std::vector<u8> m_vertexData;
+                u32 m_poseVersion;
+            };
+            typedef std::unique_ptr<CPUSkinnedSubMesh> CPUSkinnedSubMeshUPtr;
             //----------------------------------------------------------
 			/// Calculate Animation Length
             ///
@@ -182,27 +264,43 @@ namespace ChilliSource
             ///
             /// Gets the frame data from a single animation.
             ///
-            /// @param The blend type.
-            /// @param the animation.
+            /// @param the animation item. Its cursor is updated.
             /// @param the playback position.
+            /// @param OUT: The frame to write into. This is resized
+            /// as needed so can be reused without allocating.
 			//----------------------------------------------------------
-            SkinnedAnimation::FrameCUPtr CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition);
+            void CalculateAnimationFrame(AnimationItem& inAnimationItem, f32 infPlaybackPosition, SkinnedAnimation::Frame& outFrame);
             //--------------------------------------------------------------
 			/// Lerp Between Frames
 			///
-			/// Linearly interpolates between two animation frames.
+			/// Linearly interpolates between two animation frames. The
+            /// output frame may be the same as either of the input frames.
 			///
 			/// @param frame 1
 			/// @param frame 2
 			/// @param the interpolation factor
-			/// @return output interpolated frame.
+			/// @param OUT: The interpolated frame.
 			//--------------------------------------------------------------
-            SkinnedAnimation::FrameCUPtr LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor);
+            void LerpBetweenFrames(const SkinnedAnimation::Frame& inFrameA, const SkinnedAnimation::Frame& inFrameB, f32 infInterpFactor, SkinnedAnimation::Frame& outFrame);
+            //----------------------------------------------------------
+            /// Rebuilds the given joint palette from the current
+            /// animation matrices.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param [In/Out] The joint palette.
+            //----------------------------------------------------------
+            void BuildJointPalette(JointPalette& inout_jointPalette) const;
             
             const Skeleton* mpSkeleton;
             std::vector<AnimationItemPtr> mAnimations;
-            SkinnedAnimation::FrameCUPtr mCurrentAnimationData;
+            SkinnedAnimation::Frame mCurrentAnimationData;
+            SkinnedAnimation::Frame mBlendAnimationData;
+            std::vector<Core::Matrix4> mLocalAnimationMatrices;
             std::vector<Core::Matrix4> mCurrentAnimationMatrices;
+            std::vector<JointPaletteUPtr> m_jointPalettes;
+            std::vector<CPUSkinnedSubMeshUPtr> m_cpuSkinnedSubMeshes;
+            u32 m_poseVersion;
             bool mbAnimationLengthDirty;
             f32 mfAnimationLength;
             bool mbPrepared;
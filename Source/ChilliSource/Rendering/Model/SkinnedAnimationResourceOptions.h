@@ -0,0 +1,128 @@
+//
+//  SkinnedAnimationResourceOptions.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_SKINNEDANIMATIONRESOURCEOPTIONS_H_
+#define _CHILLISOURCE_RENDERING_MODEL_SKINNEDANIMATIONRESOURCEOPTIONS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //-------------------------------------------------------
+        /// Custom options for loading a skinned animation. By
+        /// default animations are loaded uncompressed. When
+        /// compression is enabled, orientations are quantised
+        /// and any keys that can be reconstructed to within the
+        /// given tolerances are discarded.
+        ///
+        /// @author Jordan Brown
+        //-------------------------------------------------------
+		class SkinnedAnimationResourceOptions final : public Core::IResourceOptions<SkinnedAnimation>
+		{
+		public:
+            //-------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            SkinnedAnimationResourceOptions() = default;
+            //-------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not the animation should be
+            /// compressed.
+            /// @param The maximum error allowed in a translation,
+            /// in the units of the skeleton.
+            /// @param The maximum error allowed in an orientation,
+            /// in radians.
+            /// @param The maximum error allowed in a scale.
+            //-------------------------------------------------------
+            SkinnedAnimationResourceOptions(bool in_compressionEnabled, f32 in_translationTolerance, f32 in_orientationTolerance, f32 in_scaleTolerance);
+            //-------------------------------------------------------
+            /// Generate a unique hash based on the
+            /// currently set options
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return Hash of the options contents
+            //-------------------------------------------------------
+            u32 GenerateHash() const override;
+            //-------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return Whether the animation should be compressed.
+            //-------------------------------------------------------
+            bool IsCompressionEnabled() const;
+            //-------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The maximum error allowed in a translation.
+            //-------------------------------------------------------
+            f32 GetTranslationTolerance() const;
+            //-------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The maximum error allowed in an orientation,
+            /// in radians.
+            //-------------------------------------------------------
+            f32 GetOrientationTolerance() const;
+            //-------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @return The maximum error allowed in a scale.
+            //-------------------------------------------------------
+            f32 GetScaleTolerance() const;
+        private:
+            
+            //-------------------------------------------------------
+            /// The options for loading animations. These are held
+            /// in a struct to more easily allow hashing of the data
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            struct Options
+            {
+                f32 m_translationTolerance = 0.001f;
+                f32 m_orientationTolerance = 0.001f;
+                f32 m_scaleTolerance = 0.001f;
+                u32 m_compressionEnabled = 0;
+            };
+            
+            Options m_options;
+		};
+	}
+}
+
+#endif
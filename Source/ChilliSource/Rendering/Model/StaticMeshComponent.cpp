@@ -29,8 +29,7 @@
 #include <ChilliSource/Rendering/Model/StaticMeshComponent.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
-#include <ChilliSource/Rendering/Base/RenderSystem.h>
-#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
@@ -274,6 +273,8 @@ namespace ChilliSource
             // Update OOBB
             mOBBoundingBox.SetSize(mpModel->GetAABB().GetSize());
             mOBBoundingBox.SetOrigin(mpModel->GetAABB().GetOrigin());
+            
+            InvalidateBounds();
 		}
         //----------------------------------------------------------
         /// Attach Mesh
@@ -287,6 +288,8 @@ namespace ChilliSource
             mOBBoundingBox.SetSize(mpModel->GetAABB().GetSize());
             mOBBoundingBox.SetOrigin(mpModel->GetAABB().GetOrigin());
             
+            InvalidateBounds();
+            
             SetMaterial(inpMaterial);
         }
         //----------------------------------------------------------
@@ -299,32 +302,39 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Render
         //----------------------------------------------------------
-        void StaticMeshComponent::Render(RenderSystem* inpRenderSystem, CameraComponent* inpCam, ShaderPass ineShaderPass)
+        void StaticMeshComponent::Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, ShaderPass ineShaderPass)
 		{
             if(IsTransparent())
             {
                 //Flush the sprite cache to maintain order
-                inpRenderSystem->GetDynamicSpriteBatchPtr()->ForceRender();
+                in_commandBuffer->FlushSprites();
             }
             
-			mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), mMaterials, ineShaderPass);
+			mpModel->Render(in_commandBuffer, GetEntity()->GetTransform().GetWorldTransform(), mMaterials, ineShaderPass);
 		}
         //----------------------------------------------------------
         /// Render Shadow Map
         //----------------------------------------------------------
-        void StaticMeshComponent::RenderShadowMap(RenderSystem* inpRenderSystem, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap)
+        void StaticMeshComponent::RenderShadowMap(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap)
 		{
-			mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), {in_staticShadowMap}, ShaderPass::k_ambient);
+			mpModel->Render(in_commandBuffer, GetEntity()->GetTransform().GetWorldTransform(), {in_staticShadowMap}, ShaderPass::k_ambient);
 		}
         //----------------------------------------------------
         //----------------------------------------------------
         void StaticMeshComponent::OnAddedToScene()
         {
-            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &StaticMeshComponent::OnEntityTransformChanged));
+            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeInlineDelegate(this, &StaticMeshComponent::OnEntityTransformChanged));
             
             OnEntityTransformChanged();
         }
         //----------------------------------------------------
+        //----------------------------------------------------
+        void StaticMeshComponent::InvalidateBounds()
+        {
+            OnEntityTransformChanged();
+            RenderComponent::InvalidateBounds();
+        }
+        //----------------------------------------------------
         /// On Entity Transform Changed
         //----------------------------------------------------
         void StaticMeshComponent::OnEntityTransformChanged()
@@ -92,6 +92,13 @@ namespace ChilliSource
 			/// @return whether or not this has transparency
 			//-----------------------------------------------------------
 			bool IsTransparent() override;
+            //----------------------------------------------------
+            /// Discards the cached bounds and notifies the scene
+            /// that they have changed.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------
+            void InvalidateBounds() override;
 			//-----------------------------------------------------------
 			/// Set Material
 			///
@@ -165,22 +172,22 @@ namespace ChilliSource
 			///
 			/// NotifyConnections render on objects mesh
             ///
-            /// @param Render system
+            /// @param Command buffer to record into
             /// @param Active camera component
             /// @param The current shader pass.
 			//----------------------------------------------------------
-			void Render(RenderSystem* inpRenderSystem, CameraComponent* inpCam, ShaderPass ineShaderPass) override;
+			void Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, ShaderPass ineShaderPass) override;
             //-----------------------------------------------------
             /// Render Shadow Map
             ///
             /// Render the mesh to the shadow map
             ///
-            /// @param Render system
+            /// @param Command buffer to record into
             /// @param Active camera component
             /// @param Material to render static shadows with
             /// @param Material to render skinned shadows with
             //-----------------------------------------------------
-            void RenderShadowMap(RenderSystem* inpRenderSystem, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap) override;
+            void RenderShadowMap(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap) override;
             //----------------------------------------------------
             /// Triggered when the component is attached to
             /// an entity on the scene
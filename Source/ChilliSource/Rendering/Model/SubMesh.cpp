@@ -29,6 +29,7 @@
 #include <ChilliSource/Rendering/Model/SubMesh.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Base/VertexLayouts.h>
 #include <ChilliSource/Rendering/Material/Material.h>
@@ -42,6 +43,118 @@ namespace ChilliSource
 {
 	namespace Rendering
 	{
+        namespace
+        {
+            //The palette used to render CPU skinned vertices, which are all bound entirely to the first joint.
+            const std::vector<Core::Vector4> k_identityJointPalette =
+            {
+                Core::Vector4(1.0f, 0.0f, 0.0f, 0.0f),
+                Core::Vector4(0.0f, 1.0f, 0.0f, 0.0f),
+                Core::Vector4(0.0f, 0.0f, 1.0f, 0.0f)
+            };
+            //-----------------------------------------------------------------
+            /// The offsets of the elements used in skinning within a vertex.
+            ///
+            /// @author Jordan Brown
+            //-----------------------------------------------------------------
+            struct SkinningLayout
+            {
+                u32 m_stride = 0;
+                u32 m_positionOffset = 0;
+                u32 m_normalOffset = 0;
+                u32 m_weightOffset = 0;
+                u32 m_jointIndexOffset = 0;
+                bool m_hasNormals = false;
+            };
+            //-----------------------------------------------------------------
+            /// @author Jordan Brown
+            ///
+            /// @param The vertex declaration.
+            /// @param [Out] The skinning layout of the declaration.
+            ///
+            /// @return Whether or not the declaration contains everything
+            /// needed for skinning.
+            //-----------------------------------------------------------------
+            bool TryGetSkinningLayout(const VertexDeclaration& in_vertexDeclaration, SkinningLayout& out_layout)
+            {
+                out_layout.m_stride = in_vertexDeclaration.GetTotalSize();
+                out_layout.m_hasNormals = in_vertexDeclaration.TryGetElementOffset(VertexDataSemantic::k_normal, out_layout.m_normalOffset);
+                
+                return (in_vertexDeclaration.TryGetElementOffset(VertexDataSemantic::k_position, out_layout.m_positionOffset) == true &&
+                        in_vertexDeclaration.TryGetElementOffset(VertexDataSemantic::k_weight, out_layout.m_weightOffset) == true &&
+                        in_vertexDeclaration.TryGetElementOffset(VertexDataSemantic::k_jointIndex, out_layout.m_jointIndexOffset) == true);
+            }
+            //-----------------------------------------------------------------
+            /// Skins a range of vertices with the given joint palette. This
+            /// mirrors the skinning in the built-in animated shaders: the
+            /// fourth weight is implied by the other three, and the weighted
+            /// joint rows are blended before being applied once to the
+            /// position and normal.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The joint palette.
+            /// @param The skinning layout of the vertices.
+            /// @param The index of the first vertex.
+            /// @param The number of vertices.
+            /// @param The source vertex data.
+            /// @param [Out] The vertex data to write the skinned vertices to.
+            //-----------------------------------------------------------------
+            void SkinVertices(const std::vector<Core::Vector4>& in_jointPalette, const SkinningLayout& in_layout, u32 in_firstVertex, u32 in_numVertices,
+                              const u8* in_sourceVertexData, u8* out_vertexData)
+            {
+                const u32 numJoints = static_cast<u32>(in_jointPalette.size() / 3);
+                const Core::Vector4* palette = in_jointPalette.data();
+                
+                const u32 endVertex = in_firstVertex + in_numVertices;
+                for (u32 vertex = in_firstVertex; vertex < endVertex; ++vertex)
+                {
+                    const u8* source = in_sourceVertexData + vertex * in_layout.m_stride;
+                    u8* destination = out_vertexData + vertex * in_layout.m_stride;
+                    
+                    const f32* sourceWeights = reinterpret_cast<const f32*>(source + in_layout.m_weightOffset);
+                    const u8* jointIndices = source + in_layout.m_jointIndexOffset;
+                    const f32 weights[4] = { sourceWeights[0], sourceWeights[1], sourceWeights[2], 1.0f - sourceWeights[0] - sourceWeights[1] - sourceWeights[2] };
+                    
+                    f32 rows[12] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+                    for (u32 influence = 0; influence < 4; ++influence)
+                    {
+                        const f32 weight = weights[influence];
+                        if (weight != 0.0f && jointIndices[influence] < numJoints)
+                        {
+                            const Core::Vector4* joint = palette + jointIndices[influence] * 3;
+                            for (u32 row = 0; row < 3; ++row)
+                            {
+                                rows[row * 4 + 0] += weight * joint[row].x;
+                                rows[row * 4 + 1] += weight * joint[row].y;
+                                rows[row * 4 + 2] += weight * joint[row].z;
+                                rows[row * 4 + 3] += weight * joint[row].w;
+                            }
+                        }
+                    }
+                    
+                    const f32* sourcePosition = reinterpret_cast<const f32*>(source + in_layout.m_positionOffset);
+                    f32* position = reinterpret_cast<f32*>(destination + in_layout.m_positionOffset);
+                    for (u32 row = 0; row < 3; ++row)
+                    {
+                        position[row] = rows[row * 4 + 0] * sourcePosition[0] + rows[row * 4 + 1] * sourcePosition[1] + rows[row * 4 + 2] * sourcePosition[2] + rows[row * 4 + 3] * sourcePosition[3];
+                    }
+                    
+                    if (in_layout.m_hasNormals == true)
+                    {
+                        const f32* sourceNormal = reinterpret_cast<const f32*>(source + in_layout.m_normalOffset);
+                        f32* normal = reinterpret_cast<f32*>(destination + in_layout.m_normalOffset);
+                        for (u32 row = 0; row < 3; ++row)
+                        {
+                            normal[row] = rows[row * 4 + 0] * sourceNormal[0] + rows[row * 4 + 1] * sourceNormal[1] + rows[row * 4 + 2] * sourceNormal[2];
+                        }
+                    }
+                }
+            }
+        }
+        
+        const u32 SubMesh::k_maxJointsPerDraw = 60;
+        
 		//--------------------------------------------------------------------
 		/// Constructor
 		//--------------------------------------------------------------------
@@ -178,33 +291,143 @@ namespace ChilliSource
 			mpInverseBindPose = inpInverseBindPose;
 		}
 		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void SubMesh::SetJointPartitions(const std::vector<JointPartition>& in_jointPartitions)
+		{
+			m_jointPartitions = in_jointPartitions;
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void SubMesh::SetSourceData(const void* in_vertexData, u32 in_vertexDataSize, const void* in_indexData, u32 in_indexDataSize)
+		{
+			const u8* vertexData = static_cast<const u8*>(in_vertexData);
+			m_sourceVertexData.assign(vertexData, vertexData + in_vertexDataSize);
+			
+			const u8* indexData = static_cast<const u8*>(in_indexData);
+			m_sourceIndexData.assign(indexData, indexData + in_indexDataSize);
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		MeshBufferUPtr SubMesh::CreateCPUSkinnedMeshBuffer(std::vector<u8>& out_vertexData) const
+		{
+			SkinningLayout layout;
+			if (m_sourceVertexData.empty() == true || TryGetSkinningLayout(mpMeshBuffer->GetVertexDeclaration(), layout) == false)
+			{
+				return nullptr;
+			}
+			
+			//Bind every vertex entirely to the first joint. The fourth weight is implied so will be 0.
+			out_vertexData = m_sourceVertexData;
+			const u32 numVertices = static_cast<u32>(out_vertexData.size()) / layout.m_stride;
+			for (u32 vertex = 0; vertex < numVertices; ++vertex)
+			{
+				u8* vertexData = out_vertexData.data() + vertex * layout.m_stride;
+				
+				f32* weights = reinterpret_cast<f32*>(vertexData + layout.m_weightOffset);
+				weights[0] = 1.0f;
+				weights[1] = 0.0f;
+				weights[2] = 0.0f;
+				weights[3] = 0.0f;
+				
+				memset(vertexData + layout.m_jointIndexOffset, 0, 4);
+			}
+			
+			BufferDescription desc = mpMeshBuffer->GetBufferDescription();
+			desc.eUsageFlag = BufferUsage::k_dynamic;
+			desc.eAccessFlag = BufferAccess::k_writeDiscard;
+			
+			MeshBufferUPtr meshBuffer(Core::Application::Get()->GetRenderSystem()->CreateBuffer(desc));
+			meshBuffer->SetVertexCount(mpMeshBuffer->GetVertexCount());
+			meshBuffer->SetIndexCount(mpMeshBuffer->GetIndexCount());
+			meshBuffer->Bind();
+			
+			f32* vertexBuffer = nullptr;
+			meshBuffer->LockVertex(&vertexBuffer, 0, 0);
+			memcpy(vertexBuffer, out_vertexData.data(), out_vertexData.size());
+			meshBuffer->UnlockVertex();
+			
+			if (m_sourceIndexData.empty() == false)
+			{
+				u16* indexBuffer = nullptr;
+				meshBuffer->LockIndex(&indexBuffer, 0, 0);
+				memcpy(indexBuffer, m_sourceIndexData.data(), m_sourceIndexData.size());
+				meshBuffer->UnlockIndex();
+			}
+			
+			return meshBuffer;
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void SubMesh::Skin(SkinnedAnimationGroup* in_animationGroup, std::vector<u8>& inout_vertexData) const
+		{
+			CS_ASSERT(inout_vertexData.size() == m_sourceVertexData.size(), "Vertex data was not created for this sub mesh.");
+			
+			SkinningLayout layout;
+			if (TryGetSkinningLayout(mpMeshBuffer->GetVertexDeclaration(), layout) == false)
+			{
+				return;
+			}
+			
+			if (m_jointPartitions.empty() == true)
+			{
+				const u32 numVertices = static_cast<u32>(m_sourceVertexData.size()) / layout.m_stride;
+				SkinVertices(in_animationGroup->GetJointPalette(mpInverseBindPose), layout, 0, numVertices, m_sourceVertexData.data(), inout_vertexData.data());
+			}
+			else
+			{
+				for (const auto& partition : m_jointPartitions)
+				{
+					SkinVertices(in_animationGroup->GetJointPalette(partition.m_inverseBindPose), layout, partition.m_vertexOffset, partition.m_numVertices, m_sourceVertexData.data(), inout_vertexData.data());
+				}
+			}
+		}
+		//-----------------------------------------------------------------
 		/// Render
 		//-----------------------------------------------------------------
-		void SubMesh::Render(RenderSystem* inpRenderSystem, const Core::Matrix4 &inmatWorld, const MaterialCSPtr& inpMaterial, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& inpAnimationGroup) const
+		void SubMesh::Render(RenderCommandBuffer* in_commandBuffer, const Core::Matrix4 &inmatWorld, const MaterialCSPtr& inpMaterial, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& inpAnimationGroup) const
 		{
             CS_ASSERT(mpMeshBuffer->GetVertexCount() > 0, "Cannot render Sub Mesh without vertices");
             
             if (inpMaterial->GetShader(in_shaderPass) != nullptr)
             {
-                inpRenderSystem->ApplyMaterial(inpMaterial, in_shaderPass);
+                in_commandBuffer->ApplyMaterial(inpMaterial, in_shaderPass);
+                
+                MeshBuffer* meshBuffer = mpMeshBuffer;
                 
                 if (inpAnimationGroup != nullptr)
                 {
-                    //Apply inverse bind pose matrix.
-                    std::vector<Core::Matrix4> combinedMatrices;
-                    inpAnimationGroup->ApplyInverseBindPose(mpInverseBindPose->mInverseBindPoseMatrices, combinedMatrices);
-                    inpRenderSystem->ApplyJoints(combinedMatrices);
+                    //If the group skins this sub mesh on the CPU, the skinned vertices already contain the pose so
+                    //the whole sub mesh can be drawn at once, regardless of how many joints it references.
+                    MeshBuffer* skinnedMeshBuffer = inpAnimationGroup->GetCPUSkinnedMeshBuffer(this, in_commandBuffer);
+                    if (skinnedMeshBuffer != nullptr)
+                    {
+                        in_commandBuffer->ApplyJoints(k_identityJointPalette);
+                        meshBuffer = skinnedMeshBuffer;
+                    }
+                    else if (m_jointPartitions.empty() == false)
+                    {
+                        const u32 indexSize = mpMeshBuffer->GetBufferDescription().IndexSize;
+                        for (const auto& partition : m_jointPartitions)
+                        {
+                            in_commandBuffer->ApplyJoints(inpAnimationGroup->GetJointPalette(partition.m_inverseBindPose));
+                            in_commandBuffer->RenderBuffer(mpMeshBuffer, partition.m_indexOffset * indexSize, partition.m_numIndices, inmatWorld);
+                        }
+                        return;
+                    }
+                    else
+                    {
+                        in_commandBuffer->ApplyJoints(inpAnimationGroup->GetJointPalette(mpInverseBindPose));
+                    }
                 }
                 
-                mpMeshBuffer->Bind();
-
-                if(mpMeshBuffer->GetIndexCount() > 0)
+                //The mesh buffer is bound when the command is executed.
+                if(meshBuffer->GetIndexCount() > 0)
                 {
-                    inpRenderSystem->RenderBuffer(mpMeshBuffer, 0, mpMeshBuffer->GetIndexCount(), inmatWorld);
+                    in_commandBuffer->RenderBuffer(meshBuffer, 0, meshBuffer->GetIndexCount(), inmatWorld);
                 }
                 else
                 {
-                    inpRenderSystem->RenderVertexBuffer(mpMeshBuffer, 0, mpMeshBuffer->GetVertexCount(), inmatWorld);
+                    in_commandBuffer->RenderVertexBuffer(meshBuffer, 0, meshBuffer->GetVertexCount(), inmatWorld);
                 }
             }
 		}
@@ -45,16 +45,45 @@ namespace ChilliSource
 	{
 		//===============================================
 		/// Inverse Bind Pose
+		///
+		/// The inverse bind pose matrices used by a
+		/// sub mesh, or a part of one. If joint indices
+		/// are given, matrix i applies to the skeleton
+		/// joint at mJointIndices[i], otherwise it
+		/// applies to joint i.
 		//===============================================
 		struct InverseBindPose
 		{
 			std::vector<CSCore::Matrix4> mInverseBindPoseMatrices;
+			std::vector<u32> mJointIndices;
 		};
 		typedef std::shared_ptr<InverseBindPose> InverseBindPosePtr;
 		
 		class SubMesh
 		{
 		public:
+			//-----------------------------------------------------------------
+			/// The maximum number of joints that a single draw can reference.
+			/// This matches the size of the joint palette in the built-in
+			/// animated shaders. Sub meshes that reference more joints are
+			/// split into joint partitions when the mesh is built.
+			//-----------------------------------------------------------------
+			static const u32 k_maxJointsPerDraw;
+			//-----------------------------------------------------------------
+			/// A range of the sub mesh which references no more than
+			/// k_maxJointsPerDraw joints, and so can be rendered in a single
+			/// draw. The vertices and indices of each partition are contiguous.
+			///
+			/// @author Jordan Brown
+			//-----------------------------------------------------------------
+			struct JointPartition
+			{
+				InverseBindPosePtr m_inverseBindPose;
+				u32 m_indexOffset;
+				u32 m_numIndices;
+				u32 m_vertexOffset;
+				u32 m_numVertices;
+			};
 			
 			virtual ~SubMesh();
 			
@@ -88,8 +117,41 @@ namespace ChilliSource
             /// @return Number of indices in this sub-mesh
             //-----------------------------------------------------------------
             u32 GetNumIndices() const;
+			//-----------------------------------------------------------------
+			/// Create CPU Skinned Mesh Buffer
+			///
+			/// Creates a dynamic mesh buffer that the sub mesh can be skinned
+			/// into on the CPU, along with the vertex data it is skinned from.
+			/// The vertex data is a copy of the source vertices with every
+			/// vertex bound entirely to the first joint, so the buffer can be
+			/// rendered with an identity joint palette. This must be called
+			/// on the main thread.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param [Out] The vertex data which should be passed to Skin().
+			///
+			/// @return The mesh buffer, or null if the sub mesh cannot be
+			/// skinned on the CPU.
+			//-----------------------------------------------------------------
+			MeshBufferUPtr CreateCPUSkinnedMeshBuffer(std::vector<u8>& out_vertexData) const;
+			//-----------------------------------------------------------------
+			/// Skin
+			///
+			/// Skins the source vertices of the sub mesh with the current pose
+			/// of the given animation group, writing the positions and normals
+			/// into the given vertex data.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The animation group.
+			/// @param [In/Out] The vertex data created by
+			/// CreateCPUSkinnedMeshBuffer().
+			//-----------------------------------------------------------------
+			void Skin(SkinnedAnimationGroup* in_animationGroup, std::vector<u8>& inout_vertexData) const;
 			
 		private:
+
 			//Only the mesh can create this
 			SubMesh(const std::string& instrName);
 			//-----------------------------------------------------------------
@@ -142,15 +204,43 @@ namespace ChilliSource
 			//-----------------------------------------------------------------
 			void SetInverseBindPose(const InverseBindPosePtr& inpInverseBindPose);
 			//-----------------------------------------------------------------
+			/// Set Joint Partitions
+			///
+			/// Sets the joint partitions the sub mesh is rendered in. Each is
+			/// rendered with its own inverse bind pose, in place of the one
+			/// for the whole sub mesh.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The joint partitions.
+			//-----------------------------------------------------------------
+			void SetJointPartitions(const std::vector<JointPartition>& in_jointPartitions);
+			//-----------------------------------------------------------------
+			/// Set Source Data
+			///
+			/// Keeps a copy of the given vertex and index data, which is
+			/// needed for the sub mesh to be skinned on the CPU. This is
+			/// only set if the mesh was loaded with CPU skinning
+			/// supported in its MeshResourceOptions.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The vertex data.
+			/// @param The size of the vertex data in bytes.
+			/// @param The index data.
+			/// @param The size of the index data in bytes.
+			//-----------------------------------------------------------------
+			void SetSourceData(const void* in_vertexData, u32 in_vertexDataSize, const void* in_indexData, u32 in_indexDataSize);
+			//-----------------------------------------------------------------
 			/// Render
 			///
 			/// Render the contents of the mesh buffer and invoke render
 			/// on any sub meshes
 			///
-			/// @param the render system.
+			/// @param The command buffer to record into.
 			/// @param World transform matrix
 			//-----------------------------------------------------------------
-			void Render(RenderSystem* inpRenderSystem, const Core::Matrix4 &inmatWorld, const MaterialCSPtr& inpMaterial, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& inpAnimationGroup) const;
+			void Render(RenderCommandBuffer* in_commandBuffer, const Core::Matrix4 &inmatWorld, const MaterialCSPtr& inpMaterial, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& inpAnimationGroup) const;
 			
 			friend class Mesh;
 			
@@ -163,6 +253,10 @@ namespace ChilliSource
 			MeshBuffer* mpMeshBuffer;
 			
 			InverseBindPosePtr mpInverseBindPose;
+			std::vector<JointPartition> m_jointPartitions;
+			
+			std::vector<u8> m_sourceVertexData;
+			std::vector<u8> m_sourceIndexData;
 		};
 	}
 }
@@ -29,8 +29,8 @@
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
 
 namespace ChilliSource
@@ -39,8 +39,8 @@ namespace ChilliSource
 	{
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleAffector(in_affectorDef, in_particleArray), m_particleAcceleration(in_particleArray->size())
+		AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: ParticleAffector(in_affectorDef, in_particlePool), m_particleAcceleration(in_particlePool->GetCapacity())
 		{
 			//This can only be created by the AccelerationParticleAffectorDef so this is safe.
 			m_accelerationAffectorDef = static_cast<const AccelerationParticleAffectorDef*>(in_affectorDef);
@@ -57,14 +57,21 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void AccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
 		{
-			Core::dynamic_array<Particle>* particleArray = GetParticleArray();
-			for (u32 i = 0; i < particleArray->size(); ++i)
-			{
-				Particle& particle = particleArray->at(i);
-				Core::Vector3& acceleration = m_particleAcceleration[i];
+			//integrated in the same way as the positions in ParticlePool::IntegrateParticles().
+			const u32 numComponents = GetParticlePool()->GetNumActiveParticles() * 3;
+			f32* velocities = reinterpret_cast<f32*>(GetParticlePool()->GetVelocities());
+			const f32* accelerations = reinterpret_cast<const f32*>(m_particleAcceleration.data());
 
-				particle.m_velocity += acceleration * in_deltaTime;
+			for (u32 i = 0; i < numComponents; ++i)
+			{
+				velocities[i] += accelerations[i] * in_deltaTime;
 			}
 		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void AccelerationParticleAffector::MoveParticle(u32 in_fromIndex, u32 in_toIndex)
+		{
+			m_particleAcceleration[in_toIndex] = m_particleAcceleration[in_fromIndex];
+		}
 	}
 }
\ No newline at end of file
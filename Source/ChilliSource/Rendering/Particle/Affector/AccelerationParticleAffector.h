@@ -68,6 +68,15 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
 			//----------------------------------------------------------------
+			/// Moves the acceleration of a particle to match its new index.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The index the particle was moved from.
+			/// @param The index the particle was moved to.
+			//----------------------------------------------------------------
+			void MoveParticle(u32 in_fromIndex, u32 in_toIndex) override;
+			//----------------------------------------------------------------
 			/// Destructor
 			///
 			/// @author Ian Copland
@@ -81,9 +90,9 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
+			AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
 
 			const AccelerationParticleAffectorDef* m_accelerationAffectorDef = nullptr;
 			Core::dynamic_array<Core::Vector3> m_particleAcceleration;
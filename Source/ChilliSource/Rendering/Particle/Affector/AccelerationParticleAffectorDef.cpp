@@ -65,9 +65,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleAffectorUPtr AccelerationParticleAffectorDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleAffectorUPtr AccelerationParticleAffectorDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleAffectorUPtr(new AccelerationParticleAffector(this, in_particleArray));
+			return ParticleAffectorUPtr(new AccelerationParticleAffector(this, in_particlePool));
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
@@ -29,8 +29,8 @@
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffectorDef.h>
 
 namespace ChilliSource
@@ -39,8 +39,8 @@ namespace ChilliSource
 	{
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleAffector(in_affectorDef, in_particleArray), m_particleAngularAcceleration(in_particleArray->size())
+		AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: ParticleAffector(in_affectorDef, in_particlePool), m_particleAngularAcceleration(in_particlePool->GetCapacity())
 		{
 			//This can only be created by the AngularAccelerationParticleAffectorDef so this is safe.
 			m_angularAccelerationAffectorDef = static_cast<const AngularAccelerationParticleAffectorDef*>(in_affectorDef);
@@ -57,13 +57,20 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void AngularAccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
 		{
-			Core::dynamic_array<Particle>* particleArray = GetParticleArray();
-			for (u32 i = 0; i < particleArray->size(); ++i)
+			const u32 numParticles = GetParticlePool()->GetNumActiveParticles();
+			f32* angularVelocities = GetParticlePool()->GetAngularVelocities();
+			const f32* angularAccelerations = m_particleAngularAcceleration.data();
+
+			for (u32 i = 0; i < numParticles; ++i)
 			{
-				Particle& particle = particleArray->at(i);
-				f32 angularAcceleration = m_particleAngularAcceleration[i];
-				particle.m_angularVelocity += angularAcceleration * in_deltaTime;
+				angularVelocities[i] += angularAccelerations[i] * in_deltaTime;
 			}
 		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void AngularAccelerationParticleAffector::MoveParticle(u32 in_fromIndex, u32 in_toIndex)
+		{
+			m_particleAngularAcceleration[in_toIndex] = m_particleAngularAcceleration[in_fromIndex];
+		}
 	}
 }
\ No newline at end of file
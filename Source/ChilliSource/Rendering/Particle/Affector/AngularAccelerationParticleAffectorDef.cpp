@@ -65,9 +65,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleAffectorUPtr AngularAccelerationParticleAffectorDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleAffectorUPtr AngularAccelerationParticleAffectorDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleAffectorUPtr(new AngularAccelerationParticleAffector(this, in_particleArray));
+			return ParticleAffectorUPtr(new AngularAccelerationParticleAffector(this, in_particlePool));
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
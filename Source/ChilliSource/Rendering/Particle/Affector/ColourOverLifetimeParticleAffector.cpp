@@ -29,18 +29,20 @@
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.h>
 
 namespace ChilliSource
 {
 	namespace Rendering
 	{
+		static_assert(sizeof(Core::Colour) == 4 * sizeof(f32), "Colour over lifetime affector requires Colour to be tightly packed.");
+
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleAffector(in_affectorDef, in_particleArray), m_particleColourData(in_particleArray->size())
+		ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: ParticleAffector(in_affectorDef, in_particlePool), m_initialColours(in_particlePool->GetCapacity()), m_colourDeltas(in_particlePool->GetCapacity())
 		{
 			//This can only be created by the ColourOverLifetimeParticleAffectorDef so this is safe.
 			m_colourOverLifetimeAffectorDef = static_cast<const ColourOverLifetimeParticleAffectorDef*>(in_affectorDef);
@@ -49,28 +51,43 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void ColourOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
 		{
-			CS_ASSERT(in_index >= 0 && in_index < m_particleColourData.size(), "Index out of bounds!");
+			CS_ASSERT(in_index >= 0 && in_index < m_initialColours.size(), "Index out of bounds!");
 
-			ColourData& colourData = m_particleColourData[in_index];
-			const Particle& particle = GetParticleArray()->at(in_index);
-			
-			colourData.m_initialColour = particle.m_colour;
+			const Core::Colour& initialColour = GetParticlePool()->GetColours()[in_index];
+			Core::Colour targetColour = m_colourOverLifetimeAffectorDef->GetTargetColourProperty()->GenerateValue(in_effectProgress);
 
-			colourData.m_targetColour = m_colourOverLifetimeAffectorDef->GetTargetColourProperty()->GenerateValue(in_effectProgress);
+			m_initialColours[in_index] = initialColour;
+			m_colourDeltas[in_index] = targetColour - initialColour;
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
 		void ColourOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
 		{
-			Core::dynamic_array<Particle>* particleArray = GetParticleArray();
-			for (u32 i = 0; i < particleArray->size(); ++i)
+			const u32 numParticles = GetParticlePool()->GetNumActiveParticles();
+			const f32* energies = GetParticlePool()->GetEnergies();
+			const f32* lifetimes = GetParticlePool()->GetLifetimes();
+			const f32* initialColours = reinterpret_cast<const f32*>(m_initialColours.data());
+			const f32* colourDeltas = reinterpret_cast<const f32*>(m_colourDeltas.data());
+			f32* colours = reinterpret_cast<f32*>(GetParticlePool()->GetColours());
+
+			//each colour is 4 floats, written out per component so the loop body is a straight line of multiply-adds.
+			for (u32 i = 0; i < numParticles; ++i)
 			{
-				Particle& particle = particleArray->at(i);
-				ColourData& colourData = m_particleColourData[i];
+				const f32 normalisedLifeProgress = 1.0f - (energies[i] / lifetimes[i]);
+				const u32 component = i * 4;
 
-				f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-				particle.m_colour = colourData.m_initialColour + (colourData.m_targetColour - colourData.m_initialColour) * normalisedLifeProgress;
+				colours[component + 0] = initialColours[component + 0] + colourDeltas[component + 0] * normalisedLifeProgress;
+				colours[component + 1] = initialColours[component + 1] + colourDeltas[component + 1] * normalisedLifeProgress;
+				colours[component + 2] = initialColours[component + 2] + colourDeltas[component + 2] * normalisedLifeProgress;
+				colours[component + 3] = initialColours[component + 3] + colourDeltas[component + 3] * normalisedLifeProgress;
 			}
 		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void ColourOverLifetimeParticleAffector::MoveParticle(u32 in_fromIndex, u32 in_toIndex)
+		{
+			m_initialColours[in_toIndex] = m_initialColours[in_fromIndex];
+			m_colourDeltas[in_toIndex] = m_colourDeltas[in_fromIndex];
+		}
 	}
 }
\ No newline at end of file
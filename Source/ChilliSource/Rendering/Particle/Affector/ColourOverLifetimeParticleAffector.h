@@ -70,6 +70,16 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
 			//----------------------------------------------------------------
+			/// Moves the initial and target colour of a particle to match its
+			/// new index.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The index the particle was moved from.
+			/// @param The index the particle was moved to.
+			//----------------------------------------------------------------
+			void MoveParticle(u32 in_fromIndex, u32 in_toIndex) override;
+			//----------------------------------------------------------------
 			/// Destructor
 			///
 			/// @author Ian Copland
@@ -83,23 +93,13 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
-			//----------------------------------------------------------------
-			ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
-			//----------------------------------------------------------------
-			/// A container for the initial and target colour of a single 
-			/// particle.
-			///
-			/// @author Ian Copland.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			struct ColourData
-			{
-				Core::Colour m_initialColour;
-				Core::Colour m_targetColour;
-			};
+			ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
 
 			const ColourOverLifetimeParticleAffectorDef* m_colourOverLifetimeAffectorDef = nullptr;
-			Core::dynamic_array<ColourData> m_particleColourData;
+			Core::dynamic_array<Core::Colour> m_initialColours;
+			Core::dynamic_array<Core::Colour> m_colourDeltas;
 		};
 	}
 }
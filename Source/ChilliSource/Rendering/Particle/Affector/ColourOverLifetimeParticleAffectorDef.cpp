@@ -65,9 +65,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleAffectorUPtr ColourOverLifetimeParticleAffectorDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleAffectorUPtr ColourOverLifetimeParticleAffectorDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleAffectorUPtr(new ColourOverLifetimeParticleAffector(this, in_particleArray));
+			return ParticleAffectorUPtr(new ColourOverLifetimeParticleAffector(this, in_particlePool));
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
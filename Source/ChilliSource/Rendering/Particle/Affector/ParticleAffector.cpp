@@ -34,8 +34,8 @@ namespace ChilliSource
 	{
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleAffector::ParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: m_affectorDef(in_affectorDef), m_particleArray(in_particleArray)
+		ParticleAffector::ParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: m_affectorDef(in_affectorDef), m_particlePool(in_particlePool)
 		{
 		}
 		//----------------------------------------------------------------
@@ -46,9 +46,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		Core::dynamic_array<Particle>* ParticleAffector::GetParticleArray() const
+		ParticlePool* ParticleAffector::GetParticlePool() const
 		{
-			return m_particleArray;
+			return m_particlePool;
 		}
 	}
 }
\ No newline at end of file
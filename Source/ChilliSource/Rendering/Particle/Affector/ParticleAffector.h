@@ -53,9 +53,9 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			ParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
+			ParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
 			//----------------------------------------------------------------
 			/// Activates the particle with the given index.
 			///
@@ -69,7 +69,8 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			virtual void ActivateParticle(u32 in_index, f32 in_effectProgress) = 0;
 			//----------------------------------------------------------------
-			/// Applies the affect to each of the active particles.
+			/// Applies the affect to each of the active particles. Active
+			/// particles are densely packed at the start of the particle pool.
 			///
 			/// This will be called on a background thread.
 			///
@@ -81,6 +82,21 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			virtual void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) = 0;
 			//----------------------------------------------------------------
+			/// Called when a particle is moved within the particle pool, so
+			/// that any per-particle data stored by the affector can be moved
+			/// to match. This happens when a particle is deactivated and the 
+			/// last active particle is moved into its place. By default this
+			/// does nothing, which suits affectors without per-particle data.
+			///
+			/// This will be called on a background thread.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The index the particle was moved from.
+			/// @param The index the particle was moved to.
+			//----------------------------------------------------------------
+			virtual void MoveParticle(u32 in_fromIndex, u32 in_toIndex) {};
+			//----------------------------------------------------------------
 			/// Destructor
 			///
 			/// @author Ian Copland
@@ -96,13 +112,13 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			/// @author Ian Copland
 			///
-			/// @return The particle array.
+			/// @return The particle pool.
 			//----------------------------------------------------------------
-			Core::dynamic_array<Particle>* GetParticleArray() const;
+			ParticlePool* GetParticlePool() const;
 		private:
 
 			const ParticleAffectorDef* m_affectorDef = nullptr;
-			Core::dynamic_array<Particle>* m_particleArray = nullptr;
+			ParticlePool* m_particlePool = nullptr;
 		};
 	}
 }
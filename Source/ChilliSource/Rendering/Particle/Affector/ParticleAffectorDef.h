@@ -77,11 +77,11 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland.
 			///
-			/// @param The particle array.
+			/// @param The particle pool.
 			///
 			/// @return the instance.
 			//----------------------------------------------------------------
-			virtual ParticleAffectorUPtr CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const = 0;
+			virtual ParticleAffectorUPtr CreateInstance(ParticlePool* in_particlePool) const = 0;
 			//----------------------------------------------------------------
 			/// @author Ian Copland
 			///
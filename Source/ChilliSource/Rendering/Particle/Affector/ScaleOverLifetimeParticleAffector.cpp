@@ -29,18 +29,20 @@
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
 
 namespace ChilliSource
 {
 	namespace Rendering
 	{
+		static_assert(sizeof(Core::Vector2) == 2 * sizeof(f32), "Scale over lifetime affector requires Vector2 to be tightly packed.");
+
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleAffector(in_affectorDef, in_particleArray), m_particleScaleData(in_particleArray->size())
+		ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: ParticleAffector(in_affectorDef, in_particlePool), m_initialScales(in_particlePool->GetCapacity()), m_scaleDeltas(in_particlePool->GetCapacity())
 		{
 			//This can only be created by the ScaleOverLifetimeParticleAffectorDef so this is safe.
 			m_scaleOverLifetimeAffectorDef = static_cast<const ScaleOverLifetimeParticleAffectorDef*>(in_affectorDef);
@@ -49,28 +51,40 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void ScaleOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
 		{
-			CS_ASSERT(in_index >= 0 && in_index < m_particleScaleData.size(), "Index out of bounds!");
+			CS_ASSERT(in_index >= 0 && in_index < m_initialScales.size(), "Index out of bounds!");
 
-			ScaleData& scaleData = m_particleScaleData[in_index];
-			const Particle& particle = GetParticleArray()->at(in_index);
-			
-			scaleData.m_initialScale = particle.m_scale;
+			const Core::Vector2& initialScale = GetParticlePool()->GetScales()[in_index];
+			Core::Vector2 targetScale = initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
 
-			scaleData.m_targetScale = scaleData.m_initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
+			m_initialScales[in_index] = initialScale;
+			m_scaleDeltas[in_index] = targetScale - initialScale;
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
 		void ScaleOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
 		{
-			Core::dynamic_array<Particle>* particleArray = GetParticleArray();
-			for (u32 i = 0; i < particleArray->size(); ++i)
+			const u32 numParticles = GetParticlePool()->GetNumActiveParticles();
+			const f32* energies = GetParticlePool()->GetEnergies();
+			const f32* lifetimes = GetParticlePool()->GetLifetimes();
+			const f32* initialScales = reinterpret_cast<const f32*>(m_initialScales.data());
+			const f32* scaleDeltas = reinterpret_cast<const f32*>(m_scaleDeltas.data());
+			f32* scales = reinterpret_cast<f32*>(GetParticlePool()->GetScales());
+
+			for (u32 i = 0; i < numParticles; ++i)
 			{
-				Particle& particle = particleArray->at(i);
-				ScaleData& scaleData = m_particleScaleData[i];
+				const f32 normalisedLifeProgress = 1.0f - (energies[i] / lifetimes[i]);
+				const u32 component = i * 2;
 
-				f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-				particle.m_scale = scaleData.m_initialScale + (scaleData.m_targetScale - scaleData.m_initialScale) * normalisedLifeProgress;
+				scales[component + 0] = initialScales[component + 0] + scaleDeltas[component + 0] * normalisedLifeProgress;
+				scales[component + 1] = initialScales[component + 1] + scaleDeltas[component + 1] * normalisedLifeProgress;
 			}
 		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void ScaleOverLifetimeParticleAffector::MoveParticle(u32 in_fromIndex, u32 in_toIndex)
+		{
+			m_initialScales[in_toIndex] = m_initialScales[in_fromIndex];
+			m_scaleDeltas[in_toIndex] = m_scaleDeltas[in_fromIndex];
+		}
 	}
 }
\ No newline at end of file
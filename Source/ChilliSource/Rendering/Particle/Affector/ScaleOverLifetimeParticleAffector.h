@@ -70,6 +70,16 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
 			//----------------------------------------------------------------
+			/// Moves the initial and target scale of a particle to match its
+			/// new index.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The index the particle was moved from.
+			/// @param The index the particle was moved to.
+			//----------------------------------------------------------------
+			void MoveParticle(u32 in_fromIndex, u32 in_toIndex) override;
+			//----------------------------------------------------------------
 			/// Destructor
 			///
 			/// @author Ian Copland
@@ -83,23 +93,13 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
-			//----------------------------------------------------------------
-			ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
-			//----------------------------------------------------------------
-			/// A container for the initial scale and scale factor of a single 
-			/// particle.
-			///
-			/// @author Ian Copland.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			struct ScaleData
-			{
-				Core::Vector2 m_initialScale;
-				Core::Vector2 m_targetScale;
-			};
+			ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
 
 			const ScaleOverLifetimeParticleAffectorDef* m_scaleOverLifetimeAffectorDef = nullptr;
-			Core::dynamic_array<ScaleData> m_particleScaleData;
+			Core::dynamic_array<Core::Vector2> m_initialScales;
+			Core::dynamic_array<Core::Vector2> m_scaleDeltas;
 		};
 	}
 }
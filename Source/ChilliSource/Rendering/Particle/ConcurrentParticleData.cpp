@@ -28,112 +28,133 @@
 
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 
 namespace ChilliSource
 {
 	namespace Rendering
 	{
-		//-----------------------------------------------------------------
-		//-----------------------------------------------------------------
-		ConcurrentParticleData::ConcurrentParticleData(u32 in_particleCount)
-			: m_particles(in_particleCount), m_lock(m_mutex, std::defer_lock)
+		namespace
 		{
+			//the committed state stores the index of the committed buffer in the low bits, and
+			//a flag in the high bit which is set until the main thread has picked it up.
+			const u32 k_bufferIndexMask = 0x3;
+			const u32 k_unreadFlag = 0x80000000;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		bool ConcurrentParticleData::StartUpdate()
+		ConcurrentParticleData::ConcurrentParticleData(u32 in_particleCount)
+			: m_committedState(2), m_updating(false), m_particleActivationCommits(in_particleCount, 0)
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
-			if (m_updating == false)
+			for (auto& buffer : m_buffers)
 			{
-				m_updating = true;
-				return true;
+				buffer.m_particles.reserve(in_particleCount);
+				buffer.m_activationCommits.reserve(in_particleCount);
 			}
-
-			return false;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		bool ConcurrentParticleData::HasActiveParticles() const
+		bool ConcurrentParticleData::StartUpdate()
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
-			return m_activeParticles;
+			bool expected = false;
+			return m_updating.compare_exchange_strong(expected, true, std::memory_order_acquire);
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		Core::AABB ConcurrentParticleData::GetAABB() const
+		void ConcurrentParticleData::AcquireLatestData()
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
-			return m_aabb;
+			if ((m_committedState.load(std::memory_order_relaxed) & k_unreadFlag) != 0)
+			{
+				u32 previousState = m_committedState.exchange(m_readIndex, std::memory_order_acq_rel);
+				m_readIndex = previousState & k_bufferIndexMask;
+			}
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		Core::Sphere ConcurrentParticleData::GetBoundingSphere() const
+		bool ConcurrentParticleData::HasActiveParticles() const
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
-			return m_boundingSphere;
+			return (m_buffers[m_readIndex].m_particles.empty() == false);
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		void ConcurrentParticleData::Lock() const
+		Core::AABB ConcurrentParticleData::GetAABB() const
 		{
-			m_lock.lock();
+			return m_buffers[m_readIndex].m_aabb;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		std::vector<u32> ConcurrentParticleData::TakeNewIndices()
+		Core::Sphere ConcurrentParticleData::GetBoundingSphere() const
 		{
-			CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when taking new indices!")
-
-			std::vector<u32> output = m_newParticleIndices;
-			m_newParticleIndices.clear();
-			return output;
+			return m_buffers[m_readIndex].m_boundingSphere;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		const Core::dynamic_array<ConcurrentParticleData::Particle>& ConcurrentParticleData::GetParticles() const
+		std::vector<u32> ConcurrentParticleData::TakeNewParticleIds()
 		{
-			CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when getting particles!");
+			const Buffer& buffer = m_buffers[m_readIndex];
+
+			std::vector<u32> output;
+			for (u32 i = 0; i < buffer.m_particles.size(); ++i)
+			{
+				if (buffer.m_activationCommits[i] > m_lastTakenCommit)
+				{
+					output.push_back(buffer.m_particles[i].m_id);
+				}
+			}
 
-			return m_particles;
+			m_lastTakenCommit = buffer.m_commit;
+			return output;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		void ConcurrentParticleData::Unlock() const
+		const std::vector<ConcurrentParticleData::Particle>& ConcurrentParticleData::GetParticles() const
 		{
-			m_lock.unlock();
+			return m_buffers[m_readIndex].m_particles;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		void ConcurrentParticleData::CommitParticleData(const Core::dynamic_array<Rendering::Particle>* in_particles, const std::vector<u32>& in_newIndices, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere)
+		void ConcurrentParticleData::CommitParticleData(const ParticlePool* in_particlePool, const std::vector<u32>& in_newIndices, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere)
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
+			CS_ASSERT(m_updating.load(std::memory_order_relaxed) == true, "Cannot commit particle data without starting an update.");
+			CS_ASSERT(in_particlePool->GetCapacity() <= m_particleActivationCommits.size(), "Particle pool cannot be larger than the concurrent particle data.");
 
-			CS_ASSERT(in_particles->size() == m_particles.size(), "Particle data lists must be the same size.");
+			const u32 commit = ++m_numCommits;
+			const u32 numParticles = in_particlePool->GetNumActiveParticles();
+			const u32* ids = in_particlePool->GetIds();
+			const Core::Vector3* positions = in_particlePool->GetPositions();
+			const Core::Vector2* scales = in_particlePool->GetScales();
+			const f32* rotations = in_particlePool->GetRotations();
+			const Core::Colour* colours = in_particlePool->GetColours();
 
-			m_activeParticles = false;
-			for (u32 i = 0; i < m_particles.size(); ++i)
+			for (auto newIndex : in_newIndices)
 			{
-				Particle& concurrentParticle = m_particles[i];
-				const Rendering::Particle& particle = (*in_particles)[i];
+				CS_ASSERT(newIndex < numParticles, "New particle index is not active.");
+				m_particleActivationCommits[ids[newIndex]] = commit;
+			}
 
-				concurrentParticle.m_isActive = particle.m_isActive;
-				concurrentParticle.m_position = particle.m_position;
-				concurrentParticle.m_rotation = particle.m_rotation;
-				concurrentParticle.m_scale = particle.m_scale;
-				concurrentParticle.m_colour = particle.m_colour;
+			Buffer& buffer = m_buffers[m_writeIndex];
+			buffer.m_particles.resize(numParticles);
+			buffer.m_activationCommits.resize(numParticles);
+			for (u32 i = 0; i < numParticles; ++i)
+			{
+				Particle& concurrentParticle = buffer.m_particles[i];
+				concurrentParticle.m_id = ids[i];
+				concurrentParticle.m_position = positions[i];
+				concurrentParticle.m_scale = scales[i];
+				concurrentParticle.m_rotation = rotations[i];
+				concurrentParticle.m_colour = colours[i];
 
-				if (concurrentParticle.m_isActive == true)
-				{
-					m_activeParticles = true;
-				}
+				buffer.m_activationCommits[i] = m_particleActivationCommits[ids[i]];
 			}
 
-			m_newParticleIndices.insert(m_newParticleIndices.end(), in_newIndices.begin(), in_newIndices.end());
-			m_aabb = in_aabb;
-			m_boundingSphere = in_boundingSphere;
-			m_updating = false;
+			buffer.m_commit = commit;
+			buffer.m_aabb = in_aabb;
+			buffer.m_boundingSphere = in_boundingSphere;
+
+			u32 previousState = m_committedState.exchange(m_writeIndex | k_unreadFlag, std::memory_order_acq_rel);
+			m_writeIndex = previousState & k_bufferIndexMask;
+
+			m_updating.store(false, std::memory_order_release);
 		}
 	}
 }
\ No newline at end of file
@@ -31,12 +31,11 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 
-#include <mutex>
+#include <atomic>
 #include <vector>
 
 namespace ChilliSource
@@ -49,11 +48,22 @@ namespace ChilliSource
 		/// draw information for each particle, the list of newly updated particles
 		/// and the total bounds of the particle effect.
 		///
+		/// The data is triple buffered: the particle update writes into one
+		/// buffer, the main thread reads from another and the third holds the
+		/// most recently committed data. Buffers are handed between the two
+		/// sides with a single atomic exchange, so neither side ever waits on
+		/// the other. The main thread picks up new data explicitly, once per
+		/// frame, so everything read during the frame comes from the same
+		/// commit. Each buffer records the commit in which each of its
+		/// particles was activated, so new particles are never missed when
+		/// the main thread skips over a commit.
+		///
 		/// @author Ian Copland
 		//------------------------------------------------------------------------
 		class ConcurrentParticleData final
 		{
 		public:
+			CS_DECLARE_NOCOPY(ConcurrentParticleData);
 			//-----------------------------------------------------------------
 			/// A struct containing just the information required for drawing a
 			/// particle.
@@ -62,7 +72,7 @@ namespace ChilliSource
 			//-----------------------------------------------------------------
 			struct Particle final
 			{
-				bool m_isActive = false;
+				u32 m_id = 0;
 				Core::Vector3 m_position;
                 Core::Vector2 m_scale = Core::Vector2::k_zero;
 				f32 m_rotation = 0.0f;
@@ -73,7 +83,7 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland
 			///
-			/// @param The number of particles.
+			/// @param The maximum number of particles.
 			//-----------------------------------------------------------------
 			ConcurrentParticleData(u32 in_particleCount);
 			//-----------------------------------------------------------------
@@ -89,7 +99,17 @@ namespace ChilliSource
 			//-----------------------------------------------------------------
 			bool StartUpdate();
 			//-----------------------------------------------------------------
-			/// This is thread-safe, lock doesn't need to be called first.
+			/// Picks up the most recently committed particle data, if any has
+			/// been committed since this was last called. All of the getters
+			/// read from the data picked up by the last call to this.
+			///
+			/// This must only be called on the main thread.
+			///
+			/// @author Jordan Brown
+			//-----------------------------------------------------------------
+			void AcquireLatestData();
+			//-----------------------------------------------------------------
+			/// This must only be called on the main thread.
 			///
 			/// @author Ian Copland
 			///
@@ -97,7 +117,7 @@ namespace ChilliSource
 			//-----------------------------------------------------------------
 			bool HasActiveParticles() const;
 			//-----------------------------------------------------------------
-			/// This is thread-safe, lock doesn't need to be called first.
+			/// This must only be called on the main thread.
 			///
 			/// @author Ian Copland
 			///
@@ -107,7 +127,7 @@ namespace ChilliSource
 			//-----------------------------------------------------------------
 			Core::AABB GetAABB() const;
 			//-----------------------------------------------------------------
-			/// This is thread-safe, lock doesn't need to be called first.
+			/// This must only be called on the main thread.
 			///
 			/// @author Ian Copland
 			///
@@ -117,68 +137,64 @@ namespace ChilliSource
 			//-----------------------------------------------------------------
 			Core::Sphere GetBoundingSphere() const;
 			//-----------------------------------------------------------------
-			/// Locks the container so other threads cannot update it while
-			/// accessing the new indices and particle list.
+			/// Returns the ids of any particles in the acquired data which
+			/// have been activated since the last time this was called.
 			///
-			/// @author Ian Copland
-			//-----------------------------------------------------------------
-			void Lock() const;
-			//-----------------------------------------------------------------
-			/// Returns the list of indices that have changed since the last
-			/// time this was called. The list will be cleared when called.
-			/// Before this is called the container must be locked to ensure
-			/// that new particles are not activated prior to being rendered.
-			/// If the container is not locked the app is considered to be
-			/// in an irrecoverable state and will terminate.
+			/// This must only be called on the main thread.
 			/// 
 			/// @author Ian Copland
 			///
-			/// @author A vector of particle indices.
+			/// @author A vector of particle ids.
 			//-----------------------------------------------------------------
-			std::vector<u32> TakeNewIndices();
+			std::vector<u32> TakeNewParticleIds();
 			//-----------------------------------------------------------------
-			/// Before this is called the container must be locked to ensure
-			/// that any iteration over the particle data is safe. If not the
-			/// app is considered to be in an irrecoverable state and will
-			/// terminate.
-			///
-			/// @author Ian Copland
+			/// Returns the particles from the acquired data. The list remains
+			/// valid until the next call to AcquireLatestData().
 			///
-			/// @param The particle list.
-			//-----------------------------------------------------------------
-			const Core::dynamic_array<ConcurrentParticleData::Particle>& GetParticles() const;
-			//-----------------------------------------------------------------
-			/// Unlocks the container. This should be called as soon as possible
-			/// after dealing with data that needs to be locked.
+			/// This must only be called on the main thread.
 			///
 			/// @author Ian Copland
+			///
+			/// @param The list of active particles.
 			//-----------------------------------------------------------------
-			void Unlock() const;
+			const std::vector<ConcurrentParticleData::Particle>& GetParticles() const;
 			//-----------------------------------------------------------------
-			/// Updates the particle data.
-			///
-			/// This is thread-safe, lock doesn't need to be called first.
+			/// Updates the particle data. This must only be called by the
+			/// owner of the current update, i.e. after StartUpdate() has
+			/// returned true. This never blocks.
 			///
 			/// @author Ian Copland
 			///
-			/// @param The list of particles.
-			/// @param The new indices.
+			/// @param The particle pool.
+			/// @param The indices in the pool of newly activated particles.
 			/// @param The aabb.
-			/// @param The obb.
 			/// @param The bounding sphere.
 			//-----------------------------------------------------------------
-			void CommitParticleData(const Core::dynamic_array<Rendering::Particle>* in_particles, const std::vector<u32>& in_newIndices, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere);
+			void CommitParticleData(const ParticlePool* in_particlePool, const std::vector<u32>& in_newIndices, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere);
 		private:
+			//-----------------------------------------------------------------
+			/// A single copy of the shared particle data.
+			///
+			/// @author Jordan Brown
+			//-----------------------------------------------------------------
+			struct Buffer final
+			{
+				std::vector<ConcurrentParticleData::Particle> m_particles;
+				std::vector<u32> m_activationCommits;
+				u32 m_commit = 0;
+				Core::AABB m_aabb;
+				Core::Sphere m_boundingSphere;
+			};
+
+			Buffer m_buffers[3];
+			u32 m_readIndex = 0;
+			u32 m_writeIndex = 1;
+			std::atomic<u32> m_committedState;
+			std::atomic<bool> m_updating;
 
-			Core::dynamic_array<ConcurrentParticleData::Particle> m_particles;
-			std::vector<u32> m_newParticleIndices;
-			Core::AABB m_aabb;
-			Core::Sphere m_boundingSphere;
-			bool m_updating = false;
-			bool m_activeParticles = false;
-			
-			mutable std::recursive_mutex m_mutex;
-			mutable std::unique_lock<std::recursive_mutex> m_lock;
+			std::vector<u32> m_particleActivationCommits;
+			u32 m_numCommits = 0;
+			u32 m_lastTakenCommit = 0;
 		};
 	}
 }
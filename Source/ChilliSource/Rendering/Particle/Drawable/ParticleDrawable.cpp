@@ -42,19 +42,15 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void ParticleDrawable::Draw(const CameraComponent* in_camera)
+		void ParticleDrawable::Draw(const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer)
 		{
-			m_concurrentParticleData->Lock();
-
-			auto newIndices = m_concurrentParticleData->TakeNewIndices();
-			for (const auto& index : newIndices)
+			auto newIds = m_concurrentParticleData->TakeNewParticleIds();
+			for (const auto& id : newIds)
 			{
-				ActivateParticle(m_concurrentParticleData->GetParticles(), index);
+				ActivateParticle(id);
 			}
 
-			DrawParticles(m_concurrentParticleData->GetParticles(), in_camera);
-
-			m_concurrentParticleData->Unlock();
+			DrawParticles(m_concurrentParticleData->GetParticles(), in_camera, in_commandBuffer);
 		}
 		//----------------------------------------------
 		//----------------------------------------------
@@ -43,8 +43,8 @@ namespace ChilliSource
 		/// Particle drawables are drawn from the main thread, however particles 
 		/// are updated from a background task. Information is passed between 
 		/// threads using the concurrent particle draw data array. This contains 
-		/// just the information needed to render a particle and can be locked 
-		/// before use.
+		/// just the information needed to render a particle and can be read
+		/// without locking.
 		///
 		/// @author Ian Copland
 		//-----------------------------------------------------------------------
@@ -66,13 +66,16 @@ namespace ChilliSource
 			/// Updates the particle drawable and renders all active particles
 			/// in the effect. 
 			///
-			/// This must be called on the main thread.
+			/// This must be called on the main thread, or on a worker thread
+			/// while the main thread waits for the renderer to finish
+			/// recording.
 			///
 			/// @author Ian Copland
 			///
 			/// @param The camera component used to render.
+			/// @param The command buffer to record into.
 			//----------------------------------------------------------------
-			void Draw(const CameraComponent* in_camera);
+			void Draw(const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer);
 			//----------------------------------------------------------------
 			/// Destructor
 			///
@@ -94,18 +97,15 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			const ParticleDrawableDef* GetDrawableDef() const;
 			//----------------------------------------------------------------
-			/// Activates the particle with the given index.
+			/// Activates the particle with the given id.
 			///
-			/// This is called on the main thread, but the particle data can 
-			/// be modified on other threads so make sure to lock it prior to 
-			/// use.
+			/// This is always called on the main thread.
 			///
 			/// @author Ian Copland
 			///
-			/// @param The particle draw data.
-			/// @param The index of the particle to activate.
+			/// @param The id of the particle to activate.
 			//----------------------------------------------------------------
-			virtual void ActivateParticle(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index) = 0;
+			virtual void ActivateParticle(u32 in_particleId) = 0;
 			//----------------------------------------------------------------
 			/// Renders all active particles in the effect. 
 			///
@@ -113,10 +113,11 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland
 			///
-			/// @param The particle draw data.
+			/// @param The draw data for each active particle.
 			/// @param The camera component used to render.
+			/// @param The command buffer to record into.
 			//----------------------------------------------------------------
-			virtual void DrawParticles(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) = 0;
+			virtual void DrawParticles(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer) = 0;
 		private:
 			const Core::Entity* m_entity = nullptr;
 			const ParticleDrawableDef* m_drawableDef = nullptr;
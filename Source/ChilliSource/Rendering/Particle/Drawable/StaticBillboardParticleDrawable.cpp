@@ -34,17 +34,15 @@
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Drawable/StaticBillboardParticleDrawableDef.h>
 
-#include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/ColourUtils.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
-#include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Base/AspectRatioUtils.h>
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
 #include <ChilliSource/Rendering/Camera/CameraComponent.h>
 #include <ChilliSource/Rendering/Material/Material.h>
-#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
@@ -88,11 +86,10 @@ namespace ChilliSource
 				}
 			}
 			//-----------------------------------------------------------------------------
-			/// Builds world space sprite data for a particle from the given parameters.
+			/// Builds the world space sprite vertices for a particle from the given parameters.
 			///
 			/// @author Ian Copland
 			///
-			/// @param The material.
 			/// @param The uvs.
 			/// @param The local bottom left vertex position of the sprite.
 			/// @param The local top right vertex position of the sprite.
@@ -100,51 +97,45 @@ namespace ChilliSource
 			/// @param The world scale of the sprite.
 			/// @param The world orientation of the sprite.
 			/// @param The colour of the sprite.
-			///
-			/// @param The sprite data.
+			/// @param [Out] The four sprite vertices.
 			//-----------------------------------------------------------------------------
-			SpriteBatch::SpriteData BuildSpriteData(const MaterialCSPtr& in_material, const UVs& in_uvs, const Core::Vector2& in_localBL,
-				const Core::Vector2& in_localTR, const Core::Vector3& in_worldPosition, const Core::Vector2& in_worldScale, const Core::Quaternion& in_worldOrientation,
-				const Core::Colour& in_colour)
+			void BuildSpriteVertices(const UVs& in_uvs, const Core::Vector2& in_localBL, const Core::Vector2& in_localTR, const Core::Vector3& in_worldPosition,
+				const Core::Vector2& in_worldScale, const Core::Quaternion& in_worldOrientation, const Core::Colour& in_colour, SpriteBatch::SpriteVertex* out_vertices)
 			{
-				SpriteBatch::SpriteData spriteData;
-				spriteData.pMaterial = in_material;
 
 				//set the sprite colour
 				Core::ByteColour colour = Core::ColourUtils::ColourToByteColour(in_colour);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].Col = colour;
+				out_vertices[(u32)SpriteBatch::Verts::k_topLeft].Col = colour;
+				out_vertices[(u32)SpriteBatch::Verts::k_bottomLeft].Col = colour;
+				out_vertices[(u32)SpriteBatch::Verts::k_topRight].Col = colour;
+				out_vertices[(u32)SpriteBatch::Verts::k_bottomRight].Col = colour;
 
 				//set the UVs.
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vTex.x = in_uvs.m_u;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vTex.y = in_uvs.m_v;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.x = in_uvs.m_u;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.y = in_uvs.m_v + in_uvs.m_t;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vTex.y = in_uvs.m_v;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vTex.y = in_uvs.m_v + in_uvs.m_t;
+				out_vertices[(u32)SpriteBatch::Verts::k_topLeft].vTex.x = in_uvs.m_u;
+				out_vertices[(u32)SpriteBatch::Verts::k_topLeft].vTex.y = in_uvs.m_v;
+				out_vertices[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.x = in_uvs.m_u;
+				out_vertices[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.y = in_uvs.m_v + in_uvs.m_t;
+				out_vertices[(u32)SpriteBatch::Verts::k_topRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
+				out_vertices[(u32)SpriteBatch::Verts::k_topRight].vTex.y = in_uvs.m_v;
+				out_vertices[(u32)SpriteBatch::Verts::k_bottomRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
+				out_vertices[(u32)SpriteBatch::Verts::k_bottomRight].vTex.y = in_uvs.m_v + in_uvs.m_t;
 
 				//Build the vertex data.
 				Core::Vector3 localTopLeft(in_localBL.x * in_worldScale.x, in_localTR.y * in_worldScale.y, 0.0f);
 				Core::Vector3 worldTopLeft = in_worldPosition + Core::Vector3::Rotate(localTopLeft, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vPos = Core::Vector4(worldTopLeft, 1.0f);
+				out_vertices[(u32)SpriteBatch::Verts::k_topLeft].vPos = Core::Vector4(worldTopLeft, 1.0f);
 
 				Core::Vector3 localTopRight(in_localTR.x * in_worldScale.x, in_localTR.y * in_worldScale.y, 0.0f);
 				Core::Vector3 worldTopRight = in_worldPosition + Core::Vector3::Rotate(localTopRight, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vPos = Core::Vector4(worldTopRight, 1.0f);
+				out_vertices[(u32)SpriteBatch::Verts::k_topRight].vPos = Core::Vector4(worldTopRight, 1.0f);
 
 				Core::Vector3 localBottomLeft(in_localBL.x * in_worldScale.x, in_localBL.y * in_worldScale.y, 0.0f);
 				Core::Vector3 worldBottomLeft = in_worldPosition + Core::Vector3::Rotate(localBottomLeft, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vPos = Core::Vector4(worldBottomLeft, 1.0f);
+				out_vertices[(u32)SpriteBatch::Verts::k_bottomLeft].vPos = Core::Vector4(worldBottomLeft, 1.0f);
 
 				Core::Vector3 localBottomRight(in_localTR.x * in_worldScale.x, in_localBL.y * in_worldScale.y, 0.0f);
 				Core::Vector3 worldBottomRight = in_worldPosition + Core::Vector3::Rotate(localBottomRight, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos = Core::Vector4(worldBottomRight, 1.0f);
-
-				return spriteData;
+				out_vertices[(u32)SpriteBatch::Verts::k_bottomRight].vPos = Core::Vector4(worldBottomRight, 1.0f);
 			}
 		}
 
@@ -158,21 +149,21 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::ActivateParticle(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index)
+		void StaticBillboardParticleDrawable::ActivateParticle(u32 in_particleId)
 		{
-			CS_ASSERT(in_index >= 0 && in_index < m_particleBillboardIndices.size(), "Index out of bounds!");
+			CS_ASSERT(in_particleId < m_particleBillboardIndices.size(), "Particle id out of bounds!");
 
 			switch (m_billboardDrawableDef->GetImageSelectionType())
 			{
 			case StaticBillboardParticleDrawableDef::ImageSelectionType::k_cycle:
-				m_particleBillboardIndices[in_index] = m_nextBillboardIndex++;
+				m_particleBillboardIndices[in_particleId] = m_nextBillboardIndex++;
 				if (m_nextBillboardIndex >= m_billboards->size())
 				{
 					m_nextBillboardIndex = 0;
 				}
 				break;
 			case StaticBillboardParticleDrawableDef::ImageSelectionType::k_random:
-				m_particleBillboardIndices[in_index] = Core::Random::Generate<u32>(0, m_billboards->size() - 1);
+				m_particleBillboardIndices[in_particleId] = Core::Random::Generate<u32>(0, m_billboards->size() - 1);
 				break;
 			default:
 				CS_LOG_FATAL("Invalid image selection type.");
@@ -181,15 +172,15 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::DrawParticles(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera)
+		void StaticBillboardParticleDrawable::DrawParticles(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer)
 		{
 			switch (GetDrawableDef()->GetParticleEffect()->GetSimulationSpace())
 			{
 			case ParticleEffect::SimulationSpace::k_local:
-				DrawLocalSpace(in_particleData, in_camera);
+				DrawLocalSpace(in_particleData, in_camera, in_commandBuffer);
 				break;
 			case ParticleEffect::SimulationSpace::k_world:
-				DrawWorldSpace(in_particleData, in_camera);
+				DrawWorldSpace(in_particleData, in_camera, in_commandBuffer);
 				break;
 			default:
 				CS_LOG_FATAL("Invalid simulation space.");
@@ -252,9 +243,10 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::DrawLocalSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+		void StaticBillboardParticleDrawable::DrawLocalSpace(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer) const
 		{
 			const auto& material = m_billboardDrawableDef->GetMaterial();
+			SpriteBatch::SpriteVertex vertices[k_numSpriteVerts];
 			auto entityWorldTransform = GetEntity()->GetTransform().GetWorldTransform();
 
 			//we can't directly apply the parent entities scale to the particles as this would look strange as
@@ -266,11 +258,9 @@ namespace ChilliSource
 			//billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
 			auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
 
-			for (u32 i = 0; i < in_particleData.size(); ++i)
+			for (const auto& particle : in_particleData)
 			{
-				const auto& particle = in_particleData[i];
-
-				if (particle.m_isActive == true && particle.m_colour != Core::Colour::k_transparent)
+				if (particle.m_colour != Core::Colour::k_transparent)
 				{
 					auto worldPosition = particle.m_position * entityWorldTransform;
 					auto worldScale = particle.m_scale * particleScaleFactor;
@@ -278,37 +268,36 @@ namespace ChilliSource
 					//rotate locally in the XY plane before rotating to face the camera.
 					auto worldOrientation = Core::Quaternion(Core::Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView;
 
-					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
-					auto spriteData = BuildSpriteData(material, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, worldPosition, worldScale, worldOrientation,
-						particle.m_colour);
+					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[particle.m_id]);
+					BuildSpriteVertices(billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, worldPosition, worldScale, worldOrientation,
+						particle.m_colour, vertices);
 
-					Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(spriteData, nullptr);
+					in_commandBuffer->RenderSprite(material, vertices);
 				}
 			}
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::DrawWorldSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+		void StaticBillboardParticleDrawable::DrawWorldSpace(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer) const
 		{
 			const auto& material = m_billboardDrawableDef->GetMaterial();
+			SpriteBatch::SpriteVertex vertices[k_numSpriteVerts];
 
 			//billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
 			auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
 
-			for (u32 i = 0; i < in_particleData.size(); ++i)
+			for (const auto& particle : in_particleData)
 			{
-				const auto& particle = in_particleData[i];
-
-				if (particle.m_isActive == true && particle.m_colour != Core::Colour::k_transparent)
+				if (particle.m_colour != Core::Colour::k_transparent)
 				{
 					//rotate locally in the XY plane before rotating to face the camera.
 					auto worldOrientation = Core::Quaternion(Core::Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView;
 
-					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
-					auto spriteData = BuildSpriteData(material, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, particle.m_position, particle.m_scale,
-						worldOrientation, particle.m_colour);
+					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[particle.m_id]);
+					BuildSpriteVertices(billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, particle.m_position, particle.m_scale,
+						worldOrientation, particle.m_colour, vertices);
 
-					Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(spriteData, nullptr);
+					in_commandBuffer->RenderSprite(material, vertices);
 				}
 			}
 		}
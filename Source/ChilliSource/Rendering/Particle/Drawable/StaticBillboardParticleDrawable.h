@@ -71,23 +71,23 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			StaticBillboardParticleDrawable(const Core::Entity* in_entity, const ParticleDrawableDef* in_drawableDef, ConcurrentParticleData* in_concurrentParticleData);
 			//----------------------------------------------------------------
-			/// Activates the particle with the given index.
+			/// Activates the particle with the given id.
 			///
 			/// @author Ian Copland
 			///
-			/// @param The particle draw data.
-			/// @param The index of the particle to activate.
+			/// @param The id of the particle to activate.
 			//----------------------------------------------------------------
-			void ActivateParticle(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index) override;
+			void ActivateParticle(u32 in_particleId) override;
 			//----------------------------------------------------------------
 			/// Renders all active particles in the effect.
 			///
 			/// @author Ian Copland
 			///
-			/// @param The particle draw data.
+			/// @param The draw data for each active particle.
 			/// @param The camera component used to render.
+			/// @param The command buffer to record into.
 			//----------------------------------------------------------------
-			void DrawParticles(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) override;
+			void DrawParticles(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer) override;
 			//----------------------------------------------------------------
 			/// Builds the billboard image data from the provided texture
 			/// or texture atlas.
@@ -109,10 +109,11 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland
 			///
-			/// @param The particle draw data.
+			/// @param The draw data for each active particle.
 			/// @param The camera component used to render.
+			/// @param The command buffer to record into.
 			//----------------------------------------------------------------
-			void DrawLocalSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+			void DrawLocalSpace(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer) const;
 			//----------------------------------------------------------------
 			/// Draws the particles without taking into account the world
 			/// space transform of the owning entity as the particles are
@@ -120,10 +121,11 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland
 			///
-			/// @param The particle draw data.
+			/// @param The draw data for each active particle.
 			/// @param The camera component used to render.
+			/// @param The command buffer to record into.
 			//----------------------------------------------------------------
-			void DrawWorldSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+			void DrawWorldSpace(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, RenderCommandBuffer* in_commandBuffer) const;
 
 			const StaticBillboardParticleDrawableDef* m_billboardDrawableDef;
 			std::unique_ptr <Core::dynamic_array<BillboardData>> m_billboards;
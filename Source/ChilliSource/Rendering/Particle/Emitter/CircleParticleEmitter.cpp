@@ -54,8 +54,8 @@ namespace ChilliSource
 
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		CircleParticleEmitter::CircleParticleEmitter(const ParticleEmitterDef* in_particleEmitter, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleEmitter(in_particleEmitter, in_particleArray)
+		CircleParticleEmitter::CircleParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticlePool* in_particlePool)
+			: ParticleEmitter(in_particleEmitter, in_particlePool)
 		{
 			//Only the circle emitter def can create this, so this is safe.
 			m_circleParticleEmitterDef = static_cast<const CircleParticleEmitterDef*>(in_particleEmitter);
@@ -147,9 +147,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleEmitterUPtr CircleParticleEmitterDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleEmitterUPtr CircleParticleEmitterDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleEmitterUPtr(new CircleParticleEmitter(this, in_particleArray));
+			return ParticleEmitterUPtr(new CircleParticleEmitter(this, in_particlePool));
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
@@ -114,8 +114,8 @@ namespace ChilliSource
 
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		Cone2DParticleEmitter::Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleEmitter(in_particleEmitter, in_particleArray)
+		Cone2DParticleEmitter::Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticlePool* in_particlePool)
+			: ParticleEmitter(in_particleEmitter, in_particlePool)
 		{
 			//Only the sphere emitter def can create this, so this is safe.
 			m_coneParticleEmitterDef = static_cast<const Cone2DParticleEmitterDef*>(in_particleEmitter);
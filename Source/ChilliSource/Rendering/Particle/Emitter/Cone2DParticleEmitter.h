@@ -69,9 +69,9 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle emitter definition.
-			/// @param The particle array.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, Core::dynamic_array<Particle>* in_particleArray);
+			Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticlePool* in_particlePool);
 
 			const Cone2DParticleEmitterDef* m_coneParticleEmitterDef = nullptr;
 		};
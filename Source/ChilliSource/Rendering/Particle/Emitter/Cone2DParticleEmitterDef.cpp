@@ -159,9 +159,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleEmitterUPtr Cone2DParticleEmitterDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleEmitterUPtr Cone2DParticleEmitterDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleEmitterUPtr(new Cone2DParticleEmitter(this, in_particleArray));
+			return ParticleEmitterUPtr(new Cone2DParticleEmitter(this, in_particlePool));
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
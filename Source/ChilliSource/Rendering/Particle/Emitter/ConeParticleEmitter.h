@@ -69,9 +69,9 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle emitter definition.
-			/// @param The particle array.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, Core::dynamic_array<Particle>* in_particleArray);
+			ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticlePool* in_particlePool);
 
 			const ConeParticleEmitterDef* m_coneParticleEmitterDef = nullptr;
 		};
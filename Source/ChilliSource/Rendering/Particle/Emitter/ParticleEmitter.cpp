@@ -32,8 +32,8 @@
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Entity/Transform.h>
 #include <ChilliSource/Core/Math/Random.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
 #include <algorithm>
@@ -44,11 +44,11 @@ namespace ChilliSource
 	{
 		//----------------------------------------------
 		//----------------------------------------------
-		ParticleEmitter::ParticleEmitter(const ParticleEmitterDef* in_emitterDef, Core::dynamic_array<Particle>* in_particleArray)
-			: m_emitterDef(in_emitterDef), m_particleArray(in_particleArray)
+		ParticleEmitter::ParticleEmitter(const ParticleEmitterDef* in_emitterDef, ParticlePool* in_particlePool)
+			: m_emitterDef(in_emitterDef), m_particlePool(in_particlePool)
 		{
 			CS_ASSERT(m_emitterDef != nullptr, "Cannot create particle emitter with null emitter def.");
-			CS_ASSERT(m_particleArray != nullptr, "Cannot create particle emitter with null particle array.");
+			CS_ASSERT(m_particlePool != nullptr, "Cannot create particle emitter with null particle pool.");
 		}
 		//----------------------------------------------
 		//----------------------------------------------
@@ -178,15 +178,9 @@ namespace ChilliSource
 		{
 			const ParticleEffect* particleEffect = m_emitterDef->GetParticleEffect();
 
-			u32 particleIndex = m_nextParticleIndex++;
-			Particle& particle = m_particleArray->at(particleIndex);
-			if (m_nextParticleIndex >= particleEffect->GetMaxParticles())
-			{
-				m_nextParticleIndex = 0;
-			}
-
-			if (particle.m_isActive == false)
+			if (m_particlePool->IsFull() == false)
 			{
+				u32 particleIndex = m_particlePool->ActivateParticle();
 				inout_emittedParticles.push_back(particleIndex);
 
 				//Get the emission position and direction.
@@ -206,23 +200,23 @@ namespace ChilliSource
 					{
 						//transform the position into world space.
 						const Core::Matrix4 worldTransform = Core::Matrix4::CreateTransform(in_emissionPosition, in_emissionScale, in_emissionOrientation);
-						particle.m_position = localPosition * worldTransform;
+						m_particlePool->GetPositions()[particleIndex] = localPosition * worldTransform;
 
 						//we can't directly apply the emission scale to the particles as this would look strange as
 						//the camera moved around an emitting entity with a non-uniform scale, so this works out a uniform
 						//scale from the average of the components.
 						f32 particleScaleFactor = (in_emissionScale.x + in_emissionScale.y + in_emissionScale.z) / 3.0f;
-						particle.m_scale = localScale * particleScaleFactor;
+						m_particlePool->GetScales()[particleIndex] = localScale * particleScaleFactor;
 
 						//transform the velocity into world space.
-						particle.m_velocity = Core::Vector3::Rotate(((localDirection * localSpeed) * in_emissionScale), in_emissionOrientation);
+						m_particlePool->GetVelocities()[particleIndex] = Core::Vector3::Rotate(((localDirection * localSpeed) * in_emissionScale), in_emissionOrientation);
 						break;
 					}
 					case ParticleEffect::SimulationSpace::k_local:
 					{
-						particle.m_position = localPosition;
-						particle.m_scale = localScale;
-						particle.m_velocity = localDirection * localSpeed;
+						m_particlePool->GetPositions()[particleIndex] = localPosition;
+						m_particlePool->GetScales()[particleIndex] = localScale;
+						m_particlePool->GetVelocities()[particleIndex] = localDirection * localSpeed;
 						break;
 					}
 					default:
@@ -233,12 +227,12 @@ namespace ChilliSource
 				}
 
 				//apply the remaining properties.
-				particle.m_lifetime = particleEffect->GetLifetimeProperty()->GenerateValue(in_normalisedEmissionTime);
-				particle.m_energy = particle.m_lifetime;
-				particle.m_colour = particleEffect->GetInitialColourProperty()->GenerateValue(in_normalisedEmissionTime);
-				particle.m_rotation = localRotation;
-				particle.m_angularVelocity = particleEffect->GetInitialAngularVelocityProperty()->GenerateValue(in_normalisedEmissionTime);
-				particle.m_isActive = true;
+				f32 lifetime = particleEffect->GetLifetimeProperty()->GenerateValue(in_normalisedEmissionTime);
+				m_particlePool->GetLifetimes()[particleIndex] = lifetime;
+				m_particlePool->GetEnergies()[particleIndex] = lifetime;
+				m_particlePool->GetColours()[particleIndex] = particleEffect->GetInitialColourProperty()->GenerateValue(in_normalisedEmissionTime);
+				m_particlePool->GetRotations()[particleIndex] = localRotation;
+				m_particlePool->GetAngularVelocities()[particleIndex] = particleEffect->GetInitialAngularVelocityProperty()->GenerateValue(in_normalisedEmissionTime);
 			}
 		}
 	}
@@ -60,9 +60,9 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle emitter definition.
-			/// @param The particle array.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			ParticleEmitter(const ParticleEmitterDef* in_particleEmitter, Core::dynamic_array<Particle>* in_particleArray);
+			ParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticlePool* in_particlePool);
 			//----------------------------------------------------------------
 			/// Tries to emit new particles if required. This will be called 
 			/// as part of a background task.
@@ -128,8 +128,7 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			std::vector<u32> TryEmitBurst(f32 in_playbackTime, const Core::Vector3& in_emitterPosition, const Core::Vector3& in_emitterScale, const Core::Quaternion& in_emitterOrientation);
 			//----------------------------------------------------------------
-			/// Emits a new particle if the next particle in the list is free
-			/// to be emitted. 
+			/// Emits a new particle if the particle pool isn't full.
 			///
 			/// @author Ian Copland
 			/// 
@@ -148,14 +147,13 @@ namespace ChilliSource
 			void Emit(f32 in_normalisedEmissionTime, const Core::Vector3& in_emissionPosition, const Core::Vector3& in_emissionScale, const Core::Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles);
 
 			const ParticleEmitterDef* m_emitterDef = nullptr;
-			Core::dynamic_array<Particle>* m_particleArray = nullptr;
+			ParticlePool* m_particlePool = nullptr;
 
 			Core::Vector3 m_emissionPosition;
 			Core::Vector3 m_emissionScale;
 			Core::Quaternion m_emissionOrientation;
 			f32 m_emissionTime = 0.0f;
 			bool m_hasEmitted = false;
-			u32 m_nextParticleIndex = 0;
 		};
 	}
 }
@@ -38,8 +38,8 @@ namespace ChilliSource
 	{
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		PointParticleEmitter::PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleEmitter(in_particleEmitter, in_particleArray)
+		PointParticleEmitter::PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticlePool* in_particlePool)
+			: ParticleEmitter(in_particleEmitter, in_particlePool)
 		{
 		}
 		//----------------------------------------------------------------
@@ -54,8 +54,8 @@ namespace ChilliSource
 
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		SphereParticleEmitter::SphereParticleEmitter(const ParticleEmitterDef* in_particleEmitter, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleEmitter(in_particleEmitter, in_particleArray)
+		SphereParticleEmitter::SphereParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticlePool* in_particlePool)
+			: ParticleEmitter(in_particleEmitter, in_particlePool)
 		{
 			//Only the sphere emitter def can create this, so this is safe.
 			m_sphereParticleEmitterDef = static_cast<const SphereParticleEmitterDef*>(in_particleEmitter);
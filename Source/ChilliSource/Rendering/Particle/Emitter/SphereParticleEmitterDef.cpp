@@ -147,9 +147,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleEmitterUPtr SphereParticleEmitterDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleEmitterUPtr SphereParticleEmitterDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleEmitterUPtr(new SphereParticleEmitter(this, in_particleArray));
+			return ParticleEmitterUPtr(new SphereParticleEmitter(this, in_particlePool));
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
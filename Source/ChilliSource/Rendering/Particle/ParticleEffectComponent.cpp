@@ -29,15 +29,14 @@
 #include <ChilliSource/Rendering/Particle/ParticleEffectComponent.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/State/State.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
@@ -79,39 +78,37 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle effect.
-			/// @param The array of particles.
+			/// @param The particle pool.
 			/// 
 			/// @return a pair containing the AABB and the Bounding Sphere.
 			//----------------------------------------------------------------
-			std::pair<Core::AABB, Core::Sphere> CalculateBoundingShapes(const ParticleEffect* in_particleEffect, const Core::dynamic_array<Particle>* in_particleArray)
+			std::pair<Core::AABB, Core::Sphere> CalculateBoundingShapes(const ParticleEffect* in_particleEffect, const ParticlePool* in_particlePool)
 			{
 				Core::Vector3 min = CSCore::Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
 				Core::Vector3 max = CSCore::Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
 
-				bool anyActive = false;
-				for (const auto& particle : *in_particleArray)
+				const u32 numParticles = in_particlePool->GetNumActiveParticles();
+				const Core::Vector3* positions = in_particlePool->GetPositions();
+				for (u32 i = 0; i < numParticles; ++i)
 				{
-					if (particle.m_isActive == true)
-					{
-						anyActive = true;
-
-						if (particle.m_position.x < min.x)
-							min.x = particle.m_position.x;
-						if (particle.m_position.y < min.y)
-							min.y = particle.m_position.y;
-						if (particle.m_position.z < min.z)
-							min.z = particle.m_position.z;
-
-						if (particle.m_position.x > max.x)
-							max.x = particle.m_position.x;
-						if (particle.m_position.y > max.y)
-							max.y = particle.m_position.y;
-						if (particle.m_position.z > max.z)
-							max.z = particle.m_position.z;
-					}
+					const Core::Vector3& position = positions[i];
+
+					if (position.x < min.x)
+						min.x = position.x;
+					if (position.y < min.y)
+						min.y = position.y;
+					if (position.z < min.z)
+						min.z = position.z;
+
+					if (position.x > max.x)
+						max.x = position.x;
+					if (position.y > max.y)
+						max.y = position.y;
+					if (position.z > max.z)
+						max.z = position.z;
 				}
 
-				if (anyActive == false)
+				if (numParticles == 0)
 				{
 					min = CSCore::Vector3::k_zero;
 					max = CSCore::Vector3::k_zero;
@@ -135,7 +132,7 @@ namespace ChilliSource
 			/// @param The particle emitter. If null, the effect is no longer
 			/// emitting.
 			/// @param The list of particle affectors.
-			/// @param The array of particles.
+			/// @param The particle pool.
 			/// @param The particle draw data array.
 			/// @param The playback time.
 			/// @param The delta time.
@@ -146,32 +143,40 @@ namespace ChilliSource
 			/// of emission since the last frame.
 			//----------------------------------------------------------------
 			void ParticleUpdateTask(ParticleEffectCSPtr in_particleEffect, ParticleEmitterSPtr in_particleEmitter, std::vector<ParticleAffectorSPtr> in_particleAffectors, 
-				std::shared_ptr<Core::dynamic_array<Particle>> in_particleArray, ConcurrentParticleDataSPtr in_concurrentParticleData, f32 in_playbackTime, 
+				std::shared_ptr<ParticlePool> in_particlePool, ConcurrentParticleDataSPtr in_concurrentParticleData, f32 in_playbackTime, 
 				f32 in_deltaTime, Core::Vector3 in_entityPosition, Core::Vector3 in_entityScale, Core::Quaternion in_entityOrientation, bool in_interpolateEmission)
 			{
 				CS_ASSERT(in_particleEffect != nullptr, "Cannot update particles with null particle effect.");
-				CS_ASSERT(in_particleArray != nullptr, "Cannot update particles with null particle array.");
+				CS_ASSERT(in_particlePool != nullptr, "Cannot update particles with null particle pool.");
 				CS_ASSERT(in_concurrentParticleData != nullptr, "Cannot update particles with null concurrent particle data.");
 
-				//update the particles
-				for (auto& particle : *in_particleArray)
+				//remove any particles that have expired. The last active particle is moved into the place of the removed particle
+				//to keep the active particles densely packed, so the affectors need to be informed of the move.
+				f32* energies = in_particlePool->GetEnergies();
+				u32 particleIndex = 0;
+				while (particleIndex < in_particlePool->GetNumActiveParticles())
 				{
-					if (particle.m_isActive == true)
+					energies[particleIndex] -= in_deltaTime;
+					if (energies[particleIndex] > 0.0f)
 					{
-						particle.m_energy -= in_deltaTime;
-						if (particle.m_energy > 0.0f)
-						{
-							particle.m_position += particle.m_velocity * in_deltaTime;
-							particle.m_rotation += particle.m_angularVelocity * in_deltaTime;
-						}
-						else
+						++particleIndex;
+					}
+					else
+					{
+						u32 movedFromIndex = in_particlePool->DeactivateParticle(particleIndex);
+						if (movedFromIndex != particleIndex)
 						{
-							particle.m_energy = 0.0f;
-							particle.m_isActive = false;
+							for (auto& affector : in_particleAffectors)
+							{
+								affector->MoveParticle(movedFromIndex, particleIndex);
+							}
 						}
 					}
 				}
 
+				//update the remaining particles
+				in_particlePool->IntegrateParticles(in_deltaTime);
+
                 //calculate the normalised playback progress.
                 const f32 effectProgress = in_playbackTime / in_particleEffect->GetDuration();
                 
@@ -197,8 +202,8 @@ namespace ChilliSource
 					}
 				}
 
-				auto boundingShapes = CalculateBoundingShapes(in_particleEffect.get(), in_particleArray.get());
-				in_concurrentParticleData->CommitParticleData(in_particleArray.get(), newIndices, boundingShapes.first, boundingShapes.second);
+				auto boundingShapes = CalculateBoundingShapes(in_particleEffect.get(), in_particlePool.get());
+				in_concurrentParticleData->CommitParticleData(in_particlePool.get(), newIndices, boundingShapes.first, boundingShapes.second);
 			}
 		}
 		CS_DEFINE_NAMEDTYPE(ParticleEffectComponent);
@@ -373,19 +378,19 @@ namespace ChilliSource
 			{
 				ValidateParticleEffect(m_particleEffect);
 
-				m_particleArray = std::make_shared<Core::dynamic_array<Particle>>(m_particleEffect->GetMaxParticles());
+				m_particlePool = std::make_shared<ParticlePool>(m_particleEffect->GetMaxParticles());
 				m_concurrentParticleData = std::make_shared<ConcurrentParticleData>(m_particleEffect->GetMaxParticles());
 
 				m_drawable = m_particleEffect->GetDrawableDef()->CreateInstance(GetEntity(), m_concurrentParticleData.get());
 				CS_ASSERT(m_drawable != nullptr, "Failed to create particle drawable.");
 
-				m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(m_particleArray.get());
+				m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(m_particlePool.get());
 				CS_ASSERT(m_emitter != nullptr, "Failed to create particle emitter.");
 
 				const std::vector<const ParticleAffectorDef*> affectorDefs = m_particleEffect->GetAffectorDefs();
 				for (const auto& affectorDef : affectorDefs)
 				{
-					ParticleAffectorSPtr affector = affectorDef->CreateInstance(m_particleArray.get());
+					ParticleAffectorSPtr affector = affectorDef->CreateInstance(m_particlePool.get());
 					CS_ASSERT(affector != nullptr, "Failed to create particle emitter.");
 
 					m_affectors.push_back(affector);
@@ -403,7 +408,7 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		void ParticleEffectComponent::CleanupParticleEffect()
 		{
-			m_particleArray.reset();
+			m_particlePool.reset();
 			m_concurrentParticleData.reset();
 			m_drawable.reset();
 			m_emitter.reset();
@@ -418,6 +423,7 @@ namespace ChilliSource
 			m_localAABB = m_concurrentParticleData->GetAABB();
 			m_localBoundingSphere = m_concurrentParticleData->GetBoundingSphere();
 			m_invalidateBoundingShapeCache = true;
+			InvalidateVolume();
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
@@ -490,7 +496,7 @@ namespace ChilliSource
 		{
 			PrepareParticleEffect();
 
-			m_entityTransformConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &ParticleEffectComponent::OnEntityTransformChanged));
+			m_entityTransformConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeInlineDelegate(this, &ParticleEffectComponent::OnEntityTransformChanged));
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -504,6 +510,13 @@ namespace ChilliSource
 		{
 			if (m_particleEffect != nullptr)
 			{
+				//Pick up the latest particle data once per frame, so the bounds and the drawn particles always
+				//come from the same update.
+				if (m_concurrentParticleData != nullptr)
+				{
+					m_concurrentParticleData->AcquireLatestData();
+				}
+
 				switch (m_playbackState)
 				{
 				case PlaybackState::k_notPlaying:
@@ -531,11 +544,8 @@ namespace ChilliSource
 			if (m_concurrentParticleData->StartUpdate() == true)
 			{
 				//intialise the particles by disabling them all.
-				for (auto& particle : *m_particleArray)
-				{
-					particle.m_isActive = false;
-				}
-				m_concurrentParticleData->CommitParticleData(m_particleArray.get(), std::vector<u32>(), Core::AABB(), Core::Sphere());
+				m_particlePool->DeactivateAllParticles();
+				m_concurrentParticleData->CommitParticleData(m_particlePool.get(), std::vector<u32>(), Core::AABB(), Core::Sphere());
 
 				m_playbackState = PlaybackState::k_playing;
 				UpdatePlayingState(in_deltaTime);
@@ -573,7 +583,7 @@ namespace ChilliSource
 				StoreLocalBoundingShapes();
 
 				bool shouldInterpolateEmission = (m_firstFrame == false);
-				Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, m_emitter, m_affectors, m_particleArray, m_concurrentParticleData,
+				Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, m_emitter, m_affectors, m_particlePool, m_concurrentParticleData,
 					m_playbackTimer, m_accumulatedDeltaTime, GetEntity()->GetTransform().GetWorldPosition(), GetEntity()->GetTransform().GetWorldScale(), GetEntity()->GetTransform().GetWorldOrientation(), shouldInterpolateEmission));
 
 				m_firstFrame = false;
@@ -596,7 +606,7 @@ namespace ChilliSource
 					StoreLocalBoundingShapes();
 
 					bool shouldInterpolateEmission = (m_firstFrame == false);
-					Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, nullptr, m_affectors, m_particleArray, m_concurrentParticleData,
+					Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, nullptr, m_affectors, m_particlePool, m_concurrentParticleData,
 						m_playbackTimer, m_accumulatedDeltaTime, GetEntity()->GetTransform().GetWorldPosition(), GetEntity()->GetTransform().GetWorldScale(), GetEntity()->GetTransform().GetWorldOrientation(), shouldInterpolateEmission));
 
 					m_firstFrame = false;
@@ -606,13 +616,13 @@ namespace ChilliSource
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
-		void ParticleEffectComponent::Render(RenderSystem* in_renderSystem, CameraComponent* in_camera, ShaderPass in_shaderPass)
+		void ParticleEffectComponent::Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* in_camera, ShaderPass in_shaderPass)
 		{
 			if (m_particleEffect != nullptr && (m_playbackState == PlaybackState::k_playing || m_playbackState == PlaybackState::k_stopping))
 			{
 				CS_ASSERT(m_drawable != nullptr, "Cannot render without a drawable.");
 
-				m_drawable->Draw(in_camera);
+				m_drawable->Draw(in_camera, in_commandBuffer);
 			}
 		}
 		//----------------------------------------------------------------
@@ -348,11 +348,11 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland
 			///
-			/// @param The render system.
+			/// @param The command buffer to record into.
 			/// @param The active camera component.
 			/// @param The current shader pass.
 			//----------------------------------------------------------------
-			void Render(RenderSystem* in_renderSystem, CameraComponent* in_camera, ShaderPass in_shaderPass) override;
+			void Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* in_camera, ShaderPass in_shaderPass) override;
 			//----------------------------------------------------------------
 			/// Called when the component should render to the shadow map. 
 			/// Particles will never render to the shadow map so this does 
@@ -360,12 +360,12 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland
 			///
-			/// @param The render system.
+			/// @param The command buffer to record into.
 			/// @param The active camera component.
 			/// @param The material to render static shadows with.
 			/// @param The material to render skinned shadows with.
 			//----------------------------------------------------------------
-			void RenderShadowMap(RenderSystem* in_renderSystem, CameraComponent* in_camera, const MaterialCSPtr& in_staticShadowMat, const MaterialCSPtr& in_animShadowMat) override {};
+			void RenderShadowMap(RenderCommandBuffer* in_commandBuffer, CameraComponent* in_camera, const MaterialCSPtr& in_staticShadowMat, const MaterialCSPtr& in_animShadowMat) override {};
 			//----------------------------------------------------------------
 			/// Called when the entities transform changes. This invalidates
 			/// the bounding shape cache.
@@ -393,7 +393,7 @@ namespace ChilliSource
 			ParticleDrawableUPtr m_drawable;
 			ParticleEmitterSPtr m_emitter;
 			std::vector<ParticleAffectorSPtr> m_affectors;
-			std::shared_ptr<Core::dynamic_array<Particle>> m_particleArray;
+			std::shared_ptr<ParticlePool> m_particlePool;
 			ConcurrentParticleDataSPtr m_concurrentParticleData;
 
 			PlaybackType m_playbackType = PlaybackType::k_once;
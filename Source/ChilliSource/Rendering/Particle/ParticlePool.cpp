@@ -0,0 +1,233 @@
+//
+//  ParticlePool.cpp
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		static_assert(sizeof(Core::Vector3) == 3 * sizeof(f32), "Particle kernels require Vector3 to be tightly packed.");
+
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		ParticlePool::ParticlePool(u32 in_capacity)
+			: m_ids(in_capacity), m_freeIds(in_capacity), m_lifetimes(in_capacity), m_energies(in_capacity), m_positions(in_capacity), m_scales(in_capacity), 
+			m_rotations(in_capacity), m_colours(in_capacity), m_velocities(in_capacity), m_angularVelocities(in_capacity)
+		{
+			DeactivateAllParticles();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::GetCapacity() const
+		{
+			return static_cast<u32>(m_ids.size());
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::GetNumActiveParticles() const
+		{
+			return m_numActiveParticles;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		bool ParticlePool::IsFull() const
+		{
+			return (m_numActiveParticles == GetCapacity());
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::ActivateParticle()
+		{
+			CS_ASSERT(IsFull() == false, "Cannot activate a particle in a full particle pool.");
+
+			//free ids are stored in the same array slots as inactive particles, so the next free id is always at the end of the active range.
+			u32 index = m_numActiveParticles++;
+			m_ids[index] = m_freeIds[index];
+			return index;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::DeactivateParticle(u32 in_index)
+		{
+			CS_ASSERT(in_index < m_numActiveParticles, "Cannot deactivate a particle which isn't active.");
+
+			u32 lastIndex = --m_numActiveParticles;
+			u32 id = m_ids[in_index];
+
+			if (in_index != lastIndex)
+			{
+				m_ids[in_index] = m_ids[lastIndex];
+				m_lifetimes[in_index] = m_lifetimes[lastIndex];
+				m_energies[in_index] = m_energies[lastIndex];
+				m_positions[in_index] = m_positions[lastIndex];
+				m_scales[in_index] = m_scales[lastIndex];
+				m_rotations[in_index] = m_rotations[lastIndex];
+				m_colours[in_index] = m_colours[lastIndex];
+				m_velocities[in_index] = m_velocities[lastIndex];
+				m_angularVelocities[in_index] = m_angularVelocities[lastIndex];
+			}
+
+			m_freeIds[lastIndex] = id;
+			return lastIndex;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void ParticlePool::DeactivateAllParticles()
+		{
+			m_numActiveParticles = 0;
+
+			for (u32 i = 0; i < m_freeIds.size(); ++i)
+			{
+				m_freeIds[i] = i;
+			}
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void ParticlePool::IntegrateParticles(f32 in_deltaTime)
+		{
+			//positions and velocities are treated as flat arrays of floats so the loop is a simple multiply-add the compiler can vectorise.
+			const u32 numPositionComponents = m_numActiveParticles * 3;
+			f32* positions = reinterpret_cast<f32*>(m_positions.data());
+			const f32* velocities = reinterpret_cast<const f32*>(m_velocities.data());
+			for (u32 i = 0; i < numPositionComponents; ++i)
+			{
+				positions[i] += velocities[i] * in_deltaTime;
+			}
+
+			f32* rotations = m_rotations.data();
+			const f32* angularVelocities = m_angularVelocities.data();
+			for (u32 i = 0; i < m_numActiveParticles; ++i)
+			{
+				rotations[i] += angularVelocities[i] * in_deltaTime;
+			}
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const u32* ParticlePool::GetIds() const
+		{
+			return m_ids.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		f32* ParticlePool::GetLifetimes()
+		{
+			return m_lifetimes.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const f32* ParticlePool::GetLifetimes() const
+		{
+			return m_lifetimes.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		f32* ParticlePool::GetEnergies()
+		{
+			return m_energies.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const f32* ParticlePool::GetEnergies() const
+		{
+			return m_energies.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		Core::Vector3* ParticlePool::GetPositions()
+		{
+			return m_positions.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const Core::Vector3* ParticlePool::GetPositions() const
+		{
+			return m_positions.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		Core::Vector2* ParticlePool::GetScales()
+		{
+			return m_scales.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const Core::Vector2* ParticlePool::GetScales() const
+		{
+			return m_scales.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		f32* ParticlePool::GetRotations()
+		{
+			return m_rotations.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const f32* ParticlePool::GetRotations() const
+		{
+			return m_rotations.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		Core::Colour* ParticlePool::GetColours()
+		{
+			return m_colours.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const Core::Colour* ParticlePool::GetColours() const
+		{
+			return m_colours.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		Core::Vector3* ParticlePool::GetVelocities()
+		{
+			return m_velocities.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const Core::Vector3* ParticlePool::GetVelocities() const
+		{
+			return m_velocities.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		f32* ParticlePool::GetAngularVelocities()
+		{
+			return m_angularVelocities.data();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const f32* ParticlePool::GetAngularVelocities() const
+		{
+			return m_angularVelocities.data();
+		}
+	}
+}
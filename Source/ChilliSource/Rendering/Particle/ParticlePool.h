@@ -0,0 +1,250 @@
+//
+//  ParticlePool.h
+//  Chilli Source
+//  Created by Jordan Brown on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEPOOL_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEPOOL_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//-----------------------------------------------------------------------
+		/// Storage for the particles in a single particle effect. Each particle
+		/// property is stored in its own array, and active particles are kept 
+		/// densely packed at the start of the arrays: when a particle is 
+		/// deactivated the last active particle is moved into its place. This 
+		/// means updates only touch live particles and each loop over a property
+		/// reads contiguous memory, which the compiler can vectorise.
+		///
+		/// As particles move when others are deactivated, their index is not 
+		/// stable. Each particle is also given an Id on activation which stays
+		/// the same for the rest of its life, and can be used for indexing data
+		/// outside of the pool.
+		///
+		/// Particle pools are updated as part of a background task and should 
+		/// not be accessed from other threads.
+		///
+		/// @author Jordan Brown
+		//-----------------------------------------------------------------------
+		class ParticlePool final
+		{
+		public:
+			CS_DECLARE_NOCOPY(ParticlePool);
+			//----------------------------------------------------------------
+			/// Constructor.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The maximum number of particles.
+			//----------------------------------------------------------------
+			ParticlePool(u32 in_capacity);
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The maximum number of particles.
+			//----------------------------------------------------------------
+			u32 GetCapacity() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The number of active particles. These occupy indices 
+			/// 0 to this value.
+			//----------------------------------------------------------------
+			u32 GetNumActiveParticles() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return Whether or not all particles are active.
+			//----------------------------------------------------------------
+			bool IsFull() const;
+			//----------------------------------------------------------------
+			/// Activates a new particle at the end of the active range and
+			/// assigns it an unused Id. The particle's other properties are
+			/// left for the caller to initialise. The pool must not be full.
+			///
+			/// @author Jordan Brown
+			///
+			/// @return The index of the new particle.
+			//----------------------------------------------------------------
+			u32 ActivateParticle();
+			//----------------------------------------------------------------
+			/// Deactivates the particle at the given index, moving the last
+			/// active particle into its place.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The index of the particle to deactivate.
+			///
+			/// @return The previous index of the particle that was moved into
+			/// the given index. If the deactivated particle was the last 
+			/// active particle nothing is moved and the given index is 
+			/// returned.
+			//----------------------------------------------------------------
+			u32 DeactivateParticle(u32 in_index);
+			//----------------------------------------------------------------
+			/// Deactivates all particles.
+			///
+			/// @author Jordan Brown
+			//----------------------------------------------------------------
+			void DeactivateAllParticles();
+			//----------------------------------------------------------------
+			/// Moves and rotates all active particles by their velocity and
+			/// angular velocity.
+			///
+			/// @author Jordan Brown
+			///
+			/// @param The delta time.
+			//----------------------------------------------------------------
+			void IntegrateParticles(f32 in_deltaTime);
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The Id of each particle.
+			//----------------------------------------------------------------
+			const u32* GetIds() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The total lifetime of each particle.
+			//----------------------------------------------------------------
+			f32* GetLifetimes();
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The total lifetime of each particle.
+			//----------------------------------------------------------------
+			const f32* GetLifetimes() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The remaining lifetime of each particle.
+			//----------------------------------------------------------------
+			f32* GetEnergies();
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The remaining lifetime of each particle.
+			//----------------------------------------------------------------
+			const f32* GetEnergies() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The position of each particle.
+			//----------------------------------------------------------------
+			Core::Vector3* GetPositions();
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The position of each particle.
+			//----------------------------------------------------------------
+			const Core::Vector3* GetPositions() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The scale of each particle.
+			//----------------------------------------------------------------
+			Core::Vector2* GetScales();
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The scale of each particle.
+			//----------------------------------------------------------------
+			const Core::Vector2* GetScales() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The rotation of each particle.
+			//----------------------------------------------------------------
+			f32* GetRotations();
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The rotation of each particle.
+			//----------------------------------------------------------------
+			const f32* GetRotations() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The colour of each particle.
+			//----------------------------------------------------------------
+			Core::Colour* GetColours();
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The colour of each particle.
+			//----------------------------------------------------------------
+			const Core::Colour* GetColours() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The velocity of each particle.
+			//----------------------------------------------------------------
+			Core::Vector3* GetVelocities();
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The velocity of each particle.
+			//----------------------------------------------------------------
+			const Core::Vector3* GetVelocities() const;
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The angular velocity of each particle.
+			//----------------------------------------------------------------
+			f32* GetAngularVelocities();
+			//----------------------------------------------------------------
+			/// @author Jordan Brown
+			///
+			/// @return The angular velocity of each particle.
+			//----------------------------------------------------------------
+			const f32* GetAngularVelocities() const;
+
+		private:
+			u32 m_numActiveParticles = 0;
+
+			Core::dynamic_array<u32> m_ids;
+			Core::dynamic_array<u32> m_freeIds;
+			Core::dynamic_array<f32> m_lifetimes;
+			Core::dynamic_array<f32> m_energies;
+			Core::dynamic_array<Core::Vector3> m_positions;
+			Core::dynamic_array<Core::Vector2> m_scales;
+			Core::dynamic_array<f32> m_rotations;
+			Core::dynamic_array<Core::Colour> m_colours;
+			Core::dynamic_array<Core::Vector3> m_velocities;
+			Core::dynamic_array<f32> m_angularVelocities;
+		};
+	}
+}
+
+#endif
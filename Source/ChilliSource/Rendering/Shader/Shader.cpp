@@ -28,7 +28,9 @@
 
 #include <ChilliSource/Rendering/Shader/Shader.h>
 
-#if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
+#if defined(CS_RENDERBACKEND_NULL)
+#include <CSBackend/Rendering/Null/Shader/Shader.h>
+#elif defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
 #include <CSBackend/Rendering/OpenGL/Shader/Shader.h>
 #endif
 
@@ -41,7 +43,9 @@ namespace ChilliSource
         //----------------------------------------------------------
         ShaderUPtr Shader::Create()
         {
-#if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
+#if defined(CS_RENDERBACKEND_NULL)
+            return ShaderUPtr(new CSBackend::Null::Shader());
+#elif defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
             return ShaderUPtr(new CSBackend::OpenGL::Shader());
 #else
             return nullptr;
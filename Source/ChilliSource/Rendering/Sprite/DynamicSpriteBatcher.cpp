@@ -28,16 +28,26 @@
 
 #include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
 
+#include <ChilliSource/Core/Base/AppConfig.h>
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Math/MathUtils.h>
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace ChilliSource
 {
 	namespace Rendering
 	{	
-        const u32 kudwMaxSpritesInDynamicBatch = 512;
+        namespace
+        {
+            //The number of flushes worth of sprites the ring buffer holds.
+            const u32 k_numRingFlushes = 4;
+            //The sprite batch holds one more sprite than its capacity and must be addressable with 16-bit indices.
+            const u32 k_maxRingCapacity = (65536 / k_numSpriteVerts) - 1;
+        }
         
 		//-------------------------------------------------------
 		/// Constructor
@@ -45,16 +55,40 @@ namespace ChilliSource
 		/// Default
 		//-------------------------------------------------------
 		DynamicSpriteBatch::DynamicSpriteBatch(RenderSystem* inpRenderSystem) 
-        : m_renderSystem(inpRenderSystem), mudwCurrentRenderSpriteBatch(0), mudwSpriteCommandCounter(0)
+        : m_mappedVertices(nullptr), m_ringPosition(0), m_numBatchedSprites(0), m_currentLayer(0), m_materialSortingEnabled(false), m_renderSystem(inpRenderSystem)
 		{
-            for(u32 i=0; i<kudwNumBuffers; ++i)
-            {
-                mpBatch[i] = new SpriteBatch(kudwMaxSpritesInDynamicBatch, inpRenderSystem, BufferUsage::k_dynamic);
-            }
+            m_batchCapacity = Core::Application::Get()->GetAppConfig()->GetDynamicSpriteBatchCapacity();
+            m_batchCapacity = Core::MathUtils::Clamp(m_batchCapacity, 1u, k_maxRingCapacity);
+            m_ringCapacity = std::min(m_batchCapacity * k_numRingFlushes, k_maxRingCapacity);
+            
+            m_batch = new SpriteBatch(m_ringCapacity, inpRenderSystem, BufferUsage::k_dynamic, BufferAccess::k_writeNoOverwrite);
             
             maRenderCommands.reserve(50);
 		}
         //-------------------------------------------------------
+        //-------------------------------------------------------
+        DynamicSpriteBatch::MaterialHandle DynamicSpriteBatch::GetMaterialHandle(const MaterialCSPtr& in_material)
+        {
+            CS_ASSERT(in_material != nullptr, "Cannot get a handle to a null material.");
+            
+            //Consecutive sprites usually share a material, so check the most recent one first.
+            if(m_materials.empty() == false && m_materials.back().get() == in_material.get())
+            {
+                return static_cast<MaterialHandle>(m_materials.size() - 1);
+            }
+            
+            auto it = m_materialHandles.find(in_material.get());
+            if(it != m_materialHandles.end())
+            {
+                return it->second;
+            }
+            
+            MaterialHandle handle = static_cast<MaterialHandle>(m_materials.size());
+            m_materials.push_back(in_material);
+            m_materialHandles.insert(std::make_pair(in_material.get(), handle));
+            return handle;
+        }
+        //-------------------------------------------------------
         /// Render
         ///
         /// Batch the sprite to be rendered later. Track the 
@@ -66,34 +100,98 @@ namespace ChilliSource
         //-------------------------------------------------------
 		void DynamicSpriteBatch::Render(const SpriteBatch::SpriteData& inpSprite, const Core::Matrix4 * inpTransform)
 		{
-            //If we exceed the capacity of the buffer then we will be forced to flush it
-            if(maSpriteCache.size() >= kudwMaxSpritesInDynamicBatch)
+            Render(GetMaterialHandle(inpSprite.pMaterial), inpSprite.sVerts, inpTransform);
+		}
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void DynamicSpriteBatch::Render(MaterialHandle in_material, const SpriteBatch::SpriteVertex* in_vertices, const Core::Matrix4* in_transform)
+        {
+            CS_ASSERT(in_material < m_materials.size(), "Invalid material handle.");
+            
+            //If we exceed the capacity of the buffer then we will be forced to flush it. Material handles
+            //remain valid as they are only released by ForceRender().
+            if(m_numBatchedSprites >= m_batchCapacity)
             {
-                ForceRender();
+                BuildAndFlushBatch();
             }
             
             //As all the contents of the mesh buffer have the same vertex format we can push sprites into the buffer
             //regardless of the material. However we cannot render the buffer in a single draw call we must render
             //subsets of the buffer based on materials
-            if(mpLastMaterial && mpLastMaterial != inpSprite.pMaterial)
+            InsertDrawCommand(in_material);
+            
+            SpriteBatch::SpriteVertex* vertices = AllocateSpriteVertices();
+            if(in_transform)
+            {
+                for(u32 i = 0; i < k_numSpriteVerts; i++)
+                {
+                    vertices[i].vPos = in_vertices[i].vPos * *in_transform;
+                    vertices[i].vTex = in_vertices[i].vTex;
+                    vertices[i].Col = in_vertices[i].Col;
+                }
+            }
+            else
             {
-                InsertDrawCommand();
+                memcpy(vertices, in_vertices, sizeof(SpriteBatch::SpriteVertex) * k_numSpriteVerts);
             }
             
-            maSpriteCache.push_back(inpSprite);
-            if(inpTransform)
+            ++m_numBatchedSprites;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        SpriteBatch::SpriteVertex* DynamicSpriteBatch::AllocateSpriteVertices()
+        {
+            if(m_materialSortingEnabled == true)
             {
-                for(u32 i = 0; i < k_numSpriteVerts; i++)
-					maSpriteCache.back().sVerts[i].vPos = inpSprite.sVerts[i].vPos * *inpTransform;
+                m_vertices.resize(m_vertices.size() + k_numSpriteVerts);
+                return m_vertices.data() + m_vertices.size() - k_numSpriteVerts;
             }
-            mpLastMaterial = inpSprite.pMaterial;
-            ++mudwSpriteCommandCounter;
-		}
+            
+            if(m_mappedVertices == nullptr)
+            {
+                //The number of sprites in the batch isn't known yet, so map room for a full batch.
+                if(m_ringPosition + m_batchCapacity > m_ringCapacity)
+                {
+                    m_ringPosition = 0;
+                }
+                
+                m_mappedVertices = m_batch->MapVertices(m_batchCapacity, m_ringPosition);
+            }
+            
+            return m_mappedVertices + m_numBatchedSprites * k_numSpriteVerts;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void DynamicSpriteBatch::SetMaterialSortingEnabled(bool in_enabled)
+        {
+            if(m_materialSortingEnabled == in_enabled)
+            {
+                return;
+            }
+            
+            //The batched sprites are either staged or mapped depending on whether sorting is enabled.
+            if(m_numBatchedSprites > 0)
+            {
+                BuildAndFlushBatch();
+            }
+            
+            m_materialSortingEnabled = in_enabled;
+            if(m_materialSortingEnabled == true)
+            {
+                m_vertices.reserve(m_batchCapacity * k_numSpriteVerts);
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void DynamicSpriteBatch::EndLayer()
+        {
+            ++m_currentLayer;
+        }
         //-------------------------------------------------------
         //-------------------------------------------------------
         void DynamicSpriteBatch::EnableScissoring(const Core::Vector2& in_pos, const Core::Vector2& in_size)
         {
-            InsertDrawCommand();
+            EndLayer();
             
             maRenderCommands.resize(maRenderCommands.size() + 1);
             
@@ -106,7 +204,7 @@ namespace ChilliSource
         //-------------------------------------------------------
         void DynamicSpriteBatch::DisableScissoring()
         {
-            InsertDrawCommand();
+            EndLayer();
             
             maRenderCommands.resize(maRenderCommands.size() + 1);
             
@@ -115,24 +213,77 @@ namespace ChilliSource
         }
         //-------------------------------------------------------
         //-------------------------------------------------------
-		void DynamicSpriteBatch::InsertDrawCommand()
+		void DynamicSpriteBatch::InsertDrawCommand(MaterialHandle in_material)
 		{
-            if(!maSpriteCache.empty())
+            if(maRenderCommands.empty() == false)
+            {
+                RenderCommand& lastCommand = maRenderCommands.back();
+                if(lastCommand.m_type == CommandType::k_draw && lastCommand.m_material == in_material && lastCommand.m_layer == m_currentLayer)
+                {
+                    ++lastCommand.m_numSprites;
+                    return;
+                }
+            }
+            
+            maRenderCommands.resize(maRenderCommands.size() + 1);
+            
+            RenderCommand &sLastCommand = maRenderCommands.back();
+            sLastCommand.m_type = CommandType::k_draw;
+            sLastCommand.m_material = in_material;
+            sLastCommand.m_firstSprite = m_numBatchedSprites;
+            sLastCommand.m_numSprites = 1;
+            sLastCommand.m_layer = m_currentLayer;
+		}
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void DynamicSpriteBatch::SortDrawCommandsByMaterial()
+        {
+            m_sortedRenderCommands.clear();
+            m_spriteOrder.clear();
+            
+            u32 commandIndex = 0;
+            while(commandIndex < maRenderCommands.size())
             {
-                maRenderCommands.resize(maRenderCommands.size() + 1);
+                if(maRenderCommands[commandIndex].m_type != CommandType::k_draw)
+                {
+                    m_sortedRenderCommands.push_back(maRenderCommands[commandIndex++]);
+                    continue;
+                }
                 
-                RenderCommand &sLastCommand = maRenderCommands.back();
+                //find the draw commands in this layer and group them by material, keeping the submission order within each material.
+                u32 layerEnd = commandIndex + 1;
+                while(layerEnd < maRenderCommands.size() && maRenderCommands[layerEnd].m_type == CommandType::k_draw && maRenderCommands[layerEnd].m_layer == maRenderCommands[commandIndex].m_layer)
+                {
+                    ++layerEnd;
+                }
                 
-                sLastCommand.m_type = CommandType::k_draw;
-                sLastCommand.m_material = mpLastMaterial;
-                //The offset of the indices for this batch
-                sLastCommand.m_offset = ((maSpriteCache.size() - mudwSpriteCommandCounter) * k_numSpriteIndices) * sizeof(s16);
-                //The number of indices in this batch
-                sLastCommand.m_stride = mudwSpriteCommandCounter * k_numSpriteIndices;
+                std::stable_sort(maRenderCommands.begin() + commandIndex, maRenderCommands.begin() + layerEnd, [](const RenderCommand& in_a, const RenderCommand& in_b)
+                {
+                    return in_a.m_material < in_b.m_material;
+                });
                 
-                mudwSpriteCommandCounter = 0;
+                u32 layerStart = m_sortedRenderCommands.size();
+                for(; commandIndex < layerEnd; ++commandIndex)
+                {
+                    const RenderCommand& command = maRenderCommands[commandIndex];
+                    
+                    if(m_sortedRenderCommands.size() > layerStart && m_sortedRenderCommands.back().m_material == command.m_material)
+                    {
+                        m_sortedRenderCommands.back().m_numSprites += command.m_numSprites;
+                    }
+                    else
+                    {
+                        m_sortedRenderCommands.push_back(command);
+                        m_sortedRenderCommands.back().m_firstSprite = m_spriteOrder.size();
+                    }
+                    
+                    for(u32 i = 0; i < command.m_numSprites; ++i)
+                    {
+                        m_spriteOrder.push_back(command.m_firstSprite + i);
+                    }
+                }
             }
-		}
+        }
         //-------------------------------------------------------
         /// Force Render
         ///
@@ -143,40 +294,77 @@ namespace ChilliSource
         //-------------------------------------------------------
         void DynamicSpriteBatch::ForceRender()
         {
-            if(!maSpriteCache.empty())
+            if(m_numBatchedSprites > 0)
             {
-                //Close off the batch
-                InsertDrawCommand();
-                
-                //Copy geometry into the mesh buffer and render
+                //Finish writing the geometry into the mesh buffer and render
                 BuildAndFlushBatch();
             }
+            
+            m_materials.clear();
+            m_materialHandles.clear();
         }
         //----------------------------------------------------------
         /// Build and Flush Batch
         ///
-        /// Map the batch into the mesh buffer and present the
-        /// contents. This will then swap the active buffer
-        /// so that it can be filled while the other one is 
-        /// rendering
+        /// Finish writing the batch into the mesh buffer and
+        /// present the contents. The next batch is written to a
+        /// different range of the ring buffer so that it can be
+        /// filled while this one is rendering
         //----------------------------------------------------------
 		void DynamicSpriteBatch::BuildAndFlushBatch()
         {
-            if(!maSpriteCache.empty())
+            const bool sortByMaterial = (m_materialSortingEnabled == true && maRenderCommands.size() > 1);
+            if(sortByMaterial == true)
+            {
+                SortDrawCommandsByMaterial();
+            }
+            
+            const std::vector<RenderCommand>& renderCommands = (sortByMaterial == true) ? m_sortedRenderCommands : maRenderCommands;
+            
+            const u32 numSprites = m_numBatchedSprites;
+            
+            if(m_mappedVertices != nullptr)
+            {
+                //The vertices were written straight into the ring buffer as they were batched.
+                m_batch->UnmapVertices(numSprites);
+                m_mappedVertices = nullptr;
+            }
+            else if(m_vertices.empty() == false)
             {
-                //Build the next buffer
-                mpBatch[mudwCurrentRenderSpriteBatch]->Build(maSpriteCache);
-                maSpriteCache.clear();
-            }   
+                if(m_ringPosition + numSprites > m_ringCapacity)
+                {
+                    m_ringPosition = 0;
+                }
+                
+                //Copy the staged vertices into the next free range of the ring buffer, in the order they will be drawn.
+                SpriteBatch::SpriteVertex* vertexBuffer = m_batch->MapVertices(numSprites, m_ringPosition);
+                
+                if(sortByMaterial == true)
+                {
+                    for(u32 i = 0; i < numSprites; ++i)
+                    {
+                        memcpy(vertexBuffer + i * k_numSpriteVerts, m_vertices.data() + m_spriteOrder[i] * k_numSpriteVerts, sizeof(SpriteBatch::SpriteVertex) * k_numSpriteVerts);
+                    }
+                }
+                else
+                {
+                    memcpy(vertexBuffer, m_vertices.data(), sizeof(SpriteBatch::SpriteVertex) * m_vertices.size());
+                }
+                
+                m_batch->UnmapVertices(numSprites);
+                m_vertices.clear();
+            }
             
             //Loop round all the render commands and draw the sections of the buffer with the correct material
-            for(auto it = maRenderCommands.begin(); it != maRenderCommands.end(); ++it)
+            u32 numDrawCommands = 0;
+            for(auto it = renderCommands.begin(); it != renderCommands.end(); ++it)
             {
                 switch(it->m_type)
                 {
                 case CommandType::k_draw:
-                    //Render the last filled buffer
-                    mpBatch[mudwCurrentRenderSpriteBatch]->Render(it->m_material, it->m_offset, it->m_stride);
+                    //Render the range of the ring buffer that was just filled
+                    m_batch->Render(m_materials[it->m_material], (m_ringPosition + it->m_firstSprite) * k_numSpriteIndices * sizeof(u16), it->m_numSprites * k_numSpriteIndices);
+                    ++numDrawCommands;
                     break;
                 case CommandType::k_scissorOn:
                     m_renderSystem->EnableScissorTesting(true);
@@ -190,20 +378,24 @@ namespace ChilliSource
             }
                 
             maRenderCommands.clear();
-            mpLastMaterial.reset();
-                
-            //Swap the buffers
-            mudwCurrentRenderSpriteBatch = (mudwCurrentRenderSpriteBatch + 1) % kudwNumBuffers;
+            m_sortedRenderCommands.clear();
+            m_currentLayer = 0;
+            
+            m_ringPosition += numSprites;
+            m_numBatchedSprites = 0;
+            m_renderSystem->RecordSpriteBatchFlush(numSprites, numDrawCommands);
 		}
         //----------------------------------------------------------
         /// Destructor
         //----------------------------------------------------------
         DynamicSpriteBatch::~DynamicSpriteBatch()
         {
-            for(u32 i=0; i<kudwNumBuffers; ++i)
+            if(m_mappedVertices != nullptr)
             {
-                delete mpBatch[i];
+                m_batch->UnmapVertices(0);
             }
+            
+            CS_SAFEDELETE(m_batch);
         }
 	}
 }
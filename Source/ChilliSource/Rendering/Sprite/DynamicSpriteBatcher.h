@@ -32,12 +32,12 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
 
+#include <unordered_map>
+
 namespace ChilliSource
 {
 	namespace Rendering
 	{
-        const u32 kudwNumBuffers = 2;
-        
         enum class CommandType
         {
             k_draw,
@@ -47,13 +47,13 @@ namespace ChilliSource
         
         struct RenderCommand
         {
-            MaterialCSPtr m_material;
-            
             Core::Vector2 m_scissorPos;
             Core::Vector2 m_scissorSize;
             
-            u32 m_offset;
-            u32 m_stride;
+            u32 m_material;
+            u32 m_firstSprite;
+            u32 m_numSprites;
+            u32 m_layer;
             
             CommandType m_type;
         };
@@ -61,9 +61,41 @@ namespace ChilliSource
 		class DynamicSpriteBatch
 		{
 		public:
+            //-------------------------------------------------------
+            /// A lightweight reference to a material used by the
+            /// batch. Handles remain valid until the next call to
+            /// ForceRender().
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            typedef u32 MaterialHandle;
+            
+            //-------------------------------------------------------
+            /// Constructor. The number of sprites that can be batched
+            /// before a flush is read from the app config. Flushed
+            /// sprites are written to consecutive ranges of a single
+            /// ring buffer, which holds several flushes worth of
+            /// sprites.
+            ///
+            /// @param The render system.
+            //-------------------------------------------------------
 			DynamicSpriteBatch(RenderSystem* inpRenderSystem);
             ~DynamicSpriteBatch();
             
+            //-------------------------------------------------------
+            /// Returns a handle to the given material which can be
+            /// used to submit sprites. The batch holds a reference to
+            /// the material until the next call to ForceRender(), so
+            /// sprites submitted by handle don't need to copy the
+            /// material pointer.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The material.
+            ///
+            /// @return The handle to the material.
+            //-------------------------------------------------------
+            MaterialHandle GetMaterialHandle(const MaterialCSPtr& in_material);
 			//-------------------------------------------------------
 			/// Render
 			///
@@ -75,6 +107,49 @@ namespace ChilliSource
             /// @param Sprite data to batch
 			//-------------------------------------------------------
 			void Render(const SpriteBatch::SpriteData& inpSprite, const Core::Matrix4 * inpTransform = nullptr);
+            //-------------------------------------------------------
+            /// Batches a sprite to be rendered later with the
+            /// material with the given handle. The vertices are
+            /// written straight into the mapped range of the ring
+            /// buffer, unless material sorting is enabled in which
+            /// case they are staged so that they can be re-ordered.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The handle of the material to render with.
+            /// @param The four vertices of the sprite, in the order
+            /// given by SpriteBatch::Verts.
+            /// @param [Optional] A transform to apply to the vertex
+            /// positions.
+            //-------------------------------------------------------
+            void Render(MaterialHandle in_material, const SpriteBatch::SpriteVertex* in_vertices, const Core::Matrix4* in_transform = nullptr);
+            //-------------------------------------------------------
+            /// Sets whether sprites are re-ordered by material when
+            /// the batch is flushed. Only sprites within the same
+            /// layer are re-ordered, and the order of sprites with the
+            /// same material is preserved. This reduces the number of
+            /// draw calls, but should only be enabled when sprites
+            /// with different materials in the same layer can be
+            /// drawn in any order. Sorting requires sprites to be
+            /// staged before they are written to the ring buffer, so
+            /// it costs an extra copy per sprite. Changing this
+            /// flushes any batched sprites. This is disabled by
+            /// default.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Whether or not material sorting is enabled.
+            //-------------------------------------------------------
+            void SetMaterialSortingEnabled(bool in_enabled);
+            //-------------------------------------------------------
+            /// Ends the current layer. Sprites submitted after this
+            /// will always be drawn after those submitted before it,
+            /// even when material sorting is enabled. Changes to
+            /// scissoring also end the current layer.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            void EndLayer();
             //-------------------------------------------------------
 			/// Enable scissoring with the given region. Any
             /// subsequent renders to the batcher will be clipped
@@ -97,39 +172,73 @@ namespace ChilliSource
 			/// Force Render
 			///
             /// Force the currently batched sprites to be rendered
-            /// regardless of whether the batch is full
+            /// regardless of whether the batch is full. This also
+            /// releases all material handles.
 			//-------------------------------------------------------
 			void ForceRender();
 			
 		private:
             
             //-------------------------------------------------------
-            /// Take the contents of the sprite cache as it stands
-            /// and generate a draw call commmand
+            /// Adds a draw command for the given material, or extends
+            /// the last command if it uses the same material.
             ///
-            /// @author S Downie
+            /// @author Jordan Brown
+            ///
+            /// @param The material handle.
+            //-------------------------------------------------------
+            void InsertDrawCommand(MaterialHandle in_material);
+            //-------------------------------------------------------
+            /// Returns where the vertices of the next sprite should
+            /// be written. This is either the staged vertex data or,
+            /// if material sorting is disabled, the mapped range of
+            /// the ring buffer, which is mapped on the first sprite
+            /// of each batch.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @return The four vertices of the next sprite.
             //-------------------------------------------------------
-            void InsertDrawCommand();
+            SpriteBatch::SpriteVertex* AllocateSpriteVertices();
+            //-------------------------------------------------------
+            /// Re-orders the draw commands so that, within each
+            /// layer, there is a single draw command per material.
+            /// The sprites are not moved; instead the order in which
+            /// they should be written to the vertex buffer is built.
+            ///
+            /// @author Jordan Brown
+            //-------------------------------------------------------
+            void SortDrawCommandsByMaterial();
             //----------------------------------------------------------
             /// Build and Flush Batch
             ///
-            /// Map the batch into the mesh buffer and present the
-            /// contents. This will then swap the active buffer
-            /// so that it can be filled while the other one is 
-            /// rendering
+            /// Finish writing the batched sprites into their range of
+            /// the ring buffer and present the contents. The ring
+            /// wraps back to the start when there isn't room for a
+            /// batch, so the previously flushed ranges can still be
+            /// rendering while new ones are filled.
             //----------------------------------------------------------
             void BuildAndFlushBatch();
 			
 		private:
         
-			SpriteBatch* mpBatch[kudwNumBuffers];
-			std::vector<SpriteBatch::SpriteData> maSpriteCache;
+			SpriteBatch* m_batch;
+            std::vector<SpriteBatch::SpriteVertex> m_vertices;
+            SpriteBatch::SpriteVertex* m_mappedVertices;
             std::vector<RenderCommand> maRenderCommands;
             
-            MaterialCSPtr mpLastMaterial;
+            std::vector<MaterialCSPtr> m_materials;
+            std::unordered_map<const Material*, MaterialHandle> m_materialHandles;
+            
+            std::vector<RenderCommand> m_sortedRenderCommands;
+            std::vector<u32> m_spriteOrder;
             
-            u32 mudwCurrentRenderSpriteBatch;
-            u32 mudwSpriteCommandCounter;
+            u32 m_batchCapacity;
+            u32 m_ringCapacity;
+            u32 m_ringPosition;
+            u32 m_numBatchedSprites;
+            u32 m_currentLayer;
+            bool m_materialSortingEnabled;
             
             RenderSystem* m_renderSystem;
 		};
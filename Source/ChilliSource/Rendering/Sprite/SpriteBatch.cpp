@@ -46,18 +46,27 @@ namespace ChilliSource
 		///
 		/// Default
 		//------------------------------------------------------
-		SpriteBatch::SpriteBatch(u32 inudwCapacity, RenderSystem * inpRenderSystem, BufferUsage ineUsage) 
-        : m_renderSystem(inpRenderSystem), mpSpriteBuffer(nullptr), mdwTag(0), mudwNumSpritesBuiltIndicesFor(0)
+		SpriteBatch::SpriteBatch(u32 inudwCapacity, RenderSystem * inpRenderSystem, BufferUsage ineUsage, BufferAccess in_access) 
+        : m_renderSystem(inpRenderSystem), mpSpriteBuffer(nullptr), mdwTag(0), mudwNumSpritesBuiltIndicesFor(0), m_firstMappedSprite(0), m_numMappedSprites(0)
 		{
 			BufferDescription desc;
 			desc.eUsageFlag = ineUsage;
 			desc.VertexDataCapacity = (inudwCapacity + 1) * k_numSpriteVerts * sizeof(SpriteVertex); 
 			desc.IndexDataCapacity  = (inudwCapacity + 1) * sizeof(u16) * k_numSpriteIndices;
 			desc.ePrimitiveType = PrimitiveType::k_tri;
-			desc.eAccessFlag = BufferAccess::k_read;
+			desc.eAccessFlag = in_access;
 			desc.VertexLayout = VertexLayout::kSprite;
 			
 			mpSpriteBuffer = m_renderSystem->CreateBuffer(desc);
+            
+            //Sub-ranges of the vertices can be mapped at any offset, so build all the indices now rather than re-locking the index buffer while it is in use.
+            if(in_access == BufferAccess::k_writeNoOverwrite)
+            {
+                CS_ASSERT((inudwCapacity + 1) * k_numSpriteVerts <= 65536, "Sprite batch capacity exceeds the range of 16-bit indices.");
+                
+                mpSpriteBuffer->Bind();
+                BuildIndicesForNumberSprites(inudwCapacity + 1);
+            }
 		}
 		//------------------------------------------------------
 		/// Build
@@ -69,16 +78,8 @@ namespace ChilliSource
 		//------------------------------------------------------
 		void SpriteBatch::Build(const std::vector<SpriteData>& in_sprites)
 		{
-			const u32 udwNumSprites = in_sprites.size();
-			const u32 udwNumIndices = k_numSpriteIndices * udwNumSprites; 
-			
-			mpSpriteBuffer->Bind();
-			mpSpriteBuffer->SetVertexCount(k_numSpriteVerts *  udwNumSprites);
-			mpSpriteBuffer->SetIndexCount(udwNumIndices);
-			
 			//Get the buffer locations
-			SpriteVertex* pVBuffer = nullptr;
-			mpSpriteBuffer->LockVertex((f32**)&pVBuffer, 0, 0);
+			SpriteVertex* pVBuffer = MapVertices(in_sprites.size());
 
 			u32 VertIdx = 0;
 									
@@ -89,11 +90,43 @@ namespace ChilliSource
 				VertIdx+=4;
 			}
 			
-			//---End mapping - Vertex
-			mpSpriteBuffer->UnlockVertex();
-
-			BuildIndicesForNumberSprites(udwNumSprites);
+			UnmapVertices(in_sprites.size());
 		}
+        //------------------------------------------------------
+        //------------------------------------------------------
+        SpriteBatch::SpriteVertex* SpriteBatch::MapVertices(u32 in_numSprites, u32 in_firstSprite)
+        {
+            CS_ASSERT(in_firstSprite == 0 || mpSpriteBuffer->GetBufferDescription().eAccessFlag == BufferAccess::k_writeNoOverwrite, "Only no-overwrite sprite batches can map a sub-range of their vertices.");
+            
+            m_firstMappedSprite = in_firstSprite;
+            m_numMappedSprites = in_firstSprite + in_numSprites;
+            
+			mpSpriteBuffer->Bind();
+			mpSpriteBuffer->SetVertexCount(k_numSpriteVerts * m_numMappedSprites);
+			mpSpriteBuffer->SetIndexCount(k_numSpriteIndices * m_numMappedSprites);
+            
+            const u32 spriteSize = k_numSpriteVerts * sizeof(SpriteVertex);
+            
+            SpriteVertex* pVBuffer = nullptr;
+			mpSpriteBuffer->LockVertex((f32**)&pVBuffer, in_firstSprite * spriteSize, in_numSprites * spriteSize);
+            return pVBuffer;
+        }
+        //------------------------------------------------------
+        //------------------------------------------------------
+        void SpriteBatch::UnmapVertices(u32 in_numWrittenSprites)
+        {
+            CS_ASSERT(m_firstMappedSprite + in_numWrittenSprites <= m_numMappedSprites, "Cannot write more sprites than were mapped.");
+            
+            m_numMappedSprites = m_firstMappedSprite + in_numWrittenSprites;
+            
+            //Other buffers may have been bound since the vertices were mapped.
+			mpSpriteBuffer->Bind();
+			mpSpriteBuffer->SetVertexCount(k_numSpriteVerts * m_numMappedSprites);
+			mpSpriteBuffer->SetIndexCount(k_numSpriteIndices * m_numMappedSprites);
+			mpSpriteBuffer->UnlockVertex(in_numWrittenSprites * k_numSpriteVerts * sizeof(SpriteVertex));
+
+			BuildIndicesForNumberSprites(m_numMappedSprites);
+        }
         //-------------------------------------------------------
         /// Map Sprite Into Buffer
         ///
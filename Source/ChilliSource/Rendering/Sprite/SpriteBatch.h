@@ -81,7 +81,17 @@ namespace ChilliSource
                 MaterialCSPtr pMaterial;
             };
             
-			SpriteBatch(u32 inudwCapacity, RenderSystem * inpRenderSystem, BufferUsage ineUsage);
+            //------------------------------------------------------
+            /// Constructor
+            ///
+            /// @param The maximum number of sprites in the batch.
+            /// @param The render system.
+            /// @param The buffer usage.
+            /// @param [Optional] The buffer access. Batches created
+            /// with k_writeNoOverwrite can have sub-ranges of their
+            /// vertices mapped, and their indices are built up front.
+            //------------------------------------------------------
+			SpriteBatch(u32 inudwCapacity, RenderSystem * inpRenderSystem, BufferUsage ineUsage, BufferAccess in_access = BufferAccess::k_read);
 			~SpriteBatch();
 			//------------------------------------------------------
 			/// Build
@@ -92,6 +102,36 @@ namespace ChilliSource
             /// @param Sprite array
 			//------------------------------------------------------
 			void Build(const std::vector<SpriteData>& in_sprites);
+            //------------------------------------------------------
+            /// Prepares the batch to hold up to the given number of
+            /// sprites and maps its vertex buffer so the vertices can
+            /// be written directly. UnmapVertices() must be called
+            /// once the vertices have been written.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The maximum number of sprites to map.
+            /// @param [Optional] The index of the first sprite to
+            /// map. This can only be non-zero for batches created
+            /// with k_writeNoOverwrite access; the sprites before it
+            /// are left untouched.
+            ///
+            /// @return The mapped vertices, with room for four
+            /// vertices per sprite, starting at the first sprite.
+            //------------------------------------------------------
+            SpriteVertex* MapVertices(u32 in_numSprites, u32 in_firstSprite = 0);
+            //------------------------------------------------------
+            /// Unmaps the vertex buffer mapped by MapVertices(),
+            /// finalising the batch. Only the given number of sprites
+            /// from the start of the mapped range are kept, so fewer
+            /// sprites than were mapped can be written. Other buffers
+            /// can be bound and drawn while the vertices are mapped.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param The number of sprites that were written.
+            //------------------------------------------------------
+            void UnmapVertices(u32 in_numWrittenSprites);
 			//------------------------------------------------------
 			/// Render
 			///
@@ -153,6 +193,8 @@ namespace ChilliSource
 		private:
 			
 			u32 mudwNumSpritesBuiltIndicesFor;
+            u32 m_firstMappedSprite;
+            u32 m_numMappedSprites;
 			
 			s32 mdwTag;
 			
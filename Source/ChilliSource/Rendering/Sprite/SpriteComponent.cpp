@@ -33,9 +33,8 @@
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Rendering/Base/AspectRatioUtils.h>
-#include <ChilliSource/Rendering/Base/RenderSystem.h>
+#include <ChilliSource/Rendering/Base/RenderCommandBuffer.h>
 #include <ChilliSource/Rendering/Material/Material.h>
-#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
@@ -381,7 +380,7 @@ namespace ChilliSource
 		void SpriteComponent::SetOriginAlignment(AlignmentAnchor in_alignment)
         {
 			m_originAlignment = in_alignment;
-			m_vertexPositionsValid = false;
+			InvalidateBounds();
 		}
 		//-----------------------------------------------------------
 		//-----------------------------------------------------------
@@ -391,16 +390,12 @@ namespace ChilliSource
 		}
         //-----------------------------------------------------------
         //-----------------------------------------------------------
-        void SpriteComponent::Render(RenderSystem* inpRenderSystem, CameraComponent* inpCam, ShaderPass ineShaderPass)
+        void SpriteComponent::Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, ShaderPass ineShaderPass)
         {
             if (ineShaderPass == ShaderPass::k_ambient)
             {
-                if(IsTextureSizeCacheValid() == false)
-                {
-                    OnTransformChanged();
-                    SetTextureSizeCacheValid();
-                }
-                
+                //Texture size changes are picked up on the main thread in OnUpdate(), which invalidates the vertices
+                //along with the bounds, as this can be called off the main thread.
                 if(m_vertexPositionsValid == false)
                 {
                     //We have been transformed so we need to recalculate our vertices
@@ -411,19 +406,33 @@ namespace ChilliSource
                 m_spriteData.pMaterial = mpMaterial;
                 
                 //Add us to the render systems dynamic batch
-                //If we force a batch flush here then the previous sprites
-                //will be rendered.
-                inpRenderSystem->GetDynamicSpriteBatchPtr()->Render(m_spriteData);
+                in_commandBuffer->RenderSprite(m_spriteData.pMaterial, m_spriteData.sVerts);
             }
         }
         //------------------------------------------------------------
         //------------------------------------------------------------
         void SpriteComponent::OnTransformChanged()
+        {
+            InvalidateBounds();
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        void SpriteComponent::InvalidateBounds()
         {
             m_vertexPositionsValid = false;
             m_isBSValid = false;
             m_isAABBValid = false;
             m_isOOBBValid = false;
+            
+            RenderComponent::InvalidateBounds();
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        void SpriteComponent::SetMaterial(const MaterialCSPtr& in_material)
+        {
+            RenderComponent::SetMaterial(in_material);
+            
+            InvalidateBounds();
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
@@ -457,7 +466,7 @@ namespace ChilliSource
 		//----------------------------------------------------
 		void SpriteComponent::OnAddedToScene()
 		{
-			m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &SpriteComponent::OnTransformChanged));
+			m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeInlineDelegate(this, &SpriteComponent::OnTransformChanged));
             
             OnTransformChanged();
 		}
@@ -468,6 +477,16 @@ namespace ChilliSource
             m_transformChangedConnection = nullptr;
 		}
         //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void SpriteComponent::OnUpdate(f32 in_deltaTime)
+        {
+            if(IsTextureSizeCacheValid() == false)
+            {
+                InvalidateBounds();
+                SetTextureSizeCacheValid();
+            }
+        }
+        //-----------------------------------------------------------
         /// The image from the texture atlas will have potentially
         /// been cropped by the tool. This will affect the sprites
         /// position within the uncropped image and we need to
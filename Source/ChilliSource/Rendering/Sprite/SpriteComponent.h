@@ -129,6 +129,23 @@ namespace ChilliSource
 			/// @return world space bounding sphere
 			//----------------------------------------------------
 			const Core::Sphere& GetBoundingSphere() override;
+            //----------------------------------------------------
+            /// Discards the cached bounds and vertex positions
+            /// and notifies the scene that the bounds have changed.
+            ///
+            /// @author Jordan Brown
+            //----------------------------------------------------
+            void InvalidateBounds() override;
+            //-----------------------------------------------------------
+            /// Sets the material. As the size of the sprite can depend
+            /// on the size of the material's texture, this invalidates
+            /// the bounds.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Handle to material
+            //-----------------------------------------------------------
+            void SetMaterial(const MaterialCSPtr& in_material) override;
 			//-----------------------------------------------------------
 			/// @author S Downie
 			///
@@ -275,22 +292,22 @@ namespace ChilliSource
             /// to the sprite batch for rendering and flush the
             /// batch if we have a different material
             ///
-            /// @param Render system
+            /// @param Command buffer to record into
             /// @param Active camera component
             /// @param The current shader pass.
             //-----------------------------------------------------------
-            void Render(RenderSystem* inpRenderSystem, CameraComponent* inpCam, ShaderPass ineShaderPass) override;
+            void Render(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, ShaderPass ineShaderPass) override;
             //-----------------------------------------------------
             /// Render Shadow Map
             ///
             /// Render the mesh to the shadow map
             ///
-            /// @param Render system
+            /// @param Command buffer to record into
             /// @param Active camera component
             /// @param Material to render static shadows with
             /// @param Material to render skinned shadows with
             //-----------------------------------------------------
-            void RenderShadowMap(RenderSystem* inpRenderSystem, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap) override {};
+            void RenderShadowMap(RenderCommandBuffer* in_commandBuffer, CameraComponent* inpCam, const MaterialCSPtr& in_staticShadowMap, const MaterialCSPtr& in_animShadowMap) override {};
             //----------------------------------------------------
 			/// Triggered when the component is attached to
 			/// an entity on the scene
@@ -305,6 +322,17 @@ namespace ChilliSource
             /// @author S Downie
 			//----------------------------------------------------
 			void OnRemovedFromScene() override;
+            //----------------------------------------------------
+            /// Checks whether the texture has changed size since
+            /// the bounds were last built and if so invalidates
+            /// them, so that the scene is told about the new bounds
+            /// before it is next culled.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Time since last update in seconds
+            //----------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) override;
             //------------------------------------------------------------
             /// On Transform Changed
             ///
@@ -28,7 +28,9 @@
 
 #include <ChilliSource/Rendering/Texture/Cubemap.h>
 
-#if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
+#if defined(CS_RENDERBACKEND_NULL)
+#include <CSBackend/Rendering/Null/Texture/Cubemap.h>
+#elif defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
 #include <CSBackend/Rendering/OpenGL/Texture/Cubemap.h>
 #endif
 
@@ -42,7 +44,9 @@ namespace ChilliSource
         //--------------------------------------------------------------
         CubemapUPtr Cubemap::Create()
         {
-#if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
+#if defined(CS_RENDERBACKEND_NULL)
+            return CubemapUPtr(new CSBackend::Null::Cubemap());
+#elif defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
             return CubemapUPtr(new CSBackend::OpenGL::Cubemap());
 #else
             return nullptr;
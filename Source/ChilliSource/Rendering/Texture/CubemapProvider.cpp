@@ -31,6 +31,7 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Json/JsonUtils.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Texture/Cubemap.h>
@@ -265,7 +266,7 @@ namespace ChilliSource
                     out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
                     in_delegate(out_resource);
                 });
-                Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(task);
+                Core::Application::Get()->GetResourcePool()->ScheduleUploadTask(task);
             }
         }
 	}
@@ -28,7 +28,9 @@
 
 #include <ChilliSource/Rendering/Texture/Texture.h>
 
-#if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
+#if defined(CS_RENDERBACKEND_NULL)
+#include <CSBackend/Rendering/Null/Texture/Texture.h>
+#elif defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
 #include <CSBackend/Rendering/OpenGL/Texture/Texture.h>
 #endif
 
@@ -42,7 +44,9 @@ namespace ChilliSource
         //--------------------------------------------------------------
         TextureUPtr Texture::Create()
         {
-#if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
+#if defined(CS_RENDERBACKEND_NULL)
+            return TextureUPtr(new CSBackend::Null::Texture());
+#elif defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
             return TextureUPtr(new CSBackend::OpenGL::Texture());
 #else
             return nullptr;
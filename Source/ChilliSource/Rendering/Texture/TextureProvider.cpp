@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Image/Image.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureResourceOptions.h>
@@ -190,7 +191,7 @@ namespace ChilliSource
                     out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
                     in_delegate(out_resource);
                 });
-                Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(task);
+                Core::Application::Get()->GetResourcePool()->ScheduleUploadTask(task);
             }
         }
 	}
@@ -72,9 +72,9 @@ namespace ChilliSource
             m_screenResizedConnection = m_screen->GetResolutionChangedEvent().OpenConnection(Core::MakeDelegate(this, &Canvas::OnScreenResolutionChanged));
             
             auto pointerSystem = Core::Application::Get()->GetSystem<Input::PointerSystem>();
-            m_pointerDownConnection = pointerSystem->GetPointerDownEventInternal().OpenConnection(Core::MakeDelegate(this, &Canvas::OnPointerDown));
-            m_pointerMovedConnection = pointerSystem->GetPointerMovedEvent().OpenConnection(Core::MakeDelegate(this, &Canvas::OnPointerMoved));
-            m_pointerUpConnection = pointerSystem->GetPointerUpEvent().OpenConnection(Core::MakeDelegate(this, &Canvas::OnPointerUp));
+            m_pointerDownConnection = pointerSystem->GetPointerDownEventInternal().OpenConnection(Core::MakeInlineDelegate(this, &Canvas::OnPointerDown));
+            m_pointerMovedConnection = pointerSystem->GetPointerMovedEvent().OpenConnection(Core::MakeInlineDelegate(this, &Canvas::OnPointerMoved));
+            m_pointerUpConnection = pointerSystem->GetPointerUpEvent().OpenConnection(Core::MakeInlineDelegate(this, &Canvas::OnPointerUp));
         }
         //-----------------------------------------------------------
         /// UI can filter input events to prevent them from being
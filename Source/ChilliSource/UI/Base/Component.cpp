@@ -56,17 +56,14 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        bool Component::HasProperty(const std::string& in_propertyName) const
+        bool Component::HasProperty(const Core::PropertyName& in_propertyName) const
         {
-            std::string lowerPropertyName = in_propertyName;
-            Core::StringUtils::ToLowerCase(lowerPropertyName);
-            
-            auto it = m_properties.find(lowerPropertyName);
+            auto it = m_properties.find(in_propertyName.GetId());
             return (it != m_properties.end());
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        void Component::SetProperty(const std::string& in_propertyName, const char* in_propertyValue)
+        void Component::SetProperty(const Core::PropertyName& in_propertyName, const char* in_propertyValue)
         {
             SetProperty(in_propertyName, std::string(in_propertyValue));
         }
@@ -92,9 +89,10 @@ namespace ChilliSource
             
             for (const auto& key : in_properties.GetKeys())
             {
-                if (in_properties.HasValue(key) == true)
+                Core::PropertyName name(key);
+                if (in_properties.HasValue(name) == true)
                 {
-                    SetProperty(key, in_properties.GetPropertyObject(key));
+                    SetProperty(name, in_properties.GetPropertyObject(name));
                 }
             }
         }
@@ -109,17 +107,14 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        void Component::SetProperty(const std::string& in_propertyName, const Core::IProperty* in_property)
+        void Component::SetProperty(const Core::PropertyName& in_propertyName, const Core::IProperty* in_property)
         {
             CS_ASSERT(m_propertyRegistrationComplete == true, "Cannot set a property on a UI::Component prior to property registration completion.");
             
-            std::string lowerPropertyName = in_propertyName;
-            Core::StringUtils::ToLowerCase(lowerPropertyName);
-            
-            auto it = m_properties.find(lowerPropertyName);
+            auto it = m_properties.find(in_propertyName.GetId());
             if(it == m_properties.end())
             {
-                CS_LOG_FATAL("Cannot find property with name '" + in_propertyName + "' in UI::Component.");
+                CS_LOG_FATAL("Cannot find property with name '" + in_propertyName.GetName() + "' in UI::Component.");
             }
             
             it->second->Set(in_property);
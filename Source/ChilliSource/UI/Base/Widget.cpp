@@ -250,22 +250,22 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         void Widget::InitBaseProperties()
         {
-            m_baseProperties.emplace(k_properyNameName, Core::PropertyTypes::String()->CreateProperty(Core::MakeDelegate(this, &Widget::GetName), Core::MakeDelegate(this, &Widget::SetName)));
-            m_baseProperties.emplace(k_properyNameRelPosition, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRelativePosition), Core::MakeDelegate(this, &Widget::SetRelativePosition)));
-            m_baseProperties.emplace(k_properyNameAbsPosition, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalAbsolutePosition), Core::MakeDelegate(this, &Widget::SetAbsolutePosition)));
-            m_baseProperties.emplace(k_properyNameRelSize, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRelativeSize), Core::MakeDelegate(this, &Widget::SetRelativeSize)));
-            m_baseProperties.emplace(k_properyNameAbsSize, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalAbsoluteSize), Core::MakeDelegate(this, &Widget::SetAbsoluteSize)));
-            m_baseProperties.emplace(k_properyNamePreferredSize, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetPreferredSize), Core::MakeDelegate(this, &Widget::SetDefaultPreferredSize)));
-            m_baseProperties.emplace(k_properyNameScale, Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalScale), Core::MakeDelegate(this, &Widget::ScaleTo)));
-            m_baseProperties.emplace(k_properyNameColour, Core::PropertyTypes::Colour()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalColour), Core::MakeDelegate(this, &Widget::SetColour)));
-            m_baseProperties.emplace(k_properyNameRotation, Core::PropertyTypes::Float()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRotation), Core::MakeDelegate(this, &Widget::RotateTo)));
-            m_baseProperties.emplace(k_properyNameOriginAnchor, PropertyTypes::AlignmentAnchor()->CreateProperty(Core::MakeDelegate(this, &Widget::GetOriginAnchor), Core::MakeDelegate(this, &Widget::SetOriginAnchor)));
-            m_baseProperties.emplace(k_properyNameParentalAnchor, PropertyTypes::AlignmentAnchor()->CreateProperty(Core::MakeDelegate(this, &Widget::GetParentalAnchor), Core::MakeDelegate(this, &Widget::SetParentalAnchor)));
-            m_baseProperties.emplace(k_properyNameVisible, Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsVisible), Core::MakeDelegate(this, &Widget::SetVisible)));
-            m_baseProperties.emplace(k_properyNameClipChildren, Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsClippingEnabled), Core::MakeDelegate(this, &Widget::SetClippingEnabled)));
-            m_baseProperties.emplace(k_properyNameInputEnabled, Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsInputEnabled), Core::MakeDelegate(this, &Widget::SetInputEnabled)));
-            m_baseProperties.emplace(k_properyNameInputConsumeEnabled, Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsInputConsumeEnabled), Core::MakeDelegate(this, &Widget::SetInputConsumeEnabled)));
-            m_baseProperties.emplace(k_properyNameSizePolicy, PropertyTypes::SizePolicy()->CreateProperty(Core::MakeDelegate(this, &Widget::GetSizePolicy), Core::MakeDelegate(this, &Widget::SetSizePolicy)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameName).GetId(), Core::PropertyTypes::String()->CreateProperty(Core::MakeDelegate(this, &Widget::GetName), Core::MakeDelegate(this, &Widget::SetName)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameRelPosition).GetId(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRelativePosition), Core::MakeDelegate(this, &Widget::SetRelativePosition)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameAbsPosition).GetId(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalAbsolutePosition), Core::MakeDelegate(this, &Widget::SetAbsolutePosition)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameRelSize).GetId(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRelativeSize), Core::MakeDelegate(this, &Widget::SetRelativeSize)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameAbsSize).GetId(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalAbsoluteSize), Core::MakeDelegate(this, &Widget::SetAbsoluteSize)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNamePreferredSize).GetId(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetPreferredSize), Core::MakeDelegate(this, &Widget::SetDefaultPreferredSize)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameScale).GetId(), Core::PropertyTypes::Vector2()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalScale), Core::MakeDelegate(this, &Widget::ScaleTo)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameColour).GetId(), Core::PropertyTypes::Colour()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalColour), Core::MakeDelegate(this, &Widget::SetColour)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameRotation).GetId(), Core::PropertyTypes::Float()->CreateProperty(Core::MakeDelegate(this, &Widget::GetLocalRotation), Core::MakeDelegate(this, &Widget::RotateTo)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameOriginAnchor).GetId(), PropertyTypes::AlignmentAnchor()->CreateProperty(Core::MakeDelegate(this, &Widget::GetOriginAnchor), Core::MakeDelegate(this, &Widget::SetOriginAnchor)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameParentalAnchor).GetId(), PropertyTypes::AlignmentAnchor()->CreateProperty(Core::MakeDelegate(this, &Widget::GetParentalAnchor), Core::MakeDelegate(this, &Widget::SetParentalAnchor)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameVisible).GetId(), Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsVisible), Core::MakeDelegate(this, &Widget::SetVisible)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameClipChildren).GetId(), Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsClippingEnabled), Core::MakeDelegate(this, &Widget::SetClippingEnabled)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameInputEnabled).GetId(), Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsInputEnabled), Core::MakeDelegate(this, &Widget::SetInputEnabled)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameInputConsumeEnabled).GetId(), Core::PropertyTypes::Bool()->CreateProperty(Core::MakeDelegate(this, &Widget::IsInputConsumeEnabled), Core::MakeDelegate(this, &Widget::SetInputConsumeEnabled)));
+            m_baseProperties.emplace(Core::PropertyName(k_properyNameSizePolicy).GetId(), PropertyTypes::SizePolicy()->CreateProperty(Core::MakeDelegate(this, &Widget::GetSizePolicy), Core::MakeDelegate(this, &Widget::SetSizePolicy)));
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -317,35 +317,31 @@ namespace ChilliSource
             //Hook up any links to our components
             for(const auto& link : in_componentPropertyLinks)
             {
-                CS_ASSERT(m_baseProperties.find(link.GetLinkName()) == m_baseProperties.end(), "Cannot add duplicate property: " + link.GetLinkName());
-                CS_ASSERT(m_componentPropertyLinks.find(link.GetLinkName()) == m_componentPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
-                CS_ASSERT(m_childPropertyLinks.find(link.GetLinkName()) == m_childPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                Core::PropertyName linkName(link.GetLinkName());
+                CS_ASSERT(m_baseProperties.find(linkName.GetId()) == m_baseProperties.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                CS_ASSERT(m_componentPropertyLinks.find(linkName.GetId()) == m_componentPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                CS_ASSERT(m_childPropertyLinks.find(linkName.GetId()) == m_childPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
                 
                 Component* component = GetComponentWithName(link.GetLinkedOwner());
                 CS_ASSERT(component != nullptr, "Cannot create property link for property '" + link.GetLinkName() + "' because target component '" + link.GetLinkedOwner() + "' doesn't exist.");
                 CS_ASSERT(component->HasProperty(link.GetLinkName()) == true, "Cannot create property link for property '" + link.GetLinkName() + "' because target component '" +
                           link.GetLinkedOwner() + "' doesn't contain a property called '" + link.GetLinkedProperty() + "'.");
                 
-                std::string lowerLinkName = link.GetLinkName();
-                Core::StringUtils::ToLowerCase(lowerLinkName);
-                
-                m_componentPropertyLinks.emplace(lowerLinkName, std::make_pair(component, link.GetLinkedProperty()));
+                m_componentPropertyLinks.emplace(linkName.GetId(), std::make_pair(component, Core::PropertyName(link.GetLinkedProperty())));
             }
             
             //Hook up any links to our childrens properties
             for(const auto& link : in_childPropertyLinks)
             {
-                CS_ASSERT(m_baseProperties.find(link.GetLinkName()) == m_baseProperties.end(), "Cannot add duplicate property: " + link.GetLinkName());
-                CS_ASSERT(m_componentPropertyLinks.find(link.GetLinkName()) == m_componentPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
-                CS_ASSERT(m_childPropertyLinks.find(link.GetLinkName()) == m_childPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                Core::PropertyName linkName(link.GetLinkName());
+                CS_ASSERT(m_baseProperties.find(linkName.GetId()) == m_baseProperties.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                CS_ASSERT(m_componentPropertyLinks.find(linkName.GetId()) == m_componentPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
+                CS_ASSERT(m_childPropertyLinks.find(linkName.GetId()) == m_childPropertyLinks.end(), "Cannot add duplicate property: " + link.GetLinkName());
                 
                 Widget* childWidget = GetInternalWidgetRecursive(link.GetLinkedOwner());
                 CS_ASSERT(childWidget != nullptr, "Cannot create property link for property '" + link.GetLinkName() + "' because target widget '" + link.GetLinkedOwner() + "' doesn't exist.");
                 
-                std::string lowerLinkName = link.GetLinkName();
-                Core::StringUtils::ToLowerCase(lowerLinkName);
-                
-                m_childPropertyLinks.emplace(lowerLinkName, std::make_pair(childWidget, link.GetLinkedProperty()));
+                m_childPropertyLinks.emplace(linkName.GetId(), std::make_pair(childWidget, Core::PropertyName(link.GetLinkedProperty())));
             }
         }
         //----------------------------------------------------------------------------------------
@@ -354,9 +350,10 @@ namespace ChilliSource
         {
             for (const auto& key : in_propertyMap.GetKeys())
             {
-                if (in_propertyMap.HasValue(key) == true)
+                Core::PropertyName name(key);
+                if (in_propertyMap.HasValue(name) == true)
                 {
-                    SetProperty(key, in_propertyMap.GetPropertyObject(key));
+                    SetProperty(name, in_propertyMap.GetPropertyObject(name));
                 }
             }
         }
@@ -1006,7 +1003,7 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        void Widget::SetProperty(const std::string& in_name, const char* in_value)
+        void Widget::SetProperty(const Core::PropertyName& in_name, const char* in_value)
         {
             SetProperty<std::string>(in_name, in_value);
         }
@@ -1282,33 +1279,30 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        void Widget::SetProperty(const std::string& in_propertyName, const Core::IProperty* in_property)
+        void Widget::SetProperty(const Core::PropertyName& in_propertyName, const Core::IProperty* in_property)
         {
-            std::string lowerName = in_propertyName;
-            Core::StringUtils::ToLowerCase(lowerName);
-            
-            auto basePropIt = m_baseProperties.find(lowerName);
+            auto basePropIt = m_baseProperties.find(in_propertyName.GetId());
             if(basePropIt != m_baseProperties.end())
             {
                 basePropIt->second->Set(in_property);
                 return;
             }
             
-            auto componentPropIt = m_componentPropertyLinks.find(lowerName);
+            auto componentPropIt = m_componentPropertyLinks.find(in_propertyName.GetId());
             if(componentPropIt != m_componentPropertyLinks.end())
             {
                 componentPropIt->second.first->SetProperty(componentPropIt->second.second, in_property);
                 return;
             }
             
-            auto childPropIt = m_childPropertyLinks.find(lowerName);
+            auto childPropIt = m_childPropertyLinks.find(in_propertyName.GetId());
             if(childPropIt != m_childPropertyLinks.end())
             {
                 childPropIt->second.first->SetProperty(childPropIt->second.second, in_property);
                 return;
             }
             
-            CS_LOG_FATAL("Invalid property name for Widget: " + in_propertyName);
+            CS_LOG_FATAL("Invalid property name for Widget: " + in_propertyName.GetName());
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
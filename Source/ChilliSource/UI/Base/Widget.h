@@ -131,7 +131,7 @@ namespace ChilliSource
             /// @param The pointer.
             /// @param The input that triggered the event
             //----------------------------------------------------------------------------------------
-            using InputDelegate = std::function<void(Widget*, const Input::Pointer&, Input::Pointer::InputType)>;
+            using InputDelegate = Core::InlineDelegate<void(Widget*, const Input::Pointer&, Input::Pointer::InputType)>;
             //----------------------------------------------------------------------------------------
             /// Delegate for moving input events.
             ///
@@ -140,7 +140,7 @@ namespace ChilliSource
             /// @param Widget that the input event occurred on
             /// @param The pointer
             //----------------------------------------------------------------------------------------
-            using InputMovedDelegate = std::function<void(Widget*, const Input::Pointer&)>;
+            using InputMovedDelegate = Core::InlineDelegate<void(Widget*, const Input::Pointer&)>;
             //----------------------------------------------------------------------------------------
             /// @author S Downie
             ///
@@ -814,7 +814,7 @@ namespace ChilliSource
             /// @param Name. This is case insensitive.
             /// @param Value
             //----------------------------------------------------------------------------------------
-            template<typename TType> void SetProperty(const std::string& in_name, TType&& in_value);
+            template<typename TType> void SetProperty(const Core::PropertyName& in_name, TType&& in_value);
             //----------------------------------------------------------------------------------------
             /// Specialisation to store property value for const char* as a std::string
             ///
@@ -823,7 +823,7 @@ namespace ChilliSource
             /// @param Property name. This is case insensitive.
             /// @param Property value
             //----------------------------------------------------------------------------------------
-            void SetProperty(const std::string& in_name, const char* in_value);
+            void SetProperty(const Core::PropertyName& in_name, const char* in_value);
             //----------------------------------------------------------------------------------------
             /// Get the value of the property with the given name. If no property exists
             /// with the name then it will assert.
@@ -834,7 +834,22 @@ namespace ChilliSource
             ///
             /// @return Value
             //----------------------------------------------------------------------------------------
-            template<typename TType> TType GetProperty(const std::string& in_name) const;
+            template<typename TType> TType GetProperty(const Core::PropertyName& in_name) const;
+            //----------------------------------------------------------------------------------------
+            /// Resolves a typed handle to the property with the given name, following any links
+            /// to component or child widget properties. The handle can then be used to set and get
+            /// the property without further lookups, so should be preferred for properties which
+            /// are changed often, for example when animating. The handle is invalidated when the
+            /// widget which owns the property is destroyed. If no property exists with the name
+            /// then it will assert.
+            ///
+            /// @author Jordan Brown
+            ///
+            /// @param Name. This is case insensitive.
+            ///
+            /// @return The property handle.
+            //----------------------------------------------------------------------------------------
+            template<typename TType> Core::PropertyHandle<TType> GetPropertyHandle(const Core::PropertyName& in_name);
             //----------------------------------------------------------------------------------------
             /// Performs a calculation to check if the given position is within the OOBB
             /// of the widget
@@ -1052,7 +1067,7 @@ namespace ChilliSource
             /// @param The property name.
             /// @param The property used to set the value.
             //----------------------------------------------------------------------------------------
-            void SetProperty(const std::string& in_propertyName, const Core::IProperty* in_property);
+            void SetProperty(const Core::PropertyName& in_propertyName, const Core::IProperty* in_property);
             //----------------------------------------------------------------------------------------
             /// Called when the out transform changes forcing this to update its caches
             ///
@@ -1146,9 +1161,9 @@ namespace ChilliSource
             
         private:
             
-            std::unordered_map<std::string, CSCore::IPropertyUPtr> m_baseProperties;
-            std::unordered_map<std::string, std::pair<Component*, std::string>> m_componentPropertyLinks;
-            std::unordered_map<std::string, std::pair<Widget*, std::string>> m_childPropertyLinks;
+            std::unordered_map<u32, CSCore::IPropertyUPtr> m_baseProperties;
+            std::unordered_map<u32, std::pair<Component*, Core::PropertyName>> m_componentPropertyLinks;
+            std::unordered_map<u32, std::pair<Widget*, Core::PropertyName>> m_childPropertyLinks;
             
             std::unordered_map<Input::Pointer::Id, std::set<Input::Pointer::InputType>> m_pressedInput;
             
@@ -1225,64 +1240,84 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> void Widget::SetProperty(const std::string& in_name, TType&& in_value)
+        template<typename TType> void Widget::SetProperty(const Core::PropertyName& in_name, TType&& in_value)
         {
-            std::string lowerName = in_name;
-            Core::StringUtils::ToLowerCase(lowerName);
-            
-            auto basePropIt = m_baseProperties.find(lowerName);
+            auto basePropIt = m_baseProperties.find(in_name.GetId());
             if(basePropIt != m_baseProperties.end())
             {
-                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name);
+                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name.GetName());
                 property->Set(std::forward<TType>(in_value));
                 return;
             }
             
-            auto componentPropIt = m_componentPropertyLinks.find(lowerName);
+            auto componentPropIt = m_componentPropertyLinks.find(in_name.GetId());
             if(componentPropIt != m_componentPropertyLinks.end())
             {
                 componentPropIt->second.first->SetProperty<TType>(componentPropIt->second.second, std::forward<TType>(in_value));
                 return;
             }
             
-            auto childPropIt = m_childPropertyLinks.find(lowerName);
+            auto childPropIt = m_childPropertyLinks.find(in_name.GetId());
             if(childPropIt != m_childPropertyLinks.end())
             {
                 childPropIt->second.first->SetProperty<TType>(childPropIt->second.second, std::forward<TType>(in_value));
                 return;
             }
             
-            CS_LOG_FATAL("Invalid property name for Widget: " + in_name);
+            CS_LOG_FATAL("Invalid property name for Widget: " + in_name.GetName());
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
-        template<typename TType> TType Widget::GetProperty(const std::string& in_name) const
+        template<typename TType> TType Widget::GetProperty(const Core::PropertyName& in_name) const
         {
-            std::string lowerName = in_name;
-            Core::StringUtils::ToLowerCase(lowerName);
-            
-            auto basePropIt = m_baseProperties.find(lowerName);
+            auto basePropIt = m_baseProperties.find(in_name.GetId());
             if(basePropIt != m_baseProperties.end())
             {
-                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name);
+                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name.GetName());
                 return property->Get();
             }
             
-            auto componentPropIt = m_componentPropertyLinks.find(lowerName);
+            auto componentPropIt = m_componentPropertyLinks.find(in_name.GetId());
             if(componentPropIt != m_componentPropertyLinks.end())
             {
                 return componentPropIt->second.first->GetProperty<TType>(componentPropIt->second.second);
             }
             
-            auto childPropIt = m_childPropertyLinks.find(lowerName);
+            auto childPropIt = m_childPropertyLinks.find(in_name.GetId());
             if(childPropIt != m_childPropertyLinks.end())
             {
                 return childPropIt->second.first->GetProperty<TType>(childPropIt->second.second);
             }
             
-            CS_LOG_FATAL("Invalid property name for Widget: " + in_name);
+            CS_LOG_FATAL("Invalid property name for Widget: " + in_name.GetName());
             return TType();
         }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        template<typename TType> Core::PropertyHandle<TType> Widget::GetPropertyHandle(const Core::PropertyName& in_name)
+        {
+            auto basePropIt = m_baseProperties.find(in_name.GetId());
+            if(basePropIt != m_baseProperties.end())
+            {
+                auto property = CS_SMARTCAST(Core::Property<TType>*, basePropIt->second.get(), "Incorrect type for property with name: " + in_name.GetName());
+                return Core::PropertyHandle<TType>(property);
+            }
+            
+            auto componentPropIt = m_componentPropertyLinks.find(in_name.GetId());
+            if(componentPropIt != m_componentPropertyLinks.end())
+            {
+                return componentPropIt->second.first->GetPropertyHandle<TType>(componentPropIt->second.second);
+            }
+            
+            auto childPropIt = m_childPropertyLinks.find(in_name.GetId());
+            if(childPropIt != m_childPropertyLinks.end())
+            {
+                return childPropIt->second.first->GetPropertyHandle<TType>(childPropIt->second.second);
+            }
+            
+            CS_LOG_FATAL("Invalid property name for Widget: " + in_name.GetName());
+            return Core::PropertyHandle<TType>();
+        }
     }
 }
 
@@ -325,13 +325,20 @@ namespace ChilliSource
                 m_invalidateCache = true;
             }
             
+            //The font can be rebuilt in place when resources are refreshed.
+            if (m_cachedFontBuildVersion != m_font->GetBuildVersion())
+            {
+                m_cachedFontBuildVersion = m_font->GetBuildVersion();
+                m_invalidateCache = true;
+            }
+            
             if (m_invalidateCache == true)
             {
                 m_invalidateCache = false;
-                m_cachedText = in_renderer->BuildText(m_text, m_font, in_absSize, m_textProperties);
+                m_cachedText = in_renderer->GetBuiltText(m_text, m_font, in_absSize, m_textProperties);
             }
         
-            in_renderer->DrawText(m_cachedText.m_characters, in_transform, m_textColour, m_font->GetTexture());
+            in_renderer->DrawText(m_cachedText->m_characters, in_transform, m_textColour, m_font->GetTexture());
         }
     }
 }
\ No newline at end of file
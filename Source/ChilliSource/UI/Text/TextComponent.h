@@ -367,7 +367,8 @@ namespace ChilliSource
             
             bool m_invalidateCache = true;
             Core::Vector2 m_cachedSize;
-            Rendering::CanvasRenderer::BuiltText m_cachedText;
+            u32 m_cachedFontBuildVersion = 0;
+            Rendering::CanvasRenderer::BuiltTextCSPtr m_cachedText;
         };
     }
 }
@@ -0,0 +1,131 @@
+#!/usr/bin/python
+#
+#  compare_benchmark_results.py
+#  Chilli Source
+#  Created by Jordan Brown on 18/10/2026.
+#
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2026 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#
+
+import sys
+import re
+
+#----------------------------------------------------------------------
+# Compares the results written by CSBenchmark with a baseline set of
+# results, and fails if the median frame time of any benchmark has
+# regressed by more than the given tolerance. This allows the
+# benchmarks to be used to catch CPU regressions in CI.
+#
+# @author Jordan Brown
+#----------------------------------------------------------------------
+
+RESULT_PATTERN = re.compile(r"^(.+): mean ([0-9.]+)ms, p50 ([0-9.]+)ms, p95 ([0-9.]+)ms, p99 ([0-9.]+)ms, max ([0-9.]+)ms")
+
+#----------------------------------------------------------------------
+# Reads the results of each benchmark from a results file.
+#
+# @author Jordan Brown
+#
+# @param The results file path.
+#
+# @return A dictionary of benchmark name to median frame time in
+# milliseconds.
+#----------------------------------------------------------------------
+def read_results(file_path):
+    results = {}
+    with open(file_path, "r") as results_file:
+        for line in results_file:
+            match = RESULT_PATTERN.match(line.strip())
+            if match:
+                results[match.group(1)] = float(match.group(3))
+    return results
+
+#----------------------------------------------------------------------
+# Compares the results with the baseline, printing the change of each
+# benchmark.
+#
+# @author Jordan Brown
+#
+# @param The results.
+# @param The baseline results.
+# @param The fraction the median frame time can increase by before it
+# counts as a regression.
+#
+# @return Whether or not any benchmark regressed or was missing.
+#----------------------------------------------------------------------
+def compare_results(results, baseline, tolerance):
+    failed = False
+    for name in sorted(baseline.keys()):
+        if name not in results:
+            print("MISSING: " + name)
+            failed = True
+            continue
+
+        baseline_time = baseline[name]
+        time = results[name]
+        change = (time - baseline_time) / baseline_time if baseline_time > 0.0 else 0.0
+
+        status = "ok"
+        if change > tolerance:
+            status = "REGRESSED"
+            failed = True
+
+        print("%s: p50 %.3fms -> %.3fms (%+.1f%%) %s" % (name, baseline_time, time, change * 100.0, status))
+
+    for name in sorted(results.keys()):
+        if name not in baseline:
+            print("NEW: %s: p50 %.3fms" % (name, results[name]))
+
+    return failed
+
+#----------------------------------------------------------------------
+# The entry point into the script. The tolerance is optional and
+# defaults to 10%.
+#
+# @author Jordan Brown
+#
+# @param The list of arguments.
+#----------------------------------------------------------------------
+def main(args):
+    if len(args) != 3 and len(args) != 4:
+        print("ERROR: Missing results path or baseline path")
+        return 2
+
+    results = read_results(args[1])
+    baseline = read_results(args[2])
+
+    tolerance = 0.1
+    if len(args) == 4:
+        tolerance = float(args[3]) / 100.0
+
+    if len(baseline) == 0:
+        print("ERROR: No results found in baseline " + args[2])
+        return 2
+
+    if compare_results(results, baseline, tolerance):
+        return 1
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
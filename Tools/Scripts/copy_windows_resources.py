@@ -77,14 +77,15 @@ def copy_file_tree(src_path, dst_path):
 #
 # @param Project directory path
 # @param Target directory path
+# @param Chilli Source directory path
 #----------------------------------------------------------------------
-def copy_resources(project_dir, target_dir):
+def copy_resources(project_dir, target_dir, cs_dir):
     assetsDir = os.path.join(target_dir, "assets")
 
     file_system_utils.delete_directory(assetsDir)
 
     app_src_path = os.path.join(project_dir, "..", "..", "Content", "AppResources")
-    cs_src_path = os.path.join(project_dir, "..", "..", "ChilliSource", "CSResources")
+    cs_src_path = os.path.join(cs_dir, "CSResources")
 
     app_dst_path = os.path.join(assetsDir, "AppResources")
     cs_dst_path = os.path.join(assetsDir, "CSResources")
@@ -97,11 +98,11 @@ def copy_resources(project_dir, target_dir):
 #
 # @author S Downie
 #
-# @param Project directory path
+# @param Chilli Source directory path
 # @param Target directory path
 #----------------------------------------------------------------------
-def copy_libs(project_dir, target_dir):
-    libs_src_path = os.path.join(project_dir, "..", "..", "ChilliSource", "Libraries", "Core", "Windows", "Libs")
+def copy_libs(cs_dir, target_dir):
+    libs_src_path = os.path.join(cs_dir, "Libraries", "Core", "Windows", "Libs")
     dll_files = file_system_utils.get_file_paths_with_extensions(libs_src_path, ["dll"])
 
     for dll_file in dll_files:
@@ -112,36 +113,42 @@ def copy_libs(project_dir, target_dir):
 #
 # @author S Downie
 #
-# @param Project directory path
+# @param Chilli Source directory path
 # @param Target directory path
 #----------------------------------------------------------------------
-def premultiply_pngs(project_dir, target_dir):
+def premultiply_pngs(cs_dir, target_dir):
     assetsDir = os.path.join(target_dir, "assets")
 
-    jarFile = os.path.join(project_dir, "..", "..", "ChilliSource", "Tools", "PNGAlphaPremultiplier.jar")
+    jarFile = os.path.join(cs_dir, "Tools", "PNGAlphaPremultiplier.jar")
     png_files = file_system_utils.get_file_paths_with_extensions(assetsDir, ["png"])
 
     for png_file in png_files:
         subprocess.call(["java", "-Djava.awt.headless=true", "-Xmx512m", "-jar", jarFile, "--input", png_file, "--output", png_file]);
 
 #----------------------------------------------------------------------
-# The entry point into the script.
+# The entry point into the script. The Chilli Source directory is
+# optional and defaults to the ChilliSource directory of the project.
 #
 # @author S Downie
 #
 # @param The list of arguments.
 #----------------------------------------------------------------------
 def main(args):
-    if not len(args) is 3:
+    if not len(args) is 3 and not len(args) is 4:
         print("ERROR: Missing project path or target path")
         return
 
     project_dir = args[1]
     target_dir = args[2]
 
-    copy_resources(project_dir, target_dir)
-    copy_libs(project_dir, target_dir)
-    premultiply_pngs(project_dir, target_dir)
+    if len(args) is 4:
+        cs_dir = args[3]
+    else:
+        cs_dir = os.path.join(project_dir, "..", "..", "ChilliSource")
+
+    copy_resources(project_dir, target_dir, cs_dir)
+    copy_libs(cs_dir, target_dir)
+    premultiply_pngs(cs_dir, target_dir)
 
 if __name__ == "__main__":
     main(sys.argv)